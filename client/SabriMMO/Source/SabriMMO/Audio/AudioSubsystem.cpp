@@ -16,9 +16,87 @@
 #include "MMOGameInstance.h"
 #include "SocketEventRouter.h"
 #include "UI/EnemySubsystem.h"
+#include "UI/EntityRegistrySubsystem.h"
+#include "UI/PlayerInputSubsystem.h"
+#include "UI/PartySubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/AssetManager.h"
+#include "GameFramework/WorldSettings.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/PackageName.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogMMOAudio, Log, All);
 
+static TAutoConsoleVariable<int32> CVarAudioMaxVoices(
+	TEXT("Audio.MaxVoices"),
+	24,
+	TEXT("Positional SFX voices playing at once. When full, a new sound takes the voice of a\n")
+	TEXT("lower-priority one (local > target > party > other) or is dropped."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarAudioShowVoices(
+	TEXT("Audio.ShowVoices"),
+	0,
+	TEXT("1 = on-screen readout of active / culled / coalesced / dropped SFX voices."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarAudioAsyncLoad(
+	TEXT("Audio.AsyncLoad"),
+	1,
+	TEXT("1 = stream sound assets in the background; a sound not yet loaded starts late or is skipped (default).\n")
+	TEXT("0 = load on first play, blocking the game thread."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarAudioLateStartMs(
+	TEXT("Audio.LateStartMs"),
+	250,
+	TEXT("A sound that had to stream in still plays if it arrived within this many ms of being requested."),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorldAndArgs GAudioSoundReportCmd(
+	TEXT("Audio.SoundReport"),
+	TEXT("Print resident / loading sounds, their memory, and preload coverage for this zone."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UAudioSubsystem* Audio = World ? World->GetSubsystem<UAudioSubsystem>() : nullptr)
+		{
+			Audio->LogSoundMemoryReport(TEXT("requested"));
+		}
+	}));
+
+static FAutoConsoleCommandWithWorldAndArgs GAudioVoiceStatsCmd(
+	TEXT("Audio.VoiceStats"),
+	TEXT("Print SFX voice pool usage and culled / coalesced / dropped counts."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UAudioSubsystem* Audio = World ? World->GetSubsystem<UAudioSubsystem>() : nullptr)
+		{
+			Audio->LogVoiceStats();
+		}
+	}));
+
+namespace
+{
+	// A sound within this distance of an anchor (local pawn, target, party member) is theirs.
+	// Combat sounds play at the entity's actor location, so this only needs to absorb offsets.
+	constexpr float PriorityAnchorRadius = 150.f;
+
+	constexpr uint64 VoiceReadoutKey = 0x5AB41D10;
+
+	// Sound paths are package paths ("/Game/.../poring_attack"); streaming wants the object
+	FSoftObjectPath ToSoundObjectPath(const FString& AssetPath)
+	{
+		return FSoftObjectPath(AssetPath.Contains(TEXT("."))
+			? AssetPath
+			: AssetPath + TEXT(".") + FPackageName::GetShortName(AssetPath));
+	}
+
+	double ToMB(int64 Bytes)
+	{
+		return Bytes / (1024.0 * 1024.0);
+	}
+}
+
 // ============================================================
 // Lifecycle
 // ============================================================
@@ -244,20 +322,19 @@ void UAudioSubsystem::OnWorldBeginPlay(UWorld& InWorld)
 	}
 
 	// ---- Concurrency limits per event type ----
-	// Caps prevent audio chaos when many entities are active. Lifetime is the
-	// duration each play counts toward the cap (approx avg sound length).
-	auto AddCap = [this](EMonsterSoundType Type, int32 Max, double Lifetime)
+	// Caps (voices of that type actually playing) keep one kind of sound from taking
+	// the whole voice budget when many entities are active.
+	auto AddCap = [this](EMonsterSoundType Type, int32 Max)
 	{
 		FConcurrencyState State;
 		State.MaxConcurrent = Max;
-		State.Lifetime = Lifetime;
 		ConcurrencyTracking.Add(Type, State);
 	};
-	AddCap(EMonsterSoundType::Attack, 8, 1.5);
-	AddCap(EMonsterSoundType::Damage, 8, 1.0);
-	AddCap(EMonsterSoundType::Die,    6, 2.5);
-	AddCap(EMonsterSoundType::Move,   6, 0.6);
-	AddCap(EMonsterSoundType::Stand,  4, 2.0);
+	AddCap(EMonsterSoundType::Attack, 8);
+	AddCap(EMonsterSoundType::Damage, 8);
+	AddCap(EMonsterSoundType::Die,    6);
+	AddCap(EMonsterSoundType::Move,   6);
+	AddCap(EMonsterSoundType::Stand,  4);
 
 	// ---- Player sound maps (per-class swing/hit + body materials + singletons) ----
 	// Map KEYS use the server's job class strings ("swordsman", "mage", etc. — see
@@ -1163,6 +1240,19 @@ void UAudioSubsystem::Deinitialize()
 		FocusLostHandle.Reset();
 	}
 
+	// Zone exit: everything this world streamed in goes with it
+	LogSoundMemoryReport(TEXT("zone exit"));
+	for (auto& Pair : SoundLoads)
+	{
+		if (Pair.Value.Handle.IsValid())
+		{
+			Pair.Value.Handle->CancelHandle();
+		}
+	}
+	SoundLoads.Empty();
+	PreloadedMonsterClasses.Empty();
+	PreloadedSkills.Empty();
+	NumPreloadsInFlight = 0;
 	SoundCache.Empty();
 	MonsterSoundMap.Empty();
 	StatusSoundMap.Empty();
@@ -1179,6 +1269,16 @@ void UAudioSubsystem::Deinitialize()
 	SkillImpactSoundMap.Empty();
 	RecentSkillImpactPlayTime.Empty();
 	ConcurrencyTracking.Empty();
+	for (UAudioComponent* AC : VoiceComponents)
+	{
+		if (AC)
+		{
+			AC->Stop();
+			AC->DestroyComponent();
+		}
+	}
+	VoiceComponents.Empty();
+	Voices.Empty();
 	MonsterAttenuation = nullptr;
 	UIClickSoundPath.Empty();
 	UICancelSoundPath.Empty();
@@ -1271,24 +1371,8 @@ void UAudioSubsystem::PlayStatusSound(const FString& StatusType, const FVector&
 		PathPtr = StatusSoundMap.Find(StatusType.ToLower());
 	if (!PathPtr) return;
 
-	USoundBase* Sound = LoadSoundCached(*PathPtr);
-	if (!Sound) return;
-
-	UWorld* World = GetWorld();
-	if (!World) return;
-
-	// Status sounds bypass concurrency caps — they're rare and important.
-	UGameplayStatics::PlaySoundAtLocation(
-		World,
-		Sound,
-		Location,
-		GetEffectiveSfxVolume(),    // SFX bus baked in
-		1.0f,
-		0.0f,
-		MonsterAttenuation,
-		nullptr,
-		nullptr
-	);
+	// Status sounds bypass the per-type caps — they're rare and important.
+	PlayUncappedSound(*PathPtr, Location);
 }
 
 // ============================================================
@@ -1332,32 +1416,15 @@ void UAudioSubsystem::PlayLevelUpSound()
 {
 	if (LevelUpSoundPath.IsEmpty()) return;
 
-	USoundBase* Sound = LoadSoundCached(LevelUpSoundPath);
-	if (!Sound) return;
-
-	UWorld* World = GetWorld();
-	if (!World) return;
-
 	// 2D non-spatial — local player only. The caller filters for the local player
 	// (BasicInfoSubsystem::HandleExpLevelUp already does this).
-	UGameplayStatics::PlaySound2D(World, Sound, GetEffectiveSfxVolume(), 1.0f, 0.0f);
+	PlaySound2DInternal(LevelUpSoundPath, 1.0f);
 }
 
 void UAudioSubsystem::PlayHealSound(const FVector& Location)
 {
 	if (HealSoundPath.IsEmpty()) return;
-
-	USoundBase* Sound = LoadSoundCached(HealSoundPath);
-	if (!Sound) return;
-
-	UWorld* World = GetWorld();
-	if (!World) return;
-
-	UGameplayStatics::PlaySoundAtLocation(
-		World, Sound, Location,
-		GetEffectiveSfxVolume(), 1.0f, 0.0f,
-		MonsterAttenuation, nullptr, nullptr
-	);
+	PlayUncappedSound(HealSoundPath, Location);
 }
 
 // ============================================================
@@ -1435,18 +1502,8 @@ void UAudioSubsystem::PlayItemDropSound(const FString& TierColor, const FVector&
 	}
 	if (!PathPtr || PathPtr->IsEmpty()) return;
 
-	USoundBase* Sound = LoadSoundCached(*PathPtr);
-	if (!Sound) return;
-
-	UWorld* World = GetWorld();
-	if (!World) return;
-
-	// 3D positional, no concurrency cap (drops are infrequent + clustered)
-	UGameplayStatics::PlaySoundAtLocation(
-		World, Sound, Location,
-		GetEffectiveSfxVolume(), 1.0f, 0.0f,
-		MonsterAttenuation, nullptr, nullptr
-	);
+	// 3D positional, no per-type cap (drops are infrequent + clustered)
+	PlayUncappedSound(*PathPtr, Location);
 }
 
 void UAudioSubsystem::PlayCoinPickupSound()
@@ -1488,29 +1545,13 @@ void UAudioSubsystem::PlayMvpFanfareSound()
 void UAudioSubsystem::PlayWarpPortalSound(const FVector& Location)
 {
 	if (WarpPortalSoundPath.IsEmpty()) return;
-	USoundBase* Sound = LoadSoundCached(WarpPortalSoundPath);
-	if (!Sound) return;
-	UWorld* World = GetWorld();
-	if (!World) return;
-	UGameplayStatics::PlaySoundAtLocation(
-		World, Sound, Location,
-		GetEffectiveSfxVolume(), 1.0f, 0.0f,
-		MonsterAttenuation, nullptr, nullptr
-	);
+	PlayUncappedSound(WarpPortalSoundPath, Location);
 }
 
 void UAudioSubsystem::PlayTeleportSound(const FVector& Location)
 {
 	if (TeleportSoundPath.IsEmpty()) return;
-	USoundBase* Sound = LoadSoundCached(TeleportSoundPath);
-	if (!Sound) return;
-	UWorld* World = GetWorld();
-	if (!World) return;
-	UGameplayStatics::PlaySoundAtLocation(
-		World, Sound, Location,
-		GetEffectiveSfxVolume(), 1.0f, 0.0f,
-		MonsterAttenuation, nullptr, nullptr
-	);
+	PlayUncappedSound(TeleportSoundPath, Location);
 }
 
 // ============================================================
@@ -1573,6 +1614,11 @@ void UAudioSubsystem::PlayZoneAmbient(const FString& ZoneName)
 	UWorld* World = GetWorld();
 	if (!World) return;
 
+	// Set up front: layers spawn as their sounds stream in, and only while this is still the zone
+	EvictZoneSounds(ZoneName);
+	CurrentAmbientZone = ZoneName;
+	auto IsStillZone = [this, ZoneName]() { return CurrentAmbientZone.Equals(ZoneName, ESearchCase::IgnoreCase); };
+
 	// ---- 2D ambient layers ----
 	const TArray<FString>* Layers = ZoneAmbientMap.Find(ZoneName);
 	if (!Layers)
@@ -1580,34 +1626,19 @@ void UAudioSubsystem::PlayZoneAmbient(const FString& ZoneName)
 		Layers = ZoneAmbientMap.Find(ZoneName.ToLower());
 	}
 	int32 LayerCount = 0;
-	const float AmbVol = GetEffectiveAmbientVolume();
 	if (Layers && Layers->Num() > 0)
 	{
 		for (const FString& Path : *Layers)
 		{
-			USoundBase* Sound = LoadSoundCached(Path);
-			if (!Sound) continue;
-
-			if (USoundWave* Wave = Cast<USoundWave>(Sound))
+			RequestSound(Path, ESoundScope::Zone, true, [this, Path, IsStillZone](USoundBase* Sound)
 			{
-				Wave->bLooping = true;
-			}
-
-			// Spawn at the current effective ambient volume. We keep the component
-			// alive in ActiveAmbientComponents so ApplyVolumeToActiveComponents can
-			// update its volume live when the slider moves.
-			UAudioComponent* AC = UGameplayStatics::SpawnSound2D(
-				World, Sound,
-				AmbVol, 1.0f, 0.0f,
-				nullptr, true, false
-			);
-			if (AC)
-			{
-				AC->bIsUISound = true;
-				AC->bAllowSpatialization = false;
-				ActiveAmbientComponents.Add(AC);
-				++LayerCount;
-			}
+				if (Sound && IsStillZone())
+				{
+					SpawnAmbientLayer(Sound);
+					MarkSoundPlayed(Path);
+				}
+			});
+			++LayerCount;
 		}
 	}
 
@@ -1622,37 +1653,76 @@ void UAudioSubsystem::PlayZoneAmbient(const FString& ZoneName)
 	{
 		for (const FAmbientPoint& Point : *Points)
 		{
-			USoundBase* Sound = LoadSoundCached(Point.SoundPath);
-			if (!Sound) continue;
-
-			if (USoundWave* Wave = Cast<USoundWave>(Sound))
-			{
-				Wave->bLooping = true;
-			}
-
-			// 3D ambient also uses the ambient bus volume. The 0.6 multiplier is the
-			// per-source design balance (e.g. fountains shouldn't dominate the bed).
-			UAudioComponent* AC = UGameplayStatics::SpawnSoundAtLocation(
-				World, Sound, Point.Location,
-				FRotator::ZeroRotator,
-				AmbVol * 0.6f, 1.0f, 0.0f,
-				AmbientAttenuation,
-				nullptr, false  // bAutoDestroy=false
-			);
-			if (AC)
+			const FString Path = Point.SoundPath;
+			const FVector Location = Point.Location;
+			RequestSound(Path, ESoundScope::Zone, true, [this, Path, Location, IsStillZone](USoundBase* Sound)
 			{
-				AC->bAllowSpatialization = true;
-				Active3DAmbientComponents.Add(AC);
-				++PointCount;
-			}
+				if (Sound && IsStillZone())
+				{
+					SpawnAmbientPoint(Sound, Location);
+					MarkSoundPlayed(Path);
+				}
+			});
+			++PointCount;
 		}
 	}
 
-	CurrentAmbientZone = ZoneName;
 	UE_LOG(LogMMOAudio, Log, TEXT("Zone ambient started for %s (%d 2D layers, %d 3D points)"),
 		*ZoneName, LayerCount, PointCount);
 }
 
+void UAudioSubsystem::SpawnAmbientLayer(USoundBase* Sound)
+{
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	if (USoundWave* Wave = Cast<USoundWave>(Sound))
+	{
+		Wave->bLooping = true;
+	}
+
+	// Spawn at the current effective ambient volume. We keep the component
+	// alive in ActiveAmbientComponents so ApplyVolumeToActiveComponents can
+	// update its volume live when the slider moves.
+	UAudioComponent* AC = UGameplayStatics::SpawnSound2D(
+		World, Sound,
+		GetEffectiveAmbientVolume(), 1.0f, 0.0f,
+		nullptr, true, false
+	);
+	if (AC)
+	{
+		AC->bIsUISound = true;
+		AC->bAllowSpatialization = false;
+		ActiveAmbientComponents.Add(AC);
+	}
+}
+
+void UAudioSubsystem::SpawnAmbientPoint(USoundBase* Sound, const FVector& Location)
+{
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	if (USoundWave* Wave = Cast<USoundWave>(Sound))
+	{
+		Wave->bLooping = true;
+	}
+
+	// 3D ambient also uses the ambient bus volume. The 0.6 multiplier is the
+	// per-source design balance (e.g. fountains shouldn't dominate the bed).
+	UAudioComponent* AC = UGameplayStatics::SpawnSoundAtLocation(
+		World, Sound, Location,
+		FRotator::ZeroRotator,
+		GetEffectiveAmbientVolume() * 0.6f, 1.0f, 0.0f,
+		AmbientAttenuation,
+		nullptr, false  // bAutoDestroy=false
+	);
+	if (AC)
+	{
+		AC->bAllowSpatialization = true;
+		Active3DAmbientComponents.Add(AC);
+	}
+}
+
 void UAudioSubsystem::StopAllAmbient()
 {
 	for (const TObjectPtr<UAudioComponent>& AC : ActiveAmbientComponents)
@@ -1720,11 +1790,34 @@ void UAudioSubsystem::PlayBgm(const FString& AssetPath)
 		return;
 	}
 
-	USoundBase* Sound = LoadSoundCached(AssetPath);
-	if (!Sound)
+	// Streams in; starts when it lands unless another track was asked for meanwhile.
+	// Asked for again while still loading (A, B, A): the first request starts it.
+	CurrentBgmPath = AssetPath;
+	if (PendingBgmPaths.Contains(AssetPath)) return;
+
+	PendingBgmPaths.Add(AssetPath);
+	RequestSound(AssetPath, ESoundScope::Session, false, [this, AssetPath](USoundBase* Sound)
 	{
-		UE_LOG(LogMMOAudio, Warning, TEXT("BGM track not found: %s"), *AssetPath);
-		return;
+		PendingBgmPaths.Remove(AssetPath);
+		if (!AssetPath.Equals(CurrentBgmPath, ESearchCase::IgnoreCase)) return;
+		if (!Sound)
+		{
+			UE_LOG(LogMMOAudio, Warning, TEXT("BGM track not found: %s"), *AssetPath);
+			CurrentBgmPath.Empty();
+			return;
+		}
+		StartBgm(Sound);
+		MarkSoundPlayed(AssetPath);
+	});
+}
+
+void UAudioSubsystem::StartBgm(USoundBase* Sound)
+{
+	// Never leave a looping track orphaned
+	if (ActiveBgmComponent)
+	{
+		ActiveBgmComponent->FadeOut(1.5f, 0.0f);
+		ActiveBgmComponent = nullptr;
 	}
 
 	// Force loop on the underlying SoundWave (BGM tracks should loop indefinitely)
@@ -1756,8 +1849,7 @@ void UAudioSubsystem::PlayBgm(const FString& AssetPath)
 		ActiveBgmComponent = AC;
 	}
 
-	CurrentBgmPath = AssetPath;
-	UE_LOG(LogMMOAudio, Log, TEXT("BGM started: %s"), *AssetPath);
+	UE_LOG(LogMMOAudio, Log, TEXT("BGM started: %s"), *CurrentBgmPath);
 }
 
 void UAudioSubsystem::StopBgm()
@@ -2190,73 +2282,263 @@ const FMonsterSoundConfig* UAudioSubsystem::ResolveConfig(const FString& SpriteC
 	return nullptr;
 }
 
-USoundBase* UAudioSubsystem::LoadSoundCached(const FString& AssetPath)
+// ============================================================
+// Sound streaming
+// ============================================================
+
+USoundBase* UAudioSubsystem::FindLoadedSound(const FString& AssetPath)
 {
 	if (AssetPath.IsEmpty()) return nullptr;
 
-	if (TObjectPtr<USoundBase>* Cached = SoundCache.Find(AssetPath))
+	if (const TObjectPtr<USoundBase>* Cached = SoundCache.Find(AssetPath))
 	{
 		if (Cached->Get()) return Cached->Get();
 	}
 
-	USoundBase* Loaded = LoadObject<USoundBase>(nullptr, *AssetPath);
-	if (Loaded)
+	// Already in memory without us asking (another system loaded it): adopt it
+	const FSoundLoad* Pending = SoundLoads.Find(AssetPath);
+	if (Pending && Pending->bLoading) return nullptr;
+
+	USoundBase* InMemory = Cast<USoundBase>(ToSoundObjectPath(AssetPath).ResolveObject());
+	if (!InMemory || InMemory->HasAnyFlags(RF_NeedLoad | RF_NeedPostLoad)) return nullptr;
+
+	SoundCache.Add(AssetPath, InMemory);
+	FSoundLoad& Load = SoundLoads.FindOrAdd(AssetPath);
+	Load.Bytes = InMemory->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+	Load.bFailed = false;
+	return InMemory;
+}
+
+void UAudioSubsystem::RequestSound(const FString& AssetPath, ESoundScope Scope, bool bPreload,
+                                   TFunction<void(USoundBase*)> OnLoaded)
+{
+	if (AssetPath.IsEmpty())
+	{
+		if (OnLoaded) OnLoaded(nullptr);
+		return;
+	}
+
+	if (USoundBase* Resident = FindLoadedSound(AssetPath))
+	{
+		SoundLoads.FindChecked(AssetPath).bPreloaded |= bPreload;
+		if (OnLoaded) OnLoaded(Resident);
+		return;
+	}
+
+	const bool bNew = !SoundLoads.Contains(AssetPath);
+	FSoundLoad& Load = SoundLoads.FindOrAdd(AssetPath);
+	if (bNew)
+	{
+		Load.Scope = Scope;
+	}
+	if (Load.bFailed)
+	{
+		if (OnLoaded) OnLoaded(nullptr);
+		return;
+	}
+	if (OnLoaded)
+	{
+		Load.Waiters.Add(MoveTemp(OnLoaded));
+	}
+	if (bPreload && !Load.bPreloaded)
+	{
+		Load.bPreloaded = true;
+		if (Load.bLoading) ++NumPreloadsInFlight;
+	}
+	if (Load.bLoading) return;
+
+	Load.bLoading = true;
+	if (Load.bPreloaded) ++NumPreloadsInFlight;
+
+	UAssetManager* AM = UAssetManager::GetIfInitialized();
+	if (!AM || CVarAudioAsyncLoad.GetValueOnGameThread() == 0)
 	{
-		SoundCache.Add(AssetPath, Loaded);
+		LoadObject<USoundBase>(nullptr, *AssetPath);
+		OnSoundLoaded(AssetPath);
+		return;
+	}
+
+	// Completes inline if the sound is already in memory — OnSoundLoaded handles both.
+	// Preloads queue behind sounds something is waiting to play.
+	TSharedPtr<FStreamableHandle> Handle = AM->GetStreamableManager().RequestAsyncLoad(
+		ToSoundObjectPath(AssetPath),
+		FStreamableDelegate::CreateUObject(this, &UAudioSubsystem::OnSoundLoaded, AssetPath),
+		bPreload ? FStreamableManager::DefaultAsyncLoadPriority : FStreamableManager::AsyncLoadHighPriority,
+		false /* bManageActiveHandle */,
+		false /* bStartStalled */,
+		TEXT("AudioSubsystem"));
+
+	// Re-find: an inline completion runs waiters, which may add entries
+	FSoundLoad* Pending = SoundLoads.Find(AssetPath);
+	if (Pending && Pending->bLoading)
+	{
+		Pending->Handle = Handle;
 	}
-	return Loaded;
 }
 
-bool UAudioSubsystem::PlaySoundInternal(const FString& AssetPath, const FVector& Location, EMonsterSoundType Type)
+void UAudioSubsystem::OnSoundLoaded(FString AssetPath)
 {
-	if (!TryReserveConcurrencySlot(Type))
+	FSoundLoad* Load = SoundLoads.Find(AssetPath);
+	if (!Load || !Load->bLoading) return;   // evicted while it was streaming
+
+	Load->bLoading = false;
+	Load->Handle.Reset();
+	if (Load->bPreloaded)
 	{
-		// Cap reached — drop this play silently. Logged at Verbose to keep production logs clean.
-		UE_LOG(LogMMOAudio, Verbose, TEXT("Concurrency cap reached for type %d — dropping %s"),
-			(int32)Type, *AssetPath);
-		return false;
+		NumPreloadsInFlight = FMath::Max(0, NumPreloadsInFlight - 1);
 	}
 
-	USoundBase* Sound = LoadSoundCached(AssetPath);
-	if (!Sound)
+	USoundBase* Sound = Cast<USoundBase>(ToSoundObjectPath(AssetPath).ResolveObject());
+	if (Sound)
+	{
+		SoundCache.Add(AssetPath, Sound);
+		Load->Bytes = Sound->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+	}
+	else
 	{
 		UE_LOG(LogMMOAudio, Warning, TEXT("Failed to load sound: %s"), *AssetPath);
-		return false;
+		Load->bFailed = true;
 	}
 
-	// Defensive: if a previous code path or older build set SoundClassObject, clear
-	// it so the audio device doesn't try to look up properties for an unregistered
-	// runtime UObject and spam "Unable to find sound class properties" warnings.
-	Sound->SoundClassObject = nullptr;
+	// Waiters may play (and so request) sounds — run them off a copy
+	TArray<TFunction<void(USoundBase*)>, TInlineAllocator<1>> Waiters = MoveTemp(Load->Waiters);
+	for (TFunction<void(USoundBase*)>& Waiter : Waiters)
+	{
+		Waiter(Sound);
+	}
+}
 
-	UWorld* World = GetWorld();
-	if (!World) return false;
+void UAudioSubsystem::MarkSoundPlayed(const FString& AssetPath)
+{
+	if (FSoundLoad* Load = SoundLoads.Find(AssetPath))
+	{
+		Load->bPlayed = true;
+	}
+}
 
-	// Bake the effective SFX volume into VolumeMultiplier — this REPLACES the old
-	// USoundClass routing. Slider changes affect future plays only (one-shots are
-	// short, no live update needed).
-	const float Vol = GetEffectiveSfxVolume();
-	UGameplayStatics::PlaySoundAtLocation(
-		World,
-		Sound,
-		Location,
-		Vol,                        // VolumeMultiplier (bus×master×mute baked in)
-		1.0f,                       // PitchMultiplier
-		0.0f,                       // StartTime
-		MonsterAttenuation,         // Attenuation override
-		nullptr,                    // Concurrency override
-		nullptr                     // Owning actor
-	);
-	return true;
+bool UAudioSubsystem::IsLateStartAllowed(double RequestTime) const
+{
+	return (FPlatformTime::Seconds() - RequestTime) * 1000.0 <= CVarAudioLateStartMs.GetValueOnGameThread();
+}
+
+void UAudioSubsystem::PreloadMonsterSounds(const FString& SpriteClass)
+{
+	if (SpriteClass.IsEmpty()) return;
+
+	bool bAlreadyRequested = false;
+	PreloadedMonsterClasses.Add(SpriteClass, &bAlreadyRequested);
+	if (bAlreadyRequested) return;
+
+	const FMonsterSoundConfig* Config = ResolveConfig(SpriteClass);
+	if (!Config) return;   // player classes, monsters without a sound set
+
+	for (const TArray<FString>* Paths : { &Config->AttackPaths, &Config->DamagePaths, &Config->DiePaths,
+	                                      &Config->MovePaths, &Config->StandPaths })
+	{
+		for (const FString& Path : *Paths)
+		{
+			RequestSound(Path, ESoundScope::Zone, true);
+		}
+	}
+	RequestSound(Config->BodyMaterialPath, ESoundScope::Zone, true);
+}
+
+void UAudioSubsystem::PreloadSkillSounds(TConstArrayView<int32> SkillIds)
+{
+	int32 NumNew = 0;
+	for (int32 SkillId : SkillIds)
+	{
+		bool bAlreadyRequested = false;
+		PreloadedSkills.Add(SkillId, &bAlreadyRequested);
+		if (bAlreadyRequested) continue;
+		++NumNew;
+
+		if (const FString* CastPath = SkillCastSoundMap.Find(SkillId))
+		{
+			RequestSound(*CastPath, ESoundScope::Session, true);
+		}
+		if (const FString* ImpactPath = SkillImpactSoundMap.Find(SkillId))
+		{
+			RequestSound(*ImpactPath, ESoundScope::Session, true);
+		}
+	}
+
+	// Every skill without its own cast sound falls back to this one
+	if (NumNew > 0)
+	{
+		RequestSound(DefaultSkillCastSoundPath, ESoundScope::Session, true);
+	}
+}
+
+void UAudioSubsystem::EvictZoneSounds(const FString& NewZone)
+{
+	// First zone of this world: whatever was preloaded so far (monster spawns can beat the
+	// ambient start) already belongs to it
+	if (SoundZone.IsEmpty() || SoundZone.Equals(NewZone, ESearchCase::IgnoreCase))
+	{
+		SoundZone = NewZone;
+		return;
+	}
+
+	LogSoundMemoryReport(TEXT("zone change"));
+
+	int32 NumEvicted = 0;
+	int64 EvictedBytes = 0;
+	for (auto It = SoundLoads.CreateIterator(); It; ++It)
+	{
+		FSoundLoad& Load = It.Value();
+		if (Load.Scope != ESoundScope::Zone) continue;
+
+		if (Load.bLoading)
+		{
+			if (Load.Handle.IsValid()) Load.Handle->CancelHandle();
+			if (Load.bPreloaded) NumPreloadsInFlight = FMath::Max(0, NumPreloadsInFlight - 1);
+		}
+		++NumEvicted;
+		EvictedBytes += Load.Bytes;
+		SoundCache.Remove(It.Key());
+		It.RemoveCurrent();
+	}
+	PreloadedMonsterClasses.Empty();
+
+	UE_LOG(LogMMOAudio, Log, TEXT("Released %d zone sounds of %s (%.1f MB)"), NumEvicted, *SoundZone, ToMB(EvictedBytes));
+	SoundZone = NewZone;
+}
+
+bool UAudioSubsystem::PlaySoundInternal(const FString& AssetPath, const FVector& Location, EMonsterSoundType Type)
+{
+	return PlayVoice(AssetPath, nullptr, Location, static_cast<int32>(Type), 1.0f);
+}
+
+bool UAudioSubsystem::PlayUncappedSound(const FString& AssetPath, const FVector& Location)
+{
+	return PlayVoice(AssetPath, nullptr, Location, INDEX_NONE, 1.0f);
+}
+
+bool UAudioSubsystem::PlayCombatSound(USoundBase* Sound, const FVector& Location, EMonsterSoundType Type, float Pitch)
+{
+	return Sound && PlayVoice(FString(), Sound, Location, static_cast<int32>(Type), Pitch);
 }
 
 void UAudioSubsystem::PlaySound2DInternal(const FString& AssetPath, float VolumeMultiplier)
 {
 	if (AssetPath.IsEmpty()) return;
-	USoundBase* Sound = LoadSoundCached(AssetPath);
+	USoundBase* Sound = FindLoadedSound(AssetPath);
 	if (!Sound)
 	{
-		UE_LOG(LogMMOAudio, Warning, TEXT("Failed to load 2D sound: %s"), *AssetPath);
+		// Not resident yet: play it when it lands if that is soon enough to still match the click
+		const double RequestTime = FPlatformTime::Seconds();
+		RequestSound(AssetPath, ESoundScope::Session, false, [this, AssetPath, VolumeMultiplier, RequestTime](USoundBase* Loaded)
+		{
+			if (!Loaded) return;
+			if (!IsLateStartAllowed(RequestTime))
+			{
+				++NumSkippedLoads;
+				return;
+			}
+			++NumLateStarts;
+			PlaySound2DInternal(AssetPath, VolumeMultiplier);
+		});
 		return;
 	}
 
@@ -2268,29 +2550,7 @@ void UAudioSubsystem::PlaySound2DInternal(const FString& AssetPath, float Volume
 	// 2D non-spatial — no concurrency cap (UI/event sounds are infrequent and important).
 	// Bake the effective SFX volume in (caller's VolumeMultiplier × bus×master×mute).
 	UGameplayStatics::PlaySound2D(World, Sound, VolumeMultiplier * GetEffectiveSfxVolume(), 1.0f, 0.0f);
-}
-
-bool UAudioSubsystem::TryReserveConcurrencySlot(EMonsterSoundType Type)
-{
-	FConcurrencyState* State = ConcurrencyTracking.Find(Type);
-	if (!State) return true; // No cap configured -> allow
-
-	UWorld* World = GetWorld();
-	const double Now = World ? World->GetTimeSeconds() : 0.0;
-
-	// Reap expired entries (older than Lifetime)
-	const double Cutoff = Now - State->Lifetime;
-	State->RecentPlayTimes.RemoveAll([Cutoff](double T) { return T < Cutoff; });
-
-	// Check cap
-	if (State->RecentPlayTimes.Num() >= State->MaxConcurrent)
-	{
-		return false;
-	}
-
-	// Reserve a slot
-	State->RecentPlayTimes.Add(Now);
-	return true;
+	MarkSoundPlayed(AssetPath);
 }
 
 const FString& UAudioSubsystem::GetPathForType(const FMonsterSoundConfig& Config, EMonsterSoundType Type) const
@@ -2313,3 +2573,345 @@ const FString& UAudioSubsystem::GetPathForType(const FMonsterSoundConfig& Config
 	if (Paths->Num() == 1)            return (*Paths)[0];
 	return (*Paths)[FMath::RandRange(0, Paths->Num() - 1)];
 }
+
+// ============================================================
+// Voice manager
+// ============================================================
+
+bool UAudioSubsystem::PlayVoice(const FString& AssetPath, USoundBase* Sound, const FVector& Location, int32 CapType, float Pitch)
+{
+	UWorld* World = GetWorld();
+	if (!World || (!Sound && AssetPath.IsEmpty())) return false;
+
+	RefreshPriorityAnchors();
+
+	// Out of earshot: nothing to hear, so don't load or spend a voice on it
+	if (Anchors.Listener.IsSet() && MonsterAttenuation)
+	{
+		const FSoundAttenuationSettings& A = MonsterAttenuation->Attenuation;
+		const float Audible = A.AttenuationShapeExtents.X + A.FalloffDistance;
+		if (FVector::DistSquared(*Anchors.Listener, Location) > FMath::Square(Audible))
+		{
+			++NumVoicesCulled;
+			UpdateVoiceReadout();
+			return true;
+		}
+	}
+
+	const ESfxPriority Priority = ClassifyPriority(Location);
+	const uint32 SoundKey = AssetPath.IsEmpty() ? PointerHash(Sound) : GetTypeHash(AssetPath);
+
+	// The same sound already started this frame (a volley of identical hits): one voice is
+	// enough. It moves to this location if this one matters more.
+	for (int32 i = 0; i < Voices.Num(); ++i)
+	{
+		FSfxVoice& Voice = Voices[i];
+		if (Voice.Frame != GFrameCounter || Voice.SoundKey != SoundKey || !IsVoiceActive(i)) continue;
+
+		if (Priority > Voice.Priority)
+		{
+			Voice.Priority = Priority;
+			VoiceComponents[i]->SetWorldLocation(Location);
+		}
+		++NumVoicesCoalesced;
+		UpdateVoiceReadout();
+		return true;
+	}
+
+	if (!Sound)
+	{
+		Sound = FindLoadedSound(AssetPath);
+		if (!Sound)
+		{
+			// Missed by the zone preload: stream it and start late if it lands in time.
+			// Nothing waits on the game thread.
+			const double RequestTime = FPlatformTime::Seconds();
+			RequestSound(AssetPath, ESoundScope::Session, false,
+				[this, AssetPath, Location, CapType, Pitch, RequestTime](USoundBase* Loaded)
+				{
+					if (!Loaded) return;
+					if (!IsLateStartAllowed(RequestTime))
+					{
+						++NumSkippedLoads;
+						return;
+					}
+					++NumLateStarts;
+					PlayVoice(AssetPath, Loaded, Location, CapType, Pitch);
+				});
+			return true;
+		}
+	}
+
+	const int32 Index = AcquireVoice(Priority, CapType);
+	if (Index == INDEX_NONE)
+	{
+		UE_LOG(LogMMOAudio, Verbose, TEXT("No voice for %s (priority %d, type %d) — dropped"),
+			Sound ? *Sound->GetName() : *AssetPath, (int32)Priority, CapType);
+		++NumVoicesDropped;
+		UpdateVoiceReadout();
+		return false;
+	}
+
+	// Defensive: if a previous code path or older build set SoundClassObject, clear
+	// it so the audio device doesn't try to look up properties for an unregistered
+	// runtime UObject and spam "Unable to find sound class properties" warnings.
+	Sound->SoundClassObject = nullptr;
+
+	UAudioComponent* AC = VoiceComponents[Index];
+	if (AC->IsPlaying())
+	{
+		++NumVoicesStolen;
+		AC->Stop();
+	}
+
+	FSfxVoice& Voice = Voices[Index];
+	Voice.StartTime = World->GetTimeSeconds();
+	Voice.Frame = GFrameCounter;
+	Voice.SoundKey = SoundKey;
+	Voice.CapType = CapType;
+	Voice.Priority = Priority;
+
+	// Bake the effective SFX volume into VolumeMultiplier — this REPLACES the old
+	// USoundClass routing. Slider changes affect future plays only (one-shots are
+	// short, no live update needed).
+	AC->SetSound(Sound);
+	AC->SetWorldLocation(Location);
+	AC->SetVolumeMultiplier(GetEffectiveSfxVolume());
+	AC->SetPitchMultiplier(Pitch);
+	AC->Play();
+	if (!AssetPath.IsEmpty())
+	{
+		MarkSoundPlayed(AssetPath);
+	}
+
+	++NumVoicesPlayed;
+	UpdateVoiceReadout();
+	return true;
+}
+
+int32 UAudioSubsystem::AcquireVoice(ESfxPriority Priority, int32 CapType)
+{
+	const int32 Budget = FMath::Max(1, CVarAudioMaxVoices.GetValueOnGameThread());
+	const FConcurrencyState* Cap = (CapType != INDEX_NONE)
+		? ConcurrencyTracking.Find(static_cast<EMonsterSoundType>(CapType)) : nullptr;
+
+	// Least important first: lower priority, then older
+	auto IsBetterVictim = [this](int32 Candidate, int32 Current)
+	{
+		if (Current == INDEX_NONE) return true;
+		const FSfxVoice& A = Voices[Candidate];
+		const FSfxVoice& B = Voices[Current];
+		return A.Priority != B.Priority ? A.Priority < B.Priority : A.StartTime < B.StartTime;
+	};
+
+	int32 Active = 0;
+	int32 ActiveOfType = 0;
+	int32 FirstFree = INDEX_NONE;
+	int32 Victim = INDEX_NONE;
+	int32 TypeVictim = INDEX_NONE;
+	for (int32 i = 0; i < Voices.Num(); ++i)
+	{
+		if (!IsVoiceActive(i))
+		{
+			if (FirstFree == INDEX_NONE && VoiceComponents[i]) FirstFree = i;
+			continue;
+		}
+		++Active;
+		const bool bOutranked = Voices[i].Priority < Priority;
+		if (bOutranked && IsBetterVictim(i, Victim)) Victim = i;
+		if (Voices[i].CapType == CapType)
+		{
+			++ActiveOfType;
+			if (bOutranked && IsBetterVictim(i, TypeVictim)) TypeVictim = i;
+		}
+	}
+
+	// This type is at its cap: only a less important sound of the same type can make room
+	if (Cap && ActiveOfType >= Cap->MaxConcurrent)
+	{
+		return TypeVictim;
+	}
+
+	if (Active < Budget)
+	{
+		if (FirstFree != INDEX_NONE) return FirstFree;
+		if (Voices.Num() < Budget)
+		{
+			if (UAudioComponent* AC = CreateVoiceComponent())
+			{
+				VoiceComponents.Add(AC);
+				return Voices.AddDefaulted();
+			}
+		}
+	}
+
+	return Victim;
+}
+
+bool UAudioSubsystem::IsVoiceActive(int32 Index) const
+{
+	const UAudioComponent* AC = VoiceComponents[Index];
+	return AC && AC->IsPlaying();
+}
+
+UAudioComponent* UAudioSubsystem::CreateVoiceComponent()
+{
+	UWorld* World = GetWorld();
+	AWorldSettings* Owner = World ? World->GetWorldSettings() : nullptr;
+	if (!Owner) return nullptr;
+
+	// Same setup PlaySoundAtLocation gives its throwaway components, minus bAutoDestroy
+	UAudioComponent* AC = NewObject<UAudioComponent>(Owner, NAME_None, RF_Transient);
+	AC->bAutoActivate = false;
+	AC->bAutoDestroy = false;
+	AC->bAllowSpatialization = true;
+	AC->AttenuationSettings = MonsterAttenuation;
+	AC->RegisterComponentWithWorld(World);
+	return AC;
+}
+
+void UAudioSubsystem::RefreshPriorityAnchors()
+{
+	if (Anchors.Frame == GFrameCounter) return;
+	Anchors.Frame = GFrameCounter;
+	Anchors.Listener.Reset();
+	Anchors.Local.Reset();
+	Anchors.Target.Reset();
+	Anchors.Party.Reset();
+
+	UWorld* World = GetWorld();
+	APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+	if (!PC) return;
+
+	FVector ListenerLoc, Front, Right;
+	PC->GetAudioListenerPosition(ListenerLoc, Front, Right);
+	Anchors.Listener = ListenerLoc;
+
+	if (const APawn* Pawn = PC->GetPawn())
+	{
+		Anchors.Local = Pawn->GetActorLocation();
+	}
+
+	UEntityRegistrySubsystem* Registry = World->GetSubsystem<UEntityRegistrySubsystem>();
+	if (!Registry) return;
+
+	if (const UPlayerInputSubsystem* Input = World->GetSubsystem<UPlayerInputSubsystem>())
+	{
+		if (Input->GetAttackTargetId() > 0)
+		{
+			const EEntityCategory Category = Input->IsAttackTargetEnemy() ? EEntityCategory::Enemy : EEntityCategory::Player;
+			if (const AActor* Target = Registry->Find(Category, Input->GetAttackTargetId()))
+			{
+				Anchors.Target = Target->GetActorLocation();
+			}
+		}
+	}
+
+	if (const UPartySubsystem* Party = World->GetSubsystem<UPartySubsystem>())
+	{
+		for (const FPartyMember& Member : Party->Members)
+		{
+			if (const AActor* Actor = Registry->Find(EEntityCategory::Player, Member.CharacterId))
+			{
+				Anchors.Party.Add(Actor->GetActorLocation());
+			}
+		}
+	}
+}
+
+ESfxPriority UAudioSubsystem::ClassifyPriority(const FVector& Location) const
+{
+	const float RadiusSq = FMath::Square(PriorityAnchorRadius);
+	auto Near = [&Location, RadiusSq](const FVector& Anchor) { return FVector::DistSquared(Anchor, Location) <= RadiusSq; };
+
+	if (Anchors.Local.IsSet() && Near(*Anchors.Local)) return ESfxPriority::Local;
+	if (Anchors.Target.IsSet() && Near(*Anchors.Target)) return ESfxPriority::Target;
+	for (const FVector& Member : Anchors.Party)
+	{
+		if (Near(Member)) return ESfxPriority::Party;
+	}
+	return ESfxPriority::Other;
+}
+
+// ============================================================
+// Voice metrics
+// ============================================================
+
+void UAudioSubsystem::LogVoiceStats() const
+{
+	int32 ActiveByPriority[4] = {};
+	for (int32 i = 0; i < Voices.Num(); ++i)
+	{
+		if (IsVoiceActive(i)) ++ActiveByPriority[static_cast<int32>(Voices[i].Priority)];
+	}
+	const int32 Active = ActiveByPriority[0] + ActiveByPriority[1] + ActiveByPriority[2] + ActiveByPriority[3];
+
+	UE_LOG(LogMMOAudio, Log, TEXT("SFX voices: %d active / %d pooled / %d budget (local %d, target %d, party %d, other %d)"),
+		Active, Voices.Num(), CVarAudioMaxVoices.GetValueOnGameThread(),
+		ActiveByPriority[3], ActiveByPriority[2], ActiveByPriority[1], ActiveByPriority[0]);
+	UE_LOG(LogMMOAudio, Log, TEXT("  %llu played, %llu culled (distance), %llu coalesced, %llu dropped, %llu stolen"),
+		NumVoicesPlayed, NumVoicesCulled, NumVoicesCoalesced, NumVoicesDropped, NumVoicesStolen);
+}
+
+void UAudioSubsystem::UpdateVoiceReadout() const
+{
+	if (!GEngine || CVarAudioShowVoices.GetValueOnGameThread() == 0) return;
+
+	int32 Active = 0;
+	for (int32 i = 0; i < Voices.Num(); ++i)
+	{
+		if (IsVoiceActive(i)) ++Active;
+	}
+	GEngine->AddOnScreenDebugMessage(VoiceReadoutKey, 2.0f, FColor::Cyan,
+		FString::Printf(TEXT("SFX voices %d/%d | played %llu  culled %llu  coalesced %llu  dropped %llu  stolen %llu"),
+			Active, CVarAudioMaxVoices.GetValueOnGameThread(),
+			NumVoicesPlayed, NumVoicesCulled, NumVoicesCoalesced, NumVoicesDropped, NumVoicesStolen));
+}
+
+// ============================================================
+// Sound memory report
+// ============================================================
+
+void UAudioSubsystem::LogSoundMemoryReport(const TCHAR* Reason) const
+{
+	int32 NumResident = 0, NumZone = 0, NumLoading = 0, NumFailed = 0;
+	int32 NumPreloaded = 0, NumPreloadedPlayed = 0, NumUnused = 0, NumMissed = 0;
+	int64 ResidentBytes = 0, ZoneBytes = 0, UnusedBytes = 0;
+	for (const auto& Pair : SoundLoads)
+	{
+		const FSoundLoad& Load = Pair.Value;
+		if (Load.bLoading) { ++NumLoading; continue; }
+		if (Load.bFailed)  { ++NumFailed;  continue; }
+
+		++NumResident;
+		ResidentBytes += Load.Bytes;
+		if (Load.Scope == ESoundScope::Zone)
+		{
+			++NumZone;
+			ZoneBytes += Load.Bytes;
+		}
+		if (Load.bPreloaded)
+		{
+			++NumPreloaded;
+			if (Load.bPlayed)
+			{
+				++NumPreloadedPlayed;
+			}
+			else
+			{
+				++NumUnused;
+				UnusedBytes += Load.Bytes;
+			}
+		}
+		else if (Load.bPlayed)
+		{
+			++NumMissed;
+		}
+	}
+
+	UE_LOG(LogMMOAudio, Log, TEXT("Sounds (%s, zone %s): %d resident %.1f MB (zone-scoped %d, %.1f MB), %d loading, %d failed"),
+		Reason, SoundZone.IsEmpty() ? TEXT("-") : *SoundZone,
+		NumResident, ToMB(ResidentBytes), NumZone, ToMB(ZoneBytes), NumLoading, NumFailed);
+	UE_LOG(LogMMOAudio, Log, TEXT("  preloaded %d: %d played, %d never played (%.1f MB); %d played without preload (%llu late starts, %llu skipped)"),
+		NumPreloaded, NumPreloadedPlayed, NumUnused, ToMB(UnusedBytes), NumMissed, NumLateStarts, NumSkippedLoads);
+}
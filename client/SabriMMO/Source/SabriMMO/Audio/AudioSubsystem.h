@@ -20,8 +20,20 @@
 // Body material layering for monsters: monster_<material>.wav plays simultaneously
 // with damage/die (RO Classic's "physical impact + body crumple" two-layer model).
 //
-// Concurrency: each event type has a max simultaneous slot count to prevent audio
-// chaos when many entities are active at once.
+// Voices: positional one-shots play on a small pool of reused UAudioComponents under a
+// global budget (Audio.MaxVoices). A sound is culled before its asset is touched when it
+// is out of earshot, folded into an identical sound already started this frame, and, when
+// the budget is full, takes the voice of a lower-priority sound or is dropped. Priority
+// comes from where it plays: local player > attack target > party member > anything else.
+// Each event type still has its own cap inside the budget. Audio.VoiceStats /
+// Audio.ShowVoices report active, culled and coalesced voices.
+//
+// Loading: sound assets stream in asynchronously — nothing on the play path blocks. Each
+// zone's working set is requested up front: monster sounds for the zone's own monster list
+// (zone:spawn_manifest and enemy spawns — not adjacent-zone predictions), cast/impact sounds
+// for the local player's skill tree, and the zone's ambient layers. A sound that still has to load when it is played starts
+// late (up to Audio.LateStartMs) or is skipped. Zone-scoped sounds are released when the
+// zone changes; Audio.SoundReport prints residency, memory and preload hit rates.
 //
 // Sprite class -> sound config lookup is built once in OnWorldBeginPlay.
 // Family aliases (poporing -> poring, drops -> poring, etc.) are first-class.
@@ -32,6 +44,7 @@
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "Dom/JsonValue.h"
+#include "Engine/StreamableManager.h"
 #include "AudioSubsystem.generated.h"
 
 class USoundBase;
@@ -104,15 +117,19 @@ struct FMonsterSoundConfig
 
 struct FConcurrencyState
 {
-	// Recent play timestamps. Entries older than Lifetime are reaped on each access.
-	TArray<double> RecentPlayTimes;
-
-	// Max concurrent plays of this type. Calls beyond this are dropped.
+	// Max voices of this type playing at once. Beyond this a new sound only plays by
+	// replacing a lower-priority one of the same type.
 	int32 MaxConcurrent = 8;
+};
 
-	// How long a sound counts toward the cap (seconds).
-	// Approximation of typical monster sound length.
-	double Lifetime = 2.0;
+// Who a positional sound belongs to, judged by where it plays. Higher wins a voice
+// when the budget is full.
+enum class ESfxPriority : uint8
+{
+	Other,
+	Party,     // at a party member
+	Target,    // at the local player's attack target
+	Local      // at the local player
 };
 
 // ============================================================
@@ -333,12 +350,34 @@ public:
 	// REPLACE the broken USoundClass-based bus routing — the old approach mutated the
 	// shared sound asset's SoundClassObject which doesn't survive PIE multi-world or
 	// world transitions, leading to "Unable to find sound class properties" spam.
-	// Public so external systems (CombatActionSubsystem legacy hit sounds, etc.) can
-	// route their direct PlaySoundAtLocation calls through the SFX bus too.
+	// Public so external systems can apply the SFX bus to audio they play themselves.
 	float GetEffectiveSfxVolume()     const { return bAudioMuted ? 0.f : CurrentSfxVolume     * CurrentMasterVolume; }
 	float GetEffectiveBgmVolume()     const { return bAudioMuted ? 0.f : CurrentBgmVolume     * CurrentMasterVolume; }
 	float GetEffectiveAmbientVolume() const { return bAudioMuted ? 0.f : CurrentAmbientVolume * CurrentMasterVolume; }
 
+	// Play an already-loaded positional sound through the voice manager (culling, coalescing,
+	// budget), counted against Type's cap. For systems that own their own USoundBase assets.
+	bool PlayCombatSound(USoundBase* Sound, const FVector& Location, EMonsterSoundType Type, float Pitch = 1.0f);
+
+	// Voice manager counters to the log (Audio.VoiceStats)
+	void LogVoiceStats() const;
+
+	// ---- Sound streaming / zone preload ----
+
+	// Start streaming every sound of a monster sprite class in this zone (spawn manifest /
+	// enemy spawn). Idempotent; unknown classes are ignored.
+	void PreloadMonsterSounds(const FString& SpriteClass);
+
+	// Start streaming cast + impact sounds for the local player's skills.
+	void PreloadSkillSounds(TConstArrayView<int32> SkillIds);
+
+	// True while preload requests are still streaming (the loading screen waits on this).
+	bool IsPreloadInProgress() const { return NumPreloadsInFlight > 0; }
+
+	// Resident / loading sounds, memory, and how well preloading covered what was played
+	// (Audio.SoundReport; also logged on zone exit)
+	void LogSoundMemoryReport(const TCHAR* Reason) const;
+
 private:
 	// Server status:applied event handler — resolves target position and plays the status sound.
 	void HandleStatusApplied(const TSharedPtr<FJsonValue>& Data);
@@ -346,13 +385,41 @@ private:
 	// Resolve a sprite class to its sound config (handles family aliases).
 	const FMonsterSoundConfig* ResolveConfig(const FString& SpriteClass) const;
 
-	// Lazy-load a USoundBase by /Game/ path. Cached on first access.
-	USoundBase* LoadSoundCached(const FString& AssetPath);
+	// The sound at a /Game/ path if it is already resident (cached, or loaded by someone else)
+	USoundBase* FindLoadedSound(const FString& AssetPath);
 
-	// Play one specific sound at a location, with concurrency check + attenuation.
-	// Returns true if the sound was actually played (not dropped by concurrency).
+	enum class ESoundScope : uint8
+	{
+		Session,   // UI, player, skill sounds — kept until the subsystem goes away
+		Zone       // monster + ambient sounds — released when the zone changes
+	};
+
+	// Stream a sound in. OnLoaded runs with the sound (or null on failure) once it is
+	// resident — immediately if it already is. bPreload marks it as part of the zone's
+	// working set (counted for the loading screen and the memory report).
+	void RequestSound(const FString& AssetPath, ESoundScope Scope, bool bPreload,
+	                  TFunction<void(USoundBase*)> OnLoaded = nullptr);
+	void OnSoundLoaded(FString AssetPath);
+	void MarkSoundPlayed(const FString& AssetPath);
+
+	// Entering NewZone: drop the previous zone's zone-scoped sounds. Deinitialize drops the rest.
+	void EvictZoneSounds(const FString& NewZone);
+
+	// A play that had to wait for its sound: still worth starting?
+	bool IsLateStartAllowed(double RequestTime) const;
+
+	void SpawnAmbientLayer(USoundBase* Sound);
+	void SpawnAmbientPoint(USoundBase* Sound, const FVector& Location);
+	void StartBgm(USoundBase* Sound);
+
+	// Play one specific sound at a location through the voice manager, under Type's cap.
+	// Returns false only if the sound could not play (no asset, or no voice it could take);
+	// a sound culled for distance or folded into an identical one counts as handled.
 	bool PlaySoundInternal(const FString& AssetPath, const FVector& Location, EMonsterSoundType Type);
 
+	// Same, without a per-type cap (status, heal, drops, portals — rare and important)
+	bool PlayUncappedSound(const FString& AssetPath, const FVector& Location);
+
 	// Play one specific sound 2D non-spatial (UI / event sounds, no concurrency check).
 	void PlaySound2DInternal(const FString& AssetPath, float VolumeMultiplier = 1.0f);
 
@@ -365,8 +432,24 @@ private:
 	// Pick the right path field from a config given the sound type.
 	const FString& GetPathForType(const FMonsterSoundConfig& Config, EMonsterSoundType Type) const;
 
-	// Concurrency: returns true if this type still has slots; updates timestamps as a side effect.
-	bool TryReserveConcurrencySlot(EMonsterSoundType Type);
+	// ---- Voice manager ----
+
+	// CapType is an EMonsterSoundType, or INDEX_NONE for no per-type cap.
+	// Sound may be null, in which case AssetPath is loaded once a voice is secured.
+	bool PlayVoice(const FString& AssetPath, USoundBase* Sound, const FVector& Location, int32 CapType, float Pitch);
+
+	// Voice for a new sound: a free one, a new one under the budget, or the least important
+	// playing one below Priority. INDEX_NONE if none qualifies.
+	int32 AcquireVoice(ESfxPriority Priority, int32 CapType);
+
+	bool IsVoiceActive(int32 Index) const;
+	UAudioComponent* CreateVoiceComponent();
+
+	// Local pawn / attack target / party positions and the listener, sampled once per frame
+	void RefreshPriorityAnchors();
+	ESfxPriority ClassifyPriority(const FVector& Location) const;
+
+	void UpdateVoiceReadout() const;
 
 	// ---- State ----
 
@@ -489,6 +572,9 @@ private:
 	// Cached BGM asset path so PlayZoneBgm/PlayBgm can be idempotent.
 	FString CurrentBgmPath;
 
+	// Tracks whose load is in flight — a repeat PlayBgm of one reuses that request
+	TSet<FString> PendingBgmPaths;
+
 	// ---- Volume bus state ----
 
 	// Sound class hierarchy: Master parent → BGM/SFX/Ambient children.
@@ -550,14 +636,75 @@ private:
 	// Resolve job class -> body material category (cloth/wood/metal).
 	EPlayerBodyMaterial ResolveBodyMaterialFor(const FString& JobClass) const;
 
-	// Asset path -> loaded USoundBase (lazy cache, GC-protected)
+	// Asset path -> loaded USoundBase (resident set, GC-protected)
 	UPROPERTY()
 	TMap<FString, TObjectPtr<USoundBase>> SoundCache;
 
+	// Every requested path: load state, scope, and whether it has been played
+	struct FSoundLoad
+	{
+		TSharedPtr<FStreamableHandle> Handle;          // while loading
+		TArray<TFunction<void(USoundBase*)>, TInlineAllocator<1>> Waiters;
+		int64 Bytes = 0;
+		ESoundScope Scope = ESoundScope::Session;
+		bool bLoading = false;
+		bool bFailed = false;
+		bool bPreloaded = false;
+		bool bPlayed = false;
+	};
+	TMap<FString, FSoundLoad> SoundLoads;
+
+	// Sprite classes / skills whose sounds have been requested (PreloadXxx is called per spawn)
+	TSet<FString> PreloadedMonsterClasses;
+	TSet<int32> PreloadedSkills;
+
+	// Zone the zone-scoped sounds were loaded for (empty until the first ambient start)
+	FString SoundZone;
+
+	int32 NumPreloadsInFlight = 0;
+
+	// Plays that found their sound not yet resident
+	uint64 NumLateStarts = 0;
+	uint64 NumSkippedLoads = 0;
+
 	// Programmatic attenuation so spatialization works regardless of per-asset import settings
 	UPROPERTY()
 	TObjectPtr<USoundAttenuation> MonsterAttenuation;
 
 	// Per-type concurrency state
 	TMap<EMonsterSoundType, FConcurrencyState> ConcurrencyTracking;
+
+	// ---- Voice pool ----
+
+	struct FSfxVoice
+	{
+		double StartTime = 0.0;
+		uint64 Frame = 0;          // GFrameCounter when started — for same-frame coalescing
+		uint32 SoundKey = 0;       // hash of the asset path / object
+		int32 CapType = INDEX_NONE;
+		ESfxPriority Priority = ESfxPriority::Other;
+	};
+
+	// Pooled one-shot components (grown on demand up to Audio.MaxVoices) and, parallel to
+	// them, what each is playing
+	UPROPERTY()
+	TArray<TObjectPtr<UAudioComponent>> VoiceComponents;
+	TArray<FSfxVoice> Voices;
+
+	struct FPriorityAnchors
+	{
+		uint64 Frame = MAX_uint64;
+		TOptional<FVector> Listener;
+		TOptional<FVector> Local;
+		TOptional<FVector> Target;
+		TArray<FVector, TInlineAllocator<12>> Party;
+	};
+	FPriorityAnchors Anchors;
+
+	// Lifetime counters for Audio.VoiceStats / Audio.ShowVoices
+	uint64 NumVoicesPlayed = 0;
+	uint64 NumVoicesCulled = 0;      // out of earshot, never loaded
+	uint64 NumVoicesCoalesced = 0;   // identical sound already started this frame
+	uint64 NumVoicesDropped = 0;     // budget / type cap full of equal-or-higher priority
+	uint64 NumVoicesStolen = 0;      // took a lower-priority sound's voice
 };
@@ -0,0 +1,140 @@
+// BlueprintBindings.cpp — Per-class resolved Blueprint variables and events (see header).
+
+#include "BlueprintBindings.h"
+#include "UObject/UnrealType.h"
+
+// ============================================================
+// Property matching
+// ============================================================
+
+bool BlueprintBindings::Matches(const FProperty* Prop, const int32*)
+{
+	return Prop->IsA<FIntProperty>();
+}
+
+bool BlueprintBindings::Matches(const FProperty* Prop, const double*)
+{
+	return Prop->IsA<FDoubleProperty>();
+}
+
+bool BlueprintBindings::Matches(const FProperty* Prop, const FVector*)
+{
+	const FStructProperty* StructProp = CastField<const FStructProperty>(Prop);
+	return StructProp && StructProp->Struct == TBaseStructure<FVector>::Get();
+}
+
+bool BlueprintBindings::Matches(const FProperty* Prop, const FString*)
+{
+	return Prop->IsA<FStrProperty>();
+}
+
+bool BlueprintBindings::Matches(const FProperty* Prop, UObject* const*)
+{
+	return Prop->IsA<FObjectProperty>();
+}
+
+const FProperty* BlueprintBindings::FindProperty(const UStruct* Owner, FName Name)
+{
+	const FProperty* Prop = Owner ? Owner->FindPropertyByName(Name) : nullptr;
+	return (Prop && Prop->ArrayDim == 1) ? Prop : nullptr;
+}
+
+int32 BlueprintBindings::GetOffset(const FProperty* Prop)
+{
+	return Prop->GetOffset_ForInternal();
+}
+
+// ============================================================
+// FBPBool
+// ============================================================
+
+void FBPBool::Bind(const UStruct* Owner, FName Name)
+{
+	const FBoolProperty* Prop = CastField<const FBoolProperty>(BlueprintBindings::FindProperty(Owner, Name));
+	if (!Prop)
+	{
+		Offset = INDEX_NONE;
+		return;
+	}
+	Offset = Prop->GetOffset_ForInternal() + Prop->GetByteOffset();
+	FieldMask = Prop->GetFieldMask();
+	ByteMask = Prop->GetByteMask();
+}
+
+// ============================================================
+// FBPFunction
+// ============================================================
+
+void FBPFunction::Bind(const UClass* Class, FName Name)
+{
+	Function = Class ? Class->FindFunctionByName(Name) : nullptr;
+	ParmsSize = Function ? Function->ParmsSize : 0;
+
+	StringParamOffsets.Reset();
+	if (!Function) return;
+	for (TFieldIterator<FStrProperty> It(Function); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
+	{
+		StringParamOffsets.Add(It->GetOffset_ForInternal());
+	}
+}
+
+void FBPFunction::Call(UObject* Target) const
+{
+	if (!Function || !Target) return;
+	if (ParmsSize == 0)
+	{
+		Target->ProcessEvent(Function, nullptr);
+		return;
+	}
+	FBPCallFrame(*this).Call(Target);
+}
+
+// ============================================================
+// FBPCallFrame
+// ============================================================
+
+// Memzero + explicit FString lifecycle (NOT InitializeStruct/DestroyStruct, which can write
+// past ParmsSize because GetStructureSize() rounds up for alignment — that was the 0xc0000409
+// the old alloca'd helper hit). Every other BP parameter type we bind is fine zeroed.
+FBPCallFrame::FBPCallFrame(const FBPFunction& InFunction)
+	: Function(InFunction)
+{
+	const int32 Size = Function.ParmsSize;
+	if (!Function.Function || Size == 0) return;
+
+	Params = Size <= InlineSize ? Inline : static_cast<uint8*>(FMemory::Malloc(Size, 16));
+	FMemory::Memzero(Params, Size);
+	for (int32 Offset : Function.StringParamOffsets)
+	{
+		new (Params + Offset) FString();
+	}
+}
+
+FBPCallFrame::~FBPCallFrame()
+{
+	if (!Params) return;
+	for (int32 Offset : Function.StringParamOffsets)
+	{
+		reinterpret_cast<FString*>(Params + Offset)->~FString();
+	}
+	if (Params != Inline)
+	{
+		FMemory::Free(Params);
+	}
+}
+
+void FBPCallFrame::Call(UObject* Target)
+{
+	if (!Function.Function || !Target) return;
+	Target->ProcessEvent(Function.Function, Params);
+}
+
+// ============================================================
+// Shared tables
+// ============================================================
+
+void FBPMovementBindings::Bind(const UClass* Class)
+{
+	TargetPosition.Bind(Class, TEXT("TargetPosition"));
+	IsMoving.Bind(Class, TEXT("bIsMoving"));
+}
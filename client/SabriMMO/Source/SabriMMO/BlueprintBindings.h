@@ -0,0 +1,195 @@
+// BlueprintBindings.h — Resolved-once access to the Blueprint variables and events C++ drives.
+// The entity subsystems still talk to BP_EnemyCharacter / BP_OtherPlayerCharacter through a
+// handful of BP variables (TargetPosition, bIsMoving, bIsDead) and events (InitializeEnemy,
+// UpdateEnemyHealth, ...). Going through FindPropertyByName / FindFunction for that walked the
+// class's property chain, by FName, for every enemy:move and player:moved — and for sprite
+// enemies, which have none of those variables, walked all of it to find nothing.
+//
+// A binding table is a struct of typed handles plus a Bind(const UClass*) that resolves each
+// of them by name. TBPBindingCache builds one table per class on first use; after that a write
+// is a store at a stored offset. A handle that did not resolve (missing, or a different type
+// than the C++ side expects) is a silent no-op, like the lookup helpers it replaces.
+//
+// ASabriMMONetworkTests::Test_Performance_BlueprintBindings measures both paths.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Class.h"
+#include "UObject/WeakObjectPtr.h"
+#include "Templates/UniquePtr.h"
+
+class FProperty;
+
+namespace BlueprintBindings
+{
+	/** Whether a BP property can be accessed as T */
+	bool Matches(const FProperty* Prop, const int32*);
+	bool Matches(const FProperty* Prop, const double*);
+	bool Matches(const FProperty* Prop, const FVector*);
+	bool Matches(const FProperty* Prop, const FString*);
+	bool Matches(const FProperty* Prop, UObject* const*);
+
+	/** Offset of Name in Owner (a class or a function's parameter frame) if it Matches, else INDEX_NONE */
+	template<typename T>
+	int32 FindOffset(const UStruct* Owner, FName Name);
+
+	const FProperty* FindProperty(const UStruct* Owner, FName Name);
+	int32 GetOffset(const FProperty* Prop);
+}
+
+/** A BP variable or function parameter of type T (int32, double, FVector, FString, UObject*) */
+template<typename T>
+class TBPVar
+{
+public:
+	void Bind(const UStruct* Owner, FName Name) { Offset = BlueprintBindings::FindOffset<T>(Owner, Name); }
+	bool IsBound() const { return Offset != INDEX_NONE; }
+
+	void Set(void* Container, const T& Value) const
+	{
+		if (IsBound()) *reinterpret_cast<T*>(static_cast<uint8*>(Container) + Offset) = Value;
+	}
+
+	T Get(const void* Container, const T& Default = T()) const
+	{
+		return IsBound() ? *reinterpret_cast<const T*>(static_cast<const uint8*>(Container) + Offset) : Default;
+	}
+
+private:
+	int32 Offset = INDEX_NONE;
+};
+
+/** A BP bool variable or parameter (native bools and bitfields both go through the byte masks) */
+class SABRIMMO_API FBPBool
+{
+public:
+	void Bind(const UStruct* Owner, FName Name);
+	bool IsBound() const { return Offset != INDEX_NONE; }
+
+	void Set(void* Container, bool bValue) const
+	{
+		if (!IsBound()) return;
+		uint8* Byte = static_cast<uint8*>(Container) + Offset;
+		*Byte = (*Byte & ~FieldMask) | (bValue ? ByteMask : 0);
+	}
+
+	bool Get(const void* Container, bool bDefault = false) const
+	{
+		return IsBound() ? (*(static_cast<const uint8*>(Container) + Offset) & FieldMask) != 0 : bDefault;
+	}
+
+private:
+	int32 Offset = INDEX_NONE;   // property offset + byte offset within it
+	uint8 FieldMask = 0;
+	uint8 ByteMask = 0;
+};
+
+/** A BP function or event. Parameters are bound against Get() as TBPVar / FBPBool handles. */
+class SABRIMMO_API FBPFunction
+{
+public:
+	void Bind(const UClass* Class, FName Name);
+	bool IsBound() const { return Function != nullptr; }
+	const UFunction* Get() const { return Function; }
+
+	/** Call with every parameter zeroed (or none) */
+	void Call(UObject* Target) const;
+
+private:
+	friend class FBPCallFrame;
+
+	UFunction* Function = nullptr;
+	int32 ParmsSize = 0;
+	TArray<int32, TInlineAllocator<2>> StringParamOffsets;
+};
+
+/**
+ * Parameter frame for one call of an FBPFunction: zeroed, FString parameters constructed,
+ * filled through the bound parameter handles, then Call(Target).
+ */
+class SABRIMMO_API FBPCallFrame
+{
+public:
+	explicit FBPCallFrame(const FBPFunction& InFunction);
+	~FBPCallFrame();
+
+	FBPCallFrame(const FBPCallFrame&) = delete;
+	FBPCallFrame& operator=(const FBPCallFrame&) = delete;
+
+	template<typename T>
+	FBPCallFrame& Set(const TBPVar<T>& Param, const T& Value) { if (Params) Param.Set(Params, Value); return *this; }
+	FBPCallFrame& Set(const FBPBool& Param, bool bValue) { if (Params) Param.Set(Params, bValue); return *this; }
+
+	void Call(UObject* Target);
+
+private:
+	static constexpr int32 InlineSize = 128;
+
+	const FBPFunction& Function;
+	uint8* Params = nullptr;
+	alignas(16) uint8 Inline[InlineSize];
+};
+
+/** BP variables every server-driven BP character has (TargetPosition is chased by the BP's Tick) */
+struct SABRIMMO_API FBPMovementBindings
+{
+	TBPVar<FVector> TargetPosition;
+	FBPBool IsMoving;
+
+	void Bind(const UClass* Class);
+};
+
+/**
+ * One TTable per class, bound on first use. TTable is a struct of handles with
+ * void Bind(const UClass* Class). Returned references stay valid until Reset().
+ */
+template<typename TTable>
+class TBPBindingCache
+{
+public:
+	/** Table for Object's class. Null objects get an unbound table. */
+	const TTable& Get(const UObject* Object)
+	{
+		static const TTable Unbound;
+		return Object ? Get(Object->GetClass()) : Unbound;
+	}
+
+	const TTable& Get(const UClass* Class)
+	{
+		if (LastTable && LastClass.Get() == Class) return *LastTable;
+
+		TUniquePtr<TTable>& Slot = Tables.FindOrAdd(Class);
+		if (!Slot)
+		{
+			Slot = MakeUnique<TTable>();
+			Slot->Bind(Class);
+		}
+		LastClass = Class;
+		LastTable = Slot.Get();
+		return *LastTable;
+	}
+
+	void Reset()
+	{
+		Tables.Empty();
+		LastClass.Reset();
+		LastTable = nullptr;
+	}
+
+	int32 Num() const { return Tables.Num(); }
+
+private:
+	TMap<TWeakObjectPtr<const UClass>, TUniquePtr<TTable>> Tables;
+
+	// Entity packets come in runs of one class
+	TWeakObjectPtr<const UClass> LastClass;
+	const TTable* LastTable = nullptr;
+};
+
+template<typename T>
+int32 BlueprintBindings::FindOffset(const UStruct* Owner, FName Name)
+{
+	const FProperty* Prop = FindProperty(Owner, Name);
+	return (Prop && Matches(Prop, static_cast<const T*>(nullptr))) ? GetOffset(Prop) : INDEX_NONE;
+}
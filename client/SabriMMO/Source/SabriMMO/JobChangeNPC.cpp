@@ -3,6 +3,7 @@
 
 #include "JobChangeNPC.h"
 #include "UI/NameTagSubsystem.h"
+#include "UI/EntityRegistrySubsystem.h"
 #include "UI/JobChangeSubsystem.h"
 #include "Sprite/SpriteCharacterActor.h"
 #include "Components/CapsuleComponent.h"
@@ -52,6 +53,12 @@ void AJobChangeNPC::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// Minimap NPC dots and ground-trace ignore lists read NPCs from the registry
+	if (UEntityRegistrySubsystem* Registry = GetWorld() ? GetWorld()->GetSubsystem<UEntityRegistrySubsystem>() : nullptr)
+	{
+		Registry->Register(EEntityCategory::NPC, (int32)GetUniqueID(), this);
+	}
+
 	// Re-apply at runtime in case existing placed actors have stale serialized
 	// collision settings from before the constructor was updated.
 	if (CapsuleComp)
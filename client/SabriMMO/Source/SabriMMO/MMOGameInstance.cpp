@@ -195,6 +195,7 @@ void UMMOGameInstance::SaveGameOptions()
     Save->fAmbientVolume = fOptionAmbientVolume;
     // Video
     Save->iSpriteQuality = iOptionSpriteQuality;
+    Save->iEntityDetail = iOptionEntityDetail;
     // Login
     Save->bRememberUsername = bRememberUsername;
     Save->RememberedUsername = (bRememberUsername && !Username.IsEmpty()) ? Username : FString();
@@ -250,6 +251,7 @@ void UMMOGameInstance::LoadGameOptions()
     fOptionAmbientVolume = Save->fAmbientVolume;
     // Video
     iOptionSpriteQuality = FMath::Clamp(Save->iSpriteQuality, 0, 4);
+    iOptionEntityDetail = FMath::Clamp(Save->iEntityDetail, 0, 4);
     // Login
     bRememberUsername = Save->bRememberUsername;
     if (bRememberUsername)
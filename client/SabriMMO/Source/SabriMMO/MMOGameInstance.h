@@ -61,6 +61,8 @@ public:
 	UPROPERTY() float fAmbientVolume = 0.5f;
 	// Video — Sprite Quality (0=Ultra, 1=High, 2=Medium, 3=Low, 4=Very Low). Maps to LODBias on every sprite atlas.
 	UPROPERTY() int32 iSpriteQuality = 2;
+	// Video — Entity Detail (same scale). Budgets for full / reduced update-rate sprites (USpriteSignificanceSubsystem).
+	UPROPERTY() int32 iEntityDetail = 2;
 	// Login
 	UPROPERTY() bool bRememberUsername = false;
 	UPROPERTY() FString RememberedUsername;
@@ -302,6 +304,7 @@ public:
     float fOptionAmbientVolume = 0.5f;
     // Video
     int32 iOptionSpriteQuality = 2;  // 0=Ultra, 1=High, 2=Medium, 3=Low, 4=Very Low
+    int32 iOptionEntityDetail = 2;   // same scale — sprite update LOD budgets
 
     void SaveGameOptions();
     void LoadGameOptions();
@@ -0,0 +1,155 @@
+// MoveBatchCodec.cpp — Binary move:batch decode/encode (see ro_move_codec.js).
+
+#include "MoveBatchCodec.h"
+
+namespace
+{
+	constexpr uint8 FLAG_KIND_PLAYER = 0x01;
+	constexpr uint8 FLAG_ABSOLUTE    = 0x02;
+	constexpr uint8 FLAG_MOVING      = 0x04;
+	constexpr uint8 FLAG_WEAPON_MODE = 0x08;
+
+	bool ReadVarint(const uint8* Data, int32 Size, int32& Offset, uint64& Out)
+	{
+		Out = 0;
+		for (int32 Shift = 0; Shift < 35; Shift += 7)
+		{
+			if (Offset >= Size) return false;
+			const uint8 Byte = Data[Offset++];
+			Out |= static_cast<uint64>(Byte & 0x7F) << Shift;
+			if ((Byte & 0x80) == 0) return true;
+		}
+		return false;
+	}
+
+	void WriteVarint(TArray<uint8>& Out, uint64 Value)
+	{
+		while (Value >= 0x80)
+		{
+			Out.Add(static_cast<uint8>(Value & 0x7F) | 0x80);
+			Value >>= 7;
+		}
+		Out.Add(static_cast<uint8>(Value));
+	}
+
+	FORCEINLINE uint64 ZigZag(int64 V) { return V >= 0 ? static_cast<uint64>(V) * 2 : static_cast<uint64>(-V) * 2 - 1; }
+	FORCEINLINE int64 UnZigZag(uint64 V) { return (V & 1) ? -static_cast<int64>((V + 1) / 2) : static_cast<int64>(V / 2); }
+
+	FORCEINLINE int32 Quantize(double V) { return FMath::RoundToInt32(V / FMoveBatchCodec::PositionQuantum); }
+}
+
+bool FMoveBatchCodec::Decode(const uint8* Data, int32 Size, TArray<FMoveRecord>& OutRecords, uint32* OutServerTimeMs)
+{
+	if (!Data || Size < HeaderBytes || Data[0] != Version) return false;
+
+	const int32 Count = Data[2] | (Data[3] << 8);
+	if (OutServerTimeMs)
+	{
+		*OutServerTimeMs = Data[4] | (Data[5] << 8) | (Data[6] << 16) | (static_cast<uint32>(Data[7]) << 24);
+	}
+
+	OutRecords.Reserve(OutRecords.Num() + Count);
+	int32 Offset = HeaderBytes;
+	for (int32 i = 0; i < Count; ++i)
+	{
+		if (Offset >= Size) return false;
+		const uint8 Header = Data[Offset++];
+
+		uint64 Id = 0, VX = 0, VY = 0, VZ = 0;
+		if (!ReadVarint(Data, Size, Offset, Id) || !ReadVarint(Data, Size, Offset, VX)
+			|| !ReadVarint(Data, Size, Offset, VY) || !ReadVarint(Data, Size, Offset, VZ))
+		{
+			return false;
+		}
+
+		bool bHasWeaponMode = false;
+		uint8 WeaponMode = 0;
+		if (Header & FLAG_WEAPON_MODE)
+		{
+			if (Offset >= Size) return false;
+			WeaponMode = Data[Offset++];
+			bHasWeaponMode = true;
+		}
+
+		const EMoveEntityKind Kind = (Header & FLAG_KIND_PLAYER) ? EMoveEntityKind::Player : EMoveEntityKind::Enemy;
+		FIntVector Q(static_cast<int32>(UnZigZag(VX)), static_cast<int32>(UnZigZag(VY)), static_cast<int32>(UnZigZag(VZ)));
+
+		FBaseline* Base = Baselines.Find(MakeKey(Kind, static_cast<int32>(Id)));
+		if (!(Header & FLAG_ABSOLUTE))
+		{
+			if (!Base)
+			{
+				++DroppedDeltas;
+				continue;
+			}
+			Q += Base->Pos;
+		}
+		if (!Base)
+		{
+			Base = &Baselines.Add(MakeKey(Kind, static_cast<int32>(Id)));
+		}
+		Base->Pos = Q;
+		if (bHasWeaponMode)
+		{
+			Base->WeaponMode = WeaponMode;
+			Base->bHasWeaponMode = true;
+		}
+
+		FMoveRecord& R = OutRecords.AddDefaulted_GetRef();
+		R.Kind = Kind;
+		R.Id = static_cast<int32>(Id);
+		R.Position = FVector(Q) * PositionQuantum;
+		R.bIsMoving = (Header & FLAG_MOVING) != 0;
+		R.bHasWeaponMode = Base->bHasWeaponMode;
+		R.WeaponMode = Base->WeaponMode;
+	}
+	return true;
+}
+
+void FMoveBatchCodec::Encode(TConstArrayView<FMoveRecord> Records, uint32 ServerTimeMs, TArray<uint8>& OutBytes)
+{
+	const int32 Count = FMath::Min(Records.Num(), 0xFFFF);
+	OutBytes.Reset();
+	OutBytes.Reserve(HeaderBytes + Count * 8);
+	OutBytes.Add(Version);
+	OutBytes.Add(0);
+	OutBytes.Add(static_cast<uint8>(Count & 0xFF));
+	OutBytes.Add(static_cast<uint8>(Count >> 8));
+	for (int32 b = 0; b < 4; ++b)
+	{
+		OutBytes.Add(static_cast<uint8>(ServerTimeMs >> (8 * b)));
+	}
+
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const FMoveRecord& R = Records[i];
+		const FIntVector Q(Quantize(R.Position.X), Quantize(R.Position.Y), Quantize(R.Position.Z));
+		FBaseline* Base = Baselines.Find(MakeKey(R.Kind, R.Id));
+
+		uint8 Header = (R.Kind == EMoveEntityKind::Player) ? FLAG_KIND_PLAYER : 0;
+		if (!Base) Header |= FLAG_ABSOLUTE;
+		if (R.bIsMoving) Header |= FLAG_MOVING;
+		const bool bSendWeaponMode = R.Kind == EMoveEntityKind::Player && R.bHasWeaponMode
+			&& (!Base || !Base->bHasWeaponMode || Base->WeaponMode != R.WeaponMode);
+		if (bSendWeaponMode) Header |= FLAG_WEAPON_MODE;
+
+		OutBytes.Add(Header);
+		WriteVarint(OutBytes, static_cast<uint32>(R.Id));
+		const FIntVector V = Base ? Q - Base->Pos : Q;
+		WriteVarint(OutBytes, ZigZag(V.X));
+		WriteVarint(OutBytes, ZigZag(V.Y));
+		WriteVarint(OutBytes, ZigZag(V.Z));
+		if (bSendWeaponMode) OutBytes.Add(R.WeaponMode);
+
+		if (!Base)
+		{
+			Base = &Baselines.Add(MakeKey(R.Kind, R.Id));
+		}
+		Base->Pos = Q;
+		if (bSendWeaponMode)
+		{
+			Base->WeaponMode = R.WeaponMode;
+			Base->bHasWeaponMode = true;
+		}
+	}
+}
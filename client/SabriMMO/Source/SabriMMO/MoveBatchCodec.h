@@ -0,0 +1,69 @@
+// MoveBatchCodec.h — Decoder (and test encoder) for the binary 'move:batch' channel.
+// Mirrors server/src/ro_move_codec.js — see that file for the wire format.
+// One batch carries many enemy/player position records, quantized and
+// delta-coded against the last position the server sent to the zone.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+enum class EMoveEntityKind : uint8
+{
+	Enemy = 0,
+	Player = 1,
+};
+
+/** One decoded entity position update. */
+struct FMoveRecord
+{
+	EMoveEntityKind Kind = EMoveEntityKind::Enemy;
+	int32 Id = 0;
+	FVector Position = FVector::ZeroVector;
+	bool bIsMoving = false;
+	bool bHasWeaponMode = false;
+	uint8 WeaponMode = 0;
+};
+
+/**
+ * Stateful codec: keeps the per-entity baseline the deltas are coded against.
+ * A decoder must see every packet for its zone in order (Socket.io guarantees this);
+ * delta records for entities without a baseline are dropped until the server's next
+ * absolute record (sent after every zone:ready and on the periodic keyframe).
+ */
+class SABRIMMO_API FMoveBatchCodec
+{
+public:
+	static constexpr uint8 Version = 1;
+	static constexpr float PositionQuantum = 1.f;   // UE units per step (POSITION_QUANTUM)
+	static constexpr int32 HeaderBytes = 8;
+
+	/** Decode a packet. Returns false on a malformed/unsupported packet (records decoded so far are kept). */
+	bool Decode(const uint8* Data, int32 Size, TArray<FMoveRecord>& OutRecords, uint32* OutServerTimeMs = nullptr);
+
+	/** Encode records the way the server does (used by tests/benchmarks). Updates this codec's baselines. */
+	void Encode(TConstArrayView<FMoveRecord> Records, uint32 ServerTimeMs, TArray<uint8>& OutBytes);
+
+	/** Forget all baselines (zone change). */
+	void Reset() { Baselines.Reset(); }
+
+	int32 NumBaselines() const { return Baselines.Num(); }
+
+	/** Records dropped because a delta arrived before any absolute position. */
+	uint32 GetDroppedDeltaCount() const { return DroppedDeltas; }
+
+private:
+	struct FBaseline
+	{
+		FIntVector Pos = FIntVector::ZeroValue;
+		uint8 WeaponMode = 0;
+		bool bHasWeaponMode = false;
+	};
+
+	static uint64 MakeKey(EMoveEntityKind Kind, int32 Id)
+	{
+		return (static_cast<uint64>(Kind) << 32) | static_cast<uint32>(Id);
+	}
+
+	TMap<uint64, FBaseline> Baselines;
+	uint32 DroppedDeltas = 0;
+};
@@ -30,6 +30,8 @@ public class SabriMMO : ModuleRules
 			"NavigationSystem",
 			"Navmesh",
 			"ProceduralMeshComponent",
+			"MeshDescription",
+			"StaticMeshDescription",
 			"RenderCore",
 			"RHI"
 		});
@@ -37,6 +39,12 @@ public class SabriMMO : ModuleRules
 		// Exclude NetworkPrediction module due to UE 5.7 compiler bug
 		PrivateDependencyModuleNames.AddRange(new string[] { });
 
+		// Skill VFX registry rebuilds itself after a Live Coding patch
+		if (Target.bWithLiveCoding)
+		{
+			PrivateDependencyModuleNames.Add("LiveCoding");
+		}
+
 		PublicIncludePaths.AddRange(new string[] {
 			"SabriMMO",
 			"SabriMMO/Sprite",
@@ -15,6 +15,14 @@
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
+#include "MoveBatchCodec.h"
+#include "SnapshotBuffer.h"
+#include "BlueprintBindings.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/UnrealType.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
 
 // Logging category for network tests
 DEFINE_LOG_CATEGORY_STATIC(LogNetworkTests, Log, All);
@@ -161,6 +169,21 @@ void ASabriMMONetworkTests::RunNextTest()
 		LogResult(TEXT("Performance Latency Measurement"), bResult, LastFailReason);
 		break;
 
+	case 10:
+		bResult = Test_Performance_BandwidthUsage();
+		LogResult(TEXT("Performance Bandwidth Usage"), bResult, LastFailReason);
+		break;
+
+	case 11:
+		bResult = Test_Position_Interpolation();
+		LogResult(TEXT("Position Snapshot Interpolation"), bResult, LastFailReason);
+		break;
+
+	case 12:
+		bResult = Test_Performance_BlueprintBindings();
+		LogResult(TEXT("Performance Blueprint Bindings"), bResult, LastFailReason);
+		break;
+
 	default:
 		PrintSummary();
 		DisconnectFromServer();
@@ -450,6 +473,299 @@ bool ASabriMMONetworkTests::Test_Position_MultiplePlayers()
 	return true;
 }
 
+namespace
+{
+	// One position update as the client received it
+	struct FReplayPacket
+	{
+		double ArriveLocal = 0.0;     // receive time, seconds
+		int64 ServerMs = -1;          // server timestamp, -1 when the packet had none
+		FVector Position = FVector::ZeroVector;
+		bool bMoving = true;
+	};
+
+	struct FReplayResult
+	{
+		int32 Frames = 0;
+		int32 Extrapolated = 0;
+		double MeanError = 0.0;
+		double MaxError = 0.0;
+		double FinalError = 0.0;          // last frame, once the stream has been silent for the tail
+		double SpeedJitter = 0.0;         // stddev of drawn speed while moving, snapshot buffer
+		double LegacySpeedJitter = 0.0;   // same, chasing the latest packet at constant speed
+	};
+
+	double StdDev(const TArray<double>& Values)
+	{
+		if (Values.Num() < 2) return 0.0;
+		double Sum = 0.0, SumSq = 0.0;
+		for (double V : Values) { Sum += V; SumSq += V * V; }
+		const double Mean = Sum / Values.Num();
+		return FMath::Sqrt(FMath::Max(0.0, SumSq / Values.Num() - Mean * Mean));
+	}
+
+	/**
+	 * Drive FServerClock + FSnapshotBuffer at 60 fps over a received stream with the
+	 * USnapshotInterpolationSubsystem defaults, and the old "step toward the newest packet"
+	 * path alongside. Truth(T) is where the entity really was at server time T (seconds since
+	 * the first packet), so error is measured at the time the buffer claims to be drawing.
+	 * Frames keep running for Tail seconds after the last packet arrives.
+	 */
+	FReplayResult ReplayStream(const TArray<FReplayPacket>& Packets, TFunctionRef<FVector(double)> Truth, float LegacySpeed,
+		double Tail = 0.5)
+	{
+		constexpr double FrameDt = 1.0 / 60.0;
+		constexpr double BaseDelay = 0.1;
+		constexpr double Intervals = 1.5;
+		constexpr double MaxExtrapolation = 0.25;
+		constexpr float SnapDistance = 400.f;
+
+		FReplayResult Result;
+		if (Packets.Num() == 0) return Result;
+
+		FServerClock Clock;
+		FSnapshotBuffer Buffer;
+		FVector Legacy = Packets[0].Position;
+		FVector LegacyTarget = Legacy;
+		FVector PrevDrawn = FVector::ZeroVector, PrevLegacy = FVector::ZeroVector;
+		bool bHavePrev = false;
+		TArray<double> Speeds, LegacySpeeds;
+		double ErrorSum = 0.0;
+
+		int32 Next = 0;
+		const double End = Packets.Last().ArriveLocal + Tail;
+		for (double Now = Packets[0].ArriveLocal; Now < End; Now += FrameDt)
+		{
+			while (Next < Packets.Num() && Packets[Next].ArriveLocal <= Now)
+			{
+				const FReplayPacket& P = Packets[Next++];
+				const double Stamp = P.ServerMs >= 0
+					? Clock.Observe(static_cast<uint32>(P.ServerMs), P.ArriveLocal)
+					: (Clock.IsValid() ? Clock.Now(P.ArriveLocal) : P.ArriveLocal);
+				Buffer.Push(Stamp, P.Position, P.bMoving, SnapDistance);
+				LegacyTarget = P.Position;
+			}
+
+			const double ServerNow = Clock.IsValid() ? Clock.Now(Now) : Now;
+			const double RenderTime = ServerNow - FMath::Max(BaseDelay, Intervals * Buffer.GetMeanInterval());
+
+			FVector Drawn;
+			bool bMoving = false;
+			const ESnapshotSample Kind = Buffer.Sample(RenderTime, MaxExtrapolation, Drawn, bMoving);
+			if (Kind == ESnapshotSample::Extrapolated) ++Result.Extrapolated;
+
+			const double Error = FVector::Dist2D(Drawn, Truth(RenderTime));
+			ErrorSum += Error;
+			Result.MaxError = FMath::Max(Result.MaxError, Error);
+			Result.FinalError = Error;
+			++Result.Frames;
+
+			FVector Dir = LegacyTarget - Legacy;
+			Dir.Z = 0.f;
+			const double Dist = Dir.Size();
+			if (Dist > 5.0)
+			{
+				Legacy += Dir.GetSafeNormal() * FMath::Min((double)LegacySpeed * FrameDt, Dist);
+			}
+
+			if (bHavePrev && bMoving)
+			{
+				Speeds.Add(FVector::Dist2D(Drawn, PrevDrawn) / FrameDt);
+				LegacySpeeds.Add(FVector::Dist2D(Legacy, PrevLegacy) / FrameDt);
+			}
+			PrevDrawn = Drawn;
+			PrevLegacy = Legacy;
+			bHavePrev = true;
+		}
+
+		Result.MeanError = Result.Frames ? ErrorSum / Result.Frames : 0.0;
+		Result.SpeedJitter = StdDev(Speeds);
+		Result.LegacySpeedJitter = StdDev(LegacySpeeds);
+		return Result;
+	}
+
+	/** Piecewise-linear path through (time, position) keys */
+	FVector PathAt(const TArray<TPair<double, FVector>>& Keys, double T)
+	{
+		if (Keys.Num() == 0) return FVector::ZeroVector;
+		if (T <= Keys[0].Key) return Keys[0].Value;
+		for (int32 i = 1; i < Keys.Num(); ++i)
+		{
+			if (T < Keys[i].Key)
+			{
+				const double Alpha = (T - Keys[i - 1].Key) / (Keys[i].Key - Keys[i - 1].Key);
+				return FMath::Lerp(Keys[i - 1].Value, Keys[i].Value, Alpha);
+			}
+		}
+		return Keys.Last().Value;
+	}
+
+	/** Saved/MoveStreams/*.csv from Net.RecordMoves, one packet list per entity */
+	void LoadRecordedStreams(TArray<TArray<FReplayPacket>>& OutStreams, TArray<FString>& OutNames)
+	{
+		const FString Dir = FPaths::ProjectSavedDir() / TEXT("MoveStreams");
+		TArray<FString> Files;
+		IFileManager::Get().FindFiles(Files, *(Dir / TEXT("*.csv")), true, false);
+
+		for (const FString& File : Files)
+		{
+			TArray<FString> Lines;
+			if (!FFileHelper::LoadFileToStringArray(Lines, *(Dir / File))) continue;
+
+			TMap<uint32, TArray<FReplayPacket>> ById;
+			for (int32 i = 1; i < Lines.Num(); ++i)   // skip header
+			{
+				TArray<FString> Cols;
+				if (Lines[i].ParseIntoArray(Cols, TEXT(","), false) != 7) continue;
+				FReplayPacket& P = ById.FindOrAdd((uint32)FCString::Atoi64(*Cols[2])).AddDefaulted_GetRef();
+				P.ArriveLocal = FCString::Atod(*Cols[0]);
+				P.ServerMs = FCString::Atoi64(*Cols[1]);
+				P.Position = FVector(FCString::Atod(*Cols[3]), FCString::Atod(*Cols[4]), FCString::Atod(*Cols[5]));
+				P.bMoving = Cols[6] != TEXT("0");
+			}
+			for (TPair<uint32, TArray<FReplayPacket>>& Pair : ById)
+			{
+				if (Pair.Value.Num() < 20) continue;
+				OutNames.Add(FString::Printf(TEXT("%s #%u"), *File, Pair.Key));
+				OutStreams.Add(MoveTemp(Pair.Value));
+			}
+		}
+	}
+}
+
+bool ASabriMMONetworkTests::Test_Position_Interpolation()
+{
+	// Offline and deterministic: a seeded walk (turns, stops, restarts) sent the way the
+	// player position contract sends it, delivered in order with jittered latency and
+	// occasional 250 ms stalls, replayed through the snapshot buffer at 60 fps.
+	FRandomStream Rng(4242);
+	constexpr float WalkSpeed = 300.f;
+
+	TArray<TPair<double, FVector>> Keys;
+	double T = 0.0;
+	FVector Pos(1000.f, 1000.f, 300.f);
+	float Heading = 0.f;
+	Keys.Emplace(T, Pos);
+	for (int32 Leg = 0; Leg < 24; ++Leg)
+	{
+		Heading += Rng.FRandRange(-100.f, 100.f);
+		const double Duration = Rng.FRandRange(0.8f, 2.0f);
+		const FVector Dir(FMath::Cos(FMath::DegreesToRadians(Heading)), FMath::Sin(FMath::DegreesToRadians(Heading)), 0.f);
+		Pos += Dir * WalkSpeed * Duration;
+		T += Duration;
+		Keys.Emplace(T, Pos);
+		if (Leg % 3 == 2)
+		{
+			T += 1.2;   // stand still
+			Keys.Emplace(T, Pos);
+		}
+	}
+	auto Truth = [&Keys](double At) { return PathAt(Keys, At); };
+	auto IsMovingAt = [&Keys](double At)
+	{
+		for (int32 i = 1; i < Keys.Num(); ++i)
+			if (At < Keys[i].Key) return !Keys[i].Value.Equals(Keys[i - 1].Value);
+		return false;
+	};
+
+	// Sender: every 66 ms while moving, once on stopping, 1 s keepalives while idle
+	TArray<FReplayPacket> Packets;
+	double LastSend = -10.0, PrevArrive = 0.0;
+	bool bWasMoving = false;
+	for (double Send = 0.0; Send <= T; Send += 1.0 / 30.0)
+	{
+		const bool bMoving = IsMovingAt(Send);
+		const bool bSend = bMoving ? (Send - LastSend >= 0.066 - KINDA_SMALL_NUMBER || !bWasMoving)
+		                           : (bWasMoving || Send - LastSend >= 1.0);
+		bWasMoving = bMoving;
+		if (!bSend) continue;
+		LastSend = Send;
+
+		double Latency = 0.08 + Rng.FRandRange(0.f, 0.06f);
+		if (Rng.FRand() < 0.02f) Latency += 0.25;
+		FReplayPacket& P = Packets.AddDefaulted_GetRef();
+		P.ArriveLocal = FMath::Max(PrevArrive, 500.0 + Send + Latency);   // TCP: in order
+		P.ServerMs = static_cast<int64>(Send * 1000.0 + 0.5);
+		P.Position = Truth(Send);
+		P.bMoving = bMoving;
+		PrevArrive = P.ArriveLocal;
+	}
+
+	const FReplayResult R = ReplayStream(Packets, Truth, WalkSpeed);
+	UE_LOG(LogNetworkTests, Log,
+		TEXT("Snapshot interp (synthetic, %d packets): error mean %.1f max %.1f uu, %d/%d frames extrapolated; speed jitter %.1f vs %.1f uu/s legacy"),
+		Packets.Num(), R.MeanError, R.MaxError, R.Extrapolated, R.Frames, R.SpeedJitter, R.LegacySpeedJitter);
+
+	// A sender that never says it stopped (homunculus follow tick before it sent moving=false):
+	// 5 Hz packets, each flagged moving, only while the position changes. Once the stream goes
+	// quiet the buffer must end up where the last packet put it, not out along the last segment.
+	TArray<TPair<double, FVector>> FollowKeys;
+	FollowKeys.Emplace(0.0, FVector(0.f, 0.f, 300.f));
+	FollowKeys.Emplace(1.5, FVector(900.f, 0.f, 300.f));
+	FollowKeys.Emplace(2.7, FVector(900.f, 720.f, 300.f));
+	auto FollowTruth = [&FollowKeys](double At) { return PathAt(FollowKeys, At); };
+
+	TArray<FReplayPacket> FollowPackets;
+	FVector LastSent(FLT_MAX);
+	for (double Send = 0.0; Send <= 4.0; Send += 0.2)
+	{
+		const FVector At = FollowTruth(Send);
+		if (FVector::Dist2D(At, LastSent) <= 2.0) continue;
+		LastSent = At;
+		FReplayPacket& P = FollowPackets.AddDefaulted_GetRef();
+		P.ArriveLocal = 500.0 + Send + 0.1;
+		P.ServerMs = static_cast<int64>(Send * 1000.0 + 0.5);
+		P.Position = At;
+		P.bMoving = true;
+	}
+	const FReplayResult FR = ReplayStream(FollowPackets, FollowTruth, 600.f, 2.0);
+	UE_LOG(LogNetworkTests, Log,
+		TEXT("Snapshot interp (no stop packet, %d packets): error mean %.1f max %.1f uu, at rest %.1f uu"),
+		FollowPackets.Num(), FR.MeanError, FR.MaxError, FR.FinalError);
+
+	// Recorded streams (Net.RecordMoves): no ground truth, so the reference is the path
+	// through the packets themselves at their server times
+	TArray<TArray<FReplayPacket>> Streams;
+	TArray<FString> Names;
+	LoadRecordedStreams(Streams, Names);
+	for (int32 s = 0; s < Streams.Num(); ++s)
+	{
+		const TArray<FReplayPacket>& Stream = Streams[s];
+		TArray<TPair<double, FVector>> RefKeys;
+		int64 BaseMs = -1;
+		for (const FReplayPacket& P : Stream)
+		{
+			if (P.ServerMs < 0) continue;
+			if (BaseMs < 0) BaseMs = P.ServerMs;
+			const double At = static_cast<int32>(static_cast<uint32>(P.ServerMs) - static_cast<uint32>(BaseMs)) * 0.001;
+			if (RefKeys.Num() == 0 || At > RefKeys.Last().Key) RefKeys.Emplace(At, P.Position);
+		}
+		if (RefKeys.Num() < 2) continue;
+
+		const FReplayResult RR = ReplayStream(Stream, [&RefKeys](double At) { return PathAt(RefKeys, At); }, WalkSpeed);
+		UE_LOG(LogNetworkTests, Log,
+			TEXT("Snapshot interp (%s, %d packets): error mean %.1f max %.1f uu, %d/%d frames extrapolated; speed jitter %.1f vs %.1f uu/s legacy"),
+			*Names[s], Stream.Num(), RR.MeanError, RR.MaxError, RR.Extrapolated, RR.Frames, RR.SpeedJitter, RR.LegacySpeedJitter);
+	}
+
+	if (R.MeanError > 10.0 || R.MaxError > 120.0)
+	{
+		LastFailReason = FString::Printf(TEXT("Interpolation error too high (mean %.1f, max %.1f)"), R.MeanError, R.MaxError);
+		return false;
+	}
+	if (FR.FinalError > 1.0)
+	{
+		LastFailReason = FString::Printf(TEXT("Stream without a stop packet came to rest %.1f uu from its last position"), FR.FinalError);
+		return false;
+	}
+	if (R.SpeedJitter >= R.LegacySpeedJitter)
+	{
+		LastFailReason = FString::Printf(TEXT("Buffered speed jitter %.1f not below legacy %.1f"), R.SpeedJitter, R.LegacySpeedJitter);
+		return false;
+	}
+	return true;
+}
+
 // ════════════════════════════════════════════════════════════════
 //  Socket.io Event Tests
 // ════════════════════════════════════════════════════════════════
@@ -551,6 +867,211 @@ bool ASabriMMONetworkTests::Test_Performance_LatencyMeasurement()
 	return true;
 }
 
+bool ASabriMMONetworkTests::Test_Performance_BandwidthUsage()
+{
+	// Offline: round-trip the binary move:batch codec and compare its size
+	// against the per-entity JSON enemy:move it replaces (no socket needed).
+	const int32 NumEntities = 200;
+	const int32 UpdateHz = 30;
+	const int32 Seconds = 5;
+
+	FMoveBatchCodec Encoder;
+	FMoveBatchCodec Decoder;
+	FRandomStream Rng(12345);
+
+	TArray<FMoveRecord> Records;
+	TArray<FVector> Headings;
+	for (int32 i = 0; i < NumEntities; ++i)
+	{
+		FMoveRecord& R = Records.AddDefaulted_GetRef();
+		R.Kind = (i % 5 == 0) ? EMoveEntityKind::Player : EMoveEntityKind::Enemy;
+		R.Id = (R.Kind == EMoveEntityKind::Player) ? 100 + i : 2000000 + i;
+		R.Position = FVector(Rng.FRandRange(0.f, 20000.f), Rng.FRandRange(0.f, 20000.f), 300.f);
+		R.bIsMoving = true;
+		R.bHasWeaponMode = R.Kind == EMoveEntityKind::Player;
+		R.WeaponMode = 1;
+		Headings.Add(FVector(FMath::Cos(Rng.FRandRange(0.f, 2.f * PI)), FMath::Sin(Rng.FRandRange(0.f, 2.f * PI)), 0.f));
+	}
+
+	int64 BinaryBytes = 0;
+	int64 JsonBytes = 0;
+	double MaxError = 0.0;
+	TArray<uint8> Packet;
+	TArray<FMoveRecord> Decoded;
+
+	for (int32 Frame = 0; Frame < UpdateHz * Seconds; ++Frame)
+	{
+		for (int32 i = 0; i < NumEntities; ++i)
+		{
+			Records[i].Position += Headings[i] * (200.f / UpdateHz);
+		}
+
+		Encoder.Encode(Records, static_cast<uint32>(Frame), Packet);
+		// Socket.io binary event frame overhead (451-["move:batch",{"_placeholder":true,"num":0}])
+		BinaryBytes += Packet.Num() + 45;
+
+		Decoded.Reset();
+		if (!Decoder.Decode(Packet.GetData(), Packet.Num(), Decoded) || Decoded.Num() != NumEntities)
+		{
+			LastFailReason = FString::Printf(TEXT("Decode failed on frame %d (%d/%d records)"), Frame, Decoded.Num(), NumEntities);
+			return false;
+		}
+		for (int32 i = 0; i < NumEntities; ++i)
+		{
+			if (Decoded[i].Id != Records[i].Id || Decoded[i].Kind != Records[i].Kind)
+			{
+				LastFailReason = FString::Printf(TEXT("Record %d id/kind mismatch on frame %d"), i, Frame);
+				return false;
+			}
+			MaxError = FMath::Max(MaxError, FVector::Dist(Decoded[i].Position, Records[i].Position));
+
+			TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+			Json->SetNumberField(TEXT("enemyId"), Records[i].Id);
+			Json->SetNumberField(TEXT("x"), Records[i].Position.X);
+			Json->SetNumberField(TEXT("y"), Records[i].Position.Y);
+			Json->SetNumberField(TEXT("z"), Records[i].Position.Z);
+			Json->SetNumberField(TEXT("targetX"), Records[i].Position.X);
+			Json->SetNumberField(TEXT("targetY"), Records[i].Position.Y);
+			Json->SetBoolField(TEXT("isMoving"), true);
+			FString JsonStr;
+			TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+				TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&JsonStr);
+			FJsonSerializer::Serialize(Json.ToSharedRef(), Writer);
+			// 42["enemy:move",{...}]
+			JsonBytes += JsonStr.Len() + 17;
+		}
+	}
+
+	// Quantization is 1 UE unit per axis
+	if (MaxError > FMoveBatchCodec::PositionQuantum)
+	{
+		LastFailReason = FString::Printf(TEXT("Position error %.3f exceeds quantum"), MaxError);
+		return false;
+	}
+
+	const double PerEntityBinary = double(BinaryBytes) / NumEntities / Seconds;
+	const double PerEntityJson = double(JsonBytes) / NumEntities / Seconds;
+	UE_LOG(LogNetworkTests, Log, TEXT("Move bandwidth: JSON %.0f B/entity/s, move:batch %.0f B/entity/s (%.1fx smaller)"),
+		PerEntityJson, PerEntityBinary, PerEntityJson / FMath::Max(PerEntityBinary, 1.0));
+
+	if (PerEntityBinary * 4.0 > PerEntityJson)
+	{
+		LastFailReason = FString::Printf(TEXT("move:batch only %.1fx smaller than JSON"), PerEntityJson / PerEntityBinary);
+		return false;
+	}
+	return true;
+}
+
+bool ASabriMMONetworkTests::Test_Performance_BlueprintBindings()
+{
+	// Offline: 10k synthetic enemy:move packets applied the way the non-sprite move path
+	// applies them (TargetPosition + bIsMoving on BP_EnemyCharacter), once through the
+	// per-call FindPropertyByName helpers the entity subsystems used and once through a
+	// TBPBindingCache. The test runner itself stands in for a sprite enemy: none of the
+	// variables exist, so the lookup path walks the whole class to find nothing.
+	constexpr int32 NumPackets = 10000;
+	constexpr int32 Rounds = 5;   // best of, to keep a context switch out of the numbers
+
+	UClass* EnemyClass = LoadClass<AActor>(nullptr,
+		TEXT("/Game/SabriMMO/Blueprints/BP_EnemyCharacter.BP_EnemyCharacter_C"));
+	if (!EnemyClass)
+	{
+		LastFailReason = TEXT("BP_EnemyCharacter not found");
+		return false;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	AActor* Enemy = GetWorld()->SpawnActor<AActor>(EnemyClass, FVector(0.f, 0.f, -100000.f), FRotator::ZeroRotator, SpawnParams);
+	if (!Enemy)
+	{
+		LastFailReason = TEXT("Could not spawn BP_EnemyCharacter");
+		return false;
+	}
+	Enemy->SetActorHiddenInGame(true);
+	Enemy->SetActorTickEnabled(false);   // keep the BP from chasing TargetPosition mid-run
+
+	FRandomStream Rng(2024);
+	TArray<FVector> Positions;
+	Positions.Reserve(NumPackets);
+	for (int32 i = 0; i < NumPackets; ++i)
+	{
+		Positions.Emplace(Rng.FRandRange(0.f, 20000.f), Rng.FRandRange(0.f, 20000.f), 300.f);
+	}
+
+	// Old path, as SetBPVector / SetBPBool did it
+	auto RunLookup = [&Positions](AActor* Target)
+	{
+		const double Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumPackets; ++i)
+		{
+			if (FStructProperty* P = CastField<FStructProperty>(Target->GetClass()->FindPropertyByName(TEXT("TargetPosition"))))
+			{
+				if (P->Struct == TBaseStructure<FVector>::Get())
+					*P->ContainerPtrToValuePtr<FVector>(Target) = Positions[i];
+			}
+			if (FBoolProperty* P = CastField<FBoolProperty>(Target->GetClass()->FindPropertyByName(TEXT("bIsMoving"))))
+				P->SetPropertyValue_InContainer(Target, (i & 7) != 0);
+		}
+		return (FPlatformTime::Seconds() - Start) * 1e9 / NumPackets;
+	};
+
+	// New path, as EnemySubsystem::HandleEnemyMove does it
+	TBPBindingCache<FBPMovementBindings> Cache;
+	auto RunBound = [&Positions, &Cache](AActor* Target)
+	{
+		const double Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumPackets; ++i)
+		{
+			const FBPMovementBindings& BP = Cache.Get(Target);
+			BP.TargetPosition.Set(Target, Positions[i]);
+			BP.IsMoving.Set(Target, (i & 7) != 0);
+		}
+		return (FPlatformTime::Seconds() - Start) * 1e9 / NumPackets;
+	};
+
+	double LookupNs = DBL_MAX, BoundNs = DBL_MAX, LookupMissNs = DBL_MAX, BoundMissNs = DBL_MAX;
+	for (int32 Round = 0; Round < Rounds; ++Round)
+	{
+		LookupNs = FMath::Min(LookupNs, RunLookup(Enemy));
+		BoundNs = FMath::Min(BoundNs, RunBound(Enemy));
+		LookupMissNs = FMath::Min(LookupMissNs, RunLookup(this));
+		BoundMissNs = FMath::Min(BoundMissNs, RunBound(this));
+	}
+
+	// Both paths must have landed the same values
+	const FBPMovementBindings& BP = Cache.Get(Enemy);
+	FVector Written = FVector::ZeroVector;
+	if (FStructProperty* P = CastField<FStructProperty>(EnemyClass->FindPropertyByName(TEXT("TargetPosition"))))
+		Written = *P->ContainerPtrToValuePtr<FVector>(Enemy);
+	const bool bMovingWritten = BP.IsMoving.Get(Enemy);
+	const bool bBound = BP.TargetPosition.IsBound() && BP.IsMoving.IsBound();
+	Enemy->Destroy();
+
+	UE_LOG(LogNetworkTests, Log,
+		TEXT("BP bindings (%d move packets): BP enemy %.0f -> %.0f ns/packet (%.1fx), no-variable actor %.0f -> %.0f ns/packet (%.1fx)"),
+		NumPackets, LookupNs, BoundNs, LookupNs / FMath::Max(BoundNs, 0.1),
+		LookupMissNs, BoundMissNs, LookupMissNs / FMath::Max(BoundMissNs, 0.1));
+
+	if (!bBound)
+	{
+		LastFailReason = TEXT("TargetPosition / bIsMoving did not bind on BP_EnemyCharacter");
+		return false;
+	}
+	if (!Written.Equals(Positions.Last()) || bMovingWritten != (((NumPackets - 1) & 7) != 0))
+	{
+		LastFailReason = TEXT("Bound writes did not land in the BP variables");
+		return false;
+	}
+	if (BoundNs >= LookupNs || BoundMissNs >= LookupMissNs)
+	{
+		LastFailReason = FString::Printf(TEXT("Bound path not faster (%.0f vs %.0f ns, %.0f vs %.0f ns)"),
+			BoundNs, LookupNs, BoundMissNs, LookupMissNs);
+		return false;
+	}
+	return true;
+}
+
 // ════════════════════════════════════════════════════════════════
 //  Helper Functions
 // ════════════════════════════════════════════════════════════════
@@ -89,6 +89,7 @@ private:
 	bool Test_Performance_LatencyMeasurement();
 	bool Test_Performance_ConcurrentConnections();
 	bool Test_Performance_MemoryUsage();
+	bool Test_Performance_BlueprintBindings();
 
 	// ── Error Handling Tests ──
 	bool Test_Error_InvalidEvents();
@@ -4,6 +4,7 @@
 
 #include "ShopNPC.h"
 #include "UI/NameTagSubsystem.h"
+#include "UI/EntityRegistrySubsystem.h"
 #include "Sprite/SpriteCharacterActor.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/StaticMeshComponent.h"
@@ -62,6 +63,12 @@ void AShopNPC::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// Minimap NPC dots and ground-trace ignore lists read NPCs from the registry
+	if (UEntityRegistrySubsystem* Registry = GetWorld() ? GetWorld()->GetSubsystem<UEntityRegistrySubsystem>() : nullptr)
+	{
+		Registry->Register(EEntityCategory::NPC, (int32)GetUniqueID(), this);
+	}
+
 	// Re-apply at runtime in case existing placed actors have stale serialized collision
 	// settings from before the constructor was updated. Cursor traces must reach the sprite.
 	if (CapsuleComp)
@@ -0,0 +1,164 @@
+// SnapshotBuffer.cpp — Snapshot interpolation buffer and server clock estimate (see header).
+
+#include "SnapshotBuffer.h"
+
+namespace
+{
+	// Gaps longer than this are idle periods or loss, not the send interval
+	constexpr double MaxIntervalSample = 0.5;
+
+	// Used until an entity has a measured interval (30Hz server flush x2)
+	constexpr double DefaultInterval = 0.066;
+}
+
+// ============================================================
+// FSnapshotBuffer
+// ============================================================
+
+void FSnapshotBuffer::Append(const FMotionSnapshot& Snap)
+{
+	if (Count == Capacity)
+	{
+		Head = (Head + 1) % Capacity;
+		--Count;
+	}
+	Ring[(Head + Count) % Capacity] = Snap;
+	++Count;
+}
+
+bool FSnapshotBuffer::Push(double Time, const FVector& Position, bool bMoving, float SnapDistance)
+{
+	if (Count == 0)
+	{
+		Append({ Time, Position, bMoving });
+		return true;
+	}
+
+	const FMotionSnapshot Last = Newest();
+	if (Time <= Last.Time) return false;
+
+	if (FVector::DistSquared2D(Position, Last.Position) > FMath::Square(SnapDistance))
+	{
+		Reset(Time, Position);
+		Ring[Head].bMoving = bMoving;
+		bSnapped = true;
+		return true;
+	}
+
+	const double Dt = Time - Last.Time;
+	if (Dt < MaxIntervalSample && bMoving)
+	{
+		MeanInterval = MeanInterval > 0.f ? FMath::Lerp(MeanInterval, (float)Dt, 0.1f) : (float)Dt;
+	}
+
+	// Starting off after standing still: the server only began sending once the entity
+	// moved, so without a rest point one interval back it would glide over the whole idle gap
+	const double Interval = MeanInterval > 0.f ? MeanInterval : DefaultInterval;
+	if (!Last.bMoving && Dt > Interval * 2.5)
+	{
+		Append({ Time - Interval, Last.Position, false });
+	}
+
+	Append({ Time, Position, bMoving });
+	return true;
+}
+
+void FSnapshotBuffer::Reset(double Time, const FVector& Position)
+{
+	Head = 0;
+	Count = 0;
+	Append({ Time, Position, false });
+}
+
+ESnapshotSample FSnapshotBuffer::Sample(double RenderTime, double MaxExtrapolation, FVector& OutPosition, bool& bOutMoving) const
+{
+	bOutMoving = false;
+	if (Count == 0) return ESnapshotSample::None;
+
+	const FMotionSnapshot& First = At(0);
+	if (RenderTime <= First.Time || Count == 1)
+	{
+		OutPosition = First.Position;
+		return ESnapshotSample::Held;
+	}
+
+	const FMotionSnapshot& Last = Newest();
+	if (RenderTime < Last.Time)
+	{
+		// Newest-first: the bracket is almost always among the last two or three
+		for (int32 i = Count - 2; i >= 0; --i)
+		{
+			const FMotionSnapshot& A = At(i);
+			if (A.Time <= RenderTime)
+			{
+				const FMotionSnapshot& B = At(i + 1);
+				const double Alpha = (RenderTime - A.Time) / (B.Time - A.Time);
+				OutPosition = FMath::Lerp(A.Position, B.Position, Alpha);
+				bOutMoving = !A.Position.Equals(B.Position, 1.0);
+				return ESnapshotSample::Interpolated;
+			}
+		}
+	}
+
+	// Past the newest: keep going along the last segment while it was moving, then stop
+	const FMotionSnapshot& Prev = At(Count - 2);
+	if (!Last.bMoving || MaxExtrapolation <= 0.0)
+	{
+		OutPosition = Last.Position;
+		return ESnapshotSample::Held;
+	}
+
+	const FVector Velocity = (Last.Position - Prev.Position) / (Last.Time - Prev.Time);
+	const double Ahead = RenderTime - Last.Time;
+	if (Ahead < MaxExtrapolation)
+	{
+		OutPosition = Last.Position + Velocity * Ahead;
+		bOutMoving = !Velocity.IsNearlyZero(1.0);
+		return ESnapshotSample::Extrapolated;
+	}
+
+	// The stream ended without a rest snapshot (lost, or a sender that never sends one):
+	// the newest position is the last thing known, so settle back onto it over another
+	// MaxExtrapolation rather than resting at the projected point
+	const double Back = FMath::Min((Ahead - MaxExtrapolation) / MaxExtrapolation, 1.0);
+	OutPosition = Last.Position + Velocity * (MaxExtrapolation * (1.0 - Back));
+	return ESnapshotSample::Held;
+}
+
+// ============================================================
+// FServerClock
+// ============================================================
+
+double FServerClock::Unwrap(uint32 ServerTimeMs)
+{
+	if (!bValid)
+	{
+		LastRawMs = ServerTimeMs;
+		UnwrappedMs = ServerTimeMs;
+		BaseMs = UnwrappedMs;
+	}
+	else
+	{
+		// Signed 32-bit difference handles the 49-day wrap and slightly out-of-order stamps
+		UnwrappedMs += static_cast<int32>(ServerTimeMs - LastRawMs);
+		LastRawMs = ServerTimeMs;
+	}
+	return double(UnwrappedMs - BaseMs) * 0.001;
+}
+
+double FServerClock::Observe(uint32 ServerTimeMs, double LocalSeconds)
+{
+	const double ServerSeconds = Unwrap(ServerTimeMs);
+	const double Sample = ServerSeconds - LocalSeconds;
+
+	if (!bValid || Sample > Offset)
+	{
+		Offset = Sample;
+		bValid = true;
+	}
+	else
+	{
+		Offset += (Sample - Offset) * RelaxRate;
+	}
+	return ServerSeconds;
+}
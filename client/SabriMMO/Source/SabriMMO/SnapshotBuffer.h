@@ -0,0 +1,105 @@
+// SnapshotBuffer.h — Server-timestamped position snapshots for remote entity movement.
+// FServerClock turns the server timestamps carried by move:batch / player:moved into a
+// local estimate of "server now"; FSnapshotBuffer keeps the last few positions of one entity
+// and answers "where was it at server time T" by interpolating between the two snapshots
+// around T (rendered a little in the past so T is almost always bracketed), or by
+// extrapolating along the last segment for a bounded time when packets are late or lost
+// and then settling back onto the newest snapshot if nothing more arrives.
+// Plain C++ (no UObjects) so the network tests can replay recorded streams through it.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FMotionSnapshot
+{
+	double Time = 0.0;               // server time, seconds (FServerClock timeline)
+	FVector Position = FVector::ZeroVector;
+	bool bMoving = false;
+};
+
+enum class ESnapshotSample : uint8
+{
+	None,           // buffer empty
+	Interpolated,   // render time bracketed by two snapshots
+	Extrapolated,   // past the newest snapshot, projected along the last segment
+	Held,           // at rest, before the oldest snapshot, or past the extrapolation limit (settling back onto the newest)
+};
+
+/**
+ * Fixed-size ring of one entity's snapshots, oldest to newest.
+ * Snapshots must arrive in server-time order; older or duplicate ones are dropped.
+ */
+class SABRIMMO_API FSnapshotBuffer
+{
+public:
+	static constexpr int32 Capacity = 16;
+
+	/**
+	 * Append a snapshot. A jump longer than SnapDistance (teleport, Fly Wing, knockback)
+	 * discards the history so the entity snaps instead of sliding. Returns false if dropped.
+	 */
+	bool Push(double Time, const FVector& Position, bool bMoving, float SnapDistance);
+
+	/**
+	 * Position at RenderTime. Extrapolates at most MaxExtrapolation seconds past the newest
+	 * snapshot, then eases back onto it over the same time and holds there.
+	 */
+	ESnapshotSample Sample(double RenderTime, double MaxExtrapolation, FVector& OutPosition, bool& bOutMoving) const;
+
+	/** Forget history and rest at Position (local teleport / respawn) */
+	void Reset(double Time, const FVector& Position);
+	void Clear() { Count = 0; MeanInterval = 0.f; }
+
+	int32 Num() const { return Count; }
+	const FMotionSnapshot& Newest() const { return At(Count - 1); }
+
+	/** Smoothed time between consecutive moving snapshots (0 until two have arrived) */
+	float GetMeanInterval() const { return MeanInterval; }
+
+	/** True once after Push discarded history for a snap */
+	bool ConsumeSnap() { const bool b = bSnapped; bSnapped = false; return b; }
+
+private:
+	/** i = 0 is the oldest snapshot */
+	const FMotionSnapshot& At(int32 i) const { return Ring[(Head + i) % Capacity]; }
+	void Append(const FMotionSnapshot& Snap);
+
+	FMotionSnapshot Ring[Capacity];
+	int32 Head = 0;
+	int32 Count = 0;
+	float MeanInterval = 0.f;
+	bool bSnapped = false;
+};
+
+/**
+ * Offset between the local clock and the server's. Server timestamps are ms mod 2^32
+ * (the move:batch header); they are unwrapped and expressed in seconds since the first
+ * observation. The offset follows the least-delayed packet seen: it rises immediately to a
+ * fresher sample and relaxes slowly toward later ones, so a latency spike does not drag
+ * everyone's render time back while a lasting route change is still absorbed.
+ */
+class SABRIMMO_API FServerClock
+{
+public:
+	/** Feed a timestamp received at LocalSeconds (FPlatformTime::Seconds). Returns it in server seconds. */
+	double Observe(uint32 ServerTimeMs, double LocalSeconds);
+
+	/** Estimated current server time */
+	double Now(double LocalSeconds) const { return LocalSeconds + Offset; }
+
+	bool IsValid() const { return bValid; }
+	void Reset() { bValid = false; Offset = 0.0; }
+
+	/** Fraction of the gap closed per later-than-expected sample */
+	static constexpr double RelaxRate = 0.01;
+
+private:
+	double Unwrap(uint32 ServerTimeMs);
+
+	bool bValid = false;
+	uint32 LastRawMs = 0;
+	int64 UnwrappedMs = 0;
+	int64 BaseMs = 0;
+	double Offset = 0.0;
+};
@@ -2,9 +2,226 @@
 
 #include "SocketEventRouter.h"
 #include "SocketIONative.h"
+#include "MMOGameInstance.h"
+#include "Dom/JsonObject.h"
+#include "HAL/IConsoleManager.h"
+#include "Engine/World.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogSocketRouter, Log, All);
 
+// Console command: SocketRouter.Stats [reset]
+static FAutoConsoleCommandWithWorldAndArgs GSocketRouterStatsCmd(
+	TEXT("SocketRouter.Stats"),
+	TEXT("Log per-event handler dispatch counts (invoked vs. keyed matched/skipped). Usage: SocketRouter.Stats [reset]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UMMOGameInstance* GI = World ? Cast<UMMOGameInstance>(World->GetGameInstance()) : nullptr;
+		USocketEventRouter* Router = GI ? GI->GetEventRouter() : nullptr;
+		if (!Router) return;
+
+		Router->LogDispatchStats();
+		if (Args.Num() > 0 && Args[0] == TEXT("reset"))
+		{
+			Router->ResetDispatchStats();
+		}
+	})
+);
+
+namespace
+{
+	// Read an integer id from a payload field. Server ids are numbers, but a few
+	// legacy events send them stringified — accept both.
+	bool TryGetEntityKey(const TSharedPtr<FJsonObject>& Obj, const FString& KeyField, int32& OutKey)
+	{
+		const TSharedPtr<FJsonValue> Field = Obj->TryGetField(KeyField);
+		if (!Field.IsValid()) return false;
+
+		if (Field->Type == EJson::Number)
+		{
+			OutKey = static_cast<int32>(Field->AsNumber());
+			return true;
+		}
+		if (Field->Type == EJson::String)
+		{
+			const FString Str = Field->AsString();
+			if (!Str.IsNumeric()) return false;
+			OutKey = FCString::Atoi(*Str);
+			return true;
+		}
+		return false;
+	}
+}
+
+// ============================================================
+// FEntry — per-event handler storage + dispatch
+// ============================================================
+
+int32 USocketEventRouter::FEntry::NumHandlers() const
+{
+	int32 Count = Handlers.Num() + (Typed.IsValid() ? Typed->Num() : 0);
+	for (const FKeyedIndex& Index : KeyedIndices)
+	{
+		Count += Index.NumHandlers;
+	}
+	return Count;
+}
+
+void USocketEventRouter::FEntry::Dispatch(const TSharedPtr<FJsonValue>& Message)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_SocketRouter_Dispatch);
+
+	++Stats.Messages;
+	++DispatchDepth;
+
+	// Broadcast handlers. Iterate by index: callbacks may append to the array,
+	// and handlers added mid-dispatch should not see this message.
+	const int32 NumBroadcast = Handlers.Num();
+	for (int32 i = 0; i < NumBroadcast && i < Handlers.Num(); ++i)
+	{
+		const FHandlerRef H = Handlers[i];
+		if (H->bRemoved || !H->Owner.IsValid() || !H->Callback) continue;
+		++Stats.HandlersInvoked;
+		H->Callback(Message);
+	}
+
+	// Typed handlers — decoded once, shared by const reference
+	if (Typed.IsValid())
+	{
+		int32 TypedInvoked = 0;
+		if (Typed->Dispatch(Message, TypedInvoked))
+		{
+			++Stats.TypedDecodes;
+			Stats.HandlersInvoked += TypedInvoked;
+		}
+	}
+
+	// Entity-keyed handlers — one field extraction + one map lookup per key field
+	if (KeyedIndices.Num() > 0)
+	{
+		const TSharedPtr<FJsonObject> Obj = Message.IsValid() ? Message->AsObject() : nullptr;
+		for (int32 k = 0; k < KeyedIndices.Num(); ++k)
+		{
+			const int32 NumKeyed = KeyedIndices[k].NumHandlers;
+			int32 Matched = 0;
+
+			int32 Key = 0;
+			if (Obj.IsValid() && NumKeyed > 0 && TryGetEntityKey(Obj, KeyedIndices[k].KeyField, Key))
+			{
+				if (const TArray<FHandlerRef>* Found = KeyedIndices[k].ByEntity.Find(Key))
+				{
+					// Copy the (usually 1-element) bucket: callbacks may register and rehash ByEntity
+					const TArray<FHandlerRef, TInlineAllocator<4>> Bucket(*Found);
+					for (const FHandlerRef& H : Bucket)
+					{
+						if (H->bRemoved || !H->Owner.IsValid() || !H->Callback) continue;
+						++Matched;
+						H->Callback(Message);
+					}
+				}
+			}
+
+			Stats.HandlersInvoked += Matched;
+			Stats.KeyedMatched += Matched;
+			Stats.KeyedSkipped += FMath::Max(0, NumKeyed - Matched);
+		}
+	}
+
+	if (--DispatchDepth == 0 && bNeedsCompact)
+	{
+		Compact();
+	}
+}
+
+int32 USocketEventRouter::FEntry::RemoveWhere(TFunctionRef<bool(const FHandler&)> Pred)
+{
+	int32 Removed = 0;
+	auto MarkRemoved = [&Pred, &Removed](const FHandlerRef& H)
+	{
+		if (!H->bRemoved && Pred(*H))
+		{
+			H->bRemoved = true;
+			++Removed;
+		}
+	};
+
+	for (const FHandlerRef& H : Handlers)
+	{
+		MarkRemoved(H);
+	}
+	for (FKeyedIndex& Index : KeyedIndices)
+	{
+		for (auto& Pair : Index.ByEntity)
+		{
+			for (const FHandlerRef& H : Pair.Value)
+			{
+				MarkRemoved(H);
+			}
+		}
+	}
+	if (Typed.IsValid())
+	{
+		Removed += Typed->MarkRemovedWhere(Pred);
+	}
+
+	if (Removed > 0)
+	{
+		bNeedsCompact = true;
+		if (DispatchDepth == 0)
+		{
+			Compact();
+		}
+	}
+	return Removed;
+}
+
+void USocketEventRouter::FEntry::Compact()
+{
+	auto IsRemoved = [](const FHandlerRef& H) { return H->bRemoved; };
+
+	Handlers.RemoveAll(IsRemoved);
+	if (Typed.IsValid())
+	{
+		Typed->Compact();
+	}
+	for (FKeyedIndex& Index : KeyedIndices)
+	{
+		Index.NumHandlers = 0;
+		for (auto It = Index.ByEntity.CreateIterator(); It; ++It)
+		{
+			It->Value.RemoveAll(IsRemoved);
+			if (It->Value.Num() == 0)
+			{
+				It.RemoveCurrent();
+			}
+			else
+			{
+				Index.NumHandlers += It->Value.Num();
+			}
+		}
+	}
+	bNeedsCompact = false;
+}
+
+// ============================================================
+// Registration
+// ============================================================
+
+TSharedPtr<USocketEventRouter::FEntry> USocketEventRouter::FindOrAddEntry(const FString& EventName)
+{
+	TSharedPtr<FEntry>& EntryRef = HandlerMap.FindOrAdd(EventName);
+	if (!EntryRef.IsValid())
+	{
+		EntryRef = MakeShared<FEntry>();
+
+		// First handler for this event — if we have a native client, bind the native listener now
+		if (CachedNative.IsValid())
+		{
+			BindNativeEvent(EventName, EntryRef);
+		}
+	}
+	return EntryRef;
+}
+
 uint32 USocketEventRouter::RegisterHandler(
 	const FString& EventName,
 	UObject* Owner,
@@ -12,30 +229,50 @@ uint32 USocketEventRouter::RegisterHandler(
 {
 	uint32 Id = NextHandleId++;
 
-	TSharedPtr<FEntry>& EntryRef = HandlerMap.FindOrAdd(EventName);
-	bool bFirstHandler = false;
+	TSharedPtr<FEntry> Entry = FindOrAddEntry(EventName);
 
-	if (!EntryRef.IsValid())
-	{
-		EntryRef = MakeShared<FEntry>();
-		bFirstHandler = true;
-	}
+	FHandlerRef H = MakeShared<FHandler>();
+	H->HandleId = Id;
+	H->Owner = Owner;
+	H->Callback = MoveTemp(Handler);
+	Entry->Handlers.Add(MoveTemp(H));
+
+	UE_LOG(LogSocketRouter, Verbose, TEXT("RegisterHandler: %s (handle=%u, owner=%s, total=%d)"),
+		*EventName, Id, Owner ? *Owner->GetName() : TEXT("null"), Entry->NumHandlers());
+
+	return Id;
+}
+
+uint32 USocketEventRouter::RegisterEntityHandler(
+	const FString& EventName,
+	const FString& KeyField,
+	int32 EntityId,
+	UObject* Owner,
+	TFunction<void(const TSharedPtr<FJsonValue>&)> Handler)
+{
+	uint32 Id = NextHandleId++;
 
-	FHandler H;
-	H.HandleId = Id;
-	H.Owner = Owner;
-	H.Callback = MoveTemp(Handler);
-	EntryRef->Handlers.Add(MoveTemp(H));
+	TSharedPtr<FEntry> Entry = FindOrAddEntry(EventName);
 
-	// If this is the first handler for this event and we have a native client,
-	// bind the native listener now
-	if (bFirstHandler && CachedNative.IsValid())
+	FKeyedIndex* Index = Entry->KeyedIndices.FindByPredicate([&KeyField](const FKeyedIndex& I)
 	{
-		BindNativeEvent(EventName, EntryRef);
+		return I.KeyField == KeyField;
+	});
+	if (!Index)
+	{
+		Index = &Entry->KeyedIndices.AddDefaulted_GetRef();
+		Index->KeyField = KeyField;
 	}
 
-	UE_LOG(LogSocketRouter, Verbose, TEXT("RegisterHandler: %s (handle=%u, owner=%s, total=%d)"),
-		*EventName, Id, Owner ? *Owner->GetName() : TEXT("null"), EntryRef->Handlers.Num());
+	FHandlerRef H = MakeShared<FHandler>();
+	H->HandleId = Id;
+	H->Owner = Owner;
+	H->Callback = MoveTemp(Handler);
+	Index->ByEntity.FindOrAdd(EntityId).Add(MoveTemp(H));
+	Index->NumHandlers++;
+
+	UE_LOG(LogSocketRouter, Verbose, TEXT("RegisterEntityHandler: %s[%s=%d] (handle=%u, owner=%s, total=%d)"),
+		*EventName, *KeyField, EntityId, Id, Owner ? *Owner->GetName() : TEXT("null"), Entry->NumHandlers());
 
 	return Id;
 }
@@ -51,12 +288,10 @@ void USocketEventRouter::UnregisterAllForOwner(UObject* Owner)
 		TSharedPtr<FEntry>& Entry = Pair.Value;
 		if (!Entry.IsValid()) continue;
 
-		int32 Before = Entry->Handlers.Num();
-		Entry->Handlers.RemoveAll([Owner](const FHandler& H)
+		RemovedCount += Entry->RemoveWhere([Owner](const FHandler& H)
 		{
 			return !H.Owner.IsValid() || H.Owner.Get() == Owner;
 		});
-		RemovedCount += Before - Entry->Handlers.Num();
 	}
 
 	if (RemovedCount > 0)
@@ -73,14 +308,13 @@ void USocketEventRouter::UnregisterHandler(uint32 HandleId)
 		TSharedPtr<FEntry>& Entry = Pair.Value;
 		if (!Entry.IsValid()) continue;
 
-		int32 Idx = Entry->Handlers.IndexOfByPredicate([HandleId](const FHandler& H)
+		const int32 Removed = Entry->RemoveWhere([HandleId](const FHandler& H)
 		{
 			return H.HandleId == HandleId;
 		});
 
-		if (Idx != INDEX_NONE)
+		if (Removed > 0)
 		{
-			Entry->Handlers.RemoveAt(Idx);
 			UE_LOG(LogSocketRouter, Verbose, TEXT("UnregisterHandler: handle=%u from event %s"), HandleId, *Pair.Key);
 			return;
 		}
@@ -115,7 +349,7 @@ void USocketEventRouter::RebindAllEvents()
 
 	for (auto& Pair : HandlerMap)
 	{
-		if (Pair.Value.IsValid() && Pair.Value->Handlers.Num() > 0)
+		if (Pair.Value.IsValid() && Pair.Value->NumHandlers() > 0)
 		{
 			BindNativeEvent(Pair.Key, Pair.Value);
 		}
@@ -125,38 +359,81 @@ void USocketEventRouter::RebindAllEvents()
 bool USocketEventRouter::HasHandlersFor(const FString& EventName) const
 {
 	const TSharedPtr<FEntry>* Found = HandlerMap.Find(EventName);
-	return Found && Found->IsValid() && (*Found)->Handlers.Num() > 0;
+	return Found && Found->IsValid() && (*Found)->NumHandlers() > 0;
+}
+
+// ============================================================
+// Stats
+// ============================================================
+
+void USocketEventRouter::GetDispatchStats(TArray<TPair<FString, FSocketEventDispatchStats>>& OutStats) const
+{
+	OutStats.Reset();
+	for (const auto& Pair : HandlerMap)
+	{
+		if (Pair.Value.IsValid() && Pair.Value->Stats.Messages > 0)
+		{
+			OutStats.Emplace(Pair.Key, Pair.Value->Stats);
+		}
+	}
+	OutStats.Sort([](const TPair<FString, FSocketEventDispatchStats>& A, const TPair<FString, FSocketEventDispatchStats>& B)
+	{
+		return A.Value.HandlersInvoked + A.Value.KeyedSkipped > B.Value.HandlersInvoked + B.Value.KeyedSkipped;
+	});
+}
+
+void USocketEventRouter::ResetDispatchStats()
+{
+	for (auto& Pair : HandlerMap)
+	{
+		if (Pair.Value.IsValid())
+		{
+			Pair.Value->Stats = FSocketEventDispatchStats();
+		}
+	}
+}
+
+void USocketEventRouter::LogDispatchStats() const
+{
+	TArray<TPair<FString, FSocketEventDispatchStats>> Stats;
+	GetDispatchStats(Stats);
+
+	uint64 TotalInvoked = 0, TotalMatched = 0, TotalSkipped = 0;
+	UE_LOG(LogSocketRouter, Log, TEXT("=== SocketRouter dispatch stats (%d events) ==="), Stats.Num());
+	for (const auto& Pair : Stats)
+	{
+		const FSocketEventDispatchStats& S = Pair.Value;
+		UE_LOG(LogSocketRouter, Log, TEXT("  %-32s msgs=%llu invoked=%llu keyedMatched=%llu keyedSkipped=%llu typedDecodes=%llu"),
+			*Pair.Key, S.Messages, S.HandlersInvoked, S.KeyedMatched, S.KeyedSkipped, S.TypedDecodes);
+		TotalInvoked += S.HandlersInvoked;
+		TotalMatched += S.KeyedMatched;
+		TotalSkipped += S.KeyedSkipped;
+	}
+	UE_LOG(LogSocketRouter, Log, TEXT("  TOTAL invoked=%llu keyedMatched=%llu keyedSkipped=%llu"),
+		TotalInvoked, TotalMatched, TotalSkipped);
 }
 
+// ============================================================
+// Native binding
+// ============================================================
+
 void USocketEventRouter::BindNativeEvent(const FString& EventName, TSharedPtr<FEntry> Entry)
 {
 	if (!CachedNative.IsValid() || !Entry.IsValid()) return;
 
-	// Capture the TSharedPtr<FEntry> — this remains stable even if the TArray reallocates
+	// Capture the TSharedPtr<FEntry> — this remains stable even if the HandlerMap reallocates
 	TSharedPtr<FEntry> CapturedEntry = Entry;
 
 	CachedNative->OnEvent(EventName,
 		[CapturedEntry](const FString& Event, const TSharedPtr<FJsonValue>& Message)
 		{
 			if (!CapturedEntry.IsValid()) return;
-
-			// Iterate a copy of handlers in case callbacks modify the list
-			TArray<FHandler> HandlersCopy = CapturedEntry->Handlers;
-			for (const FHandler& H : HandlersCopy)
-			{
-				// Skip handlers whose owner has been destroyed
-				if (!H.Owner.IsValid()) continue;
-
-				if (H.Callback)
-				{
-					H.Callback(Message);
-				}
-			}
+			CapturedEntry->Dispatch(Message);
 		},
 		TEXT("/"),
 		ESIOThreadOverrideOption::USE_GAME_THREAD
 	);
 
 	UE_LOG(LogSocketRouter, Verbose, TEXT("BindNativeEvent: %s (%d handlers)"),
-		*EventName, Entry->Handlers.Num());
+		*EventName, Entry->NumHandlers());
 }
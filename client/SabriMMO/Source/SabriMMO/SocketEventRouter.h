@@ -1,16 +1,43 @@
 // SocketEventRouter.h — Multi-handler dispatch layer for Socket.io events.
 // FSocketIONative::OnEvent() replaces the previous handler for the same event name.
 // This router allows multiple subsystems to register handlers for the same event.
+//
+// Handlers come in two flavours:
+//   - Broadcast: invoked for every message of the event (RegisterHandler).
+//   - Entity-keyed: invoked only when a numeric id field of the payload (attackerId,
+//     targetId, casterId, killedId...) equals the registered entity id
+//     (RegisterEntityHandler). The key is extracted once per message and looked up in
+//     a TMap, so 300 sprites listening to combat:damage cost one lookup, not 300 lambdas.
+//   - Typed: the payload is decoded once per message into a USTRUCT (see
+//     SocketEventTypes.h) and every subscriber gets the same const reference
+//     (RegisterTypedHandler). Used for the hot combat/movement events; cold events
+//     keep the plain JSON path.
 
 #pragma once
 
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
 #include "Dom/JsonValue.h"
+#include "SocketEventTypes.h"
 #include "SocketEventRouter.generated.h"
 
 class FSocketIONative;
 
+/** Dispatch counters for one event name (see USocketEventRouter::GetDispatchStats). */
+struct FSocketEventDispatchStats
+{
+	/** Messages received from the native client. */
+	uint64 Messages = 0;
+	/** Callbacks actually invoked (broadcast + matched keyed). */
+	uint64 HandlersInvoked = 0;
+	/** Keyed callbacks invoked because the payload id matched. */
+	uint64 KeyedMatched = 0;
+	/** Keyed callbacks NOT invoked — what a per-handler broadcast would have wasted. */
+	uint64 KeyedSkipped = 0;
+	/** Typed payload decodes (one per message with typed subscribers). */
+	uint64 TypedDecodes = 0;
+};
+
 UCLASS()
 class SABRIMMO_API USocketEventRouter : public UObject
 {
@@ -24,6 +51,29 @@ public:
 		UObject* Owner,
 		TFunction<void(const TSharedPtr<FJsonValue>&)> Handler);
 
+	// Register a handler that only fires when Payload[KeyField] == EntityId.
+	// Use for per-entity listeners (sprites, actors) instead of filtering inside a broadcast handler.
+	uint32 RegisterEntityHandler(
+		const FString& EventName,
+		const FString& KeyField,
+		int32 EntityId,
+		UObject* Owner,
+		TFunction<void(const TSharedPtr<FJsonValue>&)> Handler);
+
+	// Register a handler receiving the payload decoded into TEvent (a SocketEventTypes.h struct
+	// with a static Decode). All typed subscribers of an event must use the same TEvent.
+	template<typename TEvent>
+	uint32 RegisterTypedHandler(
+		const FString& EventName,
+		UObject* Owner,
+		TFunction<void(const TEvent&)> Handler);
+
+	// Deliver an already-decoded event to the typed subscribers of EventName, as if it had
+	// arrived over the socket (used by the binary move:batch channel, which has no JSON payload).
+	// Broadcast/keyed JSON handlers are not invoked. Returns the number of handlers called.
+	template<typename TEvent>
+	int32 DispatchTyped(const FString& EventName, const TEvent& Event);
+
 	// Remove all handlers registered by Owner (call in subsystem Deinitialize).
 	void UnregisterAllForOwner(UObject* Owner);
 
@@ -42,18 +92,120 @@ public:
 	// Check if any handlers are registered for an event.
 	bool HasHandlersFor(const FString& EventName) const;
 
+	// Per-event dispatch counters (invoked vs. matched). Dumped by the "SocketRouter.Stats" console command.
+	void GetDispatchStats(TArray<TPair<FString, FSocketEventDispatchStats>>& OutStats) const;
+	void ResetDispatchStats();
+	void LogDispatchStats() const;
+
 private:
 	struct FHandler
 	{
-		uint32 HandleId;
+		uint32 HandleId = 0;
 		TWeakObjectPtr<UObject> Owner;
 		TFunction<void(const TSharedPtr<FJsonValue>&)> Callback;
+		// Set when removed mid-dispatch; swept once the dispatch unwinds
+		bool bRemoved = false;
+	};
+
+	// Handlers are held by shared ref so a callback that registers/unregisters
+	// (reallocating the array) never invalidates the handler currently executing.
+	using FHandlerRef = TSharedRef<FHandler>;
+
+	// Entity-keyed handlers sharing one payload field (e.g. all "attackerId" listeners)
+	struct FKeyedIndex
+	{
+		FString KeyField;
+		TMap<int32, TArray<FHandlerRef>> ByEntity;
+		int32 NumHandlers = 0;
+	};
+
+	// Type-erased list of typed subscribers for one event (one decode per message)
+	struct FTypedChannelBase
+	{
+		virtual ~FTypedChannelBase() = default;
+		virtual const UScriptStruct* GetStruct() const = 0;
+		virtual int32 Num() const = 0;
+		// Decode + invoke. Returns false when nothing was decoded (no subscribers / bad payload).
+		virtual bool Dispatch(const TSharedPtr<FJsonValue>& Message, int32& OutInvoked) = 0;
+		virtual int32 MarkRemovedWhere(TFunctionRef<bool(const FHandler&)> Pred) = 0;
+		virtual void Compact() = 0;
+	};
+
+	template<typename TEvent>
+	struct TTypedChannel final : FTypedChannelBase
+	{
+		struct FTypedHandler : FHandler
+		{
+			TFunction<void(const TEvent&)> TypedCallback;
+		};
+
+		TArray<TSharedRef<FTypedHandler>> Handlers;
+
+		virtual const UScriptStruct* GetStruct() const override { return TEvent::StaticStruct(); }
+		virtual int32 Num() const override { return Handlers.Num(); }
+
+		virtual bool Dispatch(const TSharedPtr<FJsonValue>& Message, int32& OutInvoked) override
+		{
+			OutInvoked = 0;
+			if (Handlers.Num() == 0) return false;
+
+			TEvent Event;
+			if (!TEvent::Decode(Message, Event)) return false;
+
+			OutInvoked = Invoke(Event);
+			return true;
+		}
+
+		int32 Invoke(const TEvent& Event)
+		{
+			int32 Invoked = 0;
+			const int32 NumAtStart = Handlers.Num();
+			for (int32 i = 0; i < NumAtStart && i < Handlers.Num(); ++i)
+			{
+				const TSharedRef<FTypedHandler> H = Handlers[i];
+				if (H->bRemoved || !H->Owner.IsValid() || !H->TypedCallback) continue;
+				++Invoked;
+				H->TypedCallback(Event);
+			}
+			return Invoked;
+		}
+
+		virtual int32 MarkRemovedWhere(TFunctionRef<bool(const FHandler&)> Pred) override
+		{
+			int32 Removed = 0;
+			for (const TSharedRef<FTypedHandler>& H : Handlers)
+			{
+				if (!H->bRemoved && Pred(*H))
+				{
+					H->bRemoved = true;
+					++Removed;
+				}
+			}
+			return Removed;
+		}
+
+		virtual void Compact() override
+		{
+			Handlers.RemoveAll([](const TSharedRef<FTypedHandler>& H) { return H->bRemoved; });
+		}
 	};
 
 	// Shared entry per event — TSharedPtr so lambda captures remain stable
 	struct FEntry
 	{
-		TArray<FHandler> Handlers;
+		TArray<FHandlerRef> Handlers;
+		TArray<FKeyedIndex> KeyedIndices;
+		TUniquePtr<FTypedChannelBase> Typed;
+		FSocketEventDispatchStats Stats;
+		// >0 while this entry is dispatching; removals are deferred until it returns to 0
+		int32 DispatchDepth = 0;
+		bool bNeedsCompact = false;
+
+		int32 NumHandlers() const;
+		void Dispatch(const TSharedPtr<FJsonValue>& Message);
+		// Mark matching handlers removed (deferred) or erase them (idle). Returns number removed.
+		int32 RemoveWhere(TFunctionRef<bool(const FHandler&)> Pred);
+		void Compact();
 	};
 
 	// Map from event name to handler list
@@ -65,6 +217,61 @@ private:
 	// Monotonic counter for unique handle IDs
 	uint32 NextHandleId = 1;
 
+	// Find or create the entry for an event, binding the native listener on first use
+	TSharedPtr<FEntry> FindOrAddEntry(const FString& EventName);
+
 	// Bind a single event name to the native client's OnEvent
 	void BindNativeEvent(const FString& EventName, TSharedPtr<FEntry> Entry);
 };
+
+template<typename TEvent>
+uint32 USocketEventRouter::RegisterTypedHandler(
+	const FString& EventName,
+	UObject* Owner,
+	TFunction<void(const TEvent&)> Handler)
+{
+	TSharedPtr<FEntry> Entry = FindOrAddEntry(EventName);
+
+	if (!Entry->Typed.IsValid())
+	{
+		Entry->Typed = MakeUnique<TTypedChannel<TEvent>>();
+	}
+	else if (Entry->Typed->GetStruct() != TEvent::StaticStruct())
+	{
+		checkf(false, TEXT("RegisterTypedHandler: %s already decodes to %s, not %s"),
+			*EventName, *Entry->Typed->GetStruct()->GetName(), *TEvent::StaticStruct()->GetName());
+		return 0;
+	}
+
+	uint32 Id = NextHandleId++;
+
+	using FTypedHandler = typename TTypedChannel<TEvent>::FTypedHandler;
+	TSharedRef<FTypedHandler> H = MakeShared<FTypedHandler>();
+	H->HandleId = Id;
+	H->Owner = Owner;
+	H->TypedCallback = MoveTemp(Handler);
+	static_cast<TTypedChannel<TEvent>*>(Entry->Typed.Get())->Handlers.Add(MoveTemp(H));
+
+	return Id;
+}
+
+template<typename TEvent>
+int32 USocketEventRouter::DispatchTyped(const FString& EventName, const TEvent& Event)
+{
+	TSharedPtr<FEntry>* Found = HandlerMap.Find(EventName);
+	if (!Found || !(*Found)->Typed.IsValid()) return 0;
+
+	// Hold the entry: a callback may unregister the last handler and drop it from the map
+	TSharedPtr<FEntry> Entry = *Found;
+	if (Entry->Typed->GetStruct() != TEvent::StaticStruct()) return 0;
+
+	++Entry->Stats.Messages;
+	++Entry->DispatchDepth;
+	const int32 Invoked = static_cast<TTypedChannel<TEvent>*>(Entry->Typed.Get())->Invoke(Event);
+	Entry->Stats.HandlersInvoked += Invoked;
+	if (--Entry->DispatchDepth == 0 && Entry->bNeedsCompact)
+	{
+		Entry->Compact();
+	}
+	return Invoked;
+}
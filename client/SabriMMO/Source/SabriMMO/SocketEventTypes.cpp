@@ -0,0 +1,103 @@
+// SocketEventTypes.cpp — One-pass JSON decoders for the hot event payloads.
+
+#include "SocketEventTypes.h"
+
+namespace
+{
+	const TSharedPtr<FJsonObject>* GetPayloadObject(const TSharedPtr<FJsonValue>& Message)
+	{
+		const TSharedPtr<FJsonObject>* ObjPtr = nullptr;
+		if (!Message.IsValid() || !Message->TryGetObject(ObjPtr) || !ObjPtr || !ObjPtr->IsValid())
+			return nullptr;
+		return ObjPtr;
+	}
+
+	// Number fields arrive as doubles — truncate like the old (int32)D casts did
+	bool ReadInt(const FJsonObject& Obj, const TCHAR* Field, int32& Out)
+	{
+		double D = 0;
+		if (!Obj.TryGetNumberField(Field, D)) return false;
+		Out = (int32)D;
+		return true;
+	}
+
+	double ReadDouble(const FJsonObject& Obj, const TCHAR* Field)
+	{
+		double D = 0;
+		Obj.TryGetNumberField(Field, D);
+		return D;
+	}
+}
+
+bool FCombatDamageEvent::Decode(const TSharedPtr<FJsonValue>& Message, FCombatDamageEvent& Out)
+{
+	const TSharedPtr<FJsonObject>* ObjPtr = GetPayloadObject(Message);
+	if (!ObjPtr) return false;
+	const FJsonObject& Obj = **ObjPtr;
+
+	Out.Source = *ObjPtr;
+	ReadInt(Obj, TEXT("attackerId"), Out.AttackerId);
+	ReadInt(Obj, TEXT("targetId"), Out.TargetId);
+	ReadInt(Obj, TEXT("damage"), Out.Damage);
+	ReadInt(Obj, TEXT("damage2"), Out.Damage2);
+	ReadInt(Obj, TEXT("healAmount"), Out.HealAmount);
+	ReadInt(Obj, TEXT("skillId"), Out.SkillId);
+	ReadInt(Obj, TEXT("hitNumber"), Out.HitNumber);
+	ReadInt(Obj, TEXT("totalHits"), Out.TotalHits);
+	Out.bHasTargetHealth = ReadInt(Obj, TEXT("targetHealth"), Out.TargetHealth);
+	ReadInt(Obj, TEXT("targetMaxHealth"), Out.TargetMaxHealth);
+
+	Obj.TryGetBoolField(TEXT("isEnemy"), Out.bIsEnemy);
+	Obj.TryGetBoolField(TEXT("isCritical"), Out.bIsCritical);
+	Obj.TryGetBoolField(TEXT("isCritical2"), Out.bIsCritical2);
+	Obj.TryGetBoolField(TEXT("isDualWield"), Out.bIsDualWield);
+
+	Obj.TryGetStringField(TEXT("hitType"), Out.HitType);
+	Obj.TryGetStringField(TEXT("element"), Out.Element);
+	Obj.TryGetStringField(TEXT("element2"), Out.Element2);
+	Obj.TryGetStringField(TEXT("attackerWeaponType"), Out.AttackerWeaponType);
+
+	Out.TargetPosition = FVector(
+		(float)ReadDouble(Obj, TEXT("targetX")),
+		(float)ReadDouble(Obj, TEXT("targetY")),
+		(float)ReadDouble(Obj, TEXT("targetZ")));
+	return true;
+}
+
+bool FEnemyMoveEvent::Decode(const TSharedPtr<FJsonValue>& Message, FEnemyMoveEvent& Out)
+{
+	const TSharedPtr<FJsonObject>* ObjPtr = GetPayloadObject(Message);
+	if (!ObjPtr) return false;
+	const FJsonObject& Obj = **ObjPtr;
+
+	// enemyId is required — without it there is nothing to move
+	if (!ReadInt(Obj, TEXT("enemyId"), Out.EnemyId)) return false;
+
+	Out.Source = *ObjPtr;
+	Out.Position = FVector(
+		(float)ReadDouble(Obj, TEXT("x")),
+		(float)ReadDouble(Obj, TEXT("y")),
+		(float)ReadDouble(Obj, TEXT("z")));
+	Obj.TryGetBoolField(TEXT("isMoving"), Out.bIsMoving);
+	Obj.TryGetNumberField(TEXT("timestamp"), Out.Timestamp);
+	return true;
+}
+
+bool FPlayerMovedEvent::Decode(const TSharedPtr<FJsonValue>& Message, FPlayerMovedEvent& Out)
+{
+	const TSharedPtr<FJsonObject>* ObjPtr = GetPayloadObject(Message);
+	if (!ObjPtr) return false;
+	const FJsonObject& Obj = **ObjPtr;
+
+	if (!ReadInt(Obj, TEXT("characterId"), Out.CharacterId)) return false;
+
+	Out.Source = *ObjPtr;
+	Out.Position = FVector(
+		(float)ReadDouble(Obj, TEXT("x")),
+		(float)ReadDouble(Obj, TEXT("y")),
+		(float)ReadDouble(Obj, TEXT("z")));
+	ReadInt(Obj, TEXT("weaponMode"), Out.WeaponMode);
+	Obj.TryGetBoolField(TEXT("isMoving"), Out.bIsMoving);
+	Obj.TryGetNumberField(TEXT("timestamp"), Out.Timestamp);
+	return true;
+}
@@ -0,0 +1,91 @@
+// SocketEventTypes.h — Typed payloads for hot Socket.io events.
+// USocketEventRouter decodes these once per message and hands the same const
+// reference to every typed subscriber (RegisterTypedHandler), instead of each
+// subsystem walking the FJsonObject with its own string-keyed lookups.
+// Cold/rarely-read fields stay on Source (the original JSON object).
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonValue.h"
+#include "Dom/JsonObject.h"
+#include "SocketEventTypes.generated.h"
+
+// ============================================================
+// combat:damage / skill:effect_damage
+// ============================================================
+
+USTRUCT()
+struct FCombatDamageEvent
+{
+	GENERATED_BODY()
+
+	int32 AttackerId = 0;
+	int32 TargetId = 0;
+	int32 Damage = 0;
+	int32 Damage2 = 0;           // dual-wield left-hand hit
+	int32 HealAmount = 0;
+	int32 SkillId = 0;
+	int32 HitNumber = 0;         // multi-hit skills: 1..TotalHits
+	int32 TotalHits = 0;
+	int32 TargetHealth = 0;
+	int32 TargetMaxHealth = 0;
+	bool bHasTargetHealth = false;
+	bool bIsEnemy = false;
+	bool bIsCritical = false;
+	bool bIsCritical2 = false;
+	bool bIsDualWield = false;
+	FString HitType = TEXT("normal");     // normal, miss, dodge, perfectDodge, heal...
+	FString Element = TEXT("neutral");
+	FString Element2 = TEXT("neutral");
+	FString AttackerWeaponType;
+	FVector TargetPosition = FVector::ZeroVector;   // targetX/Y/Z (zero when absent)
+
+	/** Original payload — for fields not decoded above (attackerName, eleMod, ...). */
+	TSharedPtr<FJsonObject> Source;
+
+	bool IsHeal() const { return HitType == TEXT("heal"); }
+	bool IsMiss() const { return HitType == TEXT("miss") || HitType == TEXT("dodge") || HitType == TEXT("perfectDodge"); }
+
+	static bool Decode(const TSharedPtr<FJsonValue>& Message, FCombatDamageEvent& Out);
+};
+
+// ============================================================
+// enemy:move
+// ============================================================
+
+USTRUCT()
+struct FEnemyMoveEvent
+{
+	GENERATED_BODY()
+
+	int32 EnemyId = 0;
+	FVector Position = FVector::ZeroVector;
+	bool bIsMoving = false;
+	double Timestamp = 0.0;      // server Date.now() ms; 0 when absent (move:batch carries its own)
+
+	TSharedPtr<FJsonObject> Source;
+
+	static bool Decode(const TSharedPtr<FJsonValue>& Message, FEnemyMoveEvent& Out);
+};
+
+// ============================================================
+// player:moved
+// ============================================================
+
+USTRUCT()
+struct FPlayerMovedEvent
+{
+	GENERATED_BODY()
+
+	int32 CharacterId = 0;
+	FVector Position = FVector::ZeroVector;
+	int32 WeaponMode = 0;        // 0=none, 1=onehand, 2=twohand, 3=bow
+	bool bIsMoving = true;       // false on the sender's stop / idle keepalive packets
+	double Timestamp = 0.0;      // server Date.now() ms; 0 when absent (move:batch carries its own)
+
+	/** Spawn-only fields (characterName, jobClass, equipVisuals...) are read from here. */
+	TSharedPtr<FJsonObject> Source;
+
+	static bool Decode(const TSharedPtr<FJsonValue>& Message, FPlayerMovedEvent& Out);
+};
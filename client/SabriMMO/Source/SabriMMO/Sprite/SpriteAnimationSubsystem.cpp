@@ -0,0 +1,354 @@
+// SpriteAnimationSubsystem.cpp — Batched sprite animation driver (see header).
+
+#include "SpriteAnimationSubsystem.h"
+#include "SpriteCharacterActor.h"
+#include "SpriteSignificanceSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSpriteAnimation, Log, All);
+
+DECLARE_STATS_GROUP(TEXT("SpriteAnimation"), STATGROUP_SpriteAnimation, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Owner tracking"), STAT_SpriteAnim_Tracking, STATGROUP_SpriteAnimation);
+DECLARE_CYCLE_STAT(TEXT("Advance (batched)"), STAT_SpriteAnim_Advance, STATGROUP_SpriteAnimation);
+DECLARE_CYCLE_STAT(TEXT("Apply dirty"), STAT_SpriteAnim_Apply, STATGROUP_SpriteAnimation);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Sprites"), STAT_SpriteAnim_Num, STATGROUP_SpriteAnimation);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Dirty sprites"), STAT_SpriteAnim_Dirty, STATGROUP_SpriteAnimation);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Frame steps"), STAT_SpriteAnim_FrameSteps, STATGROUP_SpriteAnimation);
+
+static TAutoConsoleVariable<int32> CVarSpriteBatchedAnimation(
+	TEXT("Sprite.BatchedAnimation"),
+	1,
+	TEXT("1 = newly spawned sprites are driven by USpriteAnimationSubsystem with actor tick off.\n")
+	TEXT("0 = each sprite ticks itself (legacy path, for comparison)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarSpriteAnimParallelThreshold(
+	TEXT("Sprite.AnimParallelThreshold"),
+	512,
+	TEXT("Sprite count at which the batched frame/direction pass runs as a ParallelFor (0 = always serial)."),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorldAndArgs GSpriteAnimStatsCmd(
+	TEXT("Sprite.AnimStats"),
+	TEXT("Print batched sprite animation counts and last-pass timings."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (USpriteAnimationSubsystem* Sub = World ? World->GetSubsystem<USpriteAnimationSubsystem>() : nullptr)
+		{
+			Sub->LogStats();
+		}
+	}));
+
+// ============================================================
+// Lifecycle
+// ============================================================
+
+bool USpriteAnimationSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld();
+}
+
+void USpriteAnimationSubsystem::Deinitialize()
+{
+	// Sprites still alive (world teardown order) fall back to their own tick
+	for (const TWeakObjectPtr<ASpriteCharacterActor>& Weak : Sprites)
+	{
+		if (ASpriteCharacterActor* Sprite = Weak.Get())
+		{
+			Sprite->AnimSlot = INDEX_NONE;
+			Sprite->AnimSystem = nullptr;
+			Sprite->SetActorTickEnabled(true);
+		}
+	}
+	Sprites.Empty();
+	FrameTimers.Empty();
+	FrameDurations.Empty();
+	AnimStates.Empty();
+	Directions.Empty();
+	Facings.Empty();
+	FrameStrides.Empty();
+	TrackingIntervals.Empty();
+	Flags.Empty();
+	DirtyFlags.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId USpriteAnimationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USpriteAnimationSubsystem, STATGROUP_Tickables);
+}
+
+bool USpriteAnimationSubsystem::IsEnabled()
+{
+	return CVarSpriteBatchedAnimation.GetValueOnGameThread() != 0;
+}
+
+// ============================================================
+// Registration
+// ============================================================
+
+int32 USpriteAnimationSubsystem::Register(ASpriteCharacterActor* Sprite)
+{
+	if (!Sprite) return INDEX_NONE;
+	if (Sprite->AnimSlot != INDEX_NONE) return Sprite->AnimSlot;
+
+	const int32 Slot = Sprites.Add(Sprite);
+	FrameTimers.Add(Sprite->FrameTimer);
+	FrameDurations.Add(ASpriteCharacterActor::GetFrameDuration(Sprite->CurrentAnimState));
+	AnimStates.Add(static_cast<uint8>(Sprite->CurrentAnimState));
+	Directions.Add(static_cast<uint8>(Sprite->CurrentDirection));
+	Facings.Add(FVector2f(Sprite->FacingDir.X, Sprite->FacingDir.Y));
+	FrameStrides.Add((uint8)USpriteSignificanceSubsystem::GetFrameStride(Sprite->Significance));
+	TrackingIntervals.Add((uint8)USpriteSignificanceSubsystem::GetTrackingInterval(Sprite->Significance));
+	Flags.Add(Flag_Billboard | (Sprite->HasPendingLayerWork() ? Flag_PendingWork : 0));
+	DirtyFlags.Add(0);
+
+	Sprite->AnimSlot = Slot;
+	return Slot;
+}
+
+void USpriteAnimationSubsystem::Unregister(ASpriteCharacterActor* Sprite)
+{
+	if (!Sprite || !Sprites.IsValidIndex(Sprite->AnimSlot) || Sprites[Sprite->AnimSlot] != Sprite)
+		return;
+
+	const int32 Slot = Sprite->AnimSlot;
+	Sprite->AnimSlot = INDEX_NONE;
+	RemoveAtSwap(Slot);
+}
+
+void USpriteAnimationSubsystem::RemoveAtSwap(int32 Slot)
+{
+	Sprites.RemoveAtSwap(Slot, EAllowShrinking::No);
+	FrameTimers.RemoveAtSwap(Slot, EAllowShrinking::No);
+	FrameDurations.RemoveAtSwap(Slot, EAllowShrinking::No);
+	AnimStates.RemoveAtSwap(Slot, EAllowShrinking::No);
+	Directions.RemoveAtSwap(Slot, EAllowShrinking::No);
+	Facings.RemoveAtSwap(Slot, EAllowShrinking::No);
+	FrameStrides.RemoveAtSwap(Slot, EAllowShrinking::No);
+	TrackingIntervals.RemoveAtSwap(Slot, EAllowShrinking::No);
+	Flags.RemoveAtSwap(Slot, EAllowShrinking::No);
+	DirtyFlags.RemoveAtSwap(Slot, EAllowShrinking::No);
+
+	// The former last sprite now lives in Slot
+	if (Sprites.IsValidIndex(Slot))
+	{
+		if (ASpriteCharacterActor* Moved = Sprites[Slot].Get())
+		{
+			Moved->AnimSlot = Slot;
+		}
+	}
+}
+
+void USpriteAnimationSubsystem::ResetState(int32 Slot, ESpriteAnimState State)
+{
+	if (!Sprites.IsValidIndex(Slot)) return;
+	AnimStates[Slot] = static_cast<uint8>(State);
+	FrameTimers[Slot] = 0.f;
+	FrameDurations[Slot] = ASpriteCharacterActor::GetFrameDuration(State);
+}
+
+void USpriteAnimationSubsystem::SetFacing(int32 Slot, const FVector& Facing)
+{
+	if (!Sprites.IsValidIndex(Slot)) return;
+	Facings[Slot] = FVector2f(Facing.X, Facing.Y);
+}
+
+void USpriteAnimationSubsystem::MarkPendingWork(int32 Slot)
+{
+	if (!Sprites.IsValidIndex(Slot)) return;
+	Flags[Slot] |= Flag_PendingWork;
+}
+
+void USpriteAnimationSubsystem::SetUpdateRate(int32 Slot, int32 FrameStride, int32 TrackingInterval)
+{
+	if (!Sprites.IsValidIndex(Slot)) return;
+	FrameStrides[Slot] = (uint8)FMath::Clamp(FrameStride, 1, 255);
+	TrackingIntervals[Slot] = (uint8)FMath::Clamp(TrackingInterval, 1, 255);
+	// Coming back to full rate: don't burn through a long stride's worth of timer in single steps
+	FrameTimers[Slot] = FMath::Min(FrameTimers[Slot], FrameDurations[Slot]);
+}
+
+// ============================================================
+// Per-frame pass
+// ============================================================
+
+void USpriteAnimationSubsystem::Tick(float DeltaTime)
+{
+	SET_DWORD_STAT(STAT_SpriteAnim_Num, Sprites.Num());
+	if (Sprites.Num() == 0) return;
+
+	// Drop sprites destroyed without EndPlay reaching us (back to front keeps swaps valid)
+	for (int32 i = Sprites.Num() - 1; i >= 0; --i)
+	{
+		if (!Sprites[i].IsValid())
+		{
+			RemoveAtSwap(i);
+		}
+	}
+
+	// 1) Movement / owner follow. May change state or facing, which writes the SoA above.
+	//    Low-significance sprites are staggered across frames by slot.
+	{
+		SCOPE_CYCLE_COUNTER(STAT_SpriteAnim_Tracking);
+		for (int32 i = 0; i < Sprites.Num(); ++i)
+		{
+			const uint8 Interval = TrackingIntervals[i];
+			if (Interval > 1 && (GFrameCounter + i) % Interval != 0) continue;
+			Sprites[i]->UpdateOwnerTracking();
+		}
+	}
+
+	// Camera is shared by every sprite: one billboard rotation, one forward for direction
+	bool bHaveCamera = false;
+	FRotator FaceRotation = FRotator::ZeroRotator;
+	FVector2D CamFwd2D = FVector2D::ZeroVector;
+	if (APlayerController* PC = GetWorld()->GetFirstPlayerController())
+	{
+		if (PC->PlayerCameraManager)
+		{
+			const FVector CamFwd = PC->PlayerCameraManager->GetCameraRotation().Vector();
+			const FRotator FaceCamera = (-CamFwd).Rotation();
+			FaceRotation = FRotator(FaceCamera.Pitch, FaceCamera.Yaw, 0.f);
+			CamFwd2D = FVector2D(CamFwd.X, CamFwd.Y);
+			bHaveCamera = true;
+		}
+	}
+	const bool bCameraRotated = bHaveCamera && (!bHasLastFaceRotation || !FaceRotation.Equals(LastFaceRotation));
+	if (bHaveCamera)
+	{
+		LastFaceRotation = FaceRotation;
+		bHasLastFaceRotation = true;
+	}
+
+	// 2) Pure pass over the arrays: timers, direction, flags. No UObject access.
+	const int32 NumSprites = Sprites.Num();
+	int32 NumDirty = 0;
+	int32 NumFrameSteps = 0;
+	{
+		SCOPE_CYCLE_COUNTER(STAT_SpriteAnim_Advance);
+		const double AdvanceStart = FPlatformTime::Seconds();
+
+		// Without a camera the billboard request stays parked in Flags until one exists
+		const uint8 PersistentMask = Flag_PendingWork | (bHaveCamera ? Flag_Billboard : 0);
+		const int32 Threshold = CVarSpriteAnimParallelThreshold.GetValueOnGameThread();
+		const EParallelForFlags PFFlags = (Threshold > 0 && NumSprites >= Threshold)
+			? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+
+		ParallelFor(NumSprites, [this, DeltaTime, CamFwd2D, PersistentMask, bCameraRotated](int32 i)
+		{
+			uint8 Dirty = Flags[i] & PersistentMask;
+			if (bCameraRotated) Dirty |= Flag_Billboard;
+
+			const float Duration = FrameDurations[i] * FrameStrides[i];
+			if (Duration > 0.f)
+			{
+				float Timer = FrameTimers[i] + DeltaTime;
+				if (Timer >= Duration)
+				{
+					Timer -= Duration;
+					Dirty |= Flag_Frame;
+				}
+				FrameTimers[i] = Timer;
+			}
+
+			const uint8 NewDir = static_cast<uint8>(ASpriteCharacterActor::DirectionFromFacing(
+				FVector2D(Facings[i].X, Facings[i].Y), CamFwd2D));
+			if (NewDir != Directions[i])
+			{
+				Directions[i] = NewDir;
+				Dirty |= Flag_Direction;
+			}
+
+			DirtyFlags[i] = Dirty;
+		}, PFFlags);
+
+		for (int32 i = 0; i < NumSprites; ++i)
+		{
+			if (DirtyFlags[i] != 0) ++NumDirty;
+			if (DirtyFlags[i] & Flag_Frame) ++NumFrameSteps;
+		}
+		LastAdvanceMs = (FPlatformTime::Seconds() - AdvanceStart) * 1000.0;
+	}
+
+	// 3) Touch only the actors that changed. Iterate a snapshot count: SetAnimState callbacks
+	//    (revert to Idle, OnAnimCycleComplete listeners) may write the arrays but never resize them
+	//    unless a listener destroys a sprite, which IsValid below guards.
+	{
+		SCOPE_CYCLE_COUNTER(STAT_SpriteAnim_Apply);
+		const double ApplyStart = FPlatformTime::Seconds();
+
+		for (int32 i = 0; i < FMath::Min(NumSprites, Sprites.Num()); ++i)
+		{
+			const uint8 Dirty = DirtyFlags[i];
+			if (Dirty == 0) continue;
+
+			ASpriteCharacterActor* Sprite = Sprites[i].Get();
+			if (!IsValid(Sprite)) continue;
+
+			if (Dirty & Flag_Billboard)
+			{
+				Sprite->SetActorRotation(FaceRotation);
+				Flags[i] &= ~Flag_Billboard;
+			}
+
+			if (Dirty & Flag_Direction)
+			{
+				Sprite->CurrentDirection = static_cast<ESpriteDirection>(Directions[i]);
+			}
+
+			if (Dirty & Flag_Frame)
+			{
+				// Steps the frame and refreshes the layers (covers a direction change too)
+				Sprite->FrameTimer = FrameTimers[i];
+				if (!Sprite->AdvanceAnimationFrame(FrameStrides[i]) && Sprite->AnimSlot == i)
+				{
+					FrameDurations[i] = 0.f;  // held on the last frame until the next state change
+				}
+			}
+			else if (Dirty & Flag_Direction)
+			{
+				Sprite->UpdateAllLayers();
+			}
+
+			if ((Dirty & Flag_PendingWork) && !Sprite->TickPendingWork(DeltaTime) && Sprite->AnimSlot == i)
+			{
+				Flags[i] &= ~Flag_PendingWork;
+			}
+		}
+
+		LastApplyMs = (FPlatformTime::Seconds() - ApplyStart) * 1000.0;
+	}
+
+	LastDirty = NumDirty;
+	LastFrameSteps = NumFrameSteps;
+	SET_DWORD_STAT(STAT_SpriteAnim_Dirty, NumDirty);
+	SET_DWORD_STAT(STAT_SpriteAnim_FrameSteps, NumFrameSteps);
+}
+
+// ============================================================
+// Stats
+// ============================================================
+
+void USpriteAnimationSubsystem::LogStats() const
+{
+	int32 NumWalking = 0;
+	int32 NumHeld = 0;
+	int32 NumPending = 0;
+	for (int32 i = 0; i < Sprites.Num(); ++i)
+	{
+		if (AnimStates[i] == static_cast<uint8>(ESpriteAnimState::Walk)) ++NumWalking;
+		if (FrameDurations[i] <= 0.f) ++NumHeld;
+		if (Flags[i] & Flag_PendingWork) ++NumPending;
+	}
+	UE_LOG(LogSpriteAnimation, Log,
+		TEXT("Sprite animation [%s]: %d sprites (%d walking, %d held, %d with pending layer work), last pass %d dirty / %d frame steps, advance %.3f ms, apply %.3f ms"),
+		IsEnabled() ? TEXT("batched") : TEXT("per-actor tick for new sprites"),
+		Sprites.Num(), NumWalking, NumHeld, NumPending, LastDirty, LastFrameSteps, LastAdvanceMs, LastApplyMs);
+}
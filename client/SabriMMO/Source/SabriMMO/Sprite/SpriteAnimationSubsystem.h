@@ -0,0 +1,83 @@
+// SpriteAnimationSubsystem.h — Batched per-frame driver for every ASpriteCharacterActor.
+// Replaces the per-actor Tick: frame timers, anim state, 8-way direction and facing for
+// all sprites live here in structure-of-arrays form and are advanced in one pass per
+// frame. The pass is pure math (ParallelFor above Sprite.AnimParallelThreshold) and
+// only flags what changed; actors are then touched only for sprites whose atlas cell,
+// direction, billboard rotation or pending layer work actually needs it.
+// USpriteSignificanceSubsystem lowers the rate for distant sprites (SetUpdateRate).
+// `stat SpriteAnimation` shows the time per pass and the number of dirty sprites.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SpriteAtlasData.h"
+#include "SpriteAnimationSubsystem.generated.h"
+
+class ASpriteCharacterActor;
+
+UCLASS()
+class SABRIMMO_API USpriteAnimationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Sprite.BatchedAnimation — whether new sprites register here and stop ticking */
+	static bool IsEnabled();
+
+	/** Take over Sprite's per-frame update. Returns its slot (also stored on the actor). */
+	int32 Register(ASpriteCharacterActor* Sprite);
+	void Unregister(ASpriteCharacterActor* Sprite);
+
+	/** State change: restart the frame timer with the state's frame duration */
+	void ResetState(int32 Slot, ESpriteAnimState State);
+
+	/** World-space facing; only XY is used */
+	void SetFacing(int32 Slot, const FVector& Facing);
+
+	/** Pending equipment swap or hit flash — the actor's TickPendingWork runs until it reports done */
+	void MarkPendingWork(int32 Slot);
+
+	/** Significance LOD: step FrameStride cells at a time, run owner tracking every TrackingInterval frames */
+	void SetUpdateRate(int32 Slot, int32 FrameStride, int32 TrackingInterval);
+
+	int32 Num() const { return Sprites.Num(); }
+	void LogStats() const;
+
+private:
+	enum ESlotFlags : uint8
+	{
+		Flag_Billboard   = 1 << 0,  // rotation must be (re)applied
+		Flag_Frame       = 1 << 1,  // frame timer elapsed — step to the next cell
+		Flag_Direction   = 1 << 2,  // 8-way direction changed
+		Flag_PendingWork = 1 << 3,  // equipment swap streaming / hit flash running
+	};
+
+	void RemoveAtSwap(int32 Slot);
+
+	// ---- Structure-of-arrays sprite state (index = slot) ----
+	TArray<TWeakObjectPtr<ASpriteCharacterActor>> Sprites;
+	TArray<float> FrameTimers;
+	TArray<float> FrameDurations;   // 0 = held on the last frame (e.g. Death), no stepping
+	TArray<uint8> AnimStates;       // ESpriteAnimState
+	TArray<uint8> Directions;       // ESpriteDirection
+	TArray<FVector2f> Facings;      // normalized XY, zero = unset
+	TArray<uint8> FrameStrides;     // cells per step (1 = every cell)
+	TArray<uint8> TrackingIntervals;  // frames between UpdateOwnerTracking calls
+	TArray<uint8> Flags;            // persistent ESlotFlags set between passes
+	TArray<uint8> DirtyFlags;       // written by the batched pass, consumed by the apply loop
+
+	bool bHasLastFaceRotation = false;
+	FRotator LastFaceRotation = FRotator::ZeroRotator;
+
+	// Last-pass numbers for Sprite.AnimStats
+	int32 LastDirty = 0;
+	int32 LastFrameSteps = 0;
+	double LastAdvanceMs = 0.0;
+	double LastApplyMs = 0.0;
+};
@@ -165,9 +165,6 @@ struct FSingleAnimAtlasInfo
 {
 	GENERATED_BODY()
 
-	UPROPERTY(EditAnywhere, BlueprintReadOnly)
-	UTexture2D* AtlasTexture = nullptr;
-
 	/** UE5 asset path for lazy loading (e.g., /Game/SabriMMO/Sprites/...) */
 	UPROPERTY()
 	FString AssetPath;
@@ -191,19 +188,28 @@ struct FSingleAnimAtlasInfo
 	 *  2=Medium, 3=Low. Set by UOptionsSubsystem::SetSpriteQuality(). */
 	SABRIMMO_API static int32 GlobalLODBias;
 
-	/** Lazy-load the texture from AssetPath if not already loaded */
-	void EnsureTextureLoaded()
+	/** Last texture resolved from AssetPath. Weak: atlas entries live in the shared
+	 *  FSpriteClassDefinition and never keep a texture resident — the actors' material
+	 *  and UPROPERTY texture references do. */
+	mutable TWeakObjectPtr<UTexture2D> CachedTexture;
+
+	/** Lazy-load the texture from AssetPath (cheap once resident) */
+	UTexture2D* LoadTexture() const
 	{
-		if (!AtlasTexture && !AssetPath.IsEmpty())
+		if (UTexture2D* Tex = CachedTexture.Get())
+			return Tex;
+		if (AssetPath.IsEmpty())
+			return nullptr;
+
+		UTexture2D* Tex = Cast<UTexture2D>(
+			StaticLoadObject(UTexture2D::StaticClass(), nullptr, *AssetPath));
+		if (Tex && Tex->LODBias != GlobalLODBias)
 		{
-			AtlasTexture = Cast<UTexture2D>(
-				StaticLoadObject(UTexture2D::StaticClass(), nullptr, *AssetPath));
-			if (AtlasTexture && AtlasTexture->LODBias != GlobalLODBias)
-			{
-				AtlasTexture->LODBias = GlobalLODBias;
-				AtlasTexture->UpdateResource();
-			}
+			Tex->LODBias = GlobalLODBias;
+			Tex->UpdateResource();
 		}
+		CachedTexture = Tex;
+		return Tex;
 	}
 
 	/** Check if weapon should render in front of body for this frame+direction */
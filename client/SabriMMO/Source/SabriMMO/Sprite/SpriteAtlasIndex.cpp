@@ -0,0 +1,605 @@
+// SpriteAtlasIndex.cpp — Binary sprite manifest index: runtime reader + offline cook.
+
+#include "SpriteAtlasIndex.h"
+#include "SpriteClassCache.h"
+#include "SpriteCharacterActor.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Async/MappedFileHandle.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSpriteIndex, Log, All);
+
+#if !UE_BUILD_SHIPPING
+// Console command: CookSpriteAtlasIndex [output_path]
+static FAutoConsoleCommand GCookSpriteAtlasIndexCmd(
+	TEXT("CookSpriteAtlasIndex"),
+	TEXT("Cook every sprite manifest under Content/SabriMMO/Sprites/Atlases into SpriteAtlasIndex.bin. Usage: CookSpriteAtlasIndex [output_path]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const FString OutputPath = Args.Num() > 0 ? Args[0] : FSpriteAtlasIndex::GetDefaultPath();
+		FString Report;
+		if (FSpriteAtlasIndex::Cook(OutputPath, Report))
+		{
+			UE_LOG(LogSpriteIndex, Log, TEXT("[SpriteIndex] %s"), *Report);
+			// Cook has already remapped the live index if it replaced its file
+			if (FPaths::IsSamePath(OutputPath, FSpriteAtlasIndex::GetDefaultPath()))
+			{
+				FSpriteClassCache::Get().Clear();
+			}
+		}
+		else
+		{
+			UE_LOG(LogSpriteIndex, Error, TEXT("[SpriteIndex] Cook failed: %s"), *Report);
+		}
+	}));
+#endif
+
+// ============================================================
+// On-disk layout (little-endian, every section 4-byte aligned)
+// ============================================================
+
+namespace SpriteAtlasIndexFormat
+{
+	struct FHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		uint32 NumEntries;
+		uint32 NumAtlases;
+		uint32 NumRegistry;
+		uint32 NumVariants;
+		uint32 NumPreloadPaths;
+		uint32 NumDepthWords;
+		uint32 StringBytes;
+		uint32 EntriesOffset;
+		uint32 AtlasesOffset;
+		uint32 RegistryOffset;
+		uint32 VariantsOffset;
+		uint32 PreloadPathsOffset;
+		uint32 DepthWordsOffset;
+		uint32 StringsOffset;
+	};
+
+	/** One cache key. Several keys may share an atlas range (e.g. genderless item under male + female). */
+	struct FEntry
+	{
+		uint32 KeyString;
+		uint32 ManifestPathString;   // relative to the atlas content root
+		uint32 FirstAtlas;
+		uint32 NumAtlases;
+		uint32 FirstRegistry;
+		uint32 NumRegistry;
+		uint32 FirstPreloadPath;
+		uint32 NumPreloadPaths;
+		uint32 Flags;
+	};
+
+	enum EEntryFlags : uint32
+	{
+		EntryFlag_HidesHair = 1u << 0,
+	};
+
+	struct FAtlas
+	{
+		uint32 AssetPathString;
+		uint32 SourceString;
+		uint16 GridX;
+		uint16 GridY;
+		uint16 FrameCount;
+		uint16 NumDepthBits;
+		uint32 FirstDepthBit;
+	};
+
+	struct FRegistry
+	{
+		uint8 WeaponMode;
+		uint8 AnimState;
+		uint16 NumVariants;
+		uint32 FirstVariant;         // into the variants array; values are entry-local atlas indices
+	};
+
+	static_assert(sizeof(FHeader) == 64, "Index header layout changed — bump Version");
+	static_assert(sizeof(FEntry) == 36, "Index entry layout changed — bump Version");
+	static_assert(sizeof(FAtlas) == 20, "Index atlas layout changed — bump Version");
+	static_assert(sizeof(FRegistry) == 8, "Index registry layout changed — bump Version");
+
+	template<typename T>
+	const T* Section(const uint8* Data, uint32 Offset) { return reinterpret_cast<const T*>(Data + Offset); }
+}
+
+using namespace SpriteAtlasIndexFormat;
+
+// ============================================================
+// Runtime reader
+// ============================================================
+
+FSpriteAtlasIndex& FSpriteAtlasIndex::Get()
+{
+	static FSpriteAtlasIndex Instance;
+	if (!Instance.bTriedOpen)
+	{
+		Instance.bTriedOpen = true;
+		Instance.Open(GetDefaultPath());
+	}
+	return Instance;
+}
+
+FString FSpriteAtlasIndex::GetDefaultPath()
+{
+	return FPaths::ProjectContentDir() / TEXT("SabriMMO/Sprites/Atlases/SpriteAtlasIndex.bin");
+}
+
+FSpriteAtlasIndex::~FSpriteAtlasIndex()
+{
+	Close();
+}
+
+void FSpriteAtlasIndex::Reload()
+{
+	Close();
+	bTriedOpen = true;
+	Open(GetDefaultPath());
+}
+
+void FSpriteAtlasIndex::Close()
+{
+	delete MappedRegion;
+	MappedRegion = nullptr;
+	delete MappedHandle;
+	MappedHandle = nullptr;
+	OwnedBytes.Empty();
+	Data = nullptr;
+	Size = 0;
+}
+
+bool FSpriteAtlasIndex::Open(const FString& Path)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	IPlatformFile& PF = FPlatformFileManager::Get().GetPlatformFile();
+	if (!PF.FileExists(*Path))
+	{
+		UE_LOG(LogSpriteIndex, Log, TEXT("No cooked sprite index at %s — using JSON manifests"), *Path);
+		return false;
+	}
+
+	// Prefer a read-only mapping (pages fault in on demand); fall back to one bulk read
+	MappedHandle = PF.OpenMapped(*Path);
+	if (MappedHandle)
+	{
+		MappedRegion = MappedHandle->MapRegion(0, MappedHandle->GetFileSize());
+		if (MappedRegion)
+		{
+			Data = MappedRegion->GetMappedPtr();
+			Size = MappedRegion->GetMappedSize();
+		}
+	}
+	if (!Data)
+	{
+		Close();
+		if (!FFileHelper::LoadFileToArray(OwnedBytes, *Path))
+			return false;
+		Data = OwnedBytes.GetData();
+		Size = OwnedBytes.Num();
+	}
+
+	// Validate header and section bounds once so lookups can skip range checks
+	const FHeader* H = reinterpret_cast<const FHeader*>(Data);
+	auto SectionFits = [this](uint32 Offset, uint64 Count, uint64 Stride)
+	{
+		return (Offset % 4) == 0 && uint64(Offset) + Count * Stride <= uint64(Size);
+	};
+	const bool bValid = Size >= int64(sizeof(FHeader))
+		&& H->Magic == Magic && H->Version == Version
+		&& SectionFits(H->EntriesOffset, H->NumEntries, sizeof(FEntry))
+		&& SectionFits(H->AtlasesOffset, H->NumAtlases, sizeof(FAtlas))
+		&& SectionFits(H->RegistryOffset, H->NumRegistry, sizeof(FRegistry))
+		&& SectionFits(H->VariantsOffset, H->NumVariants, sizeof(uint32))
+		&& SectionFits(H->PreloadPathsOffset, H->NumPreloadPaths, sizeof(uint32))
+		&& SectionFits(H->DepthWordsOffset, H->NumDepthWords, sizeof(uint32))
+		&& H->StringBytes > 0 && uint64(H->StringsOffset) + H->StringBytes <= uint64(Size)
+		&& Data[H->StringsOffset + H->StringBytes - 1] == 0;
+	if (!bValid)
+	{
+		UE_LOG(LogSpriteIndex, Warning, TEXT("Ignoring invalid or outdated sprite index %s (expected v%u)"), *Path, Version);
+		Close();
+		return false;
+	}
+
+	OpenSeconds = FPlatformTime::Seconds() - StartTime;
+	UE_LOG(LogSpriteIndex, Log, TEXT("Sprite index %s: %u entries, %u atlases, %.1f KB (%s, %.2f ms)"),
+		*Path, H->NumEntries, H->NumAtlases, Size / 1024.0,
+		MappedRegion ? TEXT("mapped") : TEXT("read"), OpenSeconds * 1000.0);
+	return true;
+}
+
+int32 FSpriteAtlasIndex::NumEntries() const
+{
+	return Data ? int32(reinterpret_cast<const FHeader*>(Data)->NumEntries) : 0;
+}
+
+const ANSICHAR* FSpriteAtlasIndex::GetString(uint32 Offset) const
+{
+	const FHeader* H = reinterpret_cast<const FHeader*>(Data);
+	if (Offset >= H->StringBytes) Offset = 0;
+	return reinterpret_cast<const ANSICHAR*>(Data + H->StringsOffset + Offset);
+}
+
+int32 FSpriteAtlasIndex::FindEntryIndex(FStringView Key) const
+{
+	if (!Data) return INDEX_NONE;
+
+	const FHeader* H = reinterpret_cast<const FHeader*>(Data);
+	const FEntry* Entries = Section<FEntry>(Data, H->EntriesOffset);
+
+	// Keys are ASCII and sorted by byte value at cook time
+	auto CompareKey = [&Key](const ANSICHAR* Stored)
+	{
+		int32 i = 0;
+		for (; i < Key.Len() && Stored[i] != 0; ++i)
+		{
+			const uint32 A = uint32(Key[i]);
+			const uint32 B = uint8(Stored[i]);
+			if (A != B) return A < B ? -1 : 1;
+		}
+		if (i == Key.Len()) return Stored[i] == 0 ? 0 : -1;
+		return 1;
+	};
+
+	int32 Lo = 0;
+	int32 Hi = int32(H->NumEntries) - 1;
+	while (Lo <= Hi)
+	{
+		const int32 Mid = Lo + (Hi - Lo) / 2;
+		const int32 Cmp = CompareKey(GetString(Entries[Mid].KeyString));
+		if (Cmp == 0) return Mid;
+		if (Cmp < 0) Hi = Mid - 1;
+		else Lo = Mid + 1;
+	}
+	return INDEX_NONE;
+}
+
+bool FSpriteAtlasIndex::BuildDefinition(FStringView Key, FSpriteClassDefinition& OutDef) const
+{
+	const int32 EntryIdx = FindEntryIndex(Key);
+	if (EntryIdx == INDEX_NONE) return false;
+
+	const FHeader* H = reinterpret_cast<const FHeader*>(Data);
+	const FEntry& E = Section<FEntry>(Data, H->EntriesOffset)[EntryIdx];
+	if (uint64(E.FirstAtlas) + E.NumAtlases > H->NumAtlases
+		|| uint64(E.FirstRegistry) + E.NumRegistry > H->NumRegistry
+		|| uint64(E.FirstPreloadPath) + E.NumPreloadPaths > H->NumPreloadPaths)
+	{
+		return false;
+	}
+
+	const FAtlas* Atlases = Section<FAtlas>(Data, H->AtlasesOffset) + E.FirstAtlas;
+	const FRegistry* Registry = Section<FRegistry>(Data, H->RegistryOffset) + E.FirstRegistry;
+	const uint32* Variants = Section<uint32>(Data, H->VariantsOffset);
+	const uint32* PreloadPaths = Section<uint32>(Data, H->PreloadPathsOffset) + E.FirstPreloadPath;
+	const uint32* DepthWords = Section<uint32>(Data, H->DepthWordsOffset);
+
+	OutDef.CacheKey = FString(Key);
+	OutDef.ManifestPath = FPaths::ProjectContentDir() / TEXT("SabriMMO/Sprites/Atlases") / UTF8_TO_TCHAR(GetString(E.ManifestPathString));
+	OutDef.bHidesHair = (E.Flags & EntryFlag_HidesHair) != 0;
+
+	OutDef.Atlases.SetNum(E.NumAtlases);
+	for (uint32 a = 0; a < E.NumAtlases; ++a)
+	{
+		const FAtlas& Src = Atlases[a];
+		FSingleAnimAtlasInfo& Info = OutDef.Atlases[a];
+		Info.AssetPath = UTF8_TO_TCHAR(GetString(Src.AssetPathString));
+		Info.Source = UTF8_TO_TCHAR(GetString(Src.SourceString));
+		Info.GridSize = FIntPoint(Src.GridX, Src.GridY);
+		Info.FrameCount = Src.FrameCount;
+
+		if (Src.NumDepthBits > 0 && uint64(Src.FirstDepthBit) + Src.NumDepthBits <= uint64(H->NumDepthWords) * 32)
+		{
+			Info.DepthFront.SetNumUninitialized(Src.NumDepthBits);
+			for (uint32 b = 0; b < Src.NumDepthBits; ++b)
+			{
+				const uint32 Bit = Src.FirstDepthBit + b;
+				Info.DepthFront[b] = (DepthWords[Bit >> 5] >> (Bit & 31)) & 1;
+			}
+		}
+	}
+
+	OutDef.Registry.Reserve(E.NumRegistry);
+	for (uint32 r = 0; r < E.NumRegistry; ++r)
+	{
+		const FRegistry& Src = Registry[r];
+		if (Src.WeaponMode >= uint8(ESpriteWeaponMode::MAX) || Src.AnimState >= uint8(ESpriteAnimState::MAX)
+			|| uint64(Src.FirstVariant) + Src.NumVariants > H->NumVariants)
+		{
+			continue;
+		}
+		TArray<int32>& Indices = OutDef.Registry.Add(
+			FSpriteAtlasKey{static_cast<ESpriteWeaponMode>(Src.WeaponMode), static_cast<ESpriteAnimState>(Src.AnimState)});
+		Indices.Reserve(Src.NumVariants);
+		for (uint32 v = 0; v < Src.NumVariants; ++v)
+		{
+			const uint32 AtlasIdx = Variants[Src.FirstVariant + v];
+			if (AtlasIdx < E.NumAtlases) Indices.Add(int32(AtlasIdx));
+		}
+	}
+
+	OutDef.AssetPaths.Reserve(E.NumPreloadPaths);
+	for (uint32 p = 0; p < E.NumPreloadPaths; ++p)
+	{
+		OutDef.AssetPaths.Add(FSoftObjectPath(UTF8_TO_TCHAR(GetString(PreloadPaths[p]))));
+	}
+
+	return OutDef.Atlases.Num() > 0;
+}
+
+// ============================================================
+// Offline cook
+// ============================================================
+
+#if !UE_BUILD_SHIPPING
+
+namespace
+{
+	class FIndexWriter
+	{
+	public:
+		TArray<FEntry> Entries;
+		TArray<FAtlas> Atlases;
+		TArray<FRegistry> Registry;
+		TArray<uint32> Variants;
+		TArray<uint32> PreloadPaths;
+		TArray<uint32> DepthWords;
+		uint32 NumDepthBits = 0;
+
+		FIndexWriter()
+		{
+			Strings.Add(0);  // offset 0 = empty string
+		}
+
+		uint32 AddString(const FString& Str)
+		{
+			if (Str.IsEmpty()) return 0;
+			if (const uint32* Found = StringOffsets.Find(Str)) return *Found;
+
+			const FTCHARToUTF8 Utf8(*Str);
+			const uint32 Offset = Strings.Num();
+			Strings.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+			Strings.Add(0);
+			StringOffsets.Add(Str, Offset);
+			return Offset;
+		}
+
+		/** Append a definition's atlases/registry once; returns a template entry (key filled by caller). */
+		FEntry AddDefinition(const FSpriteClassDefinition& Def, const FString& RelManifestPath)
+		{
+			FEntry E = {};
+			E.ManifestPathString = AddString(RelManifestPath);
+			E.FirstAtlas = Atlases.Num();
+			E.NumAtlases = Def.Atlases.Num();
+			E.Flags = Def.bHidesHair ? EntryFlag_HidesHair : 0;
+
+			for (const FSingleAnimAtlasInfo& Info : Def.Atlases)
+			{
+				FAtlas& A = Atlases.AddZeroed_GetRef();
+				A.AssetPathString = AddString(Info.AssetPath);
+				A.SourceString = AddString(Info.Source);
+				A.GridX = uint16(FMath::Clamp(Info.GridSize.X, 0, 0xFFFF));
+				A.GridY = uint16(FMath::Clamp(Info.GridSize.Y, 0, 0xFFFF));
+				A.FrameCount = uint16(FMath::Clamp(Info.FrameCount, 0, 0xFFFF));
+				A.NumDepthBits = uint16(FMath::Min(Info.DepthFront.Num(), 0xFFFF));
+				A.FirstDepthBit = NumDepthBits;
+				for (int32 b = 0; b < A.NumDepthBits; ++b)
+				{
+					const uint32 Bit = NumDepthBits++;
+					if ((Bit >> 5) >= uint32(DepthWords.Num())) DepthWords.Add(0);
+					if (Info.DepthFront[b]) DepthWords[Bit >> 5] |= 1u << (Bit & 31);
+				}
+			}
+
+			// Deterministic registry order (TMap iteration order is not)
+			TArray<FSpriteAtlasKey> Keys;
+			Def.Registry.GetKeys(Keys);
+			Keys.Sort([](const FSpriteAtlasKey& A, const FSpriteAtlasKey& B)
+			{
+				return A.WeaponMode != B.WeaponMode ? A.WeaponMode < B.WeaponMode : A.AnimState < B.AnimState;
+			});
+
+			E.FirstRegistry = Registry.Num();
+			for (const FSpriteAtlasKey& Key : Keys)
+			{
+				const TArray<int32>& Indices = Def.Registry[Key];
+				FRegistry& R = Registry.AddZeroed_GetRef();
+				R.WeaponMode = uint8(Key.WeaponMode);
+				R.AnimState = uint8(Key.AnimState);
+				R.NumVariants = uint16(Indices.Num());
+				R.FirstVariant = Variants.Num();
+				for (int32 Idx : Indices) Variants.Add(uint32(Idx));
+			}
+			E.NumRegistry = Registry.Num() - E.FirstRegistry;
+
+			E.FirstPreloadPath = PreloadPaths.Num();
+			for (const FSoftObjectPath& Path : Def.AssetPaths)
+			{
+				PreloadPaths.Add(AddString(Path.ToString()));
+			}
+			E.NumPreloadPaths = PreloadPaths.Num() - E.FirstPreloadPath;
+			return E;
+		}
+
+		void Serialize(TArray<uint8>& Out)
+		{
+			// Pad string table so the total stays 4-byte aligned
+			while (Strings.Num() % 4) Strings.Add(0);
+
+			FHeader H = {};
+			H.Magic = FSpriteAtlasIndex::Magic;
+			H.Version = FSpriteAtlasIndex::Version;
+			H.NumEntries = Entries.Num();
+			H.NumAtlases = Atlases.Num();
+			H.NumRegistry = Registry.Num();
+			H.NumVariants = Variants.Num();
+			H.NumPreloadPaths = PreloadPaths.Num();
+			H.NumDepthWords = DepthWords.Num();
+			H.StringBytes = Strings.Num();
+
+			uint32 Offset = sizeof(FHeader);
+			auto Place = [&Offset](uint32& OutOffset, int64 Bytes) { OutOffset = Offset; Offset += uint32(Bytes); };
+			Place(H.EntriesOffset, Entries.Num() * sizeof(FEntry));
+			Place(H.AtlasesOffset, Atlases.Num() * sizeof(FAtlas));
+			Place(H.RegistryOffset, Registry.Num() * sizeof(FRegistry));
+			Place(H.VariantsOffset, Variants.Num() * sizeof(uint32));
+			Place(H.PreloadPathsOffset, PreloadPaths.Num() * sizeof(uint32));
+			Place(H.DepthWordsOffset, DepthWords.Num() * sizeof(uint32));
+			Place(H.StringsOffset, Strings.Num());
+
+			Out.Reset(Offset);
+			auto Append = [&Out](const void* Src, int64 Bytes) { Out.Append(static_cast<const uint8*>(Src), Bytes); };
+			Append(&H, sizeof(H));
+			Append(Entries.GetData(), Entries.Num() * sizeof(FEntry));
+			Append(Atlases.GetData(), Atlases.Num() * sizeof(FAtlas));
+			Append(Registry.GetData(), Registry.Num() * sizeof(FRegistry));
+			Append(Variants.GetData(), Variants.Num() * sizeof(uint32));
+			Append(PreloadPaths.GetData(), PreloadPaths.Num() * sizeof(uint32));
+			Append(DepthWords.GetData(), DepthWords.Num() * sizeof(uint32));
+			Append(Strings.GetData(), Strings.Num());
+		}
+
+	private:
+		TArray<uint8> Strings;
+		TMap<FString, uint32> StringOffsets;
+	};
+}
+
+bool FSpriteAtlasIndex::Cook(const FString& OutputPath, FString& OutReport)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	const FString AtlasRoot = FPaths::ProjectContentDir() / TEXT("SabriMMO/Sprites/Atlases");
+
+	TArray<FString> ManifestFiles;
+	IFileManager::Get().FindFilesRecursive(ManifestFiles, *AtlasRoot, TEXT("*_manifest.json"), true, false);
+	if (ManifestFiles.Num() == 0)
+	{
+		OutReport = FString::Printf(TEXT("no *_manifest.json under %s"), *AtlasRoot);
+		return false;
+	}
+
+	// Enumerate every key the runtime can ask for, resolving each through the same
+	// search order FSpriteClassCache uses, so the index answers exactly like the JSON path.
+	TSet<FString> BodyNames;
+	TSet<TPair<ESpriteLayer, int32>> LayerItems;
+	for (const FString& File : ManifestFiles)
+	{
+		FString Rel = File;
+		FPaths::MakePathRelativeTo(Rel, *(AtlasRoot + TEXT("/")));
+		FString TopDir, Rest;
+		if (!Rel.Split(TEXT("/"), &TopDir, &Rest)) continue;
+
+		const FString Stem = FPaths::GetBaseFilename(File).LeftChop(9);  // strip "_manifest"
+		if (TopDir == TEXT("Body"))
+		{
+			BodyNames.Add(Stem);
+			continue;
+		}
+		for (int32 l = 0; l < static_cast<int32>(ESpriteLayer::MAX); ++l)
+		{
+			const ESpriteLayer Layer = static_cast<ESpriteLayer>(l);
+			const FString SubDir = ASpriteCharacterActor::GetLayerSubDir(Layer);
+			const FString Prefix = SubDir.ToLower() + TEXT("_");
+			if (!SubDir.IsEmpty() && SubDir == TopDir && Stem.StartsWith(Prefix, ESearchCase::CaseSensitive))
+			{
+				const FString IdStr = Stem.Mid(Prefix.Len());
+				if (IdStr.IsNumeric()) LayerItems.Add(TPair<ESpriteLayer, int32>(Layer, FCString::Atoi(*IdStr)));
+				break;
+			}
+		}
+	}
+
+	FIndexWriter Writer;
+	TMap<FString, FEntry> EntryByManifest;   // parsed once per manifest, shared by aliasing keys
+	TArray<TPair<FString, FEntry>> Keyed;
+	int32 NumParsed = 0;
+	int32 NumFailed = 0;
+
+	auto AddKey = [&](const FString& Key, const FString& ManifestPath, const FString& FallbackSubPath)
+	{
+		if (ManifestPath.IsEmpty()) return;
+		FEntry* Shared = EntryByManifest.Find(ManifestPath);
+		if (!Shared)
+		{
+			FSpriteClassDefinitionPtr Def = FSpriteClassCache::ParseManifest(Key, ManifestPath, FallbackSubPath);
+			if (!Def.IsValid())
+			{
+				++NumFailed;
+				return;
+			}
+			++NumParsed;
+			FString RelManifest = ManifestPath;
+			FPaths::MakePathRelativeTo(RelManifest, *(AtlasRoot + TEXT("/")));
+			Shared = &EntryByManifest.Add(ManifestPath, Writer.AddDefinition(*Def, RelManifest));
+		}
+		Keyed.Emplace(Key, *Shared);
+	};
+
+	for (const FString& Name : BodyNames)
+	{
+		AddKey(TEXT("Body:") + Name, FSpriteClassCache::FindBodyManifestPath(Name), TEXT("Body"));
+	}
+	static const TCHAR* Genders[] = { TEXT(""), TEXT("male"), TEXT("female") };
+	for (const TPair<ESpriteLayer, int32>& Item : LayerItems)
+	{
+		for (const TCHAR* Gender : Genders)
+		{
+			AddKey(FSpriteClassCache::MakeLayerKey(Item.Key, Item.Value, Gender),
+				FSpriteClassCache::FindLayerManifestPath(Item.Key, Item.Value, Gender),
+				ASpriteCharacterActor::GetLayerSubDir(Item.Key));
+		}
+	}
+
+	// Binary search at runtime compares raw bytes — sort the same way
+	Keyed.Sort([](const TPair<FString, FEntry>& A, const TPair<FString, FEntry>& B)
+	{
+		return A.Key.Compare(B.Key, ESearchCase::CaseSensitive) < 0;
+	});
+	for (TPair<FString, FEntry>& Pair : Keyed)
+	{
+		Pair.Value.KeyString = Writer.AddString(Pair.Key);
+		Writer.Entries.Add(Pair.Value);
+	}
+
+	// Write beside the target and move it into place: the live index may have the target
+	// mapped, and a mapped file can't be overwritten (Windows) or changes under the reader
+	TArray<uint8> Bytes;
+	Writer.Serialize(Bytes);
+	const FString TempPath = OutputPath + TEXT(".tmp");
+	if (!FFileHelper::SaveArrayToFile(Bytes, *TempPath))
+	{
+		OutReport = FString::Printf(TEXT("could not write %s"), *TempPath);
+		return false;
+	}
+
+	const bool bReplacesLiveIndex = FPaths::IsSamePath(OutputPath, GetDefaultPath());
+	if (bReplacesLiveIndex)
+	{
+		Get().Close();
+	}
+	const bool bMoved = IFileManager::Get().Move(*OutputPath, *TempPath, true /* bReplace */);
+	if (bReplacesLiveIndex)
+	{
+		Get().Reload();
+	}
+	if (!bMoved)
+	{
+		IFileManager::Get().Delete(*TempPath);
+		OutReport = FString::Printf(TEXT("could not replace %s"), *OutputPath);
+		return false;
+	}
+
+	OutReport = FString::Printf(
+		TEXT("Wrote %s: %d keys, %d manifests (%d failed), %d atlases, %.1f KB in %.0f ms"),
+		*OutputPath, Writer.Entries.Num(), NumParsed, NumFailed, Writer.Atlases.Num(),
+		Bytes.Num() / 1024.0, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	return true;
+}
+
+#endif // !UE_BUILD_SHIPPING
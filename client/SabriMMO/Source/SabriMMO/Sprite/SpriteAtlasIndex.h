@@ -0,0 +1,73 @@
+// SpriteAtlasIndex.h — Offline-cooked binary index of every sprite manifest.
+//
+// Content/SabriMMO/Sprites/Atlases holds hundreds of small JSON files (one manifest
+// per class/item plus one JSON per animation atlas). CookSpriteAtlasIndex walks them
+// once, offline, and writes SpriteAtlasIndex.bin next to them: flat record arrays
+// (entries, atlases, (mode,state) registry, variant lists, depth bit words) plus one
+// string table. At runtime the file is memory-mapped (or read in one call) and
+// FSpriteClassCache consults it before touching any JSON. Lookups binary-search the
+// sorted entry table and never allocate.
+//
+// Keys missing from the index fall back to the JSON manifests, so newly added
+// sprites work before a re-cook. EDITED sprites need a re-cook:
+//   CookSpriteAtlasIndex [output_path]
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SpriteAtlasData.h"
+
+struct FSpriteClassDefinition;
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+class SABRIMMO_API FSpriteAtlasIndex
+{
+public:
+	static constexpr uint32 Magic = 0x58494153;   // 'SAIX'
+	static constexpr uint32 Version = 1;
+
+	/** Process-wide index, opened on first use from GetDefaultPath(). */
+	static FSpriteAtlasIndex& Get();
+
+	static FString GetDefaultPath();
+
+	~FSpriteAtlasIndex();
+
+	bool IsLoaded() const { return Data != nullptr; }
+	int32 NumEntries() const;
+	int64 GetSizeBytes() const { return Size; }
+	double GetOpenSeconds() const { return OpenSeconds; }
+
+	/** True if Key (an FSpriteClassCache key) is present. No allocation. */
+	bool Contains(FStringView Key) const { return FindEntryIndex(Key) != INDEX_NONE; }
+
+	/** Fill a definition from the entry for Key. Returns false if the key is not indexed. */
+	bool BuildDefinition(FStringView Key, FSpriteClassDefinition& OutDef) const;
+
+	/** Drop the current mapping and reopen the file (after a re-cook). */
+	void Reload();
+
+#if !UE_BUILD_SHIPPING
+	/** Scan every manifest under the atlas root and write the binary index. Reopens the live
+	 *  index when OutputPath is its file. */
+	static bool Cook(const FString& OutputPath, FString& OutReport);
+#endif
+
+private:
+	FSpriteAtlasIndex() = default;
+
+	bool Open(const FString& Path);
+	void Close();
+	int32 FindEntryIndex(FStringView Key) const;
+	const ANSICHAR* GetString(uint32 Offset) const;
+
+	// Either a memory mapping or a single owned read, never both
+	IMappedFileHandle* MappedHandle = nullptr;
+	IMappedFileRegion* MappedRegion = nullptr;
+	TArray<uint8> OwnedBytes;
+
+	const uint8* Data = nullptr;
+	int64 Size = 0;
+	double OpenSeconds = 0.0;
+	bool bTriedOpen = false;
+};
@@ -1,5 +1,8 @@
 // SpriteCharacterActor.cpp — Billboard sprite character with layered equipment
 #include "SpriteCharacterActor.h"
+#include "SpriteAnimationSubsystem.h"
+#include "SpriteOcclusionSubsystem.h"
+#include "SpriteSignificanceSubsystem.h"
 #include "ProceduralMeshComponent.h"
 #include "Materials/Material.h"
 #include "Materials/MaterialInstanceDynamic.h"
@@ -25,13 +28,19 @@
 #include "MMOGameInstance.h"
 #include "SocketEventRouter.h"
 #include "UI/EquipmentSubsystem.h"
+#include "UI/ZoneHeightfieldSubsystem.h"
+#include "UI/SnapshotInterpolationSubsystem.h"
 #include "Components/DecalComponent.h"
+#include "Components/BoxComponent.h"
 #include "Materials/MaterialExpressionCustom.h"
 #include "Materials/MaterialExpressionVectorParameter.h"
 #include "Materials/MaterialExpressionTextureCoordinate.h"
+#include "Materials/MaterialExpressionPerInstanceCustomData.h"
+#include "Containers/Ticker.h"
+#include "RenderCore.h"
 
 // Global sprite LOD bias — driven by Options > Video > Sprite Quality.
-// Read by FSingleAnimAtlasInfo::EnsureTextureLoaded() when textures load.
+// Read by FSingleAnimAtlasInfo::LoadTexture() when textures load.
 int32 FSingleAnimAtlasInfo::GlobalLODBias = 0;
 
 // State name → enum mapping for JSON parsing
@@ -60,6 +69,13 @@ ASpriteCharacterActor::ASpriteCharacterActor()
 
 void ASpriteCharacterActor::EnableClickCollision()
 {
+	// Instanced sprites: the box proxy stands in for the (unregistered) body mesh
+	if (ClickProxy)
+	{
+		ClickProxy->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+		return;
+	}
+
 	// Enable visibility-trace collision on the body mesh so clicks register on the sprite
 	int32 BodyIdx = static_cast<int32>(ESpriteLayer::Body);
 	FSpriteLayerState& Body = Layers[BodyIdx];
@@ -75,6 +91,12 @@ void ASpriteCharacterActor::EnableClickCollision()
 
 void ASpriteCharacterActor::DisableClickCollision()
 {
+	if (ClickProxy)
+	{
+		ClickProxy->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		return;
+	}
+
 	int32 BodyIdx = static_cast<int32>(ESpriteLayer::Body);
 	FSpriteLayerState& Body = Layers[BodyIdx];
 	if (Body.MeshComp)
@@ -100,6 +122,9 @@ void ASpriteCharacterActor::PlayHitFlash()
 				TEXT("TintColor"), FLinearColor(3.0f, 3.0f, 3.0f, 1.0f));
 		}
 	}
+
+	if (USpriteAnimationSubsystem* Anim = AnimSystem.Get())
+		Anim->MarkPendingWork(AnimSlot);
 }
 
 void ASpriteCharacterActor::BeginPlay()
@@ -182,16 +207,58 @@ void ASpriteCharacterActor::BeginPlay()
 
 	// Body class is set by SpawnSpriteForClass() or SetBodyClass() — not here.
 	// BeginPlay only creates the quad geometry; the caller assigns the atlas.
+
+	RegisterFrameUpdates();
+}
+
+void ASpriteCharacterActor::RegisterFrameUpdates()
+{
+	// Per-frame updates run batched in USpriteAnimationSubsystem instead of this actor's Tick
+	SetActorTickEnabled(true);
+	if (USpriteAnimationSubsystem::IsEnabled())
+	{
+		if (USpriteAnimationSubsystem* Anim = GetWorld()->GetSubsystem<USpriteAnimationSubsystem>())
+		{
+			Anim->Register(this);
+			AnimSystem = Anim;
+			SetActorTickEnabled(false);
+		}
+	}
+
+	if (USpriteSignificanceSubsystem* SignificanceSub = GetWorld()->GetSubsystem<USpriteSignificanceSubsystem>())
+		SignificanceSub->Register(this);
 }
 
 // ============================================================
-// Procedural Quad — one per layer, UVs updated per frame
+// Procedural Quad — one per layer, static geometry
 // ============================================================
 
 // Use shared constant from SpriteAtlasData.h (GSpriteCameraDepthOffset)
 // so GetSpriteScreenBounds projects from the same offset position
 static constexpr float SpriteDepthOffset = GSpriteCameraDepthOffset;
 
+static TAutoConsoleVariable<int32> CVarSpriteMaterialUVAnim(
+	TEXT("Sprite.MaterialUVAnim"),
+	1,
+	TEXT("1 = select atlas cells via the AtlasRect material parameter on a static quad (default).\n")
+	TEXT("0 = legacy path: rewrite the quad's vertices/UVs with UpdateMeshSection on every frame change."),
+	ECVF_Default);
+
+namespace
+{
+	// Frame-update counters — read by Sprite.QuadStats / Sprite.QuadBench
+	struct FSpriteQuadCounters
+	{
+		uint64 FrameUpdates = 0;
+		uint64 ParamWrites = 0;
+		uint64 MeshUploads = 0;
+		uint64 UpdateCycles = 0;
+	};
+	FSpriteQuadCounters GSpriteQuadCounters;
+
+	// Identity rect: the legacy path bakes atlas UVs into the vertices instead
+	const FLinearColor FullAtlasRect(0.f, 0.f, 1.f, 1.f);
+}
 
 void ASpriteCharacterActor::CreateLayerQuad(int32 LayerIndex)
 {
@@ -210,6 +277,20 @@ void ASpriteCharacterActor::CreateLayerQuad(int32 LayerIndex)
 	Layer.MeshComp->SetRenderCustomDepth(true);
 	Layer.MeshComp->SetCustomDepthStencilValue(1);
 
+	// bCreateCollision=true so EnableClickCollision() has geometry to trace against
+	Layer.MeshComp->bUseComplexAsSimpleCollision = true;
+	BuildStaticQuad(Layer);
+
+	// Back-to-front layer ordering via translucent sort distance offset.
+	// Higher layer index = more negative offset = appears closer = drawn LAST (on top).
+	// All 9 layers share the actor position, so this is the only ordering discriminator.
+	// Small magnitudes (-0.1 per layer) avoid corrupting cross-character sort.
+	Layer.MeshComp->TranslucencySortPriority = 0;
+	Layer.MeshComp->TranslucencySortDistanceOffset = -0.1f * static_cast<float>(LayerIndex);
+}
+
+void ASpriteCharacterActor::BuildStaticQuad(FSpriteLayerState& Layer)
+{
 	float HalfW = SpriteSize.X * 0.5f;
 	float HalfH = SpriteSize.Y * 0.5f;
 
@@ -226,11 +307,14 @@ void ASpriteCharacterActor::CreateLayerQuad(int32 LayerIndex)
 	TArray<FVector> Normals;
 	Normals.Init(FVector(1, 0, 0), 4);
 
+	// Cell-local UVs, mirrored horizontally — compensates for billboard rotation
+	// negating local Y axis (Yaw=180° makes +Y point screen-left instead of right).
+	// The material maps them into the atlas: UV * AtlasRect.zw + AtlasRect.xy
 	TArray<FVector2D> UVs;
-	UVs.Add(FVector2D(0, 1));
 	UVs.Add(FVector2D(1, 1));
-	UVs.Add(FVector2D(1, 0));
+	UVs.Add(FVector2D(0, 1));
 	UVs.Add(FVector2D(0, 0));
+	UVs.Add(FVector2D(1, 0));
 
 	TArray<FColor> Colors;
 	Colors.Init(FColor::White, 4);
@@ -238,17 +322,97 @@ void ASpriteCharacterActor::CreateLayerQuad(int32 LayerIndex)
 	TArray<FProcMeshTangent> Tangents;
 	Tangents.Init(FProcMeshTangent(0, 1, 0), 4);
 
-	// bCreateCollision=true so EnableClickCollision() has geometry to trace against
-	Layer.MeshComp->bUseComplexAsSimpleCollision = true;
 	Layer.MeshComp->CreateMeshSection(0, Vertices, Triangles, Normals,
 	                                   UVs, Colors, Tangents, true);
+	Layer.QuadSize = SpriteSize;
+	Layer.bQuadUVsStatic = true;
+	++GSpriteQuadCounters.MeshUploads;
+}
 
-	// Back-to-front layer ordering via translucent sort distance offset.
-	// Higher layer index = more negative offset = appears closer = drawn LAST (on top).
-	// All 9 layers share the actor position, so this is the only ordering discriminator.
-	// Small magnitudes (-0.1 per layer) avoid corrupting cross-character sort.
-	Layer.MeshComp->TranslucencySortPriority = 0;
-	Layer.MeshComp->TranslucencySortDistanceOffset = -0.1f * static_cast<float>(LayerIndex);
+void ASpriteCharacterActor::ApplyLayerFrame(FSpriteLayerState& Layer,
+	const FVector2D& UVOffset, const FVector2D& UVScale, float ZOffset)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	++GSpriteQuadCounters.FrameUpdates;
+
+	FLinearColor AtlasRect = FullAtlasRect;
+	float RelativeZ = 0.f;
+
+	if (bInstancedRendering)
+	{
+		// USpriteInstancingSubsystem picks these up into per-instance custom data / transform
+		Layer.AppliedAtlasRect = FLinearColor(UVOffset.X, UVOffset.Y, UVScale.X, UVScale.Y);
+		Layer.AppliedZOffset = ZOffset;
+		GSpriteQuadCounters.UpdateCycles += FPlatformTime::Cycles64() - StartCycles;
+		return;
+	}
+
+	if (CVarSpriteMaterialUVAnim.GetValueOnGameThread() != 0)
+	{
+		// Static quad: geometry only changes with SpriteSize (NPCs set it after spawn)
+		if (!Layer.bQuadUVsStatic || Layer.QuadSize != SpriteSize)
+		{
+			BuildStaticQuad(Layer);
+		}
+		AtlasRect = FLinearColor(UVOffset.X, UVOffset.Y, UVScale.X, UVScale.Y);
+		RelativeZ = ZOffset;
+	}
+	else
+	{
+		float U0 = UVOffset.X;
+		float V0 = UVOffset.Y;
+		float U1 = UVOffset.X + UVScale.X;
+		float V1 = UVOffset.Y + UVScale.Y;
+
+		// Swap U0/U1 to flip horizontally (see BuildStaticQuad)
+		TArray<FVector2D> NewUVs;
+		NewUVs.Add(FVector2D(U1, V1));
+		NewUVs.Add(FVector2D(U0, V1));
+		NewUVs.Add(FVector2D(U0, V0));
+		NewUVs.Add(FVector2D(U1, V0));
+
+		float HalfW = SpriteSize.X * 0.5f;
+		float HalfH = SpriteSize.Y * 0.5f;
+
+		TArray<FVector> Vertices;
+		Vertices.Add(FVector(SpriteDepthOffset, -HalfW, ZOffset));
+		Vertices.Add(FVector(SpriteDepthOffset, HalfW, ZOffset));
+		Vertices.Add(FVector(SpriteDepthOffset, HalfW, HalfH * 2.f + ZOffset));
+		Vertices.Add(FVector(SpriteDepthOffset, -HalfW, HalfH * 2.f + ZOffset));
+
+		TArray<FVector> Normals;
+		Normals.Init(FVector(1, 0, 0), 4);
+
+		Layer.MeshComp->UpdateMeshSection(0, Vertices, Normals, NewUVs,
+		                                   TArray<FColor>(), TArray<FProcMeshTangent>());
+		Layer.bQuadUVsStatic = false;
+		++GSpriteQuadCounters.MeshUploads;
+	}
+
+	// Sit offset moves the component instead of the vertices (transform update only)
+	if (Layer.AppliedZOffset != RelativeZ)
+	{
+		Layer.MeshComp->SetRelativeLocation(FVector(0.f, 0.f, RelativeZ));
+		Layer.AppliedZOffset = RelativeZ;
+	}
+
+	// A freshly created MID starts at the material default, so a material swap forces a write
+	if (Layer.MaterialInst)
+	{
+		if (Layer.AtlasRectMaterial.Get() != Layer.MaterialInst)
+		{
+			Layer.AtlasRectMaterial = Layer.MaterialInst;
+			Layer.AppliedAtlasRect = FullAtlasRect;
+		}
+		if (Layer.AppliedAtlasRect != AtlasRect)
+		{
+			Layer.MaterialInst->SetVectorParameterValue(TEXT("AtlasRect"), AtlasRect);
+			Layer.AppliedAtlasRect = AtlasRect;
+			++GSpriteQuadCounters.ParamWrites;
+		}
+	}
+
+	GSpriteQuadCounters.UpdateCycles += FPlatformTime::Cycles64() - StartCycles;
 }
 
 void ASpriteCharacterActor::UpdateQuadUVs(FSpriteLayerState& Layer)
@@ -261,7 +425,7 @@ void ASpriteCharacterActor::UpdateQuadUVs(FSpriteLayerState& Layer)
 	if (Layer.bUsingLayerV2)
 	{
 		// Per-animation atlas path (equipment layers)
-		if (!Layer.ActiveLayerAtlas || !Layer.ActiveLayerAtlas->AtlasTexture)
+		if (!Layer.ActiveLayerAtlas)
 		{
 			// Current animation not available — hide layer (e.g., weapon during sit)
 			Layer.MeshComp->SetVisibility(false);
@@ -296,27 +460,11 @@ void ASpriteCharacterActor::UpdateQuadUVs(FSpriteLayerState& Layer)
 		UVScale = Layer.AtlasInfo.GetUVScale();
 	}
 
-	float U0 = UVOffset.X;
-	float V0 = UVOffset.Y;
-	float U1 = UVOffset.X + UVScale.X;
-	float V1 = UVOffset.Y + UVScale.Y;
-
-	// Swap U0/U1 to flip horizontally — compensates for billboard rotation
-	// negating local Y axis (Yaw=180° makes +Y point screen-left instead of right)
-	TArray<FVector2D> NewUVs;
-	NewUVs.Add(FVector2D(U1, V1));
-	NewUVs.Add(FVector2D(U0, V1));
-	NewUVs.Add(FVector2D(U0, V0));
-	NewUVs.Add(FVector2D(U1, V0));
-
-	float HalfW = SpriteSize.X * 0.5f;
-	float HalfH = SpriteSize.Y * 0.5f;
-
 	// Sit Z-offset applies to ALL layers (matches body)
 	float ZOffset = 0.f;
 	if (CurrentAnimState == ESpriteAnimState::Sit)
 	{
-		ZOffset = -HalfH * 0.6f;
+		ZOffset = -SpriteSize.Y * 0.5f * 0.6f;
 	}
 
 	// Per-frame depth ordering for equipment layers via translucent sort distance
@@ -334,17 +482,7 @@ void ASpriteCharacterActor::UpdateQuadUVs(FSpriteLayerState& Layer)
 		Layer.MeshComp->TranslucencySortDistanceOffset = BaseOffset + FrontBackAdj;
 	}
 
-	TArray<FVector> Vertices;
-	Vertices.Add(FVector(SpriteDepthOffset, -HalfW, ZOffset));
-	Vertices.Add(FVector(SpriteDepthOffset, HalfW, ZOffset));
-	Vertices.Add(FVector(SpriteDepthOffset, HalfW, HalfH * 2.f + ZOffset));
-	Vertices.Add(FVector(SpriteDepthOffset, -HalfW, HalfH * 2.f + ZOffset));
-
-	TArray<FVector> Normals;
-	Normals.Init(FVector(1, 0, 0), 4);
-
-	Layer.MeshComp->UpdateMeshSection(0, Vertices, Normals, NewUVs,
-	                                   TArray<FColor>(), TArray<FProcMeshTangent>());
+	ApplyLayerFrame(Layer, UVOffset, UVScale, ZOffset);
 }
 
 void ASpriteCharacterActor::UpdateBodyQuadUVs()
@@ -405,42 +543,70 @@ void ASpriteCharacterActor::UpdateBodyQuadUVs()
 		}
 	}
 
-	float U0 = UVOffset.X;
-	float V0 = UVOffset.Y;
-	float U1 = UVOffset.X + UVScale.X;
-	float V1 = UVOffset.Y + UVScale.Y;
-
-	// Swap U0/U1 to flip horizontally — compensates for billboard rotation
-	// negating local Y axis (Yaw=180° makes +Y point screen-left instead of right)
-	TArray<FVector2D> NewUVs;
-	NewUVs.Add(FVector2D(U1, V1));
-	NewUVs.Add(FVector2D(U0, V1));
-	NewUVs.Add(FVector2D(U0, V0));
-	NewUVs.Add(FVector2D(U1, V0));
-
-	float HalfW = SpriteSize.X * 0.5f;
-	float HalfH = SpriteSize.Y * 0.5f;
-
 	// Shift quad down when sitting so the seated character rests on the ground
 	// instead of floating at standing-height. The sitting sprite occupies less
 	// vertical space, so we lower the quad by ~30% of sprite height.
 	float ZOffset = 0.f;
 	if (CurrentAnimState == ESpriteAnimState::Sit)
 	{
-		ZOffset = -HalfH * 0.6f;
+		ZOffset = -SpriteSize.Y * 0.5f * 0.6f;
 	}
 
-	TArray<FVector> Vertices;
-	Vertices.Add(FVector(SpriteDepthOffset, -HalfW, ZOffset));
-	Vertices.Add(FVector(SpriteDepthOffset, HalfW, ZOffset));
-	Vertices.Add(FVector(SpriteDepthOffset, HalfW, HalfH * 2.f + ZOffset));
-	Vertices.Add(FVector(SpriteDepthOffset, -HalfW, HalfH * 2.f + ZOffset));
+	ApplyLayerFrame(Body, UVOffset, UVScale, ZOffset);
+}
 
-	TArray<FVector> Normals;
-	Normals.Init(FVector(1, 0, 0), 4);
+// ============================================================
+// Instanced rendering handoff (USpriteInstancingSubsystem)
+// ============================================================
+
+void ASpriteCharacterActor::EnableInstancedRendering()
+{
+	if (bInstancedRendering)
+		return;
+	bInstancedRendering = true;
+
+	// Click proxy: thin box over the sprite quad, visibility channel only (same as the body mesh)
+	ClickProxy = NewObject<UBoxComponent>(this, TEXT("SpriteClickProxy"));
+	ClickProxy->SetupAttachment(RootComp);
+	ClickProxy->SetBoxExtent(FVector(2.f, SpriteSize.X * 0.5f, SpriteSize.Y * 0.5f));
+	ClickProxy->SetRelativeLocation(FVector(SpriteDepthOffset, 0.f, SpriteSize.Y * 0.5f));
+	ClickProxy->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	ClickProxy->SetCollisionResponseToAllChannels(ECR_Ignore);
+	ClickProxy->SetCollisionResponseToChannel(ECC_Visibility, ECR_Block);
+	ClickProxy->SetGenerateOverlapEvents(false);
+	ClickProxy->SetCanEverAffectNavigation(false);
+	ClickProxy->RegisterComponent();
+
+	// Carry over click state from the body mesh, then take the meshes out of the scene.
+	// The components stay alive so texture/material/visibility bookkeeping is unchanged.
+	FSpriteLayerState& Body = Layers[static_cast<int32>(ESpriteLayer::Body)];
+	if (Body.MeshComp && Body.MeshComp->GetCollisionEnabled() != ECollisionEnabled::NoCollision)
+	{
+		ClickProxy->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	}
+	for (int32 i = 0; i < static_cast<int32>(ESpriteLayer::MAX); i++)
+	{
+		if (Layers[i].MeshComp && Layers[i].MeshComp->IsRegistered())
+		{
+			Layers[i].MeshComp->UnregisterComponent();
+		}
+	}
+	if (BlobShadow && BlobShadow->IsRegistered())
+	{
+		BlobShadow->UnregisterComponent();
+	}
 
-	Body.MeshComp->UpdateMeshSection(0, Vertices, Normals, NewUVs,
-	                                  TArray<FColor>(), TArray<FProcMeshTangent>());
+	UpdateAllLayers();
+}
+
+UTexture2D* ASpriteCharacterActor::GetLayerTexture(int32 LayerIndex) const
+{
+	const FSpriteLayerState& Layer = Layers[LayerIndex];
+	if (LayerIndex == static_cast<int32>(ESpriteLayer::Body) && ActiveBodyTexture)
+		return ActiveBodyTexture;
+	if (Layer.bUsingLayerV2)
+		return Layer.ActiveLayerTexture;
+	return Layer.AtlasInfo.AtlasTexture;
 }
 
 // ============================================================
@@ -451,6 +617,19 @@ UMaterialInstanceDynamic* ASpriteCharacterActor::CreateSpriteMaterial(UTexture2D
 {
 	if (!Texture) return nullptr;
 
+	UMaterialInstanceDynamic* MID = UMaterialInstanceDynamic::Create(BuildSpriteMaterial(Texture, false), this);
+	if (MID)
+	{
+		MID->SetTextureParameterValue(TEXT("Atlas"), Texture);
+		// Layers created after an occlusion result (equipment swaps) start in the same state
+		if (bFeetOccluded) MID->SetScalarParameterValue(TEXT("FeetOccluded"), 1.f);
+		if (bHeadOccluded) MID->SetScalarParameterValue(TEXT("HeadOccluded"), 1.f);
+	}
+	return MID;
+}
+
+UMaterial* ASpriteCharacterActor::BuildSpriteMaterial(UTexture2D* Texture, bool bPerInstanceData)
+{
 	UMaterial* Mat = NewObject<UMaterial>(GetTransientPackage(), NAME_None, RF_Transient);
 	Mat->MaterialDomain = MD_Surface;
 	Mat->BlendMode = BLEND_Translucent;                  // Required for bDisableDepthTest
@@ -469,18 +648,94 @@ UMaterialInstanceDynamic* ASpriteCharacterActor::CreateSpriteMaterial(UTexture2D
 	TexSample->SamplerType = SAMPLERTYPE_Color;
 	Mat->GetExpressionCollection().AddExpression(TexSample);
 
-	// TintColor parameter (default White = no tint, used by Hair layer for color)
-	UMaterialExpressionVectorParameter* TintParam =
-		NewObject<UMaterialExpressionVectorParameter>(Mat);
-	TintParam->ParameterName = TEXT("TintColor");
-	TintParam->DefaultValue = FLinearColor::White;
-	Mat->GetExpressionCollection().AddExpression(TintParam);
+	if (bPerInstanceData)
+	{
+		// Instanced sprites (USpriteInstancingSubsystem) draw many actors per component
+		Mat->bUsedWithInstancedStaticMeshes = true;
+	}
+
+	// Reads one per-instance custom data float (layout: SpriteInstanceData)
+	auto MakeInstanceData = [Mat](int32 Index, float Default) -> UMaterialExpression*
+	{
+		UMaterialExpressionPerInstanceCustomData* Data = NewObject<UMaterialExpressionPerInstanceCustomData>(Mat);
+		Data->DataIndex = Index;
+		Data->ConstDefaultValue = Default;
+		Mat->GetExpressionCollection().AddExpression(Data);
+		return Data;
+	};
+
+	// AtlasRect — (U offset, V offset, U scale, V scale) of the current atlas cell.
+	// The quad carries cell-local 0..1 UVs, so a frame change is one vector write
+	// instead of a vertex buffer upload. Default = whole texture (legacy baked UVs).
+	// Instanced: the four components come from per-instance custom data instead.
+	UMaterialExpressionTextureCoordinate* QuadUV = NewObject<UMaterialExpressionTextureCoordinate>(Mat);
+	Mat->GetExpressionCollection().AddExpression(QuadUV);
+
+	UMaterialExpressionCustom* AtlasUV = NewObject<UMaterialExpressionCustom>(Mat);
+	AtlasUV->OutputType = CMOT_Float2;
+	AtlasUV->Code = TEXT("return InUV * float2(InRectZ, InRectW) + float2(InRectX, InRectY);");
+	FCustomInput& QuadUVIn = AtlasUV->Inputs.AddDefaulted_GetRef();
+	QuadUVIn.InputName = TEXT("InUV");
+	QuadUVIn.Input.Connect(0, QuadUV);
+
+	static const TCHAR* RectInputNames[] = { TEXT("InRectX"), TEXT("InRectY"), TEXT("InRectZ"), TEXT("InRectW") };
+	UMaterialExpressionVectorParameter* AtlasRectParam = nullptr;
+	if (!bPerInstanceData)
+	{
+		AtlasRectParam = NewObject<UMaterialExpressionVectorParameter>(Mat);
+		AtlasRectParam->ParameterName = TEXT("AtlasRect");
+		AtlasRectParam->DefaultValue = FLinearColor(0.f, 0.f, 1.f, 1.f);
+		Mat->GetExpressionCollection().AddExpression(AtlasRectParam);
+	}
+	for (int32 i = 0; i < 4; ++i)
+	{
+		FCustomInput& RectIn = AtlasUV->Inputs.AddDefaulted_GetRef();
+		RectIn.InputName = RectInputNames[i];
+		if (AtlasRectParam)
+		{
+			// Vector parameter outputs 1..4 are R, G, B, A
+			RectIn.Input.Connect(i + 1, AtlasRectParam);
+		}
+		else
+		{
+			RectIn.Input.Connect(0, MakeInstanceData(SpriteInstanceData::AtlasRect + i, i < 2 ? 0.f : 1.f));
+		}
+	}
+	Mat->GetExpressionCollection().AddExpression(AtlasUV);
+	TexSample->Coordinates.Connect(0, AtlasUV);
+
+	// TintColor (default White = no tint, used by Hair layer for color)
+	UMaterialExpression* TintSource = nullptr;
+	if (bPerInstanceData)
+	{
+		UMaterialExpressionCustom* TintData = NewObject<UMaterialExpressionCustom>(Mat);
+		TintData->OutputType = CMOT_Float3;
+		TintData->Code = TEXT("return float3(InR, InG, InB);");
+		static const TCHAR* TintInputNames[] = { TEXT("InR"), TEXT("InG"), TEXT("InB") };
+		for (int32 i = 0; i < 3; ++i)
+		{
+			FCustomInput& TintIn = TintData->Inputs.AddDefaulted_GetRef();
+			TintIn.InputName = TintInputNames[i];
+			TintIn.Input.Connect(0, MakeInstanceData(SpriteInstanceData::Tint + i, 1.f));
+		}
+		Mat->GetExpressionCollection().AddExpression(TintData);
+		TintSource = TintData;
+	}
+	else
+	{
+		UMaterialExpressionVectorParameter* TintParam =
+			NewObject<UMaterialExpressionVectorParameter>(Mat);
+		TintParam->ParameterName = TEXT("TintColor");
+		TintParam->DefaultValue = FLinearColor::White;
+		Mat->GetExpressionCollection().AddExpression(TintParam);
+		TintSource = TintParam;
+	}
 
 	// Multiply texture RGB by TintColor
 	UMaterialExpressionMultiply* Multiply =
 		NewObject<UMaterialExpressionMultiply>(Mat);
 	Multiply->A.Connect(0, TexSample);
-	Multiply->B.Connect(0, TintParam);
+	Multiply->B.Connect(0, TintSource);
 	Mat->GetExpressionCollection().AddExpression(Multiply);
 
 	// FeetOccluded — line trace from camera to actor feet. 1 = feet behind a wall.
@@ -582,13 +837,7 @@ UMaterialInstanceDynamic* ASpriteCharacterActor::CreateSpriteMaterial(UTexture2D
 
 	Mat->PreEditChange(nullptr);
 	Mat->PostEditChange();
-
-	UMaterialInstanceDynamic* MID = UMaterialInstanceDynamic::Create(Mat, this);
-	if (MID)
-	{
-		MID->SetTextureParameterValue(TEXT("Atlas"), Texture);
-	}
-	return MID;
+	return Mat;
 }
 
 // ============================================================
@@ -627,8 +876,14 @@ ESpriteDirection ASpriteCharacterActor::CalculateDirection() const
 		return ESpriteDirection::S;
 
 	FVector CamFwd = PC->PlayerCameraManager->GetCameraRotation().Vector();
-	FVector2D Facing2D(FacingDir.X, FacingDir.Y);
-	FVector2D CamFwd2D(CamFwd.X, CamFwd.Y);
+	return DirectionFromFacing(FVector2D(FacingDir.X, FacingDir.Y), FVector2D(CamFwd.X, CamFwd.Y));
+}
+
+ESpriteDirection ASpriteCharacterActor::DirectionFromFacing(const FVector2D& Facing, const FVector2D& CamFwd)
+{
+	// Pure math — also run from USpriteAnimationSubsystem's batched (possibly parallel) pass
+	FVector2D Facing2D = Facing;
+	FVector2D CamFwd2D = CamFwd;
 
 	if (Facing2D.IsNearlyZero() || CamFwd2D.IsNearlyZero())
 		return ESpriteDirection::S;
@@ -653,6 +908,9 @@ void ASpriteCharacterActor::SetFacingDirection(const FVector& WorldForward)
 	FacingDir.Z = 0.f;
 	if (!FacingDir.IsNearlyZero())
 		FacingDir.Normalize();
+
+	if (USpriteAnimationSubsystem* Anim = AnimSystem.Get())
+		Anim->SetFacing(AnimSlot, FacingDir);
 }
 
 // ============================================================
@@ -680,18 +938,28 @@ bool ASpriteCharacterActor::IsRevertState(ESpriteAnimState S)
 
 void ASpriteCharacterActor::UpdateAnimation(float DeltaTime)
 {
-	float Duration = GetFrameDuration();
+	float Duration = GetFrameDuration(CurrentAnimState);
 	FrameTimer += DeltaTime;
 
 	if (FrameTimer < Duration)
 		return;
 
 	FrameTimer -= Duration;
-	CurrentFrame++;
+	AdvanceAnimationFrame();
+}
 
-	int32 MaxFrames = GetFrameCount();
-	if (CurrentFrame >= MaxFrames)
+bool ASpriteCharacterActor::AdvanceAnimationFrame(int32 Steps)
+{
+	// Steps > 1: low-significance sprites skip cells (USpriteSignificanceSubsystem) but still
+	// wrap, revert and fire cycle hooks exactly as stepping one at a time would
+	for (int32 Step = 0; Step < Steps; ++Step)
 	{
+		CurrentFrame++;
+
+		int32 MaxFrames = GetFrameCount();
+		if (CurrentFrame < MaxFrames)
+			continue;
+
 		if (IsLoopingState(CurrentAnimState))
 		{
 			CurrentFrame = 0;
@@ -716,17 +984,22 @@ void ASpriteCharacterActor::UpdateAnimation(float DeltaTime)
 			if (IsRevertState(CurrentAnimState))
 			{
 				SetAnimState(ESpriteAnimState::Idle);
-				return;
+				return true;
 			}
+
+			// One-shot without revert (Death): last frame holds until the next state change
+			UpdateAllLayers();
+			return false;
 		}
 	}
 
 	UpdateAllLayers();
+	return true;
 }
 
-float ASpriteCharacterActor::GetFrameDuration() const
+float ASpriteCharacterActor::GetFrameDuration(ESpriteAnimState State)
 {
-	switch (CurrentAnimState)
+	switch (State)
 	{
 	case ESpriteAnimState::Idle:       return 0.25f;
 	case ESpriteAnimState::Walk:       return 0.10f;
@@ -789,6 +1062,8 @@ void ASpriteCharacterActor::SetAnimState(ESpriteAnimState NewState)
 	CurrentAnimState = NewState;
 	CurrentFrame = 0;
 	FrameTimer = 0.0f;
+	if (USpriteAnimationSubsystem* Anim = AnimSystem.Get())
+		Anim->ResetState(AnimSlot, NewState);
 
 	if (bUsingV2Atlas)
 	{
@@ -961,11 +1236,29 @@ void ASpriteCharacterActor::SetWeaponMode(ESpriteWeaponMode Mode)
 
 void ASpriteCharacterActor::Tick(float DeltaTime)
 {
+	// Only reached with Sprite.BatchedAnimation 0 — otherwise USpriteAnimationSubsystem
+	// runs the same steps for every sprite in one pass and this actor doesn't tick.
 	Super::Tick(DeltaTime);
 	UpdateOwnerTracking();
 	UpdateBillboard();
 	UpdateDirection();
 	UpdateAnimation(DeltaTime);
+	TickPendingWork(DeltaTime);
+}
+
+bool ASpriteCharacterActor::HasPendingLayerWork() const
+{
+	if (bHitFlashing) return true;
+	for (int32 i = 0; i < static_cast<int32>(ESpriteLayer::MAX); i++)
+	{
+		if (Layers[i].PendingSwapTexture) return true;
+	}
+	return false;
+}
+
+bool ASpriteCharacterActor::TickPendingWork(float DeltaTime)
+{
+	bool bStillPending = false;
 
 	// Path C: finalize deferred equipment swaps once their textures finish streaming.
 	// While pending, the OLD equipment material/registry stays in place so the player
@@ -983,6 +1276,10 @@ void ASpriteCharacterActor::Tick(float DeltaTime)
 		{
 			FinalizeEquipmentSwap(L, static_cast<ESpriteLayer>(i));
 		}
+		else
+		{
+			bStillPending = true;
+		}
 	}
 
 	// Hit flash: restore original tints after flash duration
@@ -1003,11 +1300,30 @@ void ASpriteCharacterActor::Tick(float DeltaTime)
 			}
 			bHitFlashing = false;
 		}
+		else
+		{
+			bStillPending = true;
+		}
 	}
+
+	return bStillPending;
 }
 
 void ASpriteCharacterActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	if (USpriteAnimationSubsystem* Anim = AnimSystem.Get())
+		Anim->Unregister(this);
+	AnimSystem = nullptr;
+
+	if (USpriteOcclusionSubsystem* Occlusion = GetWorld() ? GetWorld()->GetSubsystem<USpriteOcclusionSubsystem>() : nullptr)
+		Occlusion->Unregister(this);
+
+	if (USpriteSignificanceSubsystem* SignificanceSub = GetWorld() ? GetWorld()->GetSubsystem<USpriteSignificanceSubsystem>() : nullptr)
+		SignificanceSub->Unregister(this);
+
+	if (USnapshotInterpolationSubsystem* Interp = GetWorld() ? GetWorld()->GetSubsystem<USnapshotInterpolationSubsystem>() : nullptr)
+		Interp->Remove(this);
+
 	if (UMMOGameInstance* GI = Cast<UMMOGameInstance>(GetGameInstance()))
 	{
 		if (USocketEventRouter* Router = GI->GetEventRouter())
@@ -1018,6 +1334,75 @@ void ASpriteCharacterActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	Super::EndPlay(EndPlayReason);
 }
 
+// ============================================================
+// Pooling — UActorPoolSubsystem parks released enemy / player sprites
+// ============================================================
+
+void ASpriteCharacterActor::OnAcquiredFromPool()
+{
+	RegisterFrameUpdates();
+}
+
+void ASpriteCharacterActor::OnReleasedToPool()
+{
+	UWorld* World = GetWorld();
+
+	OnAnimCycleComplete.Clear();
+	if (UMMOGameInstance* GI = Cast<UMMOGameInstance>(GetGameInstance()))
+	{
+		if (USocketEventRouter* Router = GI->GetEventRouter())
+		{
+			Router->UnregisterAllForOwner(this);
+		}
+	}
+
+	if (USpriteOcclusionSubsystem* Occlusion = World ? World->GetSubsystem<USpriteOcclusionSubsystem>() : nullptr)
+		Occlusion->Unregister(this);
+	SetOcclusion(false, false);
+
+	if (USnapshotInterpolationSubsystem* Interp = World ? World->GetSubsystem<USnapshotInterpolationSubsystem>() : nullptr)
+		Interp->Remove(this);
+
+	// Equipment, hair and tints belonged to the last user; the body atlas stays bound
+	for (int32 i = 0; i < static_cast<int32>(ESpriteLayer::MAX); i++)
+	{
+		const ESpriteLayer LayerType = static_cast<ESpriteLayer>(i);
+		if (LayerType != ESpriteLayer::Body && LayerType != ESpriteLayer::Shadow)
+			LoadEquipmentLayer(LayerType, 0);
+	}
+	CurrentHairStyle = 0;
+	CurrentHairColor = 0;
+	bHairHiddenByHeadgear = false;
+
+	bHitFlashing = false;
+	SavedLayerTints.Empty();
+	for (int32 i = 0; i < static_cast<int32>(ESpriteLayer::MAX); i++)
+		SetLayerTint(static_cast<ESpriteLayer>(i), FLinearColor::White);
+
+	SetWeaponMode(ESpriteWeaponMode::None);
+	SetAnimState(ESpriteAnimState::Idle);
+	DisableClickCollision();
+	SetActorScale3D(FVector::OneVector);
+
+	OwnerActor.Reset();
+	bIsLocalPlayerSprite = false;
+	LocalCharacterId = 0;
+	bUseServerMovement = false;
+	GroundZOffset = 0.f;
+	LastGroundSnapLoc = FVector(TNumericLimits<float>::Max());
+	LastTrackingTime = 0.0;
+
+	// Parked sprites leave the per-frame passes; the next user starts at full detail
+	if (USpriteAnimationSubsystem* Anim = AnimSystem.Get())
+		Anim->Unregister(this);
+	AnimSystem = nullptr;
+	if (USpriteSignificanceSubsystem* SignificanceSub = World ? World->GetSubsystem<USpriteSignificanceSubsystem>() : nullptr)
+		SignificanceSub->Unregister(this);
+	Significance = ESpriteSignificance::Full;
+	if (BlobShadow)
+		BlobShadow->SetVisibility(true);
+}
+
 void ASpriteCharacterActor::UpdateAllLayers()
 {
 	for (int32 i = 0; i < static_cast<int32>(ESpriteLayer::MAX); i++)
@@ -1129,7 +1514,7 @@ void ASpriteCharacterActor::ReconcileHairVisibility()
 		{
 			SetLayerVisible(ESpriteLayer::Hair, false);
 		}
-		else if (Layers[HairIdx].bUsingLayerV2 && Layers[HairIdx].LayerAtlasRegistry.Num() > 0)
+		else if (Layers[HairIdx].bUsingLayerV2 && Layers[HairIdx].LayerDefinition.IsValid())
 		{
 			SetLayerVisible(ESpriteLayer::Hair, true);
 			ResolveLayerAtlas(Layers[HairIdx]);
@@ -1240,7 +1625,7 @@ FSpriteAtlasInfo ASpriteCharacterActor::ParseAtlasJSON(const FString& JsonStr, c
 
 					// Set default frame duration and loop from state type
 					Info.bLoops = IsLoopingState(*StateEnum);
-					Info.FrameDuration = GetFrameDuration();
+					Info.FrameDuration = GetFrameDuration(CurrentAnimState);
 
 					Variants.Variants.Add(Info);
 				}
@@ -1298,28 +1683,17 @@ void ASpriteCharacterActor::SetBodyClass(int32 ClassId, int32 Gender)
 
 	FString BodyRoot = FPaths::ProjectContentDir() / TEXT("SabriMMO/Sprites/Atlases/Body");
 
-	// --- Try V2 manifest first (per-animation atlases) ---
-	// Try subfolder first (Body/{BaseName}/), then flat (Body/)
-	FString JsonDir = BodyRoot / BaseName;
-	FString ManifestPath = JsonDir / FString::Printf(TEXT("%s_manifest.json"), *BaseName);
-	FString ManifestStr;
-	if (!FFileHelper::LoadFileToString(ManifestStr, *ManifestPath))
-	{
-		// Fallback: flat structure
-		JsonDir = BodyRoot;
-		ManifestPath = JsonDir / FString::Printf(TEXT("%s_manifest.json"), *BaseName);
-		FFileHelper::LoadFileToString(ManifestStr, *ManifestPath);
-	}
-	if (!ManifestStr.IsEmpty())
+	// --- Try V2 manifest first (per-animation atlases, parsed once per process) ---
+	if (FSpriteClassDefinitionPtr Definition = FSpriteClassCache::Get().FindOrLoadBody(BaseName))
 	{
 		bUsingV2Atlas = true;
-		LoadV2AtlasManifest(ManifestPath);
+		ApplyV2BodyDefinition(Definition);
 		return;
 	}
 
 	// --- V1: weapon-group atlases ---
-	// Reset JsonDir to try subfolder for v1 too
-	JsonDir = BodyRoot / BaseName;
+	// Try subfolder first (Body/{BaseName}/), then flat (Body/)
+	FString JsonDir = BodyRoot / BaseName;
 	if (!FPaths::DirectoryExists(JsonDir))
 		JsonDir = BodyRoot;
 
@@ -1478,30 +1852,19 @@ void ASpriteCharacterActor::SetBodyClass(int32 ClassId, int32 Gender)
 
 void ASpriteCharacterActor::SetBodyClass(const FString& AtlasBaseName)
 {
-	FString BodyRoot = FPaths::ProjectContentDir() / TEXT("SabriMMO/Sprites/Atlases/Body");
-	FString ManifestFile = FString::Printf(TEXT("%s_manifest.json"), *AtlasBaseName);
-
-	// Search order: Body/{name}/, Body/enemies/{name}/, Body/
-	TArray<FString> SearchDirs;
-	SearchDirs.Add(BodyRoot / AtlasBaseName);
-	SearchDirs.Add(BodyRoot / TEXT("enemies") / AtlasBaseName);
-	SearchDirs.Add(BodyRoot);
-
-	for (const FString& Dir : SearchDirs)
+	// Search order (Body/{name}/, Body/enemies/{name}/, Body/) lives in FSpriteClassCache;
+	// every actor of the same class shares one parsed definition.
+	FSpriteClassDefinitionPtr Definition = FSpriteClassCache::Get().FindOrLoadBody(AtlasBaseName);
+	if (!Definition)
 	{
-		FString ManifestPath = Dir / ManifestFile;
-		FString ManifestStr;
-		if (FFileHelper::LoadFileToString(ManifestStr, *ManifestPath))
-		{
-			bUsingV2Atlas = true;
-			LoadV2AtlasManifest(ManifestPath);
-			UE_LOG(LogTemp, Log, TEXT("SpriteCharacter: Body set by name '%s' (v2 manifest at %s)"),
-				*AtlasBaseName, *Dir);
-			return;
-		}
+		UE_LOG(LogTemp, Warning, TEXT("SpriteCharacter: No manifest found for '%s'"), *AtlasBaseName);
+		return;
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("SpriteCharacter: No manifest found for '%s'"), *AtlasBaseName);
+	bUsingV2Atlas = true;
+	ApplyV2BodyDefinition(Definition);
+	UE_LOG(LogTemp, Log, TEXT("SpriteCharacter: Body set by name '%s' (v2 manifest at %s)"),
+		*AtlasBaseName, *Definition->ManifestPath);
 }
 
 // ============================================================
@@ -1546,10 +1909,10 @@ void ASpriteCharacterActor::LoadEquipmentLayer(ESpriteLayer Layer, int32 ViewSpr
 	{
 		SetLayerVisible(Layer, false);
 		L.bUsingLayerV2 = false;
-		L.LayerAtlasRegistry.Empty();
+		L.LayerDefinition.Reset();
 		L.ActiveLayerAtlas = nullptr;
 		// Cancel any in-flight deferred swap — unequip overrides it.
-		L.PendingLayerAtlasRegistry.Empty();
+		L.PendingLayerDefinition.Reset();
 		L.PendingSwapTexture = nullptr;
 		L.PendingSwapTimeoutSeconds = 0.0f;
 		return;
@@ -1558,78 +1921,22 @@ void ASpriteCharacterActor::LoadEquipmentLayer(ESpriteLayer Layer, int32 ViewSpr
 	FString SubDir = GetLayerSubDir(Layer);
 	if (SubDir.IsEmpty()) return;
 
-	FString BaseName = FString::Printf(TEXT("%s_%d"), *SubDir.ToLower(), ViewSpriteId);
-	FString LayerRoot = FPaths::ProjectContentDir() / TEXT("SabriMMO/Sprites/Atlases") / SubDir;
-
-	// Search for manifest with gender-aware priority:
-	// 1. {LayerRoot}/{item_subdir}/{gender}/manifest  (e.g., Weapon/dagger/female/)
-	// 2. {LayerRoot}/{item_subdir}/manifest            (e.g., Weapon/dagger/)
-	// 3. {LayerRoot}/manifest                          (flat fallback)
-	FString JsonDir;
-	FString ManifestPath;
-	FString ManifestStr;
+	// Manifest search (item subfolder + gender, item subfolder, flat) and parsing happen once
+	// per process in FSpriteClassCache — re-equipping or 50 players wearing the same
+	// helmet reuse the same definition.
+	FSpriteClassDefinitionPtr NewDefinition = FSpriteClassCache::Get().FindOrLoadLayer(Layer, ViewSpriteId, GenderSubDir);
+	if (!NewDefinition)
 	{
-		FString ManifestFileName = FString::Printf(TEXT("%s_manifest.json"), *BaseName);
-
-		// Try each item subfolder (e.g., dagger/, bow/, egg_shell_hat/)
-		TArray<FString> SubDirs;
-		IFileManager::Get().FindFiles(SubDirs, *(LayerRoot / TEXT("*")), false, true);
-		for (const FString& SD : SubDirs)
-		{
-			FString ItemDir = LayerRoot / SD;
-
-			// Priority 1: gender subfolder (e.g., Weapon/dagger/female/)
-			if (!GenderSubDir.IsEmpty())
-			{
-				FString GenderDir = ItemDir / GenderSubDir;
-				FString GenderPath = GenderDir / ManifestFileName;
-				if (FFileHelper::LoadFileToString(ManifestStr, *GenderPath))
-				{
-					JsonDir = GenderDir;
-					ManifestPath = GenderPath;
-					break;
-				}
-			}
-
-			// Priority 2: directly in item subfolder (e.g., Weapon/dagger/)
-			FString CandidatePath = ItemDir / ManifestFileName;
-			if (FFileHelper::LoadFileToString(ManifestStr, *CandidatePath))
-			{
-				JsonDir = ItemDir;
-				ManifestPath = CandidatePath;
-				break;
-			}
-		}
-
-		// Priority 3: flat structure (e.g., Weapon/weapon_1_manifest.json)
-		if (ManifestStr.IsEmpty())
-		{
-			JsonDir = LayerRoot;
-			ManifestPath = LayerRoot / ManifestFileName;
-			FFileHelper::LoadFileToString(ManifestStr, *ManifestPath);
-		}
-	}
-
-	if (ManifestStr.IsEmpty())
-	{
-		UE_LOG(LogTemp, Warning, TEXT("SpriteEquip: Manifest not found: %s_%d in %s"),
-			*SubDir.ToLower(), ViewSpriteId, *LayerRoot);
+		UE_LOG(LogTemp, Verbose, TEXT("SpriteEquip: Manifest not found: %s_%d"),
+			*SubDir.ToLower(), ViewSpriteId);
 		SetLayerVisible(Layer, false);
 		return;
 	}
 
-	// Parse manifest
-	TSharedPtr<FJsonObject> Root;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ManifestStr);
-	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
-		return;
-
 	// Check if this headgear hides hair
 	if (Layer == ESpriteLayer::HeadgearTop || Layer == ESpriteLayer::HeadgearMid || Layer == ESpriteLayer::HeadgearLow)
 	{
-		bool bHidesHair = false;
-		Root->TryGetBoolField(TEXT("hides_hair"), bHidesHair);
-		if (bHidesHair)
+		if (NewDefinition->bHidesHair)
 		{
 			bHairHiddenByHeadgear = true;
 			SetLayerVisible(ESpriteLayer::Hair, false);
@@ -1639,139 +1946,27 @@ void ASpriteCharacterActor::LoadEquipmentLayer(ESpriteLayer Layer, int32 ViewSpr
 			// Swapping to a non-hiding headgear — restore hair
 			bHairHiddenByHeadgear = false;
 			int32 HairIdx = static_cast<int32>(ESpriteLayer::Hair);
-			if (Layers[HairIdx].bUsingLayerV2 && Layers[HairIdx].LayerAtlasRegistry.Num() > 0)
+			if (Layers[HairIdx].bUsingLayerV2 && Layers[HairIdx].LayerDefinition.IsValid())
 			{
 				SetLayerVisible(ESpriteLayer::Hair, true);
 			}
 		}
 	}
 
-	// Build into a TEMP registry instead of clobbering L.LayerAtlasRegistry up-front.
-	// If the new texture is still streaming (NeverStream=false + high mips not yet resident),
-	// we'll park this in L.PendingLayerAtlasRegistry and let Tick finalize the swap once ready
+	// Don't clobber L.LayerDefinition up-front. If the new texture is still streaming
+	// (NeverStream=false + high mips not yet resident), we'll park the definition in
+	// L.PendingLayerDefinition and let Tick finalize the swap once ready
 	// — keeping the OLD equipment visible until then (Path C: no pop-in on equipment swaps).
-	TMap<FSpriteAtlasKey, TArray<FSingleAnimAtlasInfo>> NewRegistry;
-
-	const TArray<TSharedPtr<FJsonValue>>* AtlasArr;
-	if (!Root->TryGetArrayField(TEXT("atlases"), AtlasArr))
-		return;
-
-	int32 LoadedCount = 0;
-	for (const auto& AtlasVal : *AtlasArr)
-	{
-		const TSharedPtr<FJsonObject>& AtlasObj = AtlasVal->AsObject();
-		if (!AtlasObj.IsValid()) continue;
-
-		FString FileName = AtlasObj->GetStringField(TEXT("file"));
-		FString StateName = AtlasObj->GetStringField(TEXT("state"));
-		FString GroupName = AtlasObj->GetStringField(TEXT("group"));
-
-		// Parse individual atlas JSON
-		FString AtlasJsonPath = JsonDir / FString::Printf(TEXT("%s.json"), *FileName);
-		FString AtlasJsonStr;
-		if (!FFileHelper::LoadFileToString(AtlasJsonStr, *AtlasJsonPath))
-			continue;
-
-		// Reuse body's ParseSingleAtlasJSON but with equipment texture path
-		FSingleAnimAtlasInfo Info;
-		{
-			TSharedPtr<FJsonObject> ARoot;
-			TSharedRef<TJsonReader<>> AReader = TJsonReaderFactory<>::Create(AtlasJsonStr);
-			if (!FJsonSerializer::Deserialize(AReader, ARoot) || !ARoot.IsValid())
-				continue;
-
-			const TArray<TSharedPtr<FJsonValue>>* GridArr;
-			if (ARoot->TryGetArrayField(TEXT("grid"), GridArr) && GridArr->Num() >= 2)
-			{
-				Info.GridSize.X = (*GridArr)[0]->AsNumber();
-				Info.GridSize.Y = (*GridArr)[1]->AsNumber();
-			}
-			Info.FrameCount = ARoot->GetIntegerField(TEXT("frame_count"));
-			ARoot->TryGetStringField(TEXT("source"), Info.Source);
-
-			// Parse depth_front array (per-frame front/behind ordering)
-			const TArray<TSharedPtr<FJsonValue>>* DepthArr;
-			if (ARoot->TryGetArrayField(TEXT("depth_front"), DepthArr))
-			{
-				Info.DepthFront.Reserve(DepthArr->Num());
-				for (const auto& Val : *DepthArr)
-				{
-					Info.DepthFront.Add(Val->AsNumber() > 0.5);
-				}
-			}
-
-			// Store path for lazy loading — DON'T load texture now
-			// Derive asset sub-path from JsonDir (e.g., Weapon/dagger)
-			FString ContentBase = FPaths::ProjectContentDir() / TEXT("SabriMMO/Sprites/Atlases");
-			FString EquipAssetSubPath = SubDir;
-			if (JsonDir.StartsWith(ContentBase))
-			{
-				EquipAssetSubPath = JsonDir.Mid(ContentBase.Len() + 1);
-			}
-			Info.AssetPath = FString::Printf(
-				TEXT("/Game/SabriMMO/Sprites/Atlases/%s/%s.%s"),
-				*EquipAssetSubPath, *FileName, *FileName);
-		}
-
-		const ESpriteAnimState* StateEnum = StateNameMap.Find(StateName);
-		if (!StateEnum) continue;
-
-		// Respect weapon group — must match body's group registration
-		// so equipment and body resolve to the SAME animation per mode
-		static const TMap<FString, ESpriteWeaponMode> EquipGroupMap = {
-			{TEXT("unarmed"), ESpriteWeaponMode::None},
-			{TEXT("onehand"), ESpriteWeaponMode::OneHand},
-			{TEXT("twohand"), ESpriteWeaponMode::TwoHand},
-			{TEXT("bow"),     ESpriteWeaponMode::Bow},
-		};
-
-		TArray<FString> Groups;
-		GroupName.ParseIntoArray(Groups, TEXT(","));
-
-		for (const FString& G : Groups)
-		{
-			FString Trimmed = G.TrimStartAndEnd();
-			if (Trimmed == TEXT("shared"))
-			{
-				for (int32 m = 0; m < static_cast<int32>(ESpriteWeaponMode::MAX); m++)
-				{
-					FSpriteAtlasKey Key{static_cast<ESpriteWeaponMode>(m), *StateEnum};
-					NewRegistry.FindOrAdd(Key).Add(Info);
-				}
-			}
-			else
-			{
-				const ESpriteWeaponMode* Mode = EquipGroupMap.Find(Trimmed);
-				if (Mode)
-				{
-					FSpriteAtlasKey Key{*Mode, *StateEnum};
-					NewRegistry.FindOrAdd(Key).Add(Info);
-				}
-			}
-		}
-
-		LoadedCount++;
-	}
+	const int32 LoadedCount = NewDefinition->Atlases.Num();
 
 	if (LoadedCount > 0)
 	{
 		// Find the texture we'd display first for the current state, so we can
 		// check whether it's already streamed in (apply now) or needs to wait (defer).
 		UTexture2D* TargetTex = nullptr;
+		if (const FSingleAnimAtlasInfo* Target = NewDefinition->FindAtlas(CurrentWeaponMode, CurrentAnimState, 0))
 		{
-			FSpriteAtlasKey Key{CurrentWeaponMode, CurrentAnimState};
-			TArray<FSingleAnimAtlasInfo>* Variants = NewRegistry.Find(Key);
-			if (!Variants || Variants->Num() == 0)
-			{
-				Key.WeaponMode = ESpriteWeaponMode::None;
-				Variants = NewRegistry.Find(Key);
-			}
-			if (Variants && Variants->Num() > 0)
-			{
-				FSingleAnimAtlasInfo& Target = (*Variants)[0];
-				Target.EnsureTextureLoaded();  // load asset (may not have all mips resident yet)
-				TargetTex = Target.AtlasTexture;
-			}
+			TargetTex = Target->LoadTexture();  // load asset (may not have all mips resident yet)
 		}
 
 		// Defer the swap only when ALL of:
@@ -1785,11 +1980,13 @@ void ASpriteCharacterActor::LoadEquipmentLayer(ESpriteLayer Layer, int32 ViewSpr
 		if (bDeferSwap)
 		{
 			// Pin high mips so the streaming system actually loads them, then park
-			// the new registry until Tick sees streaming complete.
+			// the new definition until Tick sees streaming complete.
 			TargetTex->SetForceMipLevelsToBeResident(60.0f, 0);
-			L.PendingLayerAtlasRegistry = MoveTemp(NewRegistry);
+			L.PendingLayerDefinition = MoveTemp(NewDefinition);
 			L.PendingSwapTexture = TargetTex;
 			L.PendingSwapTimeoutSeconds = 1.0f;  // force-apply after this even if still streaming
+			if (USpriteAnimationSubsystem* Anim = AnimSystem.Get())
+				Anim->MarkPendingWork(AnimSlot);
 
 			UE_LOG(LogTemp, Log, TEXT("SpriteEquip: Deferred swap %s viewSprite=%d "
 				"(streaming high mips; old equipment stays visible until ready)"),
@@ -1798,13 +1995,14 @@ void ASpriteCharacterActor::LoadEquipmentLayer(ESpriteLayer Layer, int32 ViewSpr
 		else
 		{
 			// Apply now (first load, or texture is already fully streamed in).
-			L.LayerAtlasRegistry = MoveTemp(NewRegistry);
+			L.LayerDefinition = MoveTemp(NewDefinition);
 			L.ActiveLayerAtlas = nullptr;
 			L.bUsingLayerV2 = true;
 
 			ResolveLayerAtlas(L);
 
-			if (L.ActiveLayerAtlas && L.ActiveLayerAtlas->AtlasTexture && L.MeshComp)
+			UTexture2D* LayerTex = L.ActiveLayerAtlas ? L.ActiveLayerAtlas->LoadTexture() : nullptr;
+			if (LayerTex && L.MeshComp)
 			{
 				// Only create a NEW material on first load. Recreating the MID on every
 				// LoadEquipmentLayer call (which fires for every slot every time
@@ -1815,7 +2013,7 @@ void ASpriteCharacterActor::LoadEquipmentLayer(ESpriteLayer Layer, int32 ViewSpr
 				// need a fresh material when one already exists for this layer.
 				if (!IsValid(L.MaterialInst))
 				{
-					L.MaterialInst = CreateSpriteMaterial(L.ActiveLayerAtlas->AtlasTexture);
+					L.MaterialInst = CreateSpriteMaterial(LayerTex);
 					if (L.MaterialInst)
 					{
 						L.MeshComp->SetMaterial(0, L.MaterialInst);
@@ -1826,7 +2024,7 @@ void ASpriteCharacterActor::LoadEquipmentLayer(ESpriteLayer Layer, int32 ViewSpr
 				bool bShouldShow = !(Layer == ESpriteLayer::Hair && bHairHiddenByHeadgear);
 				L.MeshComp->SetVisibility(bShouldShow);
 				L.bActive = bShouldShow;
-				L.ActiveLayerTexture = L.ActiveLayerAtlas->AtlasTexture;
+				L.ActiveLayerTexture = LayerTex;
 			}
 
 			UE_LOG(LogTemp, Log, TEXT("SpriteEquip: Loaded %s (viewSprite=%d, %d atlases)"),
@@ -1838,31 +2036,32 @@ void ASpriteCharacterActor::LoadEquipmentLayer(ESpriteLayer Layer, int32 ViewSpr
 		SetLayerVisible(Layer, false);
 		L.bUsingLayerV2 = false;
 		// Clear any pending swap — the unequip/load-failure overrides it.
-		L.PendingLayerAtlasRegistry.Empty();
+		L.PendingLayerDefinition.Reset();
 		L.PendingSwapTexture = nullptr;
 	}
 }
 
 void ASpriteCharacterActor::FinalizeEquipmentSwap(FSpriteLayerState& Layer, ESpriteLayer LayerType)
 {
-	if (Layer.PendingLayerAtlasRegistry.Num() > 0)
+	if (Layer.PendingLayerDefinition.IsValid())
 	{
-		Layer.LayerAtlasRegistry = MoveTemp(Layer.PendingLayerAtlasRegistry);
+		Layer.LayerDefinition = MoveTemp(Layer.PendingLayerDefinition);
 	}
-	Layer.PendingLayerAtlasRegistry.Empty();
+	Layer.PendingLayerDefinition.Reset();
 	Layer.ActiveLayerAtlas = nullptr;
 	Layer.bUsingLayerV2 = true;
 
 	ResolveLayerAtlas(Layer);
 
-	if (Layer.ActiveLayerAtlas && Layer.ActiveLayerAtlas->AtlasTexture && Layer.MeshComp)
+	UTexture2D* LayerTex = Layer.ActiveLayerAtlas ? Layer.ActiveLayerAtlas->LoadTexture() : nullptr;
+	if (LayerTex && Layer.MeshComp)
 	{
 		// Reuse existing material instance — just update the Atlas parameter via ResolveLayerAtlas.
 		// (ResolveLayerAtlas already calls SetTextureParameterValue when ActiveLayerTexture changes.)
 		// If for some reason no MID exists, create one now.
 		if (!IsValid(Layer.MaterialInst))
 		{
-			Layer.MaterialInst = CreateSpriteMaterial(Layer.ActiveLayerAtlas->AtlasTexture);
+			Layer.MaterialInst = CreateSpriteMaterial(LayerTex);
 			if (Layer.MaterialInst)
 			{
 				Layer.MeshComp->SetMaterial(0, Layer.MaterialInst);
@@ -1871,7 +2070,7 @@ void ASpriteCharacterActor::FinalizeEquipmentSwap(FSpriteLayerState& Layer, ESpr
 		bool bShouldShow = !(LayerType == ESpriteLayer::Hair && bHairHiddenByHeadgear);
 		Layer.MeshComp->SetVisibility(bShouldShow);
 		Layer.bActive = bShouldShow;
-		Layer.ActiveLayerTexture = Layer.ActiveLayerAtlas->AtlasTexture;
+		Layer.ActiveLayerTexture = LayerTex;
 	}
 
 	Layer.PendingSwapTexture = nullptr;
@@ -1880,47 +2079,37 @@ void ASpriteCharacterActor::FinalizeEquipmentSwap(FSpriteLayerState& Layer, ESpr
 
 void ASpriteCharacterActor::ResolveLayerAtlas(FSpriteLayerState& Layer)
 {
-	FSingleAnimAtlasInfo* OldLayerAtlas = Layer.ActiveLayerAtlas;
-	Layer.ActiveLayerAtlas = nullptr;
-
-	FSpriteAtlasKey Key{CurrentWeaponMode, CurrentAnimState};
-	TArray<FSingleAnimAtlasInfo>* Variants = Layer.LayerAtlasRegistry.Find(Key);
-
-	// Fallback to unarmed
-	if (!Variants || Variants->Num() == 0)
-	{
-		Key.WeaponMode = ESpriteWeaponMode::None;
-		Variants = Layer.LayerAtlasRegistry.Find(Key);
-	}
+	// Use same variant index as body so equipment matches the body's animation
+	// (falls back to unarmed inside FindAtlas)
+	Layer.ActiveLayerAtlas = Layer.LayerDefinition.IsValid()
+		? Layer.LayerDefinition->FindAtlas(CurrentWeaponMode, CurrentAnimState, ActiveVariantIndex)
+		: nullptr;
 
-	if (!Variants || Variants->Num() == 0)
+	if (!Layer.ActiveLayerAtlas)
 		return; // Animation not available — layer will hide in UpdateQuadUVs
 
-	// Use same variant index as body so equipment matches the body's animation
-	int32 Idx = FMath::Clamp(ActiveVariantIndex, 0, Variants->Num() - 1);
-	Layer.ActiveLayerAtlas = &(*Variants)[Idx];
-
 	// Lazy-load texture on demand
-	Layer.ActiveLayerAtlas->EnsureTextureLoaded();
+	UTexture2D* Tex = Layer.ActiveLayerAtlas->LoadTexture();
 
-	UE_LOG(LogTemp, Log, TEXT("ResolveLayerAtlas: state=%d mode=%d source='%s' tex=%s path='%s'"),
+	UE_LOG(LogTemp, Verbose, TEXT("ResolveLayerAtlas: state=%d mode=%d source='%s' tex=%s path='%s'"),
 		static_cast<int32>(CurrentAnimState), static_cast<int32>(CurrentWeaponMode),
 		*Layer.ActiveLayerAtlas->Source,
-		Layer.ActiveLayerAtlas->AtlasTexture ? TEXT("LOADED") : TEXT("NULL"),
+		Tex ? TEXT("LOADED") : TEXT("NULL"),
 		*Layer.ActiveLayerAtlas->AssetPath);
 
-	// Release old texture (only if different from new)
-	if (OldLayerAtlas && OldLayerAtlas != Layer.ActiveLayerAtlas && OldLayerAtlas->AtlasTexture)
+	if (!Tex)
 	{
-		OldLayerAtlas->AtlasTexture = nullptr;
+		// Texture missing — treat like a missing animation so the layer hides
+		Layer.ActiveLayerAtlas = nullptr;
+		return;
 	}
 
-	// Swap texture if changed
-	if (Layer.MaterialInst && Layer.ActiveLayerAtlas->AtlasTexture &&
-	    Layer.ActiveLayerAtlas->AtlasTexture != Layer.ActiveLayerTexture)
+	// Swap texture if changed. The layer's UPROPERTY ActiveLayerTexture is what keeps the
+	// atlas resident; the previous one becomes GC-eligible once nothing else references it.
+	if (Layer.MaterialInst && Tex != Layer.ActiveLayerTexture)
 	{
-		Layer.MaterialInst->SetTextureParameterValue(TEXT("Atlas"), Layer.ActiveLayerAtlas->AtlasTexture);
-		Layer.ActiveLayerTexture = Layer.ActiveLayerAtlas->AtlasTexture;
+		Layer.MaterialInst->SetTextureParameterValue(TEXT("Atlas"), Tex);
+		Layer.ActiveLayerTexture = Tex;
 	}
 }
 
@@ -1939,132 +2128,15 @@ void ASpriteCharacterActor::ResolveAllEquipmentAtlases()
 // V2: Per-animation atlas system
 // ============================================================
 
-FSingleAnimAtlasInfo ASpriteCharacterActor::ParseSingleAtlasJSON(const FString& JsonStr, const FString& AtlasName,
-                                                                  const FString& AssetSubPath)
+void ASpriteCharacterActor::ApplyV2BodyDefinition(const FSpriteClassDefinitionPtr& Definition)
 {
-	FSingleAnimAtlasInfo Result;
-
-	TSharedPtr<FJsonObject> Root;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonStr);
-	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
-		return Result;
-
-	const TArray<TSharedPtr<FJsonValue>>* GridArr;
-	if (Root->TryGetArrayField(TEXT("grid"), GridArr) && GridArr->Num() >= 2)
-	{
-		Result.GridSize.X = (*GridArr)[0]->AsNumber();
-		Result.GridSize.Y = (*GridArr)[1]->AsNumber();
-	}
-
-	Result.FrameCount = Root->GetIntegerField(TEXT("frame_count"));
-	Root->TryGetStringField(TEXT("source"), Result.Source);
-
-	// Store path for lazy loading — DON'T load texture now
-	// AssetSubPath is relative to /Game/SabriMMO/Sprites/Atlases/ (e.g., "Body/swordsman_m")
-	Result.AssetPath = FString::Printf(
-		TEXT("/Game/SabriMMO/Sprites/Atlases/%s/%s.%s"),
-		*AssetSubPath, *AtlasName, *AtlasName);
-	// AtlasTexture stays nullptr — loaded on demand in ResolveActiveAtlas()
-
-	return Result;
-}
-
-void ASpriteCharacterActor::LoadV2AtlasManifest(const FString& ManifestPath)
-{
-	FString JsonStr;
-	if (!FFileHelper::LoadFileToString(JsonStr, *ManifestPath))
-		return;
-
-	TSharedPtr<FJsonObject> Root;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonStr);
-	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
-		return;
-
-	FString JsonDir = FPaths::GetPath(ManifestPath);
-
-	// Derive UE5 asset sub-path from manifest location
-	// e.g., disk: .../Content/SabriMMO/Sprites/Atlases/Body/swordsman_m/ → asset: "Body/swordsman_m"
-	FString ContentBase = FPaths::ProjectContentDir() / TEXT("SabriMMO/Sprites/Atlases");
-	FString AssetSubPath;
-	if (JsonDir.StartsWith(ContentBase))
-	{
-		AssetSubPath = JsonDir.Mid(ContentBase.Len() + 1); // +1 for the separator
-	}
-	else
-	{
-		AssetSubPath = TEXT("Body"); // fallback
-	}
-
-	static const TMap<FString, ESpriteWeaponMode> GroupMap = {
-		{TEXT("unarmed"), ESpriteWeaponMode::None},
-		{TEXT("onehand"), ESpriteWeaponMode::OneHand},
-		{TEXT("twohand"), ESpriteWeaponMode::TwoHand},
-		{TEXT("bow"),     ESpriteWeaponMode::Bow},
-	};
-
-	AtlasRegistry.Empty();
-	int32 LoadedCount = 0;
-
-	const TArray<TSharedPtr<FJsonValue>>* AtlasArr;
-	if (!Root->TryGetArrayField(TEXT("atlases"), AtlasArr))
+	BodyDefinition = Definition;
+	ActiveAtlas = nullptr;
+	if (!BodyDefinition.IsValid())
 		return;
 
-	for (const auto& AtlasVal : *AtlasArr)
-	{
-		const TSharedPtr<FJsonObject>& AtlasObj = AtlasVal->AsObject();
-		if (!AtlasObj.IsValid()) continue;
-
-		FString FileName = AtlasObj->GetStringField(TEXT("file"));
-		FString StateName = AtlasObj->GetStringField(TEXT("state"));
-		FString GroupName = AtlasObj->GetStringField(TEXT("group"));
-
-		// Parse individual atlas JSON
-		FString AtlasJsonPath = JsonDir / FString::Printf(TEXT("%s.json"), *FileName);
-		FString AtlasJsonStr;
-		if (!FFileHelper::LoadFileToString(AtlasJsonStr, *AtlasJsonPath))
-		{
-			UE_LOG(LogTemp, Warning, TEXT("SpriteV2: Atlas JSON not found: %s"), *AtlasJsonPath);
-			continue;
-		}
-
-		FSingleAnimAtlasInfo Info = ParseSingleAtlasJSON(AtlasJsonStr, FileName, AssetSubPath);
-		if (Info.AssetPath.IsEmpty()) continue;  // No valid path = skip
-
-		const ESpriteAnimState* StateEnum = StateNameMap.Find(StateName);
-		if (!StateEnum) continue;
-
-		// Parse comma-separated groups (e.g., "onehand,twohand")
-		TArray<FString> Groups;
-		GroupName.ParseIntoArray(Groups, TEXT(","));
-
-		for (const FString& G : Groups)
-		{
-			FString Trimmed = G.TrimStartAndEnd();
-			if (Trimmed == TEXT("shared"))
-			{
-				// Register under ALL weapon modes
-				for (int32 m = 0; m < static_cast<int32>(ESpriteWeaponMode::MAX); m++)
-				{
-					FSpriteAtlasKey Key{static_cast<ESpriteWeaponMode>(m), *StateEnum};
-					AtlasRegistry.FindOrAdd(Key).Add(Info);
-				}
-			}
-			else
-			{
-				const ESpriteWeaponMode* Mode = GroupMap.Find(Trimmed);
-				if (Mode)
-				{
-					FSpriteAtlasKey Key{*Mode, *StateEnum};
-					AtlasRegistry.FindOrAdd(Key).Add(Info);
-				}
-			}
-		}
-
-		LoadedCount++;
-	}
-
-	UE_LOG(LogTemp, Log, TEXT("SpriteV2: Loaded %d atlases, %d registry entries"),
-		LoadedCount, AtlasRegistry.Num());
+	UE_LOG(LogTemp, Log, TEXT("SpriteV2: Using %d atlases, %d registry entries (%s)"),
+		BodyDefinition->Atlases.Num(), BodyDefinition->Registry.Num(), *BodyDefinition->CacheKey);
 
 	// Set up body layer material from first available atlas
 	FSpriteLayerState& Body = Layers[static_cast<int32>(ESpriteLayer::Body)];
@@ -2072,16 +2144,17 @@ void ASpriteCharacterActor::LoadV2AtlasManifest(const FString& ManifestPath)
 	SetWeaponMode(ESpriteWeaponMode::None);
 
 	// Create material from active atlas
-	if (ActiveAtlas && ActiveAtlas->AtlasTexture && Body.MeshComp)
+	UTexture2D* BodyTex = ActiveAtlas ? ActiveAtlas->LoadTexture() : nullptr;
+	if (BodyTex && Body.MeshComp)
 	{
-		Body.MaterialInst = CreateSpriteMaterial(ActiveAtlas->AtlasTexture);
+		Body.MaterialInst = CreateSpriteMaterial(BodyTex);
 		if (Body.MaterialInst)
 		{
 			Body.MeshComp->SetMaterial(0, Body.MaterialInst);
 		}
 		Body.MeshComp->SetVisibility(true);
 		Body.bActive = true;
-		ActiveBodyTexture = ActiveAtlas->AtlasTexture;
+		ActiveBodyTexture = BodyTex;
 	}
 
 	SelectRandomV2Variant();
@@ -2091,34 +2164,17 @@ void ASpriteCharacterActor::LoadV2AtlasManifest(const FString& ManifestPath)
 
 void ASpriteCharacterActor::ResolveActiveAtlas()
 {
-	FSingleAnimAtlasInfo* OldAtlas = ActiveAtlas;
-	ActiveAtlas = nullptr;
+	// Lookup: (current weapon mode, current state), falling back to unarmed
+	ActiveAtlas = BodyDefinition.IsValid()
+		? BodyDefinition->FindAtlas(CurrentWeaponMode, CurrentAnimState, ActiveVariantIndex)
+		: nullptr;
 
-	// Lookup: (current weapon mode, current state)
-	FSpriteAtlasKey Key{CurrentWeaponMode, CurrentAnimState};
-	TArray<FSingleAnimAtlasInfo>* Variants = AtlasRegistry.Find(Key);
-
-	// Fallback: unarmed mode
-	if (!Variants || Variants->Num() == 0)
-	{
-		Key.WeaponMode = ESpriteWeaponMode::None;
-		Variants = AtlasRegistry.Find(Key);
-	}
-
-	if (!Variants || Variants->Num() == 0)
+	if (!ActiveAtlas)
 		return;
 
-	int32 Idx = FMath::Clamp(ActiveVariantIndex, 0, Variants->Num() - 1);
-	ActiveAtlas = &(*Variants)[Idx];
-
-	// Lazy-load: only load the texture when this atlas becomes active
-	ActiveAtlas->EnsureTextureLoaded();
-
-	// Release old atlas texture to free memory (if switching to a different atlas)
-	if (OldAtlas && OldAtlas != ActiveAtlas && OldAtlas->AtlasTexture)
-	{
-		OldAtlas->AtlasTexture = nullptr;
-	}
+	// Lazy-load: only load the texture when this atlas becomes active.
+	// The previous atlas texture is released when ActiveBodyTexture stops referencing it.
+	UTexture2D* Tex = ActiveAtlas->LoadTexture();
 
 	// Swap texture on body material
 	int32 BodyIdx = static_cast<int32>(ESpriteLayer::Body);
@@ -2128,45 +2184,39 @@ void ASpriteCharacterActor::ResolveActiveAtlas()
 	FSpriteLayerState& Body = Layers[BodyIdx];
 	if (!Body.bActive || !IsValid(Body.MeshComp) || !IsValid(Body.MaterialInst))
 		return;
-	if (!ActiveAtlas->AtlasTexture || !IsValid(ActiveAtlas->AtlasTexture))
+	if (!Tex || !IsValid(Tex))
 	{
 		UE_LOG(LogTemp, Warning, TEXT("ResolveActiveAtlas: TEXTURE LOAD FAILED for state=%d source='%s' path='%s'"),
 			static_cast<int32>(CurrentAnimState), *ActiveAtlas->Source, *ActiveAtlas->AssetPath);
 		return;
 	}
-	if (ActiveAtlas->AtlasTexture == ActiveBodyTexture)
+	if (Tex == ActiveBodyTexture)
 		return;
 
 	UE_LOG(LogTemp, Log, TEXT("ResolveActiveAtlas: Swapping body texture for state=%d source='%s'"),
 		static_cast<int32>(CurrentAnimState), *ActiveAtlas->Source);
-	Body.MaterialInst->SetTextureParameterValue(TEXT("Atlas"), ActiveAtlas->AtlasTexture);
-	ActiveBodyTexture = ActiveAtlas->AtlasTexture;
+	Body.MaterialInst->SetTextureParameterValue(TEXT("Atlas"), Tex);
+	ActiveBodyTexture = Tex;
 }
 
 void ASpriteCharacterActor::SelectRandomV2Variant()
 {
-	FSpriteAtlasKey Key{CurrentWeaponMode, CurrentAnimState};
-	TArray<FSingleAnimAtlasInfo>* Variants = AtlasRegistry.Find(Key);
-
-	// Fallback to unarmed
-	if (!Variants || Variants->Num() == 0)
-	{
-		Key.WeaponMode = ESpriteWeaponMode::None;
-		Variants = AtlasRegistry.Find(Key);
-	}
+	const int32 NumVariants = BodyDefinition.IsValid()
+		? BodyDefinition->NumVariants(CurrentWeaponMode, CurrentAnimState)
+		: 0;
 
-	if (Variants && Variants->Num() > 1)
+	if (NumVariants > 1)
 	{
 		// Avoid repeating the same variant
 		int32 OldIndex = ActiveVariantIndex;
-		int32 NumVariants = Variants->Num();
 		ActiveVariantIndex = FMath::RandRange(0, NumVariants - 1);
 		if (ActiveVariantIndex == OldIndex && NumVariants > 1)
 			ActiveVariantIndex = (ActiveVariantIndex + 1) % NumVariants;
 
+		const FSingleAnimAtlasInfo* Picked = BodyDefinition->FindAtlas(CurrentWeaponMode, CurrentAnimState, ActiveVariantIndex);
 		UE_LOG(LogTemp, Log, TEXT("SpriteV2: Picked variant %d/%d for state=%d mode=%d (source=%s)"),
 			ActiveVariantIndex, NumVariants, (int32)CurrentAnimState, (int32)CurrentWeaponMode,
-			*(*Variants)[ActiveVariantIndex].Source);
+			Picked ? *Picked->Source : TEXT("NULL"));
 	}
 	else
 	{
@@ -2244,6 +2294,10 @@ void ASpriteCharacterActor::AttachToOwnerActor(AActor* Actor, bool bIsLocalPlaye
 	if (Actor)
 	{
 		SetActorLocation(Actor->GetActorLocation());
+
+		// Owner-following sprites get the wall silhouette (budgeted async traces)
+		if (USpriteOcclusionSubsystem* Occlusion = GetWorld()->GetSubsystem<USpriteOcclusionSubsystem>())
+			Occlusion->Register(this);
 	}
 
 	// Set the character ID this sprite represents
@@ -2358,6 +2412,52 @@ void ASpriteCharacterActor::SetServerTargetPosition(const FVector& Pos, bool bMo
 	ServerTargetPos = Pos;
 	ServerMoveSpeed = Speed;
 	bUseServerMovement = true;
+
+	if (USnapshotInterpolationSubsystem* Interp = GetWorld()->GetSubsystem<USnapshotInterpolationSubsystem>())
+	{
+		Interp->Push(this, Pos, bMoving, EMotionApply::Sprite);
+	}
+}
+
+void ASpriteCharacterActor::ResetServerTargetPosition(const FVector& Pos)
+{
+	ServerTargetPos = Pos;
+	bUseServerMovement = true;
+
+	if (USnapshotInterpolationSubsystem* Interp = GetWorld()->GetSubsystem<USnapshotInterpolationSubsystem>())
+	{
+		Interp->Teleport(this, Pos, EMotionApply::Sprite);
+	}
+}
+
+void ASpriteCharacterActor::HoldServerMovement(float Seconds)
+{
+	if (USnapshotInterpolationSubsystem* Interp = GetWorld()->GetSubsystem<USnapshotInterpolationSubsystem>())
+	{
+		Interp->Hold(this, Seconds);
+	}
+}
+
+bool ASpriteCharacterActor::SetOcclusion(bool bFeet, bool bHead)
+{
+	if (bFeet == bFeetOccluded && bHead == bHeadOccluded) return false;
+
+	const bool bFeetChanged = bFeet != bFeetOccluded;
+	const bool bHeadChanged = bHead != bHeadOccluded;
+	bFeetOccluded = bFeet;
+	bHeadOccluded = bHead;
+
+	for (int32 i = 0; i < static_cast<int32>(ESpriteLayer::MAX); i++)
+	{
+		UMaterialInstanceDynamic* MID = Layers[i].MeshComp
+			? Cast<UMaterialInstanceDynamic>(Layers[i].MeshComp->GetMaterial(0)) : nullptr;
+		if (MID)
+		{
+			if (bFeetChanged) MID->SetScalarParameterValue(TEXT("FeetOccluded"), bFeet ? 1.f : 0.f);
+			if (bHeadChanged) MID->SetScalarParameterValue(TEXT("HeadOccluded"), bHead ? 1.f : 0.f);
+		}
+	}
+	return true;
 }
 
 void ASpriteCharacterActor::UpdateOwnerTracking()
@@ -2366,34 +2466,52 @@ void ASpriteCharacterActor::UpdateOwnerTracking()
 	// C++ server-driven movement for standalone sprite enemies (no BP actor)
 	if (bUseServerMovement)
 	{
-		FVector Current = GetActorLocation();
-		FVector Dir = ServerTargetPos - Current;
-		Dir.Z = 0.f;
-		float Dist = Dir.Size();
+		// Low-significance sprites run this every few frames — step by the real elapsed time
+		const double Now = GetWorld()->GetTimeSeconds();
+		const float TrackingDT = LastTrackingTime > 0.0
+			? (float)FMath::Min(Now - LastTrackingTime, 0.25)
+			: GetWorld()->GetDeltaSeconds();
+		LastTrackingTime = Now;
 
-		if (Dist > 5.f)
+		FVector Current = GetActorLocation();
+		FVector Sampled;
+		bool bSampledMoving = false;
+		USnapshotInterpolationSubsystem* Interp = GetWorld()->GetSubsystem<USnapshotInterpolationSubsystem>();
+		if (Interp && Interp->SampleSprite(this, Sampled, bSampledMoving))
 		{
-			float DT = GetWorld()->GetDeltaSeconds();
-			float Step = ServerMoveSpeed * DT;
-			FVector Move = Dir.GetSafeNormal() * FMath::Min(Step, Dist);
-			FVector NewPos(Current.X + Move.X, Current.Y + Move.Y, Current.Z);
-			SetActorLocation(NewPos);
+			// Buffered server-time position; Z comes from the ground snap below
+			if (Sampled.X != Current.X || Sampled.Y != Current.Y)
+			{
+				SetActorLocation(FVector(Sampled.X, Sampled.Y, Current.Z));
+			}
 		}
+		else
+		{
+			FVector Dir = ServerTargetPos - Current;
+			Dir.Z = 0.f;
+			float Dist = Dir.Size();
 
-		// Ground snap via line trace (replaces CharacterMovementComponent gravity)
+			if (Dist > 5.f)
+			{
+				float Step = ServerMoveSpeed * TrackingDT;
+				FVector Move = Dir.GetSafeNormal() * FMath::Min(Step, Dist);
+				FVector NewPos(Current.X + Move.X, Current.Y + Move.Y, Current.Z);
+				SetActorLocation(NewPos);
+			}
+		}
+
+		// Ground snap (replaces CharacterMovementComponent gravity): cooked zone heightfield,
+		// line trace only where it can't answer. Idle sprites keep last frame's snap.
+		const FVector Loc = GetActorLocation();
+		if (!Loc.Equals(LastGroundSnapLoc, 0.f))
 		{
-			FVector Loc = GetActorLocation();
-			FVector Start = FVector(Loc.X, Loc.Y, Loc.Z + 500.f);
-			FVector End = FVector(Loc.X, Loc.Y, Loc.Z - 2000.f);
-			FHitResult Hit;
-			FCollisionQueryParams Params;
-			Params.AddIgnoredActor(this);
-			if (GetWorld()->LineTraceSingleByChannel(Hit, Start, End, ECC_WorldStatic, Params))
+			FCollisionQueryParams Params(SCENE_QUERY_STAT(SpriteGroundSnap), false, this);
+			float GroundZ = 0.f;
+			if (UZoneHeightfieldSubsystem::FindGroundZ(GetWorld(), Loc, Params, GroundZ))
 			{
-				FVector Snapped = Loc;
-				Snapped.Z = Hit.ImpactPoint.Z;
-				SetActorLocation(Snapped);
+				SetActorLocation(FVector(Loc.X, Loc.Y, GroundZ));
 			}
+			LastGroundSnapLoc = GetActorLocation();
 		}
 
 		// Animation + facing driven by EnemySubsystem (HandleEnemyMove), not velocity
@@ -2412,47 +2530,8 @@ void ASpriteCharacterActor::UpdateOwnerTracking()
 	Loc.Z -= GroundZOffset;
 	SetActorLocation(Loc);
 
-	// Two line traces from camera: one to the sprite's feet, one to the sprite's head.
-	// - Both blocked → entire sprite renders as silhouette
-	// - Only feet blocked → per-pixel depth check (parts above the wall stay sprite art)
-	// - Neither blocked → full sprite art
-	// The custom depth pass always writes stencil so the post-process can mask the area.
-	{
-		float FeetVal = 0.f;
-		float HeadVal = 0.f;
-		if (APlayerController* PC = GetWorld()->GetFirstPlayerController())
-		{
-			if (PC->PlayerCameraManager)
-			{
-				FVector CamLoc = PC->PlayerCameraManager->GetCameraLocation();
-				FVector FeetLoc = Loc + FVector(0, 0, 8.f);             // just above ground
-				FVector HeadLoc = Loc + FVector(0, 0, SpriteSize.Y);    // top of sprite quad
-				FHitResult Hit;
-				FCollisionQueryParams Params(SCENE_QUERY_STAT(SpriteOcclusionTrace), false, this);
-				Params.AddIgnoredActor(OwnerActor.Get());
-				if (GetWorld()->LineTraceSingleByChannel(Hit, CamLoc, FeetLoc, ECC_Visibility, Params))
-				{
-					FeetVal = 1.f;
-				}
-				if (GetWorld()->LineTraceSingleByChannel(Hit, CamLoc, HeadLoc, ECC_Visibility, Params))
-				{
-					HeadVal = 1.f;
-				}
-			}
-		}
-		for (int32 i = 0; i < static_cast<int32>(ESpriteLayer::MAX); i++)
-		{
-			if (Layers[i].MeshComp)
-			{
-				if (UMaterialInstanceDynamic* MID =
-					Cast<UMaterialInstanceDynamic>(Layers[i].MeshComp->GetMaterial(0)))
-				{
-					MID->SetScalarParameterValue(TEXT("FeetOccluded"), FeetVal);
-					MID->SetScalarParameterValue(TEXT("HeadOccluded"), HeadVal);
-				}
-			}
-		}
-	}
+	// Wall silhouette (FeetOccluded / HeadOccluded) comes from USpriteOcclusionSubsystem's
+	// budgeted async traces via SetOcclusion — nothing to trace here
 
 	FVector Velocity = OwnerActor->GetVelocity();
 	float Speed = Velocity.Size();
@@ -2496,43 +2575,39 @@ void ASpriteCharacterActor::RegisterCombatEvents()
 	USocketEventRouter* Router = GI->GetEventRouter();
 	if (!Router) return;
 
-	Router->RegisterHandler(TEXT("combat:damage"), this,
+	// Re-attaching (e.g. new CharacterId) must not stack a second set of handlers
+	Router->UnregisterAllForOwner(this);
+
+	// Per-character events are keyed by id in the router — only this sprite's
+	// handler runs, instead of every sprite on screen parsing and rejecting the payload.
+	const int32 Id = LocalCharacterId;
+
+	Router->RegisterEntityHandler(TEXT("combat:damage"), TEXT("attackerId"), Id, this,
 		[this](const TSharedPtr<FJsonValue>& D) { HandleCombatDamage(D); });
 
-	Router->RegisterHandler(TEXT("combat:death"), this,
+	Router->RegisterEntityHandler(TEXT("combat:death"), TEXT("killedId"), Id, this,
 		[this](const TSharedPtr<FJsonValue>& D) { HandleCombatDeath(D); });
 
 	Router->RegisterHandler(TEXT("combat:respawn"), this,
 		[this](const TSharedPtr<FJsonValue>& D) { HandleCombatRespawn(D); });
 
-	Router->RegisterHandler(TEXT("player:sit_state"), this,
+	Router->RegisterEntityHandler(TEXT("player:sit_state"), TEXT("characterId"), Id, this,
 		[this](const TSharedPtr<FJsonValue>& D) {
 			if (!D.IsValid()) return;
 			const TSharedPtr<FJsonObject>& Obj = D->AsObject();
 			if (!Obj.IsValid()) return;
-			double CId = 0;
-			Obj->TryGetNumberField(TEXT("characterId"), CId);
-			if ((int32)CId != LocalCharacterId) return;
 			bool bSitting = false;
 			Obj->TryGetBoolField(TEXT("isSitting"), bSitting);
 			SetAnimState(bSitting ? ESpriteAnimState::Sit : ESpriteAnimState::Idle);
 		});
 
 	// Hit reaction when enemy attacks this player
-	Router->RegisterHandler(TEXT("enemy:attack"), this,
+	Router->RegisterEntityHandler(TEXT("enemy:attack"), TEXT("targetId"), Id, this,
 		[this](const TSharedPtr<FJsonValue>& D) {
-			if (!D.IsValid()) return;
-			const TSharedPtr<FJsonObject>& Obj = D->AsObject();
-			if (!Obj.IsValid()) return;
-			double TId = 0;
-			Obj->TryGetNumberField(TEXT("targetId"), TId);
-			if ((int32)TId == LocalCharacterId)
+			if (CurrentAnimState != ESpriteAnimState::Death &&
+			    CurrentAnimState != ESpriteAnimState::Attack)
 			{
-				if (CurrentAnimState != ESpriteAnimState::Death &&
-				    CurrentAnimState != ESpriteAnimState::Attack)
-				{
-					SetAnimState(ESpriteAnimState::Hit);
-				}
+				SetAnimState(ESpriteAnimState::Hit);
 			}
 		});
 
@@ -2553,14 +2628,11 @@ void ASpriteCharacterActor::RegisterCombatEvents()
 
 	// skill:cast_start — broadcast to zone with casterId
 	// Triggers for skills with cast time during the cast bar
-	Router->RegisterHandler(TEXT("skill:cast_start"), this,
+	Router->RegisterEntityHandler(TEXT("skill:cast_start"), TEXT("casterId"), Id, this,
 		[this, GetCastStateFromTargetType](const TSharedPtr<FJsonValue>& D) {
 			if (!D.IsValid()) return;
 			const TSharedPtr<FJsonObject>& Obj = D->AsObject();
 			if (!Obj.IsValid()) return;
-			double CId = 0;
-			Obj->TryGetNumberField(TEXT("casterId"), CId);
-			if ((int32)CId != LocalCharacterId) return;
 			if (CurrentAnimState == ESpriteAnimState::Death) return;
 
 			FString TargetType;
@@ -2570,14 +2642,11 @@ void ASpriteCharacterActor::RegisterCombatEvents()
 
 	// skill:cast_complete — broadcast to zone with casterId
 	// Triggers for instant skills and when cast-time skills finish
-	Router->RegisterHandler(TEXT("skill:cast_complete"), this,
+	Router->RegisterEntityHandler(TEXT("skill:cast_complete"), TEXT("casterId"), Id, this,
 		[this, GetCastStateFromTargetType, IsCastingState](const TSharedPtr<FJsonValue>& D) {
 			if (!D.IsValid()) return;
 			const TSharedPtr<FJsonObject>& Obj = D->AsObject();
 			if (!Obj.IsValid()) return;
-			double CId = 0;
-			Obj->TryGetNumberField(TEXT("casterId"), CId);
-			if ((int32)CId != LocalCharacterId) return;
 			if (CurrentAnimState == ESpriteAnimState::Death) return;
 			// Don't override if already casting from skill:cast_start
 			if (IsCastingState(CurrentAnimState)) return;
@@ -2589,14 +2658,11 @@ void ASpriteCharacterActor::RegisterCombatEvents()
 
 	// skill:buff_applied — broadcast to zone with casterId, catches instant buff/debuff skills
 	// that don't emit skill:cast_start or skill:cast_complete
-	Router->RegisterHandler(TEXT("skill:buff_applied"), this,
+	Router->RegisterEntityHandler(TEXT("skill:buff_applied"), TEXT("casterId"), Id, this,
 		[this, GetCastStateFromTargetType, IsCastingState](const TSharedPtr<FJsonValue>& D) {
 			if (!D.IsValid()) return;
 			const TSharedPtr<FJsonObject>& Obj = D->AsObject();
 			if (!Obj.IsValid()) return;
-			double CId = 0;
-			Obj->TryGetNumberField(TEXT("casterId"), CId);
-			if ((int32)CId != LocalCharacterId) return;
 			if (CurrentAnimState == ESpriteAnimState::Death) return;
 			if (CurrentAnimState == ESpriteAnimState::Sit) return; // sitting buff (skillId=0) must not override sit
 			if (IsCastingState(CurrentAnimState)) return;
@@ -2651,3 +2717,162 @@ void ASpriteCharacterActor::HandleCombatRespawn(const TSharedPtr<FJsonValue>& Da
 {
 	SetAnimState(ESpriteAnimState::Idle);
 }
+
+// ============================================================
+// Quad update stats + benchmark
+// ============================================================
+
+static FAutoConsoleCommand GSpriteQuadStatsCmd(
+	TEXT("Sprite.QuadStats"),
+	TEXT("Print sprite frame-update counters (AtlasRect writes vs mesh uploads). 'Sprite.QuadStats reset' clears them."),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const FSpriteQuadCounters& C = GSpriteQuadCounters;
+		UE_LOG(LogTemp, Log, TEXT("Sprite quads [%s]: %llu frame updates, %llu AtlasRect writes, %llu mesh uploads, %.3f ms total"),
+			CVarSpriteMaterialUVAnim.GetValueOnGameThread() != 0 ? TEXT("material UV") : TEXT("legacy UpdateMeshSection"),
+			C.FrameUpdates, C.ParamWrites, C.MeshUploads, FPlatformTime::ToMilliseconds64(C.UpdateCycles));
+		if (Args.Num() > 0 && Args[0].Equals(TEXT("reset"), ESearchCase::IgnoreCase))
+		{
+			GSpriteQuadCounters = FSpriteQuadCounters();
+		}
+	}));
+
+namespace
+{
+	/**
+	 * Sprite.QuadBench — spawns a grid of walking sprites around the player and measures
+	 * each frame-update mode in turn (material UV, then legacy UpdateMeshSection).
+	 * Game/render thread times come from the same globals as 'stat unit'.
+	 */
+	struct FSpriteQuadBench
+	{
+		struct FResult
+		{
+			int32 Frames = 0;
+			double GameMs = 0.0;
+			double RenderMs = 0.0;
+			FSpriteQuadCounters Counters;
+		};
+
+		TArray<TWeakObjectPtr<ASpriteCharacterActor>> Actors;
+		FTSTicker::FDelegateHandle TickHandle;
+		bool bRunning = false;
+		int32 SavedMode = 1;
+		float PhaseSeconds = 5.f;
+		int32 Phase = 0;          // 0 warm-up material, 1 measure material, 2 warm-up legacy, 3 measure legacy
+		double PhaseStart = 0.0;
+		FResult Results[2];
+
+		static constexpr double WarmupSeconds = 1.0;
+
+		void BeginPhase(int32 NewPhase)
+		{
+			Phase = NewPhase;
+			PhaseStart = FPlatformTime::Seconds();
+			CVarSpriteMaterialUVAnim->Set(Phase < 2 ? 1 : 0, ECVF_SetByConsole);
+			GSpriteQuadCounters = FSpriteQuadCounters();
+		}
+
+		bool Tick(float)
+		{
+			const double Elapsed = FPlatformTime::Seconds() - PhaseStart;
+			const bool bMeasuring = (Phase & 1) != 0;
+
+			if (bMeasuring)
+			{
+				FResult& R = Results[Phase / 2];
+				++R.Frames;
+				R.GameMs += FPlatformTime::ToMilliseconds(GGameThreadTime);
+				R.RenderMs += FPlatformTime::ToMilliseconds(GRenderThreadTime);
+			}
+
+			if (Elapsed < (bMeasuring ? PhaseSeconds : WarmupSeconds))
+			{
+				return true;
+			}
+			if (bMeasuring)
+			{
+				Results[Phase / 2].Counters = GSpriteQuadCounters;
+			}
+			if (Phase < 3)
+			{
+				BeginPhase(Phase + 1);
+				return true;
+			}
+
+			Finish();
+			return false;
+		}
+
+		void Finish()
+		{
+			static const TCHAR* Names[] = { TEXT("material UV"), TEXT("UpdateMeshSection") };
+			UE_LOG(LogTemp, Log, TEXT("Sprite.QuadBench: %d sprites, %.1fs per mode"), Actors.Num(), PhaseSeconds);
+			for (int32 i = 0; i < 2; ++i)
+			{
+				const FResult& R = Results[i];
+				const double Frames = FMath::Max(1, R.Frames);
+				UE_LOG(LogTemp, Log, TEXT("  %-18s game %6.2f ms  render %6.2f ms  sprite updates %6.3f ms/frame  (%llu updates, %llu AtlasRect writes, %llu mesh uploads)"),
+					Names[i], R.GameMs / Frames, R.RenderMs / Frames,
+					FPlatformTime::ToMilliseconds64(R.Counters.UpdateCycles) / Frames,
+					R.Counters.FrameUpdates, R.Counters.ParamWrites, R.Counters.MeshUploads);
+			}
+
+			for (const TWeakObjectPtr<ASpriteCharacterActor>& Actor : Actors)
+			{
+				if (Actor.IsValid()) Actor->Destroy();
+			}
+			Actors.Empty();
+			CVarSpriteMaterialUVAnim->Set(SavedMode, ECVF_SetByConsole);
+			bRunning = false;
+		}
+	};
+	TUniquePtr<FSpriteQuadBench> GSpriteQuadBench;
+}
+
+static FAutoConsoleCommandWithWorldAndArgs GSpriteQuadBenchCmd(
+	TEXT("Sprite.QuadBench"),
+	TEXT("Sprite.QuadBench [count=500] [seconds=5] [classId=0] — spawn walking sprites around the player and compare ")
+	TEXT("game/render thread cost of material-UV animation vs legacy UpdateMeshSection."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (!World) return;
+		if (GSpriteQuadBench.IsValid() && GSpriteQuadBench->bRunning)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Sprite.QuadBench: already running"));
+			return;
+		}
+
+		const int32 Count = Args.Num() > 0 ? FMath::Clamp(FCString::Atoi(*Args[0]), 1, 5000) : 500;
+		const float Seconds = Args.Num() > 1 ? FMath::Max(1.f, FCString::Atof(*Args[1])) : 5.f;
+		const int32 ClassId = Args.Num() > 2 ? FCString::Atoi(*Args[2]) : 0;
+
+		FVector Center = FVector::ZeroVector;
+		if (APlayerController* PC = World->GetFirstPlayerController())
+		{
+			if (APawn* Pawn = PC->GetPawn()) Center = Pawn->GetActorLocation();
+		}
+
+		GSpriteQuadBench = MakeUnique<FSpriteQuadBench>();
+		FSpriteQuadBench& Bench = *GSpriteQuadBench;
+		Bench.SavedMode = CVarSpriteMaterialUVAnim.GetValueOnGameThread();
+		Bench.PhaseSeconds = Seconds;
+
+		const int32 Side = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(Count)));
+		const float Spacing = 120.f;
+		for (int32 i = 0; i < Count; ++i)
+		{
+			const FVector Offset((i % Side - Side * 0.5f) * Spacing, (i / Side - Side * 0.5f) * Spacing, 0.f);
+			ASpriteCharacterActor* Actor = ASpriteCharacterActor::SpawnSpriteForClass(World, Center + Offset, ClassId, i & 1);
+			if (!Actor) continue;
+			Actor->SetFacingDirection(FRotator(0.f, FMath::FRandRange(0.f, 360.f), 0.f).Vector());
+			Actor->SetAnimState(ESpriteAnimState::Walk);
+			Bench.Actors.Add(Actor);
+		}
+
+		Bench.bRunning = true;
+		Bench.BeginPhase(0);
+		Bench.TickHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateRaw(&Bench, &FSpriteQuadBench::Tick));
+		UE_LOG(LogTemp, Log, TEXT("Sprite.QuadBench: spawned %d sprites, measuring %.1fs per mode..."), Bench.Actors.Num(), Seconds);
+	}));
@@ -5,10 +5,24 @@
 #include "GameFramework/Actor.h"
 #include "ProceduralMeshComponent.h"
 #include "SpriteAtlasData.h"
+#include "SpriteClassCache.h"
+#include "UI/ActorPoolSubsystem.h"
 #include "SpriteCharacterActor.generated.h"
 
+class UMaterial;
 class UMaterialInstanceDynamic;
 class UDecalComponent;
+class UBoxComponent;
+class USpriteAnimationSubsystem;
+enum class ESpriteSignificance : uint8;
+
+/** Per-instance custom data layout for instanced sprite layers (see USpriteInstancingSubsystem) */
+namespace SpriteInstanceData
+{
+	constexpr int32 AtlasRect = 0;  // 4 floats: U offset, V offset, U scale, V scale
+	constexpr int32 Tint      = 4;  // 3 floats: RGB multiplier (hit flash = 3,3,3)
+	constexpr int32 Num       = 7;
+}
 
 /**
  * Fires when a looping sprite animation completes one full cycle (last frame -> first frame).
@@ -23,7 +37,8 @@ DECLARE_MULTICAST_DELEGATE_OneParam(FOnSpriteAnimCycleComplete, ESpriteAnimState
 
 /**
  * A single sprite layer (body, hair, weapon, etc.)
- * Rendered as a procedural quad with UV manipulation for atlas cell selection.
+ * Rendered as a procedural quad. The atlas cell is selected by the material's AtlasRect
+ * parameter; the quad geometry is static and only rebuilt when SpriteSize changes.
  */
 USTRUCT()
 struct FSpriteLayerState
@@ -40,34 +55,49 @@ struct FSpriteLayerState
 	bool bActive = false;
 	FLinearColor TintColor = FLinearColor::White;
 
-	/** Per-animation atlas registry for this layer (equipment layers) */
-	TMap<FSpriteAtlasKey, TArray<FSingleAnimAtlasInfo>> LayerAtlasRegistry;
-	FSingleAnimAtlasInfo* ActiveLayerAtlas = nullptr;
+	/** Per-animation atlas registry for this layer (equipment layers) — shared, see FSpriteClassCache */
+	FSpriteClassDefinitionPtr LayerDefinition;
+	const FSingleAnimAtlasInfo* ActiveLayerAtlas = nullptr;
 	UPROPERTY()
 	UTexture2D* ActiveLayerTexture = nullptr;
 	bool bUsingLayerV2 = false;
 
 	// Path C: deferred equipment swap. When equipping a new item whose atlas
 	// texture is still streaming (NeverStream=false + high mips not yet resident),
-	// LoadEquipmentLayer parks the new registry here and Tick finalizes the swap
+	// LoadEquipmentLayer parks the new definition here and Tick finalizes the swap
 	// once HasPendingInitOrStreaming() goes false. Until then, the old equipment
 	// stays visible — eliminates pop-in on weapon/hair/headgear changes.
-	TMap<FSpriteAtlasKey, TArray<FSingleAnimAtlasInfo>> PendingLayerAtlasRegistry;
+	FSpriteClassDefinitionPtr PendingLayerDefinition;
 	UPROPERTY()
 	UTexture2D* PendingSwapTexture = nullptr;
 	float PendingSwapTimeoutSeconds = 0.0f;
+
+	// Last frame state pushed to the GPU — writes are skipped when unchanged.
+	// AtlasRect is (U offset, V offset, U scale, V scale); the MID is tracked because
+	// every material swap starts over at the default (0,0,1,1) rect.
+	TWeakObjectPtr<UMaterialInstanceDynamic> AtlasRectMaterial;
+	FLinearColor AppliedAtlasRect = FLinearColor(0.f, 0.f, 1.f, 1.f);
+	float AppliedZOffset = 0.f;
+
+	/** SpriteSize the static quad was built for; zero forces a rebuild. */
+	FVector2D QuadSize = FVector2D::ZeroVector;
+	/** False while the legacy path has per-frame atlas UVs baked into the vertices. */
+	bool bQuadUVsStatic = false;
 };
 
 /**
  * Sprite character actor — RO Classic style billboard with layered equipment.
  *
- * Uses ProceduralMeshComponent per layer so we can update UVs per frame
- * to select the correct atlas cell. Supports dual-atlas system for body:
+ * Uses a ProceduralMeshComponent per layer with static quad geometry; frame changes
+ * only write the AtlasRect material parameter (Sprite.MaterialUVAnim 0 restores the
+ * old per-frame UpdateMeshSection path for comparison). Supports dual-atlas system for body:
  * shared atlas (weapon-independent) + weapon atlas (weapon-specific).
  * Animation variants are randomly selected on loop restart.
+ * Per-frame work (movement, billboard, direction, frame stepping) is driven in one batch by
+ * USpriteAnimationSubsystem with actor tick disabled; Tick is only the Sprite.BatchedAnimation 0 path.
  */
 UCLASS()
-class SABRIMMO_API ASpriteCharacterActor : public AActor
+class SABRIMMO_API ASpriteCharacterActor : public AActor, public IPooledActor
 {
 	GENERATED_BODY()
 
@@ -157,6 +187,10 @@ public:
 
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
+	// --- IPooledActor: the body atlas is kept; equipment, tints, owner and delegates are reset ---
+	virtual void OnAcquiredFromPool() override;
+	virtual void OnReleasedToPool() override;
+
 	/** Enable click targeting on the body sprite mesh (visibility trace only) */
 	void EnableClickCollision();
 
@@ -166,6 +200,17 @@ public:
 	/** Play brief white flash on all sprite layers (150ms). Called on damage hit. */
 	void PlayHitFlash();
 
+	/**
+	 * Hand drawing over to USpriteInstancingSubsystem: layer meshes and the blob shadow
+	 * decal are unregistered and a box click proxy replaces the body mesh for cursor traces.
+	 * Animation, movement and the layer/material bookkeeping keep running as before.
+	 */
+	void EnableInstancedRendering();
+	bool IsInstancedRendering() const { return bInstancedRendering; }
+
+	/** Sprite material graph. bPerInstanceData reads AtlasRect + TintColor from instance custom data. */
+	static UMaterial* BuildSpriteMaterial(UTexture2D* Texture, bool bPerInstanceData);
+
 protected:
 	UPROPERTY(VisibleAnywhere)
 	USceneComponent* RootComp;
@@ -193,10 +238,10 @@ private:
 	int32 CurrentHairColor = 0;
 	bool bHairHiddenByHeadgear = false;
 
-	// --- V2: Per-animation atlas registry ---
-	TMap<FSpriteAtlasKey, TArray<FSingleAnimAtlasInfo>> AtlasRegistry;
+	// --- V2: Per-animation atlas registry (shared across actors, see FSpriteClassCache) ---
+	FSpriteClassDefinitionPtr BodyDefinition;
 
-	FSingleAnimAtlasInfo* ActiveAtlas = nullptr;
+	const FSingleAnimAtlasInfo* ActiveAtlas = nullptr;
 	int32 ActiveVariantIndex = 0;
 
 	// --- V1 LEGACY: Dual atlas system ---
@@ -224,14 +269,29 @@ public:
 	float GroundZOffset = 0.f;
 	bool bIsLocalPlayerSprite = false;
 
-	/** C++ server-driven movement (replaces BP Tick interpolation for sprite enemies) */
+	/** C++ server-driven movement (replaces BP Tick interpolation for sprite enemies).
+	 *  Positions go through USnapshotInterpolationSubsystem; ServerTargetPos + ServerMoveSpeed
+	 *  stepping is the fallback (Net.Interp 0, HoldServerMovement). */
 	void SetServerTargetPosition(const FVector& Pos, bool bMoving, float Speed);
+	/** Enable server movement resting at Pos with no history (spawn / respawn) */
+	void ResetServerTargetPosition(const FVector& Pos);
+	/** Step toward ServerTargetPos (set by local code) instead of the snapshot buffer for Seconds */
+	void HoldServerMovement(float Seconds);
 	FVector ServerTargetPos = FVector::ZeroVector;
 	float ServerMoveSpeed = 200.f;
 	bool bUseServerMovement = false;  // true for enemies, false for players
+	/** Location right after the last ground snap — skipped while nothing has moved the sprite */
+	FVector LastGroundSnapLoc = FVector(TNumericLimits<float>::Max());
+	/** World time of the last UpdateOwnerTracking (low-significance sprites skip frames) */
+	double LastTrackingTime = 0.0;
 	int32 LocalCharacterId = 0;
 
+	/** Latest occlusion result; writes FeetOccluded/HeadOccluded only on change. True if anything changed. */
+	bool SetOcclusion(bool bFeet, bool bHead);
+
 	// --- Internal methods ---
+	/** Batched animation (or actor tick) + significance ranking — BeginPlay and pool reuse */
+	void RegisterFrameUpdates();
 	void UpdateOwnerTracking();
 	void RegisterCombatEvents();
 	void HandleCombatDamage(const TSharedPtr<FJsonValue>& Data);
@@ -241,14 +301,29 @@ public:
 	void CreateLayerQuad(int32 LayerIndex);
 	void UpdateQuadUVs(FSpriteLayerState& Layer);
 	void UpdateBodyQuadUVs();
+
+	/** Push the atlas cell + sit offset for one layer (material params, or mesh rebuild in legacy mode) */
+	void ApplyLayerFrame(FSpriteLayerState& Layer, const FVector2D& UVOffset, const FVector2D& UVScale, float ZOffset);
+
+	/** (Re)build the static quad section for the current SpriteSize */
+	void BuildStaticQuad(FSpriteLayerState& Layer);
 	void UpdateBillboard();
 	void UpdateDirection();
 	void UpdateAnimation(float DeltaTime);
+
+	/** Step Steps frames (wrap / revert / clamp) and refresh layers once. False once held on a last frame. */
+	bool AdvanceAnimationFrame(int32 Steps = 1);
+
+	/** Deferred equipment swaps + hit flash restore. Returns true while any remain. */
+	bool TickPendingWork(float DeltaTime);
+	bool HasPendingLayerWork() const;
+
 	void UpdateAllLayers();
 	void UpdateBodyTexture();
 
 	ESpriteDirection CalculateDirection() const;
-	float GetFrameDuration() const;
+	static ESpriteDirection DirectionFromFacing(const FVector2D& Facing, const FVector2D& CamFwd);
+	static float GetFrameDuration(ESpriteAnimState State);
 	int32 GetFrameCount() const;
 
 	/** V1: Resolve which atlas + variant provides the current body animation */
@@ -257,12 +332,8 @@ public:
 	/** V1: Pick a random variant for a looping animation */
 	void SelectRandomVariant(ESpriteAnimState State);
 
-	/** V2: Load atlas registry from manifest JSON */
-	void LoadV2AtlasManifest(const FString& ManifestPath);
-
-	/** V2: Parse a single-animation atlas JSON. AssetSubPath = UE5 path relative to /Game/SabriMMO/Sprites/Atlases/ */
-	FSingleAnimAtlasInfo ParseSingleAtlasJSON(const FString& JsonStr, const FString& AtlasName,
-	                                          const FString& AssetSubPath = TEXT("Body"));
+	/** V2: Adopt a cached body definition and set up the body layer material */
+	void ApplyV2BodyDefinition(const FSpriteClassDefinitionPtr& Definition);
 
 	/** V2: Resolve the active atlas for current weapon mode + anim state, swap texture */
 	void ResolveActiveAtlas();
@@ -273,7 +344,7 @@ public:
 	/** Equipment layer: resolve active atlas for a non-body layer based on current state */
 	void ResolveLayerAtlas(FSpriteLayerState& Layer);
 
-	/** Path C: apply a pending equipment swap (move PendingLayerAtlasRegistry → LayerAtlasRegistry,
+	/** Path C: apply a pending equipment swap (move PendingLayerDefinition → LayerDefinition,
 	 *  swap material/texture). Called from Tick when streaming completes or timeout fires. */
 	void FinalizeEquipmentSwap(FSpriteLayerState& Layer, ESpriteLayer LayerType);
 
@@ -302,6 +373,30 @@ private:
 
 	UMaterialInstanceDynamic* CreateSpriteMaterial(UTexture2D* Texture);
 
+	// ---- Instanced rendering (USpriteInstancingSubsystem reads layer state directly) ----
+	friend class USpriteInstancingSubsystem;
+	bool bInstancedRendering = false;
+
+	UPROPERTY()
+	UBoxComponent* ClickProxy = nullptr;
+
+	/** Texture currently bound to a layer's material (instanced batches are keyed by it) */
+	UTexture2D* GetLayerTexture(int32 LayerIndex) const;
+
+	// ---- Wall silhouette (USpriteOcclusionSubsystem traces, SetOcclusion applies) ----
+	friend class USpriteOcclusionSubsystem;
+	bool bFeetOccluded = false;
+	bool bHeadOccluded = false;
+
+	// ---- Update LOD (USpriteSignificanceSubsystem buckets; animation and occlusion passes read it) ----
+	friend class USpriteSignificanceSubsystem;
+	ESpriteSignificance Significance{};  // Full until ranked
+
+	// ---- Batched animation (USpriteAnimationSubsystem owns timers/direction; fields above mirror it) ----
+	friend class USpriteAnimationSubsystem;
+	int32 AnimSlot = INDEX_NONE;
+	TWeakObjectPtr<USpriteAnimationSubsystem> AnimSystem;
+
 	// ---- Hit flash state ----
 	float HitFlashTimer = 0.0f;
 	bool bHitFlashing = false;
@@ -0,0 +1,446 @@
+// SpriteClassCache.cpp — Shared sprite manifest cache (see header).
+
+#include "SpriteClassCache.h"
+#include "SpriteCharacterActor.h"
+#include "SpriteAtlasIndex.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSpriteCache, Log, All);
+
+static FAutoConsoleCommand GSpriteCacheStatsCmd(
+	TEXT("SpriteCache.Stats"),
+	TEXT("Print sprite manifest cache hit rate and resident bytes. 'SpriteCache.Stats reset' clears counters."),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		FSpriteClassCache::Get().LogStats();
+		if (Args.Num() > 0 && Args[0].Equals(TEXT("reset"), ESearchCase::IgnoreCase))
+		{
+			FSpriteClassCache::Get().ResetStats();
+		}
+	}));
+
+static FAutoConsoleCommand GSpriteCacheClearCmd(
+	TEXT("SpriteCache.Clear"),
+	TEXT("Drop all cached sprite manifests (re-read from disk on next spawn/equip)."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		FSpriteClassCache::Get().Clear();
+	}));
+
+namespace
+{
+	const TMap<FString, ESpriteAnimState>& GetStateNameMap()
+	{
+		static const TMap<FString, ESpriteAnimState> Map = {
+			{TEXT("idle"),         ESpriteAnimState::Idle},
+			{TEXT("walk"),         ESpriteAnimState::Walk},
+			{TEXT("attack"),       ESpriteAnimState::Attack},
+			{TEXT("cast_single"),  ESpriteAnimState::CastSingle},
+			{TEXT("cast_self"),    ESpriteAnimState::CastSelf},
+			{TEXT("cast_ground"),  ESpriteAnimState::CastGround},
+			{TEXT("cast_aoe"),     ESpriteAnimState::CastAoe},
+			{TEXT("hit"),          ESpriteAnimState::Hit},
+			{TEXT("death"),        ESpriteAnimState::Death},
+			{TEXT("sit"),          ESpriteAnimState::Sit},
+			{TEXT("pickup"),       ESpriteAnimState::Pickup},
+			{TEXT("block"),        ESpriteAnimState::Block},
+		};
+		return Map;
+	}
+
+	const TMap<FString, ESpriteWeaponMode>& GetGroupMap()
+	{
+		static const TMap<FString, ESpriteWeaponMode> Map = {
+			{TEXT("unarmed"), ESpriteWeaponMode::None},
+			{TEXT("onehand"), ESpriteWeaponMode::OneHand},
+			{TEXT("twohand"), ESpriteWeaponMode::TwoHand},
+			{TEXT("bow"),     ESpriteWeaponMode::Bow},
+		};
+		return Map;
+	}
+
+	FString GetAtlasContentRoot()
+	{
+		return FPaths::ProjectContentDir() / TEXT("SabriMMO/Sprites/Atlases");
+	}
+
+	int64 EstimateBytes(const FSpriteClassDefinition& Def)
+	{
+		int64 Bytes = sizeof(FSpriteClassDefinition)
+			+ Def.CacheKey.GetAllocatedSize() + Def.ManifestPath.GetAllocatedSize()
+			+ Def.Atlases.GetAllocatedSize() + Def.Registry.GetAllocatedSize()
+			+ Def.AssetPaths.GetAllocatedSize();
+		for (const FSingleAnimAtlasInfo& Info : Def.Atlases)
+		{
+			Bytes += Info.AssetPath.GetAllocatedSize() + Info.Source.GetAllocatedSize()
+				+ Info.DepthFront.GetAllocatedSize();
+		}
+		for (const auto& Pair : Def.Registry)
+		{
+			Bytes += Pair.Value.GetAllocatedSize();
+		}
+		return Bytes;
+	}
+}
+
+// ============================================================
+// FSpriteClassDefinition
+// ============================================================
+
+const TArray<int32>* FSpriteClassDefinition::FindVariantIndices(ESpriteWeaponMode Mode, ESpriteAnimState State) const
+{
+	const TArray<int32>* Variants = Registry.Find(FSpriteAtlasKey{Mode, State});
+
+	// Fallback: unarmed mode
+	if (!Variants || Variants->Num() == 0)
+	{
+		Variants = Registry.Find(FSpriteAtlasKey{ESpriteWeaponMode::None, State});
+	}
+	return (Variants && Variants->Num() > 0) ? Variants : nullptr;
+}
+
+int32 FSpriteClassDefinition::NumVariants(ESpriteWeaponMode Mode, ESpriteAnimState State) const
+{
+	const TArray<int32>* Variants = FindVariantIndices(Mode, State);
+	return Variants ? Variants->Num() : 0;
+}
+
+const FSingleAnimAtlasInfo* FSpriteClassDefinition::FindAtlas(
+	ESpriteWeaponMode Mode, ESpriteAnimState State, int32 VariantIndex) const
+{
+	const TArray<int32>* Variants = FindVariantIndices(Mode, State);
+	if (!Variants) return nullptr;
+
+	const int32 Idx = FMath::Clamp(VariantIndex, 0, Variants->Num() - 1);
+	return &Atlases[(*Variants)[Idx]];
+}
+
+// ============================================================
+// FSpriteClassCache
+// ============================================================
+
+FSpriteClassCache& FSpriteClassCache::Get()
+{
+	static FSpriteClassCache Instance;
+	return Instance;
+}
+
+FSpriteClassDefinitionPtr FSpriteClassCache::FindOrLoadBody(const FString& AtlasBaseName)
+{
+	if (AtlasBaseName.IsEmpty()) return nullptr;
+
+	return FindOrLoad(TEXT("Body:") + AtlasBaseName,
+		[&AtlasBaseName]() { return FindBodyManifestPath(AtlasBaseName); },
+		TEXT("Body"));
+}
+
+FSpriteClassDefinitionPtr FSpriteClassCache::FindOrLoadLayer(
+	ESpriteLayer Layer, int32 ViewSpriteId, const FString& GenderSubDir)
+{
+	const FString SubDir = ASpriteCharacterActor::GetLayerSubDir(Layer);
+	if (ViewSpriteId <= 0 || SubDir.IsEmpty()) return nullptr;
+
+	return FindOrLoad(MakeLayerKey(Layer, ViewSpriteId, GenderSubDir),
+		[Layer, ViewSpriteId, &GenderSubDir]() { return FindLayerManifestPath(Layer, ViewSpriteId, GenderSubDir); },
+		SubDir);
+}
+
+FString FSpriteClassCache::MakeLayerKey(ESpriteLayer Layer, int32 ViewSpriteId, const FString& GenderSubDir)
+{
+	return FString::Printf(TEXT("%s:%d:%s"),
+		*ASpriteCharacterActor::GetLayerSubDir(Layer), ViewSpriteId, *GenderSubDir);
+}
+
+FSpriteClassDefinitionPtr FSpriteClassCache::FindOrLoad(
+	const FString& CacheKey, TFunctionRef<FString()> FindManifestPath, const FString& FallbackAssetSubPath)
+{
+	check(IsInGameThread());
+	++Stats.Lookups;
+
+	if (const FSpriteClassDefinitionPtr* Found = Definitions.Find(CacheKey))
+	{
+		++Stats.Hits;
+		return *Found;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Cooked index first — no directory scans, no JSON
+	if (FSpriteAtlasIndex::Get().IsLoaded())
+	{
+		TSharedRef<FSpriteClassDefinition> Indexed = MakeShared<FSpriteClassDefinition>();
+		if (FSpriteAtlasIndex::Get().BuildDefinition(CacheKey, *Indexed))
+		{
+			Indexed->ResidentBytes = EstimateBytes(*Indexed);
+			const double Elapsed = FPlatformTime::Seconds() - StartTime;
+			++Stats.Loads;
+			++Stats.IndexLoads;
+			Stats.LoadSeconds += Elapsed;
+			Stats.IndexLoadSeconds += Elapsed;
+			FSpriteClassDefinitionPtr Def = Indexed;
+			Definitions.Add(CacheKey, Def);
+			return Def;
+		}
+	}
+
+	FSpriteClassDefinitionPtr Def;
+	const FString ManifestPath = FindManifestPath();
+	if (ManifestPath.IsEmpty())
+	{
+		++Stats.NotFound;
+		UE_LOG(LogSpriteCache, Warning, TEXT("No sprite manifest for '%s'"), *CacheKey);
+	}
+	else
+	{
+		Def = ParseManifest(CacheKey, ManifestPath, FallbackAssetSubPath);
+		++Stats.Loads;
+	}
+
+	Stats.LoadSeconds += FPlatformTime::Seconds() - StartTime;
+	Definitions.Add(CacheKey, Def);
+	return Def;
+}
+
+void FSpriteClassCache::Clear()
+{
+	UE_LOG(LogSpriteCache, Log, TEXT("Clearing %d cached sprite definitions"), Definitions.Num());
+	Definitions.Empty();
+}
+
+FSpriteClassCacheStats FSpriteClassCache::GetStats() const
+{
+	FSpriteClassCacheStats Out = Stats;
+	Out.NumDefinitions = 0;
+	Out.ResidentBytes = Definitions.GetAllocatedSize();
+	for (const auto& Pair : Definitions)
+	{
+		Out.ResidentBytes += Pair.Key.GetAllocatedSize();
+		if (Pair.Value.IsValid())
+		{
+			++Out.NumDefinitions;
+			Out.ResidentBytes += Pair.Value->ResidentBytes;
+		}
+	}
+	return Out;
+}
+
+void FSpriteClassCache::ResetStats()
+{
+	Stats = FSpriteClassCacheStats();
+}
+
+void FSpriteClassCache::LogStats() const
+{
+	const FSpriteClassCacheStats S = GetStats();
+	UE_LOG(LogSpriteCache, Log,
+		TEXT("SpriteCache: %d definitions (%d keys), %.1f KB resident | %llu lookups, %.1f%% hit, %llu loads (%.1f ms), %llu not found"),
+		S.NumDefinitions, Definitions.Num(), S.ResidentBytes / 1024.0,
+		S.Lookups, S.HitRate() * 100.0, S.Loads, S.LoadSeconds * 1000.0, S.NotFound);
+
+	const FSpriteAtlasIndex& Index = FSpriteAtlasIndex::Get();
+	UE_LOG(LogSpriteCache, Log,
+		TEXT("SpriteCache: index %s (%d entries, %.1f KB, opened in %.2f ms) | %llu from index (%.1f ms), %llu from JSON (%.1f ms)"),
+		Index.IsLoaded() ? TEXT("loaded") : TEXT("absent"), Index.NumEntries(), Index.GetSizeBytes() / 1024.0,
+		Index.GetOpenSeconds() * 1000.0, S.IndexLoads, S.IndexLoadSeconds * 1000.0,
+		S.Loads - S.IndexLoads, (S.LoadSeconds - S.IndexLoadSeconds) * 1000.0);
+}
+
+// ============================================================
+// Manifest lookup + parsing
+// ============================================================
+
+FString FSpriteClassCache::FindBodyManifestPath(const FString& AtlasBaseName)
+{
+	const FString BodyRoot = GetAtlasContentRoot() / TEXT("Body");
+	const FString ManifestFile = FString::Printf(TEXT("%s_manifest.json"), *AtlasBaseName);
+
+	// Search order: Body/{name}/ (player classes), Body/enemies/{name}/, Body/ (legacy flat)
+	const FString CandidateDirs[] = {
+		BodyRoot / AtlasBaseName,
+		BodyRoot / TEXT("enemies") / AtlasBaseName,
+		BodyRoot,
+	};
+
+	IPlatformFile& PF = FPlatformFileManager::Get().GetPlatformFile();
+	for (const FString& Dir : CandidateDirs)
+	{
+		const FString Candidate = Dir / ManifestFile;
+		if (PF.FileExists(*Candidate))
+			return Candidate;
+	}
+	return FString();
+}
+
+FString FSpriteClassCache::FindLayerManifestPath(ESpriteLayer Layer, int32 ViewSpriteId, const FString& GenderSubDir)
+{
+	const FString SubDir = ASpriteCharacterActor::GetLayerSubDir(Layer);
+	if (SubDir.IsEmpty()) return FString();
+
+	const FString LayerRoot = GetAtlasContentRoot() / SubDir;
+	const FString ManifestFileName = FString::Printf(TEXT("%s_%d_manifest.json"), *SubDir.ToLower(), ViewSpriteId);
+
+	IPlatformFile& PF = FPlatformFileManager::Get().GetPlatformFile();
+
+	// Gender-aware priority:
+	//   1. {LayerRoot}/{item_subdir}/{gender}/  (e.g., Weapon/dagger/female/)
+	//   2. {LayerRoot}/{item_subdir}/           (e.g., Weapon/dagger/)
+	//   3. {LayerRoot}/                         (flat fallback)
+	TArray<FString> SubDirs;
+	IFileManager::Get().FindFiles(SubDirs, *(LayerRoot / TEXT("*")), false, true);
+	for (const FString& SD : SubDirs)
+	{
+		const FString ItemDir = LayerRoot / SD;
+
+		if (!GenderSubDir.IsEmpty())
+		{
+			const FString GenderPath = ItemDir / GenderSubDir / ManifestFileName;
+			if (PF.FileExists(*GenderPath)) return GenderPath;
+		}
+
+		const FString ItemPath = ItemDir / ManifestFileName;
+		if (PF.FileExists(*ItemPath)) return ItemPath;
+	}
+
+	const FString RootPath = LayerRoot / ManifestFileName;
+	if (PF.FileExists(*RootPath)) return RootPath;
+
+	return FString();
+}
+
+FSpriteClassDefinitionPtr FSpriteClassCache::ParseManifest(
+	const FString& CacheKey, const FString& ManifestPath, const FString& FallbackAssetSubPath)
+{
+	FString JsonStr;
+	if (!FFileHelper::LoadFileToString(JsonStr, *ManifestPath))
+		return nullptr;
+
+	TSharedPtr<FJsonObject> Root;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonStr);
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
+	{
+		UE_LOG(LogSpriteCache, Warning, TEXT("Failed to parse sprite manifest %s"), *ManifestPath);
+		return nullptr;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* AtlasArr;
+	if (!Root->TryGetArrayField(TEXT("atlases"), AtlasArr))
+		return nullptr;
+
+	TSharedRef<FSpriteClassDefinition> Def = MakeShared<FSpriteClassDefinition>();
+	Def->CacheKey = CacheKey;
+	Def->ManifestPath = ManifestPath;
+	Root->TryGetBoolField(TEXT("hides_hair"), Def->bHidesHair);
+
+	// Derive UE5 asset sub-path from manifest location
+	// e.g., disk: .../Content/SabriMMO/Sprites/Atlases/Body/swordsman_m/ → asset: "Body/swordsman_m"
+	const FString JsonDir = FPaths::GetPath(ManifestPath);
+	const FString ContentBase = GetAtlasContentRoot();
+	const FString AssetSubPath = JsonDir.StartsWith(ContentBase)
+		? JsonDir.Mid(ContentBase.Len() + 1)  // +1 for the separator
+		: FallbackAssetSubPath;
+
+	const TMap<FString, ESpriteAnimState>& StateNameMap = GetStateNameMap();
+	const TMap<FString, ESpriteWeaponMode>& GroupMap = GetGroupMap();
+
+	Def->Atlases.Reserve(AtlasArr->Num());
+	Def->AssetPaths.Reserve(AtlasArr->Num());
+
+	for (const TSharedPtr<FJsonValue>& AtlasVal : *AtlasArr)
+	{
+		const TSharedPtr<FJsonObject>& AtlasObj = AtlasVal->AsObject();
+		if (!AtlasObj.IsValid()) continue;
+
+		const FString FileName = AtlasObj->GetStringField(TEXT("file"));
+		const FString StateName = AtlasObj->GetStringField(TEXT("state"));
+		const FString GroupName = AtlasObj->GetStringField(TEXT("group"));
+		if (FileName.IsEmpty()) continue;
+
+		// Preload wants every listed atlas, even ones for states this client doesn't map
+		const FString AssetPath = FString::Printf(
+			TEXT("/Game/SabriMMO/Sprites/Atlases/%s/%s.%s"), *AssetSubPath, *FileName, *FileName);
+		Def->AssetPaths.Add(FSoftObjectPath(AssetPath));
+
+		// Parse individual atlas JSON
+		const FString AtlasJsonPath = JsonDir / FString::Printf(TEXT("%s.json"), *FileName);
+		FString AtlasJsonStr;
+		if (!FFileHelper::LoadFileToString(AtlasJsonStr, *AtlasJsonPath))
+		{
+			UE_LOG(LogSpriteCache, Warning, TEXT("Atlas JSON not found: %s"), *AtlasJsonPath);
+			continue;
+		}
+
+		TSharedPtr<FJsonObject> ARoot;
+		TSharedRef<TJsonReader<>> AReader = TJsonReaderFactory<>::Create(AtlasJsonStr);
+		if (!FJsonSerializer::Deserialize(AReader, ARoot) || !ARoot.IsValid())
+			continue;
+
+		const ESpriteAnimState* StateEnum = StateNameMap.Find(StateName);
+		if (!StateEnum) continue;
+
+		FSingleAnimAtlasInfo Info;
+		const TArray<TSharedPtr<FJsonValue>>* GridArr;
+		if (ARoot->TryGetArrayField(TEXT("grid"), GridArr) && GridArr->Num() >= 2)
+		{
+			Info.GridSize.X = (*GridArr)[0]->AsNumber();
+			Info.GridSize.Y = (*GridArr)[1]->AsNumber();
+		}
+		Info.FrameCount = ARoot->GetIntegerField(TEXT("frame_count"));
+		ARoot->TryGetStringField(TEXT("source"), Info.Source);
+
+		// Per-frame depth ordering (equipment layers)
+		const TArray<TSharedPtr<FJsonValue>>* DepthArr;
+		if (ARoot->TryGetArrayField(TEXT("depth_front"), DepthArr))
+		{
+			Info.DepthFront.Reserve(DepthArr->Num());
+			for (const TSharedPtr<FJsonValue>& Val : *DepthArr)
+			{
+				Info.DepthFront.Add(Val->AsNumber() > 0.5);
+			}
+		}
+
+		// Texture is NOT loaded here — FSingleAnimAtlasInfo::LoadTexture() resolves it on first use
+		Info.AssetPath = AssetPath;
+
+		const int32 AtlasIndex = Def->Atlases.Add(MoveTemp(Info));
+
+		// Parse comma-separated groups (e.g., "onehand,twohand")
+		TArray<FString> Groups;
+		GroupName.ParseIntoArray(Groups, TEXT(","));
+		for (const FString& G : Groups)
+		{
+			const FString Trimmed = G.TrimStartAndEnd();
+			if (Trimmed == TEXT("shared"))
+			{
+				// Register under ALL weapon modes
+				for (int32 m = 0; m < static_cast<int32>(ESpriteWeaponMode::MAX); m++)
+				{
+					Def->Registry.FindOrAdd(FSpriteAtlasKey{static_cast<ESpriteWeaponMode>(m), *StateEnum}).Add(AtlasIndex);
+				}
+			}
+			else if (const ESpriteWeaponMode* Mode = GroupMap.Find(Trimmed))
+			{
+				Def->Registry.FindOrAdd(FSpriteAtlasKey{*Mode, *StateEnum}).Add(AtlasIndex);
+			}
+		}
+	}
+
+	if (Def->Atlases.Num() == 0)
+	{
+		UE_LOG(LogSpriteCache, Warning, TEXT("Sprite manifest %s lists no usable atlases"), *ManifestPath);
+		return nullptr;
+	}
+
+	Def->Atlases.Shrink();
+	Def->ResidentBytes = EstimateBytes(*Def);
+
+	UE_LOG(LogSpriteCache, Log, TEXT("Cached '%s': %d atlases, %d registry entries (%.1f KB)"),
+		*CacheKey, Def->Atlases.Num(), Def->Registry.Num(), Def->ResidentBytes / 1024.0);
+
+	return Def;
+}
@@ -0,0 +1,113 @@
+// SpriteClassCache.h — Process-wide cache of parsed sprite manifests.
+//
+// Every body class ("poring", "swordsman_m") and equipment layer (Weapon 12 female)
+// is located on disk, read and JSON-parsed once per process into an immutable
+// FSpriteClassDefinition. ASpriteCharacterActor instances hold a shared pointer to
+// the definition and raw pointers to its atlas entries instead of their own copies,
+// so 80 Porings spawning in one zone-in cost one manifest parse, not 80.
+// UZonePreloadSubsystem resolves its preload asset lists from the same definitions.
+// When a cooked SpriteAtlasIndex.bin is present, definitions are built from it
+// instead of the JSON (see SpriteAtlasIndex.h).
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+#include "SpriteAtlasData.h"
+
+/**
+ * Parsed manifest for one body class or equipment layer sprite. Immutable once built —
+ * shared by every actor using it (game thread only).
+ */
+struct SABRIMMO_API FSpriteClassDefinition
+{
+	/** Cache key ("Body:poring", "Weapon:12:female") */
+	FString CacheKey;
+
+	/** Manifest file the definition was built from */
+	FString ManifestPath;
+
+	/** One entry per atlas listed in the manifest (stable addresses — never resized after build) */
+	TArray<FSingleAnimAtlasInfo> Atlases;
+
+	/** (weapon mode, anim state) -> indices into Atlases, one per variant.
+	 *  "shared" atlases are registered under every weapon mode. */
+	TMap<FSpriteAtlasKey, TArray<int32>> Registry;
+
+	/** Atlas texture paths in manifest order (for async preload) */
+	TArray<FSoftObjectPath> AssetPaths;
+
+	/** Headgear manifests: true if wearing it hides the hair layer */
+	bool bHidesHair = false;
+
+	/** Approximate heap footprint of this definition (metadata only, not textures) */
+	int64 ResidentBytes = 0;
+
+	/** Number of variants for (Mode, State), falling back to unarmed. 0 = animation missing. */
+	int32 NumVariants(ESpriteWeaponMode Mode, ESpriteAnimState State) const;
+
+	/** Atlas for (Mode, State, VariantIndex) with unarmed fallback; index is clamped. nullptr if missing. */
+	const FSingleAnimAtlasInfo* FindAtlas(ESpriteWeaponMode Mode, ESpriteAnimState State, int32 VariantIndex) const;
+
+private:
+	const TArray<int32>* FindVariantIndices(ESpriteWeaponMode Mode, ESpriteAnimState State) const;
+};
+
+using FSpriteClassDefinitionPtr = TSharedPtr<const FSpriteClassDefinition>;
+
+/** Lookup counters (SpriteCache.Stats console command). */
+struct FSpriteClassCacheStats
+{
+	uint64 Lookups = 0;
+	uint64 Hits = 0;
+	/** Definitions built on a miss (IndexLoads + JSON parses) */
+	uint64 Loads = 0;
+	/** Of Loads, how many came from the cooked binary index */
+	uint64 IndexLoads = 0;
+	/** Lookups for which no manifest exists (cached as misses too) */
+	uint64 NotFound = 0;
+	double LoadSeconds = 0.0;
+	double IndexLoadSeconds = 0.0;
+	int32 NumDefinitions = 0;
+	int64 ResidentBytes = 0;
+
+	double HitRate() const { return Lookups > 0 ? double(Hits) / double(Lookups) : 0.0; }
+};
+
+class SABRIMMO_API FSpriteClassCache
+{
+public:
+	static FSpriteClassCache& Get();
+
+	/** Body sprite by atlas base name. Searches Body/{name}/, Body/enemies/{name}/, Body/. */
+	FSpriteClassDefinitionPtr FindOrLoadBody(const FString& AtlasBaseName);
+
+	/** Equipment layer sprite. Searches {Layer}/{item}/{gender}/, {Layer}/{item}/, {Layer}/. */
+	FSpriteClassDefinitionPtr FindOrLoadLayer(ESpriteLayer Layer, int32 ViewSpriteId, const FString& GenderSubDir);
+
+	/** Cache key used for a layer sprite (also the ZonePreloadSubsystem class key). */
+	static FString MakeLayerKey(ESpriteLayer Layer, int32 ViewSpriteId, const FString& GenderSubDir);
+
+	/** Drop every cached definition (actors keep theirs alive until they reload). */
+	void Clear();
+
+	FSpriteClassCacheStats GetStats() const;
+	void ResetStats();
+	void LogStats() const;
+
+	/** Manifest search order shared by the runtime lookups and the offline index cook. */
+	static FString FindBodyManifestPath(const FString& AtlasBaseName);
+	static FString FindLayerManifestPath(ESpriteLayer Layer, int32 ViewSpriteId, const FString& GenderSubDir);
+
+	/** Read + parse a manifest and every per-animation atlas JSON it lists. */
+	static FSpriteClassDefinitionPtr ParseManifest(const FString& CacheKey, const FString& ManifestPath,
+	                                               const FString& FallbackAssetSubPath);
+
+private:
+	FSpriteClassDefinitionPtr FindOrLoad(const FString& CacheKey, TFunctionRef<FString()> FindManifestPath,
+	                                     const FString& FallbackAssetSubPath);
+
+	/** Null values are cached "no manifest" results, so missing equipment sprites don't rescan the disk. */
+	TMap<FString, FSpriteClassDefinitionPtr> Definitions;
+
+	FSpriteClassCacheStats Stats;
+};
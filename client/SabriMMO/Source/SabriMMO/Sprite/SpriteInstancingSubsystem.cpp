@@ -0,0 +1,469 @@
+// SpriteInstancingSubsystem.cpp — Instanced sprite rendering backend (see header).
+
+#include "SpriteInstancingSubsystem.h"
+#include "SpriteCharacterActor.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/Texture2D.h"
+#include "Engine/World.h"
+#include "Materials/Material.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Materials/MaterialExpressionCustom.h"
+#include "Materials/MaterialExpressionTextureCoordinate.h"
+#include "Materials/MaterialExpressionConstant3Vector.h"
+#include "MeshDescription.h"
+#include "MeshDescriptionBuilder.h"
+#include "StaticMeshAttributes.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSpriteInstancing, Log, All);
+
+static TAutoConsoleVariable<int32> CVarSpriteInstancedEnemies(
+	TEXT("Sprite.InstancedEnemies"),
+	1,
+	TEXT("1 = newly spawned enemy sprites draw through USpriteInstancingSubsystem (one instanced\n")
+	TEXT("component per atlas texture + layer). 0 = each enemy draws its own layer meshes."),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorldAndArgs GSpriteInstanceStatsCmd(
+	TEXT("Sprite.InstanceStats"),
+	TEXT("Print instanced sprite batches, instance counts and per-frame sync cost."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (USpriteInstancingSubsystem* Sub = World ? World->GetSubsystem<USpriteInstancingSubsystem>() : nullptr)
+		{
+			Sub->LogStats();
+		}
+	}));
+
+namespace
+{
+	constexpr int32 ShadowSlot = static_cast<int32>(ESpriteLayer::Shadow);
+	constexpr int32 NumSlots = static_cast<int32>(ESpriteLayer::MAX);
+
+	// Footprint of the actor's blob shadow decal (DecalSize 64 x 48 x 48 → 96 UU across)
+	constexpr float ShadowDiameter = 96.f;
+	constexpr float ShadowHeight = 5.f;
+
+	const FLinearColor HitFlashTint(3.0f, 3.0f, 3.0f, 1.0f);
+}
+
+// ============================================================
+// Lifecycle
+// ============================================================
+
+bool USpriteInstancingSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld();
+}
+
+void USpriteInstancingSubsystem::Deinitialize()
+{
+	if (HostActor)
+	{
+		HostActor->Destroy();
+		HostActor = nullptr;
+	}
+	Records.Empty();
+	Batches.Empty();
+	BatchLookup.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId USpriteInstancingSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USpriteInstancingSubsystem, STATGROUP_Tickables);
+}
+
+bool USpriteInstancingSubsystem::IsEnabled()
+{
+	return CVarSpriteInstancedEnemies.GetValueOnGameThread() != 0;
+}
+
+// ============================================================
+// Registration
+// ============================================================
+
+int32 USpriteInstancingSubsystem::Register(ASpriteCharacterActor* Sprite)
+{
+	if (!Sprite) return INDEX_NONE;
+
+	FSpriteRecord Record;
+	Record.Sprite = Sprite;
+	for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+	{
+		Record.BatchIndex[Slot] = INDEX_NONE;
+		Record.InstanceIndex[Slot] = INDEX_NONE;
+	}
+
+	Sprite->EnableInstancedRendering();
+	return Records.Add(Record);
+}
+
+void USpriteInstancingSubsystem::Unregister(int32 InstanceId)
+{
+	if (!Records.IsValidIndex(InstanceId)) return;
+	RemoveAllInstances(Records[InstanceId]);
+	Records.RemoveAt(InstanceId);
+}
+
+// ============================================================
+// Per-frame sync
+// ============================================================
+
+void USpriteInstancingSubsystem::Tick(float DeltaTime)
+{
+	if (Records.Num() == 0) return;
+	const double StartTime = FPlatformTime::Seconds();
+
+	for (auto It = Records.CreateIterator(); It; ++It)
+	{
+		FSpriteRecord& Record = *It;
+		const ASpriteCharacterActor* Sprite = Record.Sprite.Get();
+		if (!Sprite)
+		{
+			RemoveAllInstances(Record);
+			It.RemoveCurrent();
+			continue;
+		}
+		SyncSprite(It.GetIndex(), Record, *Sprite);
+	}
+
+	// Custom data first (no render state update), then every transform in one upload per batch
+	for (FSpriteInstanceBatch& Batch : Batches)
+	{
+		if (!Batch.Component || Batch.Transforms.Num() == 0) continue;
+
+		const int32 Stride = Batch.Component->NumCustomDataFloats;
+		if (Stride > 0)
+		{
+			for (TConstSetBitIterator<> DirtyIt(Batch.CustomDataDirty); DirtyIt; ++DirtyIt)
+			{
+				const int32 Index = DirtyIt.GetIndex();
+				Batch.Component->SetCustomData(Index,
+					TArrayView<const float>(&Batch.CustomData[Index * Stride], Stride), false);
+			}
+			Batch.CustomDataDirty.SetRange(0, Batch.CustomDataDirty.Num(), false);
+		}
+		Batch.Component->BatchUpdateInstancesTransforms(0, Batch.Transforms, true, true, true);
+	}
+
+	LastSyncMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+}
+
+void USpriteInstancingSubsystem::SyncSprite(int32 RecordId, FSpriteRecord& Record, const ASpriteCharacterActor& Sprite)
+{
+	const bool bSpriteVisible = !Sprite.IsHidden();
+	const FTransform ActorTransform = Sprite.GetActorTransform();
+
+	for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+	{
+		// Which batch this slot belongs in this frame (texture swaps move it between batches)
+		int32 DesiredBatch = INDEX_NONE;
+		if (Slot == ShadowSlot)
+		{
+			if (bSpriteVisible && Sprite.IsBodyReady()) DesiredBatch = FindOrAddBatch(nullptr, ShadowSlot);
+		}
+		else
+		{
+			const FSpriteLayerState& Layer = Sprite.Layers[Slot];
+			if (bSpriteVisible && Layer.bActive && Layer.MeshComp && Layer.MeshComp->GetVisibleFlag())
+			{
+				if (UTexture2D* Texture = Sprite.GetLayerTexture(Slot))
+				{
+					DesiredBatch = FindOrAddBatch(Texture, Slot);
+				}
+			}
+		}
+
+		if (DesiredBatch != Record.BatchIndex[Slot])
+		{
+			RemoveInstance(Record, Slot);
+			if (DesiredBatch != INDEX_NONE) AddInstance(RecordId, Record, Slot, DesiredBatch);
+		}
+		if (DesiredBatch == INDEX_NONE) continue;
+
+		FSpriteInstanceBatch& Batch = Batches[DesiredBatch];
+		const int32 Index = Record.InstanceIndex[Slot];
+
+		if (Slot == ShadowSlot)
+		{
+			// Flat quad on the ground: pitch the +X-facing quad up and centre it on the actor
+			const FVector Scale = ActorTransform.GetScale3D();
+			const float Diameter = ShadowDiameter * Scale.X;
+			const FQuat Flat = FRotator(90.f, 0.f, 0.f).Quaternion();
+			const FVector Location = ActorTransform.GetLocation() + FVector(0.f, 0.f, ShadowHeight * Scale.Z)
+				+ Flat.RotateVector(FVector(0.f, 0.f, -0.5f * Diameter));
+			Batch.Transforms[Index] = FTransform(Flat, Location, FVector(1.f, Diameter, Diameter));
+			continue;
+		}
+
+		// Same placement as the actor's layer quad: depth offset toward the camera, sit offset in Z
+		const FSpriteLayerState& Layer = Sprite.Layers[Slot];
+		const FTransform Local(FQuat::Identity, FVector(GSpriteCameraDepthOffset, 0.f, Layer.AppliedZOffset),
+			FVector(1.f, Sprite.SpriteSize.X, Sprite.SpriteSize.Y));
+		Batch.Transforms[Index] = Local * ActorTransform;
+
+		const FLinearColor Tint = Sprite.bHitFlashing ? HitFlashTint : Layer.TintColor;
+		const float Data[SpriteInstanceData::Num] = {
+			Layer.AppliedAtlasRect.R, Layer.AppliedAtlasRect.G, Layer.AppliedAtlasRect.B, Layer.AppliedAtlasRect.A,
+			Tint.R, Tint.G, Tint.B };
+		float* Stored = &Batch.CustomData[Index * SpriteInstanceData::Num];
+		if (FMemory::Memcmp(Stored, Data, sizeof(Data)) != 0)
+		{
+			FMemory::Memcpy(Stored, Data, sizeof(Data));
+			Batch.CustomDataDirty[Index] = true;
+		}
+	}
+}
+
+void USpriteInstancingSubsystem::AddInstance(int32 RecordId, FSpriteRecord& Record, int32 Slot, int32 BatchIndex)
+{
+	FSpriteInstanceBatch& Batch = Batches[BatchIndex];
+	const int32 Index = Batch.Component->AddInstance(FTransform::Identity, true);
+	check(Index == Batch.Owners.Num());
+
+	Batch.Owners.Add(TPair<int32, int32>(RecordId, Slot));
+	Batch.Transforms.Add(FTransform::Identity);
+	Batch.CustomData.AddZeroed(Batch.Component->NumCustomDataFloats);
+	Batch.CustomDataDirty.Add(true);
+
+	Record.BatchIndex[Slot] = BatchIndex;
+	Record.InstanceIndex[Slot] = Index;
+}
+
+void USpriteInstancingSubsystem::RemoveInstance(FSpriteRecord& Record, int32 Slot)
+{
+	const int32 BatchIndex = Record.BatchIndex[Slot];
+	if (BatchIndex == INDEX_NONE) return;
+
+	FSpriteInstanceBatch& Batch = Batches[BatchIndex];
+	const int32 Index = Record.InstanceIndex[Slot];
+	const int32 Last = Batch.Owners.Num() - 1;
+	const int32 Stride = Batch.Component->NumCustomDataFloats;
+
+	// Swap-remove: the last instance takes over the freed index so indices stay dense
+	if (Index != Last)
+	{
+		const TPair<int32, int32> Moved = Batch.Owners[Last];
+		Batch.Owners[Index] = Moved;
+		Batch.Transforms[Index] = Batch.Transforms[Last];
+		if (Stride > 0)
+		{
+			FMemory::Memcpy(&Batch.CustomData[Index * Stride], &Batch.CustomData[Last * Stride], Stride * sizeof(float));
+		}
+		Batch.CustomDataDirty[Index] = true;
+		Records[Moved.Key].InstanceIndex[Moved.Value] = Index;
+	}
+
+	Batch.Component->RemoveInstance(Last);
+	Batch.Owners.RemoveAt(Last, EAllowShrinking::No);
+	Batch.Transforms.RemoveAt(Last, EAllowShrinking::No);
+	Batch.CustomData.RemoveAt(Last * Stride, Stride, EAllowShrinking::No);
+	Batch.CustomDataDirty.RemoveAt(Last);
+
+	Record.BatchIndex[Slot] = INDEX_NONE;
+	Record.InstanceIndex[Slot] = INDEX_NONE;
+}
+
+void USpriteInstancingSubsystem::RemoveAllInstances(FSpriteRecord& Record)
+{
+	for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+	{
+		RemoveInstance(Record, Slot);
+	}
+}
+
+// ============================================================
+// Batches + shared resources
+// ============================================================
+
+int32 USpriteInstancingSubsystem::FindOrAddBatch(UTexture2D* Texture, int32 LayerIndex)
+{
+	const TPair<TObjectKey<UTexture2D>, int32> Key(Texture, LayerIndex);
+	if (const int32* Found = BatchLookup.Find(Key))
+	{
+		return *Found;
+	}
+	if (!EnsureResources(Texture)) return INDEX_NONE;
+
+	const bool bShadow = LayerIndex == ShadowSlot;
+
+	UInstancedStaticMeshComponent* ISM = NewObject<UInstancedStaticMeshComponent>(HostActor);
+	ISM->SetupAttachment(HostActor->GetRootComponent());
+	ISM->SetStaticMesh(QuadMesh);
+	ISM->SetMobility(EComponentMobility::Movable);
+	ISM->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	ISM->SetCastShadow(false);
+	ISM->bReceivesDecals = false;
+	ISM->SetCanEverAffectNavigation(false);
+	ISM->SetNumCustomDataFloats(bShadow ? 0 : SpriteInstanceData::Num);
+
+	if (bShadow)
+	{
+		ISM->SetMaterial(0, ShadowMaterial);
+	}
+	else
+	{
+		// Same stencil + layer ordering as the per-actor quads. Instances inside one batch
+		// are not depth-sorted against each other, and per-frame equipment front/back
+		// ordering is not available here (enemies only draw the body layer).
+		ISM->SetRenderCustomDepth(true);
+		ISM->SetCustomDepthStencilValue(1);
+		ISM->TranslucencySortPriority = 0;
+		ISM->TranslucencySortDistanceOffset = -0.1f * static_cast<float>(LayerIndex);
+
+		UMaterialInstanceDynamic* MID = UMaterialInstanceDynamic::Create(SpriteMaterial, ISM);
+		MID->SetTextureParameterValue(TEXT("Atlas"), Texture);
+		ISM->SetMaterial(0, MID);
+	}
+	ISM->RegisterComponent();
+
+	const int32 BatchIndex = Batches.AddDefaulted();
+	FSpriteInstanceBatch& Batch = Batches[BatchIndex];
+	Batch.Component = ISM;
+	Batch.Texture = Texture;
+	Batch.LayerIndex = LayerIndex;
+	BatchLookup.Add(Key, BatchIndex);
+
+	UE_LOG(LogSpriteInstancing, Log, TEXT("New sprite batch %d: layer %d texture %s"),
+		BatchIndex, LayerIndex, Texture ? *Texture->GetName() : TEXT("<shadow>"));
+	return BatchIndex;
+}
+
+bool USpriteInstancingSubsystem::EnsureResources(UTexture2D* FirstTexture)
+{
+	UWorld* World = GetWorld();
+	if (!World) return false;
+
+	if (!HostActor)
+	{
+		FActorSpawnParameters Params;
+		Params.Name = TEXT("SpriteInstanceHost");
+		Params.ObjectFlags |= RF_Transient;
+		Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		HostActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, Params);
+		if (!HostActor) return false;
+
+		USceneComponent* Root = NewObject<USceneComponent>(HostActor, TEXT("Root"));
+		HostActor->SetRootComponent(Root);
+		Root->RegisterComponent();
+	}
+	if (!QuadMesh)
+	{
+		QuadMesh = BuildQuadMesh();
+	}
+	if (!ShadowMaterial)
+	{
+		ShadowMaterial = BuildShadowMaterial();
+	}
+	// The sprite graph needs a texture to compile; batches override it via their MID
+	if (!SpriteMaterial && FirstTexture)
+	{
+		SpriteMaterial = ASpriteCharacterActor::BuildSpriteMaterial(FirstTexture, true);
+	}
+	return QuadMesh && (FirstTexture ? SpriteMaterial != nullptr : ShadowMaterial != nullptr);
+}
+
+UStaticMesh* USpriteInstancingSubsystem::BuildQuadMesh()
+{
+	FMeshDescription MeshDesc;
+	FStaticMeshAttributes Attributes(MeshDesc);
+	Attributes.Register();
+
+	FMeshDescriptionBuilder Builder;
+	Builder.SetMeshDescription(&MeshDesc);
+	Builder.EnablePolyGroups();
+	Builder.SetNumUVLayers(1);
+
+	// Unit quad facing +X like the actor's layer quads: Y in [-0.5, 0.5], Z in [0, 1].
+	// UVs are mirrored the same way (billboard yaw flips local Y on screen).
+	const FVector Corners[4] = {
+		FVector(0.f, -0.5f, 0.f), FVector(0.f, 0.5f, 0.f), FVector(0.f, 0.5f, 1.f), FVector(0.f, -0.5f, 1.f) };
+	const FVector2D UVs[4] = { FVector2D(1, 1), FVector2D(0, 1), FVector2D(0, 0), FVector2D(1, 0) };
+
+	FVertexInstanceID Instances[4];
+	for (int32 i = 0; i < 4; ++i)
+	{
+		const FVertexID Vertex = Builder.AppendVertex(Corners[i]);
+		Instances[i] = Builder.AppendInstance(Vertex);
+		Builder.SetInstanceNormal(Instances[i], FVector(1.f, 0.f, 0.f));
+		Builder.SetInstanceUV(Instances[i], UVs[i], 0);
+		Builder.SetInstanceColor(Instances[i], FVector4f(1.f, 1.f, 1.f, 1.f));
+	}
+	const FPolygonGroupID Group = Builder.AppendPolygonGroup();
+	Builder.AppendTriangle(Instances[0], Instances[1], Instances[2], Group);
+	Builder.AppendTriangle(Instances[0], Instances[2], Instances[3], Group);
+
+	UStaticMesh* Mesh = NewObject<UStaticMesh>(this, TEXT("SpriteInstanceQuad"), RF_Transient);
+	Mesh->GetStaticMaterials().Add(FStaticMaterial());
+
+	UStaticMesh::FBuildMeshDescriptionsParams BuildParams;
+	BuildParams.bBuildSimpleCollision = false;
+	BuildParams.bFastBuild = true;
+	Mesh->BuildFromMeshDescriptions({ &MeshDesc }, BuildParams);
+	return Mesh;
+}
+
+UMaterial* USpriteInstancingSubsystem::BuildShadowMaterial()
+{
+	// Instanced stand-in for the actor's blob-shadow decal: flat translucent quad, radial falloff
+	UMaterial* Mat = NewObject<UMaterial>(GetTransientPackage(), NAME_None, RF_Transient);
+	Mat->MaterialDomain = MD_Surface;
+	Mat->BlendMode = BLEND_Translucent;
+	Mat->SetShadingModel(MSM_Unlit);
+	Mat->TwoSided = true;
+	Mat->bUsedWithInstancedStaticMeshes = true;
+
+	auto* TexCoord = NewObject<UMaterialExpressionTextureCoordinate>(Mat);
+	Mat->GetExpressionCollection().AddExpression(TexCoord);
+
+	// Same falloff as the runtime decal material in ASpriteCharacterActor::BeginPlay
+	auto* Custom = NewObject<UMaterialExpressionCustom>(Mat);
+	Custom->OutputType = CMOT_Float1;
+	Custom->Code = TEXT(
+		"float2 Centered = UV - float2(0.5, 0.5);\n"
+		"float Dist = length(Centered) * 2.0;\n"
+		"float Alpha = saturate(1.0 - Dist) * 0.5;\n"
+		"Alpha *= Alpha;\n"
+		"return Alpha;\n"
+	);
+	FCustomInput& In0 = Custom->Inputs.AddDefaulted_GetRef();
+	In0.InputName = TEXT("UV");
+	In0.Input.Connect(0, TexCoord);
+	Mat->GetExpressionCollection().AddExpression(Custom);
+	Mat->GetEditorOnlyData()->Opacity.Connect(0, Custom);
+
+	auto* Black = NewObject<UMaterialExpressionConstant3Vector>(Mat);
+	Black->Constant = FLinearColor::Black;
+	Mat->GetExpressionCollection().AddExpression(Black);
+	Mat->GetEditorOnlyData()->EmissiveColor.Connect(0, Black);
+
+	Mat->PreEditChange(nullptr);
+	Mat->PostEditChange();
+	return Mat;
+}
+
+// ============================================================
+// Stats
+// ============================================================
+
+void USpriteInstancingSubsystem::LogStats() const
+{
+	int32 TotalInstances = 0;
+	for (const FSpriteInstanceBatch& Batch : Batches)
+	{
+		TotalInstances += Batch.Owners.Num();
+	}
+	UE_LOG(LogSpriteInstancing, Log, TEXT("Sprite instancing [%s]: %d sprites, %d batches, %d instances, last sync %.3f ms"),
+		IsEnabled() ? TEXT("on") : TEXT("off"), Records.Num(), Batches.Num(), TotalInstances, LastSyncMs);
+
+	for (int32 i = 0; i < Batches.Num(); ++i)
+	{
+		const FSpriteInstanceBatch& Batch = Batches[i];
+		UE_LOG(LogSpriteInstancing, Log, TEXT("  [%2d] layer %d  %-40s instances %4d"),
+			i, Batch.LayerIndex, Batch.Texture ? *Batch.Texture->GetName() : TEXT("<shadow>"), Batch.Owners.Num());
+	}
+}
@@ -0,0 +1,112 @@
+// SpriteInstancingSubsystem.h — Instanced rendering backend for sprite actors.
+// A sprite handed over via Register() stops drawing its own layer quads and blob-shadow
+// decal. Each visible layer becomes one instance in a UInstancedStaticMeshComponent shared
+// by every sprite using the same (atlas texture, layer); per-instance custom data carries
+// the atlas cell and tint (incl. hit flash). A zone full of one monster class draws in a
+// couple of calls instead of one per layer per actor.
+// The actor stays the logical sprite (animation, movement, click proxy); this subsystem
+// pulls its layer state once per frame.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Containers/SparseArray.h"
+#include "SpriteAtlasData.h"
+#include "SpriteInstancingSubsystem.generated.h"
+
+class ASpriteCharacterActor;
+class UInstancedStaticMeshComponent;
+class UMaterial;
+class UStaticMesh;
+class UTexture2D;
+
+/** One instanced component: every instance of a (texture, layer) pair. */
+USTRUCT()
+struct FSpriteInstanceBatch
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<UInstancedStaticMeshComponent> Component;
+
+	UPROPERTY()
+	TObjectPtr<UTexture2D> Texture;
+
+	int32 LayerIndex = 0;
+
+	/** Per instance: owning record id and layer slot, for swap-removal fix-ups */
+	TArray<TPair<int32, int32>> Owners;
+
+	/** Per instance, rebuilt every frame and uploaded in one batch */
+	TArray<FTransform> Transforms;
+
+	/** Per instance, SpriteInstanceData::Num floats each; only dirty instances are uploaded */
+	TArray<float> CustomData;
+	TBitArray<> CustomDataDirty;
+};
+
+UCLASS()
+class SABRIMMO_API USpriteInstancingSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Sprite.InstancedEnemies — whether enemy sprites should be handed to this backend */
+	static bool IsEnabled();
+
+	/**
+	 * Draw Sprite through instancing from now on. Returns its instance id, or INDEX_NONE.
+	 * Destroyed sprites are dropped automatically on the next tick.
+	 */
+	int32 Register(ASpriteCharacterActor* Sprite);
+	void Unregister(int32 InstanceId);
+
+	void LogStats() const;
+
+private:
+	struct FSpriteRecord
+	{
+		TWeakObjectPtr<ASpriteCharacterActor> Sprite;
+		int32 BatchIndex[static_cast<int32>(ESpriteLayer::MAX)];
+		int32 InstanceIndex[static_cast<int32>(ESpriteLayer::MAX)];
+	};
+
+	void SyncSprite(int32 RecordId, FSpriteRecord& Record, const ASpriteCharacterActor& Sprite);
+	void AddInstance(int32 RecordId, FSpriteRecord& Record, int32 Slot, int32 BatchIndex);
+	void RemoveInstance(FSpriteRecord& Record, int32 Slot);
+	void RemoveAllInstances(FSpriteRecord& Record);
+
+	int32 FindOrAddBatch(UTexture2D* Texture, int32 LayerIndex);
+	bool EnsureResources(UTexture2D* FirstTexture);
+	UStaticMesh* BuildQuadMesh();
+	UMaterial* BuildShadowMaterial();
+
+	TSparseArray<FSpriteRecord> Records;
+
+	UPROPERTY()
+	TArray<FSpriteInstanceBatch> Batches;
+
+	TMap<TPair<TObjectKey<UTexture2D>, int32>, int32> BatchLookup;
+
+	/** Owns the instanced components; sits at the origin so instance transforms are world space */
+	UPROPERTY()
+	TObjectPtr<AActor> HostActor;
+
+	UPROPERTY()
+	TObjectPtr<UStaticMesh> QuadMesh;
+
+	UPROPERTY()
+	TObjectPtr<UMaterial> SpriteMaterial;
+
+	UPROPERTY()
+	TObjectPtr<UMaterial> ShadowMaterial;
+
+	double LastSyncMs = 0.0;
+};
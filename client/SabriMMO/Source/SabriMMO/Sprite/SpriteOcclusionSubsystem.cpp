@@ -0,0 +1,210 @@
+// SpriteOcclusionSubsystem.cpp — Budgeted async sprite occlusion traces (see header).
+
+#include "SpriteOcclusionSubsystem.h"
+#include "SpriteCharacterActor.h"
+#include "SpriteSignificanceSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSpriteOcclusion, Log, All);
+
+DECLARE_STATS_GROUP(TEXT("SpriteOcclusion"), STATGROUP_SpriteOcclusion, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Schedule + collect"), STAT_SpriteOcclusion_Tick, STATGROUP_SpriteOcclusion);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Traces issued"), STAT_SpriteOcclusion_Traces, STATGROUP_SpriteOcclusion);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Results changed"), STAT_SpriteOcclusion_Changed, STATGROUP_SpriteOcclusion);
+
+static TAutoConsoleVariable<int32> CVarSpriteOcclusionTraceBudget(
+	TEXT("Sprite.OcclusionTraceBudget"),
+	16,
+	TEXT("Async occlusion line traces per frame across all player sprites (two per sprite test)."),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorldAndArgs GSpriteOcclusionStatsCmd(
+	TEXT("Sprite.OcclusionStats"),
+	TEXT("Print registered occlusion sprites, last-frame traces and the oldest result age."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (USpriteOcclusionSubsystem* Sub = World ? World->GetSubsystem<USpriteOcclusionSubsystem>() : nullptr)
+		{
+			Sub->LogStats();
+		}
+	}));
+
+namespace
+{
+	// Results not ready this many frames after issue are dropped (the sprite is re-queued)
+	constexpr uint64 MaxPendingFrames = 3;
+
+	// The local player's own silhouette is what the player watches — test it more often
+	constexpr float LocalSpritePriority = 4.f;
+}
+
+// ============================================================
+// Lifecycle
+// ============================================================
+
+bool USpriteOcclusionSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld();
+}
+
+void USpriteOcclusionSubsystem::Deinitialize()
+{
+	Entries.Empty();
+	Pending.Empty();
+	Super::Deinitialize();
+}
+
+TStatId USpriteOcclusionSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USpriteOcclusionSubsystem, STATGROUP_Tickables);
+}
+
+void USpriteOcclusionSubsystem::Register(ASpriteCharacterActor* Sprite)
+{
+	if (!Sprite) return;
+	for (const FOcclusionEntry& Entry : Entries)
+	{
+		if (Entry.Sprite == Sprite) return;
+	}
+	FOcclusionEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.Sprite = Sprite;
+}
+
+void USpriteOcclusionSubsystem::Unregister(ASpriteCharacterActor* Sprite)
+{
+	Entries.RemoveAllSwap([Sprite](const FOcclusionEntry& Entry) { return Entry.Sprite == Sprite; }, EAllowShrinking::No);
+}
+
+// ============================================================
+// Per-frame pass
+// ============================================================
+
+void USpriteOcclusionSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SpriteOcclusion_Tick);
+
+	CollectResults();
+	IssueTraces();
+}
+
+void USpriteOcclusionSubsystem::CollectResults()
+{
+	UWorld* World = GetWorld();
+	LastChanged = 0;
+
+	for (int32 i = Pending.Num() - 1; i >= 0; --i)
+	{
+		FPendingTest& Test = Pending[i];
+		ASpriteCharacterActor* Sprite = Test.Sprite.Get();
+		if (!Sprite)
+		{
+			Pending.RemoveAtSwap(i, EAllowShrinking::No);
+			continue;
+		}
+
+		FTraceDatum FeetData, HeadData;
+		if (World->QueryTraceData(Test.Feet, FeetData) && World->QueryTraceData(Test.Head, HeadData))
+		{
+			const bool bFeet = FeetData.OutHits.Num() > 0 && FeetData.OutHits[0].bBlockingHit;
+			const bool bHead = HeadData.OutHits.Num() > 0 && HeadData.OutHits[0].bBlockingHit;
+			if (Sprite->SetOcclusion(bFeet, bHead))
+			{
+				++LastChanged;
+			}
+			Pending.RemoveAtSwap(i, EAllowShrinking::No);
+		}
+		else if (GFrameCounter - Test.IssuedFrame > MaxPendingFrames)
+		{
+			Pending.RemoveAtSwap(i, EAllowShrinking::No);
+		}
+	}
+
+	INC_DWORD_STAT_BY(STAT_SpriteOcclusion_Changed, LastChanged);
+}
+
+void USpriteOcclusionSubsystem::IssueTraces()
+{
+	LastIssued = 0;
+	MaxAgeFrames = 0;
+
+	UWorld* World = GetWorld();
+	APlayerController* PC = World->GetFirstPlayerController();
+	if (!PC || !PC->PlayerCameraManager || Entries.Num() == 0) return;
+
+	const FVector CamLoc = PC->PlayerCameraManager->GetCameraLocation();
+	const FVector CamFwd = PC->PlayerCameraManager->GetCameraRotation().Vector();
+
+	// Priority = approximate on-screen height x frames since the last test, so large sprites
+	// refresh often and small / distant ones still come round
+	Entries.RemoveAllSwap([](const FOcclusionEntry& Entry) { return !Entry.Sprite.IsValid(); }, EAllowShrinking::No);
+	Candidates.Reset();
+	for (int32 i = 0; i < Entries.Num(); ++i)
+	{
+		const FOcclusionEntry& Entry = Entries[i];
+		const ASpriteCharacterActor* Sprite = Entry.Sprite.Get();
+
+		const FVector ToSprite = Sprite->GetActorLocation() - CamLoc;
+		const float Dist = ToSprite.Size();
+		if ((ToSprite | CamFwd) <= 0.f || Sprite->IsHidden()) continue;
+
+		// Distant sprites keep no silhouette (USpriteSignificanceSubsystem clears it on demotion)
+		if (Sprite->Significance != ESpriteSignificance::Full && !Sprite->bIsLocalPlayerSprite) continue;
+
+		const uint64 Age = GFrameCounter - Entry.LastTestedFrame;
+		MaxAgeFrames = FMath::Max(MaxAgeFrames, Age);
+
+		float Score = (float)Sprite->SpriteSize.Y / FMath::Max(Dist, 1.f) * (float)FMath::Min<uint64>(Age, 1000);
+		if (Sprite->bIsLocalPlayerSprite) Score *= LocalSpritePriority;
+		Candidates.Emplace(Score, i);
+	}
+
+	const int32 MaxTests = FMath::Max(1, CVarSpriteOcclusionTraceBudget.GetValueOnGameThread() / 2);
+	if (Candidates.Num() > MaxTests)
+	{
+		Candidates.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B) { return A.Key > B.Key; });
+		Candidates.SetNum(MaxTests, EAllowShrinking::No);
+	}
+
+	for (const TPair<float, int32>& Candidate : Candidates)
+	{
+		FOcclusionEntry& Entry = Entries[Candidate.Value];
+		ASpriteCharacterActor* Sprite = Entry.Sprite.Get();
+
+		// Feet just above the ground, head at the top of the sprite quad
+		const FVector Base = Sprite->GetActorLocation();
+		const FVector FeetLoc = Base + FVector(0, 0, 8.f);
+		const FVector HeadLoc = Base + FVector(0, 0, Sprite->SpriteSize.Y);
+
+		FCollisionQueryParams Params(SCENE_QUERY_STAT(SpriteOcclusionTrace), false, Sprite);
+		if (AActor* Owner = Sprite->OwnerActor.Get())
+		{
+			Params.AddIgnoredActor(Owner);
+		}
+
+		FPendingTest& Test = Pending.AddDefaulted_GetRef();
+		Test.Sprite = Sprite;
+		Test.Feet = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, CamLoc, FeetLoc, ECC_Visibility, Params);
+		Test.Head = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, CamLoc, HeadLoc, ECC_Visibility, Params);
+		Test.IssuedFrame = GFrameCounter;
+
+		Entry.LastTestedFrame = GFrameCounter;
+		LastIssued += 2;
+	}
+
+	INC_DWORD_STAT_BY(STAT_SpriteOcclusion_Traces, LastIssued);
+}
+
+// ============================================================
+// Stats
+// ============================================================
+
+void USpriteOcclusionSubsystem::LogStats() const
+{
+	UE_LOG(LogSpriteOcclusion, Log,
+		TEXT("Sprite occlusion: %d sprites, budget %d traces; last frame %d issued, %d changed, %d pending, oldest result %llu frames"),
+		Entries.Num(), CVarSpriteOcclusionTraceBudget.GetValueOnGameThread(), LastIssued, LastChanged, Pending.Num(), MaxAgeFrames);
+}
@@ -0,0 +1,69 @@
+// SpriteOcclusionSubsystem.h — Budgeted async camera-to-sprite occlusion traces.
+// Player sprites (local and remote, i.e. sprites following an owner actor) render as a
+// silhouette when walls hide them: the sprite material reads FeetOccluded / HeadOccluded.
+// Instead of two synchronous line traces per sprite per tick, this subsystem issues at most
+// Sprite.OcclusionTraceBudget async traces per frame, spread round-robin across sprites and
+// weighted by on-screen size, and hands results to the sprite one frame later. The sprite
+// only touches its materials when a value actually flips. Only sprites in the Full
+// significance bucket (USpriteSignificanceSubsystem) are traced.
+// `stat SpriteOcclusion` shows traces issued and results that changed a sprite per frame.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "SpriteOcclusionSubsystem.generated.h"
+
+class ASpriteCharacterActor;
+
+UCLASS()
+class SABRIMMO_API USpriteOcclusionSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	void Register(ASpriteCharacterActor* Sprite);
+	void Unregister(ASpriteCharacterActor* Sprite);
+
+	int32 Num() const { return Entries.Num(); }
+	void LogStats() const;
+
+private:
+	struct FOcclusionEntry
+	{
+		TWeakObjectPtr<ASpriteCharacterActor> Sprite;
+		/** GFrameCounter of the last trace pair issued for this sprite */
+		uint64 LastTestedFrame = 0;
+	};
+
+	struct FPendingTest
+	{
+		TWeakObjectPtr<ASpriteCharacterActor> Sprite;
+		FTraceHandle Feet;
+		FTraceHandle Head;
+		uint64 IssuedFrame = 0;
+	};
+
+	/** Apply last frame's finished traces */
+	void CollectResults();
+
+	/** Pick the highest-priority sprites for this frame's budget and issue their traces */
+	void IssueTraces();
+
+	TArray<FOcclusionEntry> Entries;
+	TArray<FPendingTest> Pending;
+
+	// Scratch
+	TArray<TPair<float, int32>> Candidates;
+
+	// Last-frame numbers for Sprite.OcclusionStats
+	int32 LastIssued = 0;
+	int32 LastChanged = 0;
+	uint64 MaxAgeFrames = 0;
+};
@@ -0,0 +1,338 @@
+// SpriteSignificanceSubsystem.cpp — Distance / screen-size update LOD for sprites (see header).
+
+#include "SpriteSignificanceSubsystem.h"
+#include "SpriteCharacterActor.h"
+#include "SpriteAnimationSubsystem.h"
+#include "Components/DecalComponent.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "Engine/GameViewportClient.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+#include "DrawDebugHelpers.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSpriteSignificance, Log, All);
+
+DECLARE_STATS_GROUP(TEXT("SpriteSignificance"), STATGROUP_SpriteSignificance, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Evaluate"), STAT_SpriteSignificance_Evaluate, STATGROUP_SpriteSignificance);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Full sprites"), STAT_SpriteSignificance_Full, STATGROUP_SpriteSignificance);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Reduced sprites"), STAT_SpriteSignificance_Reduced, STATGROUP_SpriteSignificance);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Far sprites"), STAT_SpriteSignificance_Far, STATGROUP_SpriteSignificance);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Bucket changes"), STAT_SpriteSignificance_Changed, STATGROUP_SpriteSignificance);
+
+static TAutoConsoleVariable<int32> CVarSignificanceEnabled(
+	TEXT("Sprite.Significance"),
+	1,
+	TEXT("1 = distant / small sprites get reduced animation, tracking, occlusion and shadows.\n")
+	TEXT("0 = every sprite at full fidelity."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarSignificanceFullCount(
+	TEXT("Sprite.SignificanceFullCount"),
+	-1,
+	TEXT("Sprites kept at full fidelity (largest on screen first). -1 = from the Entity Detail option."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarSignificanceReducedCount(
+	TEXT("Sprite.SignificanceReducedCount"),
+	-1,
+	TEXT("Sprites in the reduced bucket after the full ones; the rest are far. -1 = from the Entity Detail option."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarSignificanceFarDistance(
+	TEXT("Sprite.SignificanceFarDistance"),
+	4000.f,
+	TEXT("Camera distance (world units) beyond which a sprite is always in the far bucket."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarSignificanceMinScreenSize(
+	TEXT("Sprite.SignificanceMinScreenSize"),
+	0.03f,
+	TEXT("Sprites shorter than this fraction of the view height are always in the far bucket."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarSignificanceInterval(
+	TEXT("Sprite.SignificanceInterval"),
+	0.1f,
+	TEXT("Seconds between re-ranking sprites into buckets."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarSignificanceDebug(
+	TEXT("Sprite.SignificanceDebug"),
+	0,
+	TEXT("1 = on-screen bucket populations, 2 = also a colored marker above every sprite."),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorldAndArgs GSpriteSignificanceStatsCmd(
+	TEXT("Sprite.SignificanceStats"),
+	TEXT("Print sprite significance budgets and bucket populations."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (USpriteSignificanceSubsystem* Sub = World ? World->GetSubsystem<USpriteSignificanceSubsystem>() : nullptr)
+		{
+			Sub->LogStats();
+		}
+	}));
+
+namespace
+{
+	// Entity Detail option (0 = Ultra .. 4 = Very Low) -> bucket budgets
+	constexpr int32 FullBudgets[]    = { 64, 40, 24, 12,  6 };
+	constexpr int32 ReducedBudgets[] = { 128, 80, 48, 24, 12 };
+
+	// Sprites slightly outside the frustum still count as on screen (their quad may poke in)
+	constexpr float ScreenMargin = 1.15f;
+}
+
+// ============================================================
+// Lifecycle
+// ============================================================
+
+bool USpriteSignificanceSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld();
+}
+
+void USpriteSignificanceSubsystem::Deinitialize()
+{
+	Entries.Empty();
+	Super::Deinitialize();
+}
+
+TStatId USpriteSignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USpriteSignificanceSubsystem, STATGROUP_Tickables);
+}
+
+void USpriteSignificanceSubsystem::Register(ASpriteCharacterActor* Sprite)
+{
+	if (!Sprite) return;
+	for (const FSignificanceEntry& Entry : Entries)
+	{
+		if (Entry.Sprite == Sprite) return;
+	}
+	FSignificanceEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.Sprite = Sprite;
+}
+
+void USpriteSignificanceSubsystem::Unregister(ASpriteCharacterActor* Sprite)
+{
+	Entries.RemoveAllSwap([Sprite](const FSignificanceEntry& Entry) { return Entry.Sprite == Sprite; }, EAllowShrinking::No);
+}
+
+void USpriteSignificanceSubsystem::SetDetailLevel(int32 Level)
+{
+	DetailLevel = FMath::Clamp(Level, 0, 4);
+	NextEvaluateTime = 0.0;  // re-bucket on the next tick
+}
+
+int32 USpriteSignificanceSubsystem::GetFrameStride(ESpriteSignificance Bucket)
+{
+	switch (Bucket)
+	{
+	case ESpriteSignificance::Full:    return 1;
+	case ESpriteSignificance::Reduced: return 2;
+	default:                           return 3;
+	}
+}
+
+int32 USpriteSignificanceSubsystem::GetTrackingInterval(ESpriteSignificance Bucket)
+{
+	switch (Bucket)
+	{
+	case ESpriteSignificance::Full:    return 1;
+	case ESpriteSignificance::Reduced: return 2;
+	default:                           return 4;
+	}
+}
+
+void USpriteSignificanceSubsystem::GetBudgets(int32& OutFull, int32& OutReduced) const
+{
+	const int32 FullOverride = CVarSignificanceFullCount.GetValueOnGameThread();
+	const int32 ReducedOverride = CVarSignificanceReducedCount.GetValueOnGameThread();
+	OutFull = FullOverride >= 0 ? FullOverride : FullBudgets[DetailLevel];
+	OutReduced = ReducedOverride >= 0 ? ReducedOverride : ReducedBudgets[DetailLevel];
+}
+
+// ============================================================
+// Per-frame pass
+// ============================================================
+
+void USpriteSignificanceSubsystem::Tick(float DeltaTime)
+{
+	UWorld* World = GetWorld();
+	const double Now = World->GetTimeSeconds();
+	if (Now >= NextEvaluateTime)
+	{
+		NextEvaluateTime = Now + FMath::Max(CVarSignificanceInterval.GetValueOnGameThread(), 0.f);
+		Evaluate();
+	}
+
+#if !UE_BUILD_SHIPPING
+	if (CVarSignificanceDebug.GetValueOnGameThread() > 0)
+	{
+		DrawDebug();
+	}
+#endif
+}
+
+void USpriteSignificanceSubsystem::Evaluate()
+{
+	SCOPE_CYCLE_COUNTER(STAT_SpriteSignificance_Evaluate);
+
+	Entries.RemoveAllSwap([](const FSignificanceEntry& Entry) { return !Entry.Sprite.IsValid(); }, EAllowShrinking::No);
+	FMemory::Memzero(BucketCounts);
+	LastChanged = 0;
+	GetBudgets(LastFullBudget, LastReducedBudget);
+
+	APlayerController* PC = GetWorld()->GetFirstPlayerController();
+	const bool bEnabled = CVarSignificanceEnabled.GetValueOnGameThread() != 0;
+	if (!bEnabled || !PC || !PC->PlayerCameraManager)
+	{
+		for (const FSignificanceEntry& Entry : Entries)
+		{
+			ApplyBucket(Entry.Sprite.Get(), ESpriteSignificance::Full);
+		}
+		BucketCounts[(int32)ESpriteSignificance::Full] = Entries.Num();
+		return;
+	}
+
+	const FVector CamLoc = PC->PlayerCameraManager->GetCameraLocation();
+	const FVector CamFwd = PC->PlayerCameraManager->GetCameraRotation().Vector();
+
+	// View height at distance D is 2 * D * tan(HFov/2) / Aspect
+	float Aspect = 16.f / 9.f;
+	if (GEngine && GEngine->GameViewport)
+	{
+		FVector2D ViewportSize;
+		GEngine->GameViewport->GetViewportSize(ViewportSize);
+		if (ViewportSize.Y > 0.f) Aspect = ViewportSize.X / ViewportSize.Y;
+	}
+	const float TanHalfFov = FMath::Tan(FMath::DegreesToRadians(PC->PlayerCameraManager->GetFOVAngle() * 0.5f));
+	const float HeightPerDistance = FMath::Max(2.f * TanHalfFov / Aspect, KINDA_SMALL_NUMBER);
+	const float CosHalfDiagonal = FMath::Cos(FMath::Min(
+		FMath::Atan(TanHalfFov * FMath::Sqrt(1.f + 1.f / FMath::Square(Aspect))) * ScreenMargin, HALF_PI));
+
+	const float FarDistance = CVarSignificanceFarDistance.GetValueOnGameThread();
+	const float MinScreenSize = CVarSignificanceMinScreenSize.GetValueOnGameThread();
+
+	Order.Reset();
+	for (int32 i = 0; i < Entries.Num(); ++i)
+	{
+		FSignificanceEntry& Entry = Entries[i];
+		ASpriteCharacterActor* Sprite = Entry.Sprite.Get();
+
+		// The player's own character is what they are watching
+		if (Sprite->bIsLocalPlayerSprite)
+		{
+			ApplyBucket(Sprite, ESpriteSignificance::Full);
+			++BucketCounts[(int32)ESpriteSignificance::Full];
+			continue;
+		}
+
+		const FVector ToSprite = Sprite->GetActorLocation() + FVector(0, 0, Sprite->SpriteSize.Y * 0.5f) - CamLoc;
+		Entry.Distance = ToSprite.Size();
+		const bool bOnScreen = !Sprite->IsHidden()
+			&& (ToSprite | CamFwd) >= CosHalfDiagonal * Entry.Distance;
+		Entry.ScreenSize = bOnScreen
+			? (float)Sprite->SpriteSize.Y / (FMath::Max(Entry.Distance, 1.f) * HeightPerDistance)
+			: 0.f;
+
+		if (Entry.ScreenSize < MinScreenSize || Entry.Distance > FarDistance)
+		{
+			ApplyBucket(Sprite, ESpriteSignificance::Far);
+			++BucketCounts[(int32)ESpriteSignificance::Far];
+			continue;
+		}
+		Order.Add(i);
+	}
+
+	// Largest on screen first: nearest N full, next M reduced, rest far
+	Order.Sort([this](int32 A, int32 B) { return Entries[A].ScreenSize > Entries[B].ScreenSize; });
+	for (int32 Rank = 0; Rank < Order.Num(); ++Rank)
+	{
+		const ESpriteSignificance Bucket =
+			Rank < LastFullBudget ? ESpriteSignificance::Full :
+			Rank < LastFullBudget + LastReducedBudget ? ESpriteSignificance::Reduced :
+			ESpriteSignificance::Far;
+		ApplyBucket(Entries[Order[Rank]].Sprite.Get(), Bucket);
+		++BucketCounts[(int32)Bucket];
+	}
+
+	SET_DWORD_STAT(STAT_SpriteSignificance_Full, BucketCounts[(int32)ESpriteSignificance::Full]);
+	SET_DWORD_STAT(STAT_SpriteSignificance_Reduced, BucketCounts[(int32)ESpriteSignificance::Reduced]);
+	SET_DWORD_STAT(STAT_SpriteSignificance_Far, BucketCounts[(int32)ESpriteSignificance::Far]);
+	INC_DWORD_STAT_BY(STAT_SpriteSignificance_Changed, LastChanged);
+}
+
+void USpriteSignificanceSubsystem::ApplyBucket(ASpriteCharacterActor* Sprite, ESpriteSignificance Bucket)
+{
+	if (Sprite->Significance == Bucket) return;
+
+	const ESpriteSignificance Previous = Sprite->Significance;
+	Sprite->Significance = Bucket;
+	++LastChanged;
+
+	if (USpriteAnimationSubsystem* Anim = Sprite->AnimSystem.Get())
+	{
+		Anim->SetUpdateRate(Sprite->AnimSlot, GetFrameStride(Bucket), GetTrackingInterval(Bucket));
+	}
+
+	// Occlusion traces are Full-only: don't leave a stale silhouette on a sprite nobody re-tests
+	if (Previous == ESpriteSignificance::Full)
+	{
+		Sprite->SetOcclusion(false, false);
+	}
+
+	if (Sprite->BlobShadow)
+	{
+		Sprite->BlobShadow->SetVisibility(Bucket != ESpriteSignificance::Far);
+	}
+}
+
+// ============================================================
+// Stats / debug overlay
+// ============================================================
+
+void USpriteSignificanceSubsystem::LogStats() const
+{
+	UE_LOG(LogSpriteSignificance, Log,
+		TEXT("Sprite significance [%s]: %d sprites, detail %d (budget %d full / %d reduced); last pass %d full, %d reduced, %d far, %d changed"),
+		CVarSignificanceEnabled.GetValueOnGameThread() ? TEXT("on") : TEXT("off"),
+		Entries.Num(), DetailLevel, LastFullBudget, LastReducedBudget,
+		BucketCounts[(int32)ESpriteSignificance::Full], BucketCounts[(int32)ESpriteSignificance::Reduced],
+		BucketCounts[(int32)ESpriteSignificance::Far], LastChanged);
+}
+
+#if !UE_BUILD_SHIPPING
+void USpriteSignificanceSubsystem::DrawDebug() const
+{
+	static const FColor BucketColors[] = { FColor::Green, FColor::Yellow, FColor::Red };
+
+	if (GEngine)
+	{
+		static const uint64 OverlayKey = GetTypeHash(FName(TEXT("SpriteSignificance")));
+		GEngine->AddOnScreenDebugMessage(OverlayKey, 0.f, FColor::Cyan, FString::Printf(
+			TEXT("Sprite significance (detail %d, budget %d/%d): Full %d | Reduced %d | Far %d"),
+			DetailLevel, LastFullBudget, LastReducedBudget,
+			BucketCounts[(int32)ESpriteSignificance::Full], BucketCounts[(int32)ESpriteSignificance::Reduced],
+			BucketCounts[(int32)ESpriteSignificance::Far]));
+	}
+
+#if ENABLE_DRAW_DEBUG
+	if (CVarSignificanceDebug.GetValueOnGameThread() < 2) return;
+
+	UWorld* World = GetWorld();
+	for (const FSignificanceEntry& Entry : Entries)
+	{
+		if (const ASpriteCharacterActor* Sprite = Entry.Sprite.Get())
+		{
+			const FVector Top = Sprite->GetActorLocation() + FVector(0, 0, Sprite->SpriteSize.Y + 16.f);
+			DrawDebugPoint(World, Top, 10.f, BucketColors[(int32)Sprite->Significance]);
+		}
+	}
+#endif
+}
+#endif
@@ -0,0 +1,89 @@
+// SpriteSignificanceSubsystem.h — Distance / screen-size update LOD for sprite characters.
+// Every sprite used to get full-rate animation, owner tracking (move interpolation + ground
+// snap), occlusion traces and a blob shadow no matter how far from the camera it was. This
+// subsystem ranks the registered sprites by approximate on-screen height a few times per
+// second and sorts them into buckets:
+//
+//   Full     — the N largest on screen: everything, every frame.
+//   Reduced  — the next M: animation steps two cells at a time, tracking every 2nd frame,
+//              no occlusion traces.
+//   Far      — the rest, anything beyond Sprite.SignificanceFarDistance, under
+//              Sprite.SignificanceMinScreenSize or off screen: animation steps three cells
+//              at a time, tracking every 4th frame, no occlusion traces, no blob shadow.
+//
+// N and M come from the Video option "Entity Detail" (UOptionsSubsystem::SetEntityDetail);
+// Sprite.SignificanceFullCount / ReducedCount override them. The local player's sprite is
+// always Full and does not use up the budget.
+// Sprite.SignificanceDebug 1 shows bucket populations on screen, 2 also marks each sprite.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SpriteSignificanceSubsystem.generated.h"
+
+class ASpriteCharacterActor;
+
+enum class ESpriteSignificance : uint8
+{
+	Full,
+	Reduced,
+	Far,
+	Num
+};
+
+UCLASS()
+class SABRIMMO_API USpriteSignificanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	void Register(ASpriteCharacterActor* Sprite);
+	void Unregister(ASpriteCharacterActor* Sprite);
+
+	/** Entity Detail option: 0 = Ultra .. 4 = Very Low (same scale as Sprite Quality) */
+	void SetDetailLevel(int32 Level);
+	int32 GetDetailLevel() const { return DetailLevel; }
+
+	/** Frame-cell stride and owner-tracking interval (frames) for a bucket */
+	static int32 GetFrameStride(ESpriteSignificance Bucket);
+	static int32 GetTrackingInterval(ESpriteSignificance Bucket);
+
+	int32 Num() const { return Entries.Num(); }
+	void LogStats() const;
+
+private:
+	struct FSignificanceEntry
+	{
+		TWeakObjectPtr<ASpriteCharacterActor> Sprite;
+		float ScreenSize = 0.f;   // approximate fraction of the view height, 0 = off screen
+		float Distance = 0.f;
+	};
+
+	/** Rank every sprite and move the ones whose bucket changed */
+	void Evaluate();
+	void ApplyBucket(ASpriteCharacterActor* Sprite, ESpriteSignificance Bucket);
+	void GetBudgets(int32& OutFull, int32& OutReduced) const;
+
+#if !UE_BUILD_SHIPPING
+	void DrawDebug() const;
+#endif
+
+	TArray<FSignificanceEntry> Entries;
+	int32 DetailLevel = 2;
+	double NextEvaluateTime = 0.0;
+
+	// Scratch
+	TArray<int32> Order;
+
+	// Last evaluation, for Sprite.SignificanceStats and the debug overlay
+	int32 BucketCounts[(int32)ESpriteSignificance::Num] = {};
+	int32 LastChanged = 0;
+	int32 LastFullBudget = 0;
+	int32 LastReducedBudget = 0;
+};
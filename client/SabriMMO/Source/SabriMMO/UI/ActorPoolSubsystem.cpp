@@ -0,0 +1,285 @@
+// ActorPoolSubsystem.cpp — Pooled enemy / player sprites and ground items (see header).
+
+#include "ActorPoolSubsystem.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogActorPool, Log, All);
+
+DECLARE_STATS_GROUP(TEXT("ActorPool"), STATGROUP_ActorPool, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pool hits"), STAT_ActorPool_Hits, STATGROUP_ActorPool);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pool misses (spawned)"), STAT_ActorPool_Misses, STATGROUP_ActorPool);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pre-warm spawns"), STAT_ActorPool_Prewarmed, STATGROUP_ActorPool);
+
+static TAutoConsoleVariable<int32> CVarPoolEnabled(
+	TEXT("Pool.Enabled"),
+	1,
+	TEXT("1 = released enemy / player sprites and ground items are parked for reuse (default).\n")
+	TEXT("0 = destroy on release and spawn on every acquire."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarPoolMaxIdle(
+	TEXT("Pool.MaxIdlePerType"),
+	64,
+	TEXT("Idle actors kept per pool; releases beyond this are destroyed."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarPoolPrewarmPerFrame(
+	TEXT("Pool.PrewarmPerFrame"),
+	4,
+	TEXT("Pre-warm spawns per frame (zone:spawn_manifest requests are spread over frames)."),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorldAndArgs GActorPoolStatsCmd(
+	TEXT("Pool.Stats"),
+	TEXT("Print idle / live counts and hit / miss totals for every actor pool."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UActorPoolSubsystem* Sub = World ? World->GetSubsystem<UActorPoolSubsystem>() : nullptr)
+		{
+			Sub->LogStats();
+		}
+	}));
+
+// ============================================================
+// Lifecycle
+// ============================================================
+
+bool UActorPoolSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld();
+}
+
+void UActorPoolSubsystem::Deinitialize()
+{
+	// Idle actors belong to the level and go with it
+	Pools.Empty();
+	Members.Empty();
+	PrewarmQueue.Empty();
+	Super::Deinitialize();
+}
+
+TStatId UActorPoolSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UActorPoolSubsystem, STATGROUP_Tickables);
+}
+
+bool UActorPoolSubsystem::IsEnabled()
+{
+	return CVarPoolEnabled.GetValueOnGameThread() != 0;
+}
+
+// ============================================================
+// Acquire / release
+// ============================================================
+
+AActor* UActorPoolSubsystem::Acquire(const FActorPoolKey& Key, const FVector& Location, FName Affinity, bool* bOutAffinityHit)
+{
+	if (bOutAffinityHit) *bOutAffinityHit = false;
+	if (!Key.Class) return nullptr;
+
+	FPool& Pool = Pools.FindOrAdd(Key);
+	Pool.Idle.RemoveAll([](const FIdleActor& Entry) { return !Entry.Actor.IsValid(); });
+
+	// Prefer the most recently parked actor still bound to Affinity, else the most recent one
+	int32 Pick = INDEX_NONE;
+	bool bAffinityHit = false;
+	if (IsEnabled() && Pool.Idle.Num() > 0)
+	{
+		Pick = Affinity.IsNone() ? INDEX_NONE
+			: Pool.Idle.FindLastByPredicate([Affinity](const FIdleActor& Entry) { return Entry.Affinity == Affinity; });
+		bAffinityHit = Pick != INDEX_NONE;
+		if (Pick == INDEX_NONE)
+			Pick = Pool.Idle.Num() - 1;
+	}
+
+	AActor* Actor = nullptr;
+	if (Pick != INDEX_NONE)
+	{
+		Actor = Pool.Idle[Pick].Actor.Get();
+		Pool.Idle.RemoveAt(Pick, 1, EAllowShrinking::No);
+
+		Actor->SetActorLocationAndRotation(Location, FRotator::ZeroRotator, false, nullptr, ETeleportType::TeleportPhysics);
+		Actor->SetActorHiddenInGame(false);
+		Actor->SetActorEnableCollision(true);
+		Cast<IPooledActor>(Actor)->OnAcquiredFromPool();
+
+		++Pool.Stats.Hits;
+		if (bAffinityHit) ++Pool.Stats.AffinityHits;
+		INC_DWORD_STAT(STAT_ActorPool_Hits);
+	}
+	else
+	{
+		Actor = SpawnPooled(Key, Location);
+		if (!Actor) return nullptr;
+
+		++Pool.Stats.Misses;
+		INC_DWORD_STAT(STAT_ActorPool_Misses);
+	}
+
+	FMembership& Member = Members.FindOrAdd(Actor);
+	Member.Key = Key;
+	Member.Affinity = Affinity;
+	Member.bIdle = false;
+
+	if (bOutAffinityHit) *bOutAffinityHit = bAffinityHit;
+	return Actor;
+}
+
+void UActorPoolSubsystem::Release(AActor* Actor)
+{
+	if (!IsValid(Actor)) return;
+
+	FMembership* Member = Members.Find(Actor);
+	if (Member && Member->bIdle) return;  // already parked
+
+	FPool* Pool = Member ? Pools.Find(Member->Key) : nullptr;
+	if (!Pool || !IsEnabled() || !Actor->Implements<UPooledActor>()
+		|| Pool->Idle.Num() >= CVarPoolMaxIdle.GetValueOnGameThread())
+	{
+		if (Pool) ++Pool->Stats.Discarded;
+		Members.Remove(Actor);
+		Actor->Destroy();
+		return;
+	}
+
+	++Pool->Stats.Released;
+	Park(Actor, *Pool, *Member);
+}
+
+AActor* UActorPoolSubsystem::SpawnPooled(const FActorPoolKey& Key, const FVector& Location)
+{
+	UWorld* World = GetWorld();
+	if (!World) return nullptr;
+
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	return World->SpawnActor<AActor>(Key.Class, Location, FRotator::ZeroRotator, Params);
+}
+
+void UActorPoolSubsystem::Park(AActor* Actor, FPool& Pool, FMembership& Member)
+{
+	Cast<IPooledActor>(Actor)->OnReleasedToPool();
+
+	Actor->SetActorHiddenInGame(true);
+	Actor->SetActorEnableCollision(false);
+	Actor->SetActorTickEnabled(false);
+
+	Member.bIdle = true;
+	Pool.Idle.Add({ Actor, Member.Affinity });
+}
+
+// ============================================================
+// Pre-warm
+// ============================================================
+
+void UActorPoolSubsystem::Prewarm(const FActorPoolKey& Key, int32 Count, FName Affinity, TFunction<void(AActor*)> Init)
+{
+	if (!IsEnabled() || !Key.Class || !Key.Class->ImplementsInterface(UPooledActor::StaticClass())) return;
+
+	const int32 Room = CVarPoolMaxIdle.GetValueOnGameThread() - Pools.FindOrAdd(Key).Idle.Num();
+	const int32 Wanted = FMath::Min(Count - NumIdle(Key, Affinity), Room);
+
+	for (FPrewarmRequest& Request : PrewarmQueue)
+	{
+		if (Request.Key == Key && Request.Affinity == Affinity)
+		{
+			Request.Remaining = FMath::Max(Request.Remaining, Wanted);
+			return;
+		}
+	}
+	if (Wanted <= 0) return;
+
+	FPrewarmRequest& Request = PrewarmQueue.AddDefaulted_GetRef();
+	Request.Key = Key;
+	Request.Affinity = Affinity;
+	Request.Remaining = Wanted;
+	Request.Init = MoveTemp(Init);
+}
+
+void UActorPoolSubsystem::Tick(float DeltaTime)
+{
+	if (PrewarmQueue.Num() == 0) return;
+	if (!IsEnabled())
+	{
+		PrewarmQueue.Reset();
+		return;
+	}
+
+	const int32 MaxIdle = CVarPoolMaxIdle.GetValueOnGameThread();
+	int32 Budget = FMath::Max(1, CVarPoolPrewarmPerFrame.GetValueOnGameThread());
+	while (Budget > 0 && PrewarmQueue.Num() > 0)
+	{
+		FPrewarmRequest& Request = PrewarmQueue[0];
+		FPool& Pool = Pools.FindOrAdd(Request.Key);
+		if (Request.Remaining <= 0 || Pool.Idle.Num() >= MaxIdle)
+		{
+			PrewarmQueue.RemoveAt(0);
+			continue;
+		}
+
+		--Request.Remaining;
+		--Budget;
+
+		AActor* Actor = SpawnPooled(Request.Key, FVector::ZeroVector);
+		if (!Actor) continue;
+		if (Request.Init) Request.Init(Actor);
+
+		FMembership& Member = Members.Add(Actor);
+		Member.Key = Request.Key;
+		Member.Affinity = Request.Affinity;
+
+		++Pool.Stats.Prewarmed;
+		INC_DWORD_STAT(STAT_ActorPool_Prewarmed);
+		Park(Actor, Pool, Member);
+	}
+}
+
+// ============================================================
+// Metrics
+// ============================================================
+
+int32 UActorPoolSubsystem::NumIdle(const FActorPoolKey& Key, FName Affinity) const
+{
+	const FPool* Pool = Pools.Find(Key);
+	if (!Pool) return 0;
+
+	int32 Count = 0;
+	for (const FIdleActor& Entry : Pool->Idle)
+	{
+		if (Entry.Affinity == Affinity && Entry.Actor.IsValid()) ++Count;
+	}
+	return Count;
+}
+
+FActorPoolStats UActorPoolSubsystem::GetStats(const FActorPoolKey& Key) const
+{
+	const FPool* Pool = Pools.Find(Key);
+	if (!Pool) return FActorPoolStats();
+
+	FActorPoolStats Stats = Pool->Stats;
+	Stats.Idle = Pool->Idle.Num();
+	for (const auto& Pair : Members)
+	{
+		if (!Pair.Value.bIdle && Pair.Value.Key == Key && Pair.Key.IsValid()) ++Stats.Live;
+	}
+	return Stats;
+}
+
+void UActorPoolSubsystem::LogStats() const
+{
+	UE_LOG(LogActorPool, Log, TEXT("Actor pools: %d pools, %d pre-warm requests queued, pooling %s"),
+		Pools.Num(), PrewarmQueue.Num(), IsEnabled() ? TEXT("on") : TEXT("off"));
+
+	for (const auto& Pair : Pools)
+	{
+		const FActorPoolStats Stats = GetStats(Pair.Key);
+		const uint64 Acquires = Stats.Hits + Stats.Misses;
+		UE_LOG(LogActorPool, Log,
+			TEXT("  %s[%s]: idle %d, live %d, hits %llu (%llu same affinity), misses %llu, hit rate %.0f%%, released %llu, discarded %llu, prewarmed %llu"),
+			*GetNameSafe(Pair.Key.Class), *Pair.Key.Tag.ToString(), Stats.Idle, Stats.Live,
+			Stats.Hits, Stats.AffinityHits, Stats.Misses, Acquires ? 100.0 * Stats.Hits / Acquires : 0.0,
+			Stats.Released, Stats.Discarded, Stats.Prewarmed);
+	}
+}
@@ -0,0 +1,137 @@
+// ActorPoolSubsystem.h — Reuse of the actors the entity subsystems spawn over and over.
+//
+// An enemy or remote-player sprite is nine procedural mesh layers, a blob shadow decal and a
+// material instance per layer; spawning a respawn wave or walking into a crowded town built
+// all of that on the game thread. Enemy sprites (after the corpse linger), remote player
+// sprites (player left / job change) and ground items (picked up / despawned) now go back
+// into a per-type idle list here instead of being destroyed, and the next spawn of that type
+// takes one out.
+//
+// Pools are keyed by class + tag (instanced enemy sprites and player sprites never mix).
+// Actors also remember an affinity — the body class they were last bound to — and Acquire
+// prefers an idle actor with the requested affinity so the atlas binding can be kept.
+// EnemySubsystem pre-warms per-class counts from the server's zone:spawn_manifest.
+//
+// Pooled classes implement IPooledActor to drop per-use state on release and re-register
+// with the per-frame systems on acquire. The caller rebinds everything else.
+// Pool.Stats prints hits / misses per pool.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ActorPoolSubsystem.generated.h"
+
+UINTERFACE(MinimalAPI, meta = (CannotImplementInterfaceInBlueprint))
+class UPooledActor : public UInterface
+{
+	GENERATED_BODY()
+};
+
+class SABRIMMO_API IPooledActor
+{
+	GENERATED_BODY()
+
+public:
+	/** Taken out of the pool (already unhidden and moved). Re-register with per-frame systems. */
+	virtual void OnAcquiredFromPool() = 0;
+
+	/** Going back into the pool: drop delegates, registrations and per-use state. */
+	virtual void OnReleasedToPool() = 0;
+};
+
+struct FActorPoolKey
+{
+	UClass* Class = nullptr;
+	FName Tag;
+
+	bool operator==(const FActorPoolKey& Other) const { return Class == Other.Class && Tag == Other.Tag; }
+	friend uint32 GetTypeHash(const FActorPoolKey& Key) { return HashCombine(GetTypeHash(Key.Class), GetTypeHash(Key.Tag)); }
+};
+
+struct FActorPoolStats
+{
+	int32 Idle = 0;
+	int32 Live = 0;             // acquired and not yet released
+	uint64 Hits = 0;            // served from the idle list
+	uint64 AffinityHits = 0;    // ... by an actor already bound to the requested affinity
+	uint64 Misses = 0;          // had to spawn
+	uint64 Released = 0;
+	uint64 Discarded = 0;       // destroyed on release (pool full or pooling off)
+	uint64 Prewarmed = 0;
+};
+
+UCLASS()
+class SABRIMMO_API UActorPoolSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	static bool IsEnabled();
+
+	/**
+	 * Idle actor of Key moved to Location (one last bound to Affinity if there is one), or a
+	 * fresh spawn. bOutAffinityHit is true when the actor is still bound to Affinity.
+	 */
+	AActor* Acquire(const FActorPoolKey& Key, const FVector& Location, FName Affinity = NAME_None, bool* bOutAffinityHit = nullptr);
+
+	template<typename T>
+	T* Acquire(FName Tag, const FVector& Location, FName Affinity = NAME_None, bool* bOutAffinityHit = nullptr)
+	{
+		return Cast<T>(Acquire(FActorPoolKey{ T::StaticClass(), Tag }, Location, Affinity, bOutAffinityHit));
+	}
+
+	/** Hand an acquired actor back. Destroyed instead if it isn't poolable, the pool is full or pooling is off. */
+	void Release(AActor* Actor);
+
+	/** Top the idle list for Key + Affinity up to Count over the next frames. Init binds each new actor. */
+	void Prewarm(const FActorPoolKey& Key, int32 Count, FName Affinity, TFunction<void(AActor*)> Init);
+
+	/** Pre-warm spawns still queued (the zone loading screen waits for them) */
+	bool IsPrewarming() const { return PrewarmQueue.Num() > 0; }
+
+	int32 NumIdle(const FActorPoolKey& Key, FName Affinity) const;
+	FActorPoolStats GetStats(const FActorPoolKey& Key) const;
+	void LogStats() const;
+
+private:
+	struct FIdleActor
+	{
+		TWeakObjectPtr<AActor> Actor;
+		FName Affinity;
+	};
+
+	struct FPool
+	{
+		TArray<FIdleActor> Idle;
+		FActorPoolStats Stats;
+	};
+
+	struct FMembership
+	{
+		FActorPoolKey Key;
+		FName Affinity;
+		bool bIdle = false;
+	};
+
+	struct FPrewarmRequest
+	{
+		FActorPoolKey Key;
+		FName Affinity;
+		int32 Remaining = 0;
+		TFunction<void(AActor*)> Init;
+	};
+
+	AActor* SpawnPooled(const FActorPoolKey& Key, const FVector& Location);
+	void Park(AActor* Actor, FPool& Pool, FMembership& Member);
+
+	TMap<FActorPoolKey, FPool> Pools;
+	TMap<TWeakObjectPtr<AActor>, FMembership> Members;
+	TArray<FPrewarmRequest> PrewarmQueue;
+};
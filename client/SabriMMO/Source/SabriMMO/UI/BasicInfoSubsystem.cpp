@@ -45,10 +45,10 @@ void UBasicInfoSubsystem::OnWorldBeginPlay(UWorld& InWorld)
 	{
 		Router->RegisterHandler(TEXT("combat:health_update"), this,
 			[this](const TSharedPtr<FJsonValue>& D) { HandleHealthUpdate(D); });
-		Router->RegisterHandler(TEXT("combat:damage"), this,
-			[this](const TSharedPtr<FJsonValue>& D) { HandleCombatDamage(D); });
-		Router->RegisterHandler(TEXT("skill:effect_damage"), this,
-			[this](const TSharedPtr<FJsonValue>& D) { HandleCombatDamage(D); });
+		Router->RegisterTypedHandler<FCombatDamageEvent>(TEXT("combat:damage"), this,
+			[this](const FCombatDamageEvent& Ev) { HandleCombatDamage(Ev); });
+		Router->RegisterTypedHandler<FCombatDamageEvent>(TEXT("skill:effect_damage"), this,
+			[this](const FCombatDamageEvent& Ev) { HandleCombatDamage(Ev); });
 		Router->RegisterHandler(TEXT("combat:death"), this,
 			[this](const TSharedPtr<FJsonValue>& D) { HandleCombatDeath(D); });
 		Router->RegisterHandler(TEXT("combat:respawn"), this,
@@ -194,30 +194,16 @@ void UBasicInfoSubsystem::HandleHealthUpdate(const TSharedPtr<FJsonValue>& Data)
 	MaxSP     = FMath::Max((int32)MM, 1);
 }
 
-void UBasicInfoSubsystem::HandleCombatDamage(const TSharedPtr<FJsonValue>& Data)
+void UBasicInfoSubsystem::HandleCombatDamage(const FCombatDamageEvent& Ev)
 {
-	if (!Data.IsValid()) return;
-	const TSharedPtr<FJsonObject>* ObjPtr = nullptr;
-	if (!Data->TryGetObject(ObjPtr) || !ObjPtr) return;
-	const TSharedPtr<FJsonObject>& Obj = *ObjPtr;
-
 	// Only update if WE are the target
-	double TargetIdD = 0;
-	Obj->TryGetNumberField(TEXT("targetId"), TargetIdD);
-	int32 TargetId = (int32)TargetIdD;
-	if (LocalCharacterId > 0 && TargetId != LocalCharacterId) return;
+	if (LocalCharacterId > 0 && Ev.TargetId != LocalCharacterId) return;
 
 	// combat:damage uses isEnemy — skip if this is an enemy target
-	bool bIsEnemy = false;
-	Obj->TryGetBoolField(TEXT("isEnemy"), bIsEnemy);
-	if (bIsEnemy) return;
-
-	double TH = 0, TMH = 0;
-	Obj->TryGetNumberField(TEXT("targetHealth"),    TH);
-	Obj->TryGetNumberField(TEXT("targetMaxHealth"), TMH);
+	if (Ev.bIsEnemy) return;
 
-	CurrentHP = FMath::Max((int32)TH, 0);
-	if ((int32)TMH > 0) MaxHP = (int32)TMH;
+	CurrentHP = FMath::Max(Ev.TargetHealth, 0);
+	if (Ev.TargetMaxHealth > 0) MaxHP = Ev.TargetMaxHealth;
 
 	UE_LOG(LogBasicInfo, Verbose, TEXT("HandleCombatDamage — HP: %d/%d"), CurrentHP, MaxHP);
 }
@@ -7,6 +7,7 @@
 #include "Subsystems/WorldSubsystem.h"
 #include "Dom/JsonValue.h"
 #include "Dom/JsonObject.h"
+#include "SocketEventTypes.h"
 #include "BasicInfoSubsystem.generated.h"
 
 class SBasicInfoWidget;
@@ -52,7 +53,7 @@ public:
 private:
 	// ---- event handlers ----
 	void HandleHealthUpdate(const TSharedPtr<FJsonValue>& Data);
-	void HandleCombatDamage(const TSharedPtr<FJsonValue>& Data);
+	void HandleCombatDamage(const FCombatDamageEvent& Ev);
 	void HandleCombatDeath(const TSharedPtr<FJsonValue>& Data);
 	void HandleCombatRespawn(const TSharedPtr<FJsonValue>& Data);
 	void HandlePlayerStats(const TSharedPtr<FJsonValue>& Data);
@@ -22,7 +22,6 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Blueprint/AIBlueprintHelperLibrary.h"
 #include "NavigationSystem.h"
-#include "Kismet/GameplayStatics.h"
 #include "Sound/SoundBase.h"
 #include "TimerManager.h"
 #include "Widgets/SCompoundWidget.h"
@@ -303,8 +302,8 @@ void UCombatActionSubsystem::OnWorldBeginPlay(UWorld& InWorld)
 	LocalCharacterId = SelChar.CharacterId;
 
 	// Register ALL combat event handlers (C1: this subsystem is the sole owner)
-	Router->RegisterHandler(TEXT("combat:damage"), this,
-		[this](const TSharedPtr<FJsonValue>& D) { HandleCombatDamage(D); });
+	Router->RegisterTypedHandler<FCombatDamageEvent>(TEXT("combat:damage"), this,
+		[this](const FCombatDamageEvent& Ev) { HandleCombatDamage(Ev); });
 	Router->RegisterHandler(TEXT("combat:auto_attack_started"), this,
 		[this](const TSharedPtr<FJsonValue>& D) { HandleAutoAttackStarted(D); });
 	Router->RegisterHandler(TEXT("combat:auto_attack_stopped"), this,
@@ -368,6 +367,7 @@ void UCombatActionSubsystem::Deinitialize()
 	HideDeathOverlay();
 	bReadyToProcess = false;
 	bIsAutoAttacking = false;
+	AttackAnimBindings.Reset();
 
 	Super::Deinitialize();
 }
@@ -376,57 +376,33 @@ void UCombatActionSubsystem::Deinitialize()
 // HandleCombatDamage — rotation + attack animation (replaces 215-node BP)
 // ============================================================
 
-void UCombatActionSubsystem::HandleCombatDamage(const TSharedPtr<FJsonValue>& Data)
+void UCombatActionSubsystem::HandleCombatDamage(const FCombatDamageEvent& Ev)
 {
-	if (!bReadyToProcess || !Data.IsValid()) return;
+	if (!bReadyToProcess) return;
 
-	const TSharedPtr<FJsonObject>* ObjPtr = nullptr;
-	if (!Data->TryGetObject(ObjPtr) || !ObjPtr) return;
-	const TSharedPtr<FJsonObject>& Obj = *ObjPtr;
-
-	// Parse fields
-	double AttackerIdD = 0, TargetIdD = 0;
-	Obj->TryGetNumberField(TEXT("attackerId"), AttackerIdD);
-	Obj->TryGetNumberField(TEXT("targetId"), TargetIdD);
-	int32 AttackerId = (int32)AttackerIdD;
-	int32 TargetId = (int32)TargetIdD;
-
-	bool bIsEnemy = false;
-	Obj->TryGetBoolField(TEXT("isEnemy"), bIsEnemy);
-
-	FString HitType;
-	Obj->TryGetStringField(TEXT("hitType"), HitType);
+	const int32 AttackerId = Ev.AttackerId;
+	const int32 TargetId = Ev.TargetId;
+	const bool bIsEnemy = Ev.bIsEnemy;
 
 	// Server-supplied attacker weapon type (for player attackers — drives weapon-type
 	// swing/hit SFX path; falls back to per-class sound if missing or unmapped).
-	FString AttackerWeaponType;
-	Obj->TryGetStringField(TEXT("attackerWeaponType"), AttackerWeaponType);
-
-	FString DamageElement;
-	Obj->TryGetStringField(TEXT("element"), DamageElement);
+	const FString& AttackerWeaponType = Ev.AttackerWeaponType;
+	const FString& DamageElement = Ev.Element;
 
 	// Update target frame HP from damage events
-	if (bTargetFrameVisible)
+	if (bTargetFrameVisible && Ev.bHasTargetHealth && TargetId == LockedTargetId)
 	{
-		double THP = 0, TMH = 0;
-		if (Obj->TryGetNumberField(TEXT("targetHealth"), THP))
-		{
-			Obj->TryGetNumberField(TEXT("targetMaxHealth"), TMH);
-			if (TargetId == LockedTargetId)
-			{
-				TargetFrameHP = (float)THP;
-				TargetFrameMaxHP = (float)TMH;
-			}
-		}
+		TargetFrameHP = (float)Ev.TargetHealth;
+		TargetFrameMaxHP = (float)Ev.TargetMaxHealth;
 	}
 
 	// Skip animation for misses
-	if (HitType == TEXT("miss") || HitType == TEXT("dodge") || HitType == TEXT("perfectDodge"))
+	if (Ev.IsMiss())
 		return;
 
 	// Heal events flow through the same handler — track separately so we play the heal
 	// sound at the target instead of the hit/body reaction sounds.
-	const bool bIsHeal = (HitType == TEXT("heal"));
+	const bool bIsHeal = Ev.IsHeal();
 
 	// Resolve attacker actor
 	AActor* Attacker = nullptr;
@@ -506,9 +482,8 @@ void UCombatActionSubsystem::HandleCombatDamage(const TSharedPtr<FJsonValue>& Da
 		}
 	}
 
-	// Parse crit flag (used by particles + sound)
-	bool bIsCritical = false;
-	Obj->TryGetBoolField(TEXT("isCritical"), bIsCritical);
+	// Crit flag (used by particles + sound)
+	const bool bIsCritical = Ev.bIsCritical;
 
 	// ---- Hit / heal / body reaction sounds at target ----
 	if (Target && Audio)
@@ -562,7 +537,7 @@ void UCombatActionSubsystem::HandleCombatDamage(const TSharedPtr<FJsonValue>& Da
 
 			// Legacy fallback hit sound for enemy targets (since the monster's own
 			// damage sound covers most of it but the original NormalHitSounds add weight).
-			// Routed through the SFX volume bus so the Options slider controls it.
+			// Goes through the audio voice manager (SFX bus, Damage cap, voice budget).
 			if (bIsEnemy || TargetId >= 2000000)
 			{
 				USoundBase* HitSound = nullptr;
@@ -572,9 +547,8 @@ void UCombatActionSubsystem::HandleCombatDamage(const TSharedPtr<FJsonValue>& Da
 					HitSound = NormalHitSounds[FMath::RandRange(0, NormalHitSounds.Num() - 1)];
 				if (HitSound)
 				{
-					const float SfxVol = Audio ? Audio->GetEffectiveSfxVolume() : 1.0f;
-					UGameplayStatics::PlaySoundAtLocation(GetWorld(), HitSound,
-						TargetLoc, SfxVol, FMath::FRandRange(0.95f, 1.05f));
+					Audio->PlayCombatSound(HitSound, TargetLoc, EMonsterSoundType::Damage,
+						FMath::FRandRange(0.95f, 1.05f));
 				}
 			}
 		}
@@ -620,7 +594,7 @@ void UCombatActionSubsystem::HandleCombatDamage(const TSharedPtr<FJsonValue>& Da
 		{
 			FVector VFXPos = TargetSprite->GetActorLocation();
 			VFXPos.Z += TargetSprite->SpriteSize.Y * 0.5f;  // Halfway up the sprite
-			VFX->SpawnAutoAttackHitEffect(VFXPos, bIsCritical);
+			VFX->SpawnAutoAttackHitEffect(VFXPos, bIsCritical, AttackerId, TargetId);
 		}
 	}
 	else if (Target)
@@ -628,7 +602,7 @@ void UCombatActionSubsystem::HandleCombatDamage(const TSharedPtr<FJsonValue>& Da
 		// Non-sprite target (BP actor) — spawn particles at actor location
 		if (USkillVFXSubsystem* VFX = GetWorld()->GetSubsystem<USkillVFXSubsystem>())
 		{
-			VFX->SpawnAutoAttackHitEffect(Target->GetActorLocation(), bIsCritical);
+			VFX->SpawnAutoAttackHitEffect(Target->GetActorLocation(), bIsCritical, AttackerId, TargetId);
 		}
 	}
 }
@@ -950,35 +924,21 @@ AActor* UCombatActionSubsystem::FindPlayerActor(int32 CharacterId)
 // Attack Animation
 // ============================================================
 
+void FAttackAnimBPBindings::Bind(const UClass* Class)
+{
+	PlayAttackAnimation.Bind(Class, TEXT("PlayAttackAnimation"));
+	InTargetPosition.Bind(PlayAttackAnimation.Get(), TEXT("InTargetPosition"));
+}
+
 void UCombatActionSubsystem::PlayAttackAnimationOnActor(AActor* Actor, const FVector& TargetPosition)
 {
 	if (!Actor) return;
 
-	UFunction* Func = Actor->FindFunction(TEXT("PlayAttackAnimation"));
-	if (!Func) return;
-
-	if (Func->ParmsSize > 0)
-	{
-		// BP_MMOCharacter's PlayAttackAnimation takes InTargetPosition (FVector).
-		// It calls FindLookAtRotation + SetActorRotation + Montage Play.
-		uint8* Params = (uint8*)FMemory_Alloca(Func->ParmsSize);
-		FMemory::Memzero(Params, Func->ParmsSize);
-
-		// Set the InTargetPosition parameter via reflection
-		FStructProperty* VecProp = CastField<FStructProperty>(
-			Func->FindPropertyByName(TEXT("InTargetPosition")));
-		if (VecProp && VecProp->Struct == TBaseStructure<FVector>::Get())
-		{
-			*VecProp->ContainerPtrToValuePtr<FVector>(Params) = TargetPosition;
-		}
-
-		Actor->ProcessEvent(Func, Params);
-	}
-	else
-	{
-		// Parameterless function (e.g. BP_EnemyCharacter) — nullptr is safe
-		Actor->ProcessEvent(Func, nullptr);
-	}
+	// BP_MMOCharacter's PlayAttackAnimation calls FindLookAtRotation + SetActorRotation + Montage Play
+	const FAttackAnimBPBindings& BP = AttackAnimBindings.Get(Actor);
+	FBPCallFrame(BP.PlayAttackAnimation)
+		.Set(BP.InTargetPosition, TargetPosition)
+		.Call(Actor);
 }
 
 // ============================================================
@@ -8,8 +8,20 @@
 #include "Subsystems/WorldSubsystem.h"
 #include "Dom/JsonValue.h"
 #include "Dom/JsonObject.h"
+#include "SocketEventTypes.h"
+#include "BlueprintBindings.h"
 #include "CombatActionSubsystem.generated.h"
 
+// PlayAttackAnimation on the attacker's BP, resolved once per class. BP_MMOCharacter's takes
+// InTargetPosition; BP_EnemyCharacter's takes nothing (the parameter handle stays unbound).
+struct FAttackAnimBPBindings
+{
+	FBPFunction PlayAttackAnimation;
+	TBPVar<FVector> InTargetPosition;
+
+	void Bind(const UClass* Class);
+};
+
 UCLASS()
 class SABRIMMO_API UCombatActionSubsystem : public UWorldSubsystem
 {
@@ -66,7 +78,7 @@ private:
 	bool bReadyToProcess = false;
 
 	// ---- Socket event handlers ----
-	void HandleCombatDamage(const TSharedPtr<FJsonValue>& Data);
+	void HandleCombatDamage(const FCombatDamageEvent& Ev);
 	void HandleAutoAttackStarted(const TSharedPtr<FJsonValue>& Data);
 	void HandleAutoAttackStopped(const TSharedPtr<FJsonValue>& Data);
 	void HandleTargetLost(const TSharedPtr<FJsonValue>& Data);
@@ -83,6 +95,7 @@ private:
 
 	// ---- Animation ----
 	void PlayAttackAnimationOnActor(AActor* Actor, const FVector& TargetPosition);
+	TBPBindingCache<FAttackAnimBPBindings> AttackAnimBindings;
 
 	// ---- Widget management ----
 	void ShowTargetFrame();
@@ -7,12 +7,25 @@
 #include "CompanionVisualActor.h"
 #include "MMOGameInstance.h"
 #include "SocketEventRouter.h"
+#include "EntityRegistrySubsystem.h"
 #include "Engine/World.h"
 #include "GameFramework/PlayerController.h"
 #include "TimerManager.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogCompVis, Log, All);
 
+static void RegisterCompanion(UWorld* World, AActor* Actor)
+{
+	if (UEntityRegistrySubsystem* Registry = World->GetSubsystem<UEntityRegistrySubsystem>())
+		Registry->Register(EEntityCategory::Companion, (int32)Actor->GetUniqueID(), Actor);
+}
+
+static void UnregisterCompanion(UWorld* World, AActor* Actor)
+{
+	if (UEntityRegistrySubsystem* Registry = World ? World->GetSubsystem<UEntityRegistrySubsystem>() : nullptr)
+		Registry->UnregisterActor(Actor);
+}
+
 bool UCompanionVisualSubsystem::ShouldCreateSubsystem(UObject* Outer) const { return true; }
 
 void UCompanionVisualSubsystem::OnWorldBeginPlay(UWorld& InWorld)
@@ -103,13 +116,17 @@ void UCompanionVisualSubsystem::SpawnCart()
 	FActorSpawnParameters Params;
 	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
 	CartActor = World->SpawnActor<ACompanionVisualActor>(ACompanionVisualActor::StaticClass(), FTransform::Identity, Params);
-	if (CartActor) CartActor->InitShape(ECompanionShape::Cart);
+	if (CartActor)
+	{
+		CartActor->InitShape(ECompanionShape::Cart);
+		RegisterCompanion(World, CartActor);
+	}
 	UE_LOG(LogCompVis, Log, TEXT("Spawned cart placeholder"));
 }
 
 void UCompanionVisualSubsystem::DespawnCart()
 {
-	if (CartActor) { CartActor->Destroy(); CartActor = nullptr; }
+	if (CartActor) { UnregisterCompanion(GetWorld(), CartActor); CartActor->Destroy(); CartActor = nullptr; }
 }
 
 void UCompanionVisualSubsystem::SpawnMount()
@@ -121,13 +138,17 @@ void UCompanionVisualSubsystem::SpawnMount()
 	FActorSpawnParameters Params;
 	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
 	MountActor = World->SpawnActor<ACompanionVisualActor>(ACompanionVisualActor::StaticClass(), FTransform::Identity, Params);
-	if (MountActor) MountActor->InitShape(ECompanionShape::Mount);
+	if (MountActor)
+	{
+		MountActor->InitShape(ECompanionShape::Mount);
+		RegisterCompanion(World, MountActor);
+	}
 	UE_LOG(LogCompVis, Log, TEXT("Spawned mount placeholder"));
 }
 
 void UCompanionVisualSubsystem::DespawnMount()
 {
-	if (MountActor) { MountActor->Destroy(); MountActor = nullptr; }
+	if (MountActor) { UnregisterCompanion(GetWorld(), MountActor); MountActor->Destroy(); MountActor = nullptr; }
 }
 
 void UCompanionVisualSubsystem::SpawnFalcon()
@@ -139,13 +160,17 @@ void UCompanionVisualSubsystem::SpawnFalcon()
 	FActorSpawnParameters Params;
 	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
 	FalconActor = World->SpawnActor<ACompanionVisualActor>(ACompanionVisualActor::StaticClass(), FTransform::Identity, Params);
-	if (FalconActor) FalconActor->InitShape(ECompanionShape::Falcon);
+	if (FalconActor)
+	{
+		FalconActor->InitShape(ECompanionShape::Falcon);
+		RegisterCompanion(World, FalconActor);
+	}
 	UE_LOG(LogCompVis, Log, TEXT("Spawned falcon placeholder"));
 }
 
 void UCompanionVisualSubsystem::DespawnFalcon()
 {
-	if (FalconActor) { FalconActor->Destroy(); FalconActor = nullptr; }
+	if (FalconActor) { UnregisterCompanion(GetWorld(), FalconActor); FalconActor->Destroy(); FalconActor = nullptr; }
 }
 
 // ============================================================
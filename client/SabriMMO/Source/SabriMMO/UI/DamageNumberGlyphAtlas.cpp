@@ -0,0 +1,193 @@
+// DamageNumberGlyphAtlas.cpp — Bakes damage-number digits and labels into a render target (see header).
+
+#include "DamageNumberGlyphAtlas.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "Engine/Canvas.h"
+#include "CanvasItem.h"
+#include "Kismet/KismetRenderingLibrary.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Fonts/FontMeasure.h"
+#include "Styling/CoreStyle.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogDamageGlyphAtlas, Log, All);
+
+static FSlateFontInfo GetBakeFont()
+{
+	return FCoreStyle::GetDefaultFontStyle("Bold", FDamageNumberGlyphAtlas::BAKE_FONT_SIZE);
+}
+
+// ============================================================
+// Construction — measure and place the digit cells
+// ============================================================
+
+FDamageNumberGlyphAtlas::FDamageNumberGlyphAtlas(UObject* InWorldContext)
+	: WorldContext(InWorldContext)
+{
+	if (!FSlateApplication::IsInitialized()) return;
+
+	TSharedRef<FSlateFontMeasure> FontMeasure =
+		FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
+	const FSlateFontInfo Font = GetBakeFont();
+
+	// Digits share one cell width (the widest) so numbers lay out monospaced like RO's bitmaps
+	float CellW = 0.f, CellH = 0.f;
+	for (int32 d = 0; d < 10; ++d)
+	{
+		const FVector2D Size = FontMeasure->Measure(FString::FromInt(d), Font);
+		DigitInkWidth[d] = (float)Size.X;
+		CellW = FMath::Max(CellW, (float)Size.X);
+		CellH = FMath::Max(CellH, (float)Size.Y);
+	}
+
+	const FVector2f DigitSize(CellW + BAKE_OUTLINE * 2.f, CellH + BAKE_OUTLINE * 2.f);
+	for (int32 d = 0; d < 10; ++d)
+	{
+		AllocateCell(DigitSize, Digits[d]);
+	}
+}
+
+bool FDamageNumberGlyphAtlas::AllocateCell(const FVector2f& Size, FDamageGlyph& OutGlyph)
+{
+	const int32 W = FMath::CeilToInt(Size.X);
+	const int32 H = FMath::CeilToInt(Size.Y);
+
+	if (CursorX + W + CELL_PADDING > ATLAS_WIDTH)
+	{
+		CursorX = CELL_PADDING;
+		CursorY += RowHeight + CELL_PADDING;
+		RowHeight = 0;
+	}
+	if (CursorY + H + CELL_PADDING > ATLAS_HEIGHT || W + CELL_PADDING * 2 > ATLAS_WIDTH)
+		return false;
+
+	OutGlyph.Origin = FVector2f((float)CursorX, (float)CursorY);
+	OutGlyph.Size = Size;
+	OutGlyph.UVMin = FVector2f(OutGlyph.Origin.X / ATLAS_WIDTH, OutGlyph.Origin.Y / ATLAS_HEIGHT);
+	OutGlyph.UVMax = FVector2f((OutGlyph.Origin.X + Size.X) / ATLAS_WIDTH, (OutGlyph.Origin.Y + Size.Y) / ATLAS_HEIGHT);
+
+	CursorX += W + CELL_PADDING;
+	RowHeight = FMath::Max(RowHeight, H);
+	return true;
+}
+
+// ============================================================
+// Labels
+// ============================================================
+
+int32 FDamageNumberGlyphAtlas::FindOrAddLabel(const FString& Text)
+{
+	for (int32 i = 0; i < Labels.Num(); ++i)
+	{
+		if (Labels[i].Text.Equals(Text, ESearchCase::CaseSensitive)) return i;
+	}
+
+	if (Text.IsEmpty() || !FSlateApplication::IsInitialized()) return INDEX_NONE;
+
+	const FVector2D Measured = FSlateApplication::Get().GetRenderer()->GetFontMeasureService()
+		->Measure(Text, GetBakeFont());
+
+	FLabel Label;
+	Label.Text = Text;
+	const FVector2f Size((float)Measured.X + BAKE_OUTLINE * 2.f, (float)Measured.Y + BAKE_OUTLINE * 2.f);
+	if (!AllocateCell(Size, Label.Glyph))
+	{
+		UE_LOG(LogDamageGlyphAtlas, Warning, TEXT("Glyph atlas full — label \"%s\" will not draw"), *Text);
+		return INDEX_NONE;
+	}
+
+	const int32 LabelId = Labels.Add(MoveTemp(Label));
+	if (bBaked)
+	{
+		Bake();
+	}
+	return LabelId;
+}
+
+// ============================================================
+// Bake — canvas draw into the render target
+// ============================================================
+
+bool FDamageNumberGlyphAtlas::Bake()
+{
+	UObject* Context = WorldContext.Get();
+	if (!Context) return false;
+
+	if (!Target)
+	{
+		Target = NewObject<UTextureRenderTarget2D>(GetTransientPackage());
+		Target->RenderTargetFormat = RTF_RGBA8;
+		Target->ClearColor = FLinearColor::Transparent;
+		Target->bAutoGenerateMips = false;
+		Target->InitAutoFormat(ATLAS_WIDTH, ATLAS_HEIGHT);
+		Target->UpdateResourceImmediate(true);
+
+		Brush.SetResourceObject(Target);
+		Brush.ImageSize = FVector2D(ATLAS_WIDTH, ATLAS_HEIGHT);
+		Brush.DrawAs = ESlateBrushDrawType::Image;
+		Brush.Tiling = ESlateBrushTileType::NoTile;
+	}
+	else
+	{
+		UKismetRenderingLibrary::ClearRenderTarget2D(Context, Target, FLinearColor::Transparent);
+	}
+
+	UCanvas* Canvas = nullptr;
+	FVector2D CanvasSize;
+	FDrawToRenderTargetContext DrawContext;
+	UKismetRenderingLibrary::BeginDrawCanvasToRenderTarget(Context, Target, Canvas, CanvasSize, DrawContext);
+	if (!Canvas)
+	{
+		UE_LOG(LogDamageGlyphAtlas, Warning, TEXT("Glyph atlas bake failed — no canvas for render target"));
+		return false;
+	}
+
+	const FSlateFontInfo Font = GetBakeFont();
+
+	// Outline: black copies at every offset within BAKE_OUTLINE, then the white fill on top.
+	// AlphaBlend writes destination alpha so the target stays transparent around the glyphs.
+	auto DrawGlyph = [Canvas, &Font](const FString& Text, const FVector2f& InkOrigin)
+	{
+		FCanvasTextItem Item(FVector2D::ZeroVector, FText::FromString(Text), Font, FLinearColor::Black);
+		Item.BlendMode = SE_BLEND_AlphaBlend;
+
+		const int32 R = BAKE_OUTLINE;
+		for (int32 dy = -R; dy <= R; ++dy)
+		{
+			for (int32 dx = -R; dx <= R; ++dx)
+			{
+				if ((dx == 0 && dy == 0) || dx * dx + dy * dy > R * R) continue;
+				Item.Position = FVector2D(InkOrigin.X + dx, InkOrigin.Y + dy);
+				Canvas->DrawItem(Item);
+			}
+		}
+
+		Item.Position = FVector2D(InkOrigin.X, InkOrigin.Y);
+		Item.SetColor(FLinearColor::White);
+		Canvas->DrawItem(Item);
+	};
+
+	for (int32 d = 0; d < 10; ++d)
+	{
+		const FDamageGlyph& G = Digits[d];
+		const float CellInkW = G.Size.X - BAKE_OUTLINE * 2.f;
+		DrawGlyph(FString::FromInt(d), FVector2f(
+			G.Origin.X + BAKE_OUTLINE + (CellInkW - DigitInkWidth[d]) * 0.5f,
+			G.Origin.Y + BAKE_OUTLINE));
+	}
+	for (const FLabel& Label : Labels)
+	{
+		DrawGlyph(Label.Text, Label.Glyph.Origin + FVector2f((float)BAKE_OUTLINE, (float)BAKE_OUTLINE));
+	}
+
+	UKismetRenderingLibrary::EndDrawCanvasToRenderTarget(Context, DrawContext);
+	bBaked = true;
+
+	UE_LOG(LogDamageGlyphAtlas, Log, TEXT("Damage glyph atlas baked: 10 digits + %d labels (%dx%d, rows used to y=%d)"),
+		Labels.Num(), ATLAS_WIDTH, ATLAS_HEIGHT, CursorY + RowHeight);
+	return true;
+}
+
+void FDamageNumberGlyphAtlas::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Collector.AddReferencedObject(Target);
+}
@@ -0,0 +1,77 @@
+// DamageNumberGlyphAtlas.h — Pre-baked RO-style bitmap glyphs for SDamageNumberOverlay.
+// Digits 0-9 and whole-word labels ("Miss", "Dodge", status text) are drawn once — white
+// fill, black outline — into a transparent render target. The overlay then renders every
+// pop as tinted textured quads in a single MakeCustomVerts batch instead of a MakeText
+// element per digit. Labels not known at bake time are appended on first use and the atlas
+// is re-baked (rare: the set of status names is small and fixed).
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/GCObject.h"
+#include "Styling/SlateBrush.h"
+
+class UTextureRenderTarget2D;
+
+/** One baked glyph cell */
+struct FDamageGlyph
+{
+	FVector2f Origin = FVector2f::ZeroVector;  // top-left in atlas pixels
+	FVector2f Size = FVector2f::ZeroVector;    // text + outline extent, atlas pixels at BAKE_FONT_SIZE
+	FVector2f UVMin = FVector2f::ZeroVector;
+	FVector2f UVMax = FVector2f::ZeroVector;
+};
+
+class FDamageNumberGlyphAtlas : public FGCObject
+{
+public:
+	/** Glyphs are baked at this font size; quads scale by FontSize / BAKE_FONT_SIZE */
+	static constexpr int32 BAKE_FONT_SIZE = 32;
+	static constexpr int32 BAKE_OUTLINE = 3;       // outline radius in atlas pixels
+	static constexpr int32 CELL_PADDING = 2;       // empty border between cells (no bilinear bleed)
+	static constexpr int32 ATLAS_WIDTH = 1024;
+	static constexpr int32 ATLAS_HEIGHT = 512;
+
+	/** WorldContext is used for the canvas draw into the render target */
+	explicit FDamageNumberGlyphAtlas(UObject* InWorldContext);
+
+	/** Label id for Text, allocating a cell if new (re-bakes if already baked). INDEX_NONE when full. */
+	int32 FindOrAddLabel(const FString& Text);
+
+	/** Draw every glyph into the render target (creating it on first call) */
+	bool Bake();
+
+	bool IsReady() const { return bBaked; }
+	const FDamageGlyph& GetDigit(int32 Digit) const { return Digits[Digit]; }
+	const FDamageGlyph* GetLabel(int32 LabelId) const { return Labels.IsValidIndex(LabelId) ? &Labels[LabelId].Glyph : nullptr; }
+	const FSlateBrush& GetBrush() const { return Brush; }
+
+	// FGCObject
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override { return TEXT("FDamageNumberGlyphAtlas"); }
+
+private:
+	struct FLabel
+	{
+		FString Text;
+		FDamageGlyph Glyph;
+	};
+
+	/** Reserve a cell of Size (shelf packing, left to right, top to bottom) */
+	bool AllocateCell(const FVector2f& Size, FDamageGlyph& OutGlyph);
+
+	TWeakObjectPtr<UObject> WorldContext;
+	TObjectPtr<UTextureRenderTarget2D> Target = nullptr;
+	FSlateBrush Brush;
+
+	FDamageGlyph Digits[10];
+	float DigitInkWidth[10] = {};   // measured width per digit, centered in the shared cell width
+	TArray<FLabel> Labels;
+
+	// Shelf packer cursor
+	int32 CursorX = CELL_PADDING;
+	int32 CursorY = CELL_PADDING;
+	int32 RowHeight = 0;
+
+	bool bBaked = false;
+};
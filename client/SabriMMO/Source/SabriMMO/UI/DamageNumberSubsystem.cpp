@@ -4,6 +4,8 @@
 
 #include "DamageNumberSubsystem.h"
 #include "SDamageNumberOverlay.h"
+#include "DamageNumberGlyphAtlas.h"
+#include "ScreenProjectionSubsystem.h"
 #include "MMOGameInstance.h"
 #include "SocketEventRouter.h"
 #include "Engine/World.h"
@@ -44,10 +46,10 @@ void UDamageNumberSubsystem::OnWorldBeginPlay(UWorld& InWorld)
 	USocketEventRouter* Router = GI->GetEventRouter();
 	if (Router)
 	{
-		Router->RegisterHandler(TEXT("combat:damage"), this,
-			[this](const TSharedPtr<FJsonValue>& D) { HandleCombatDamage(D); });
-		Router->RegisterHandler(TEXT("skill:effect_damage"), this,
-			[this](const TSharedPtr<FJsonValue>& D) { HandleCombatDamage(D); });
+		Router->RegisterTypedHandler<FCombatDamageEvent>(TEXT("combat:damage"), this,
+			[this](const FCombatDamageEvent& Ev) { HandleCombatDamage(Ev); });
+		Router->RegisterTypedHandler<FCombatDamageEvent>(TEXT("skill:effect_damage"), this,
+			[this](const FCombatDamageEvent& Ev) { HandleCombatDamage(Ev); });
 		Router->RegisterHandler(TEXT("combat:blocked"), this,
 			[this](const TSharedPtr<FJsonValue>& D) { HandleCombatBlocked(D); });
 		Router->RegisterHandler(TEXT("status:tick"), this,
@@ -106,8 +108,23 @@ void UDamageNumberSubsystem::ShowOverlay()
 		return;
 	}
 
+	// Glyph atlas: digits + every label we know up front, baked once before the first pop
+	GlyphAtlas = MakeShared<FDamageNumberGlyphAtlas>(this);
+	static const TCHAR* KnownStatuses[] = {
+		TEXT("poison"), TEXT("stun"), TEXT("freeze"), TEXT("blind"), TEXT("silence"), TEXT("stone"),
+		TEXT("petrifying"), TEXT("sleep"), TEXT("bleeding"), TEXT("confusion"), TEXT("curse")
+	};
+	for (const TCHAR* Status : KnownStatuses)
+	{
+		GlyphAtlas->FindOrAddLabel(GetStatusDisplayName(Status));
+	}
+
 	OverlayWidget = SNew(SDamageNumberOverlay)
-		.CritStarburstTexture(CritStarburstTexture);
+		.CritStarburstTexture(CritStarburstTexture)
+		.GlyphAtlas(GlyphAtlas);
+
+	// After the overlay registered its fixed labels (Miss, Dodge, ...)
+	GlyphAtlas->Bake();
 
 	ViewportOverlay =
 		SNew(SWeakWidget)
@@ -137,6 +154,7 @@ void UDamageNumberSubsystem::HideOverlay()
 
 	OverlayWidget.Reset();
 	ViewportOverlay.Reset();
+	GlyphAtlas.Reset();
 	bOverlayAdded = false;
 }
 
@@ -149,85 +167,38 @@ bool UDamageNumberSubsystem::ProjectWorldToScreen(const FVector& WorldPos, FVect
 	UWorld* World = GetWorld();
 	if (!World) return false;
 
-	APlayerController* PC = UGameplayStatics::GetPlayerController(World, 0);
-	if (!PC) return false;
-
-	bool bSuccess = PC->ProjectWorldLocationToScreen(WorldPos, OutScreenPos, false);
-	return bSuccess;
+	// Shared per-frame view snapshot — no controller lookup per call
+	UScreenProjectionSubsystem* Projection = World->GetSubsystem<UScreenProjectionSubsystem>();
+	return Projection && Projection->ProjectPoint(WorldPos, OutScreenPos);
 }
 
 // ============================================================
 // Handle combat:damage / skill:effect_damage socket event
 // ============================================================
 
-void UDamageNumberSubsystem::HandleCombatDamage(const TSharedPtr<FJsonValue>& Data)
+void UDamageNumberSubsystem::HandleCombatDamage(const FCombatDamageEvent& Ev)
 {
-	if (!Data.IsValid())
-	{
-		UE_LOG(LogDamageNumbers, Warning, TEXT("HandleCombatDamage: Data is invalid!"));
-		return;
-	}
-
-	const TSharedPtr<FJsonObject>* ObjPtr = nullptr;
-	if (!Data->TryGetObject(ObjPtr) || !ObjPtr)
-	{
-		UE_LOG(LogDamageNumbers, Warning, TEXT("HandleCombatDamage: Failed to extract JSON object!"));
-		return;
-	}
-	const TSharedPtr<FJsonObject>& Obj = *ObjPtr;
-
-	// ---- Extract event fields ----
-	double AttackerIdD = 0, TargetIdD = 0, DamageD = 0, HealAmountD = 0;
-	Obj->TryGetNumberField(TEXT("attackerId"), AttackerIdD);
-	Obj->TryGetNumberField(TEXT("targetId"), TargetIdD);
-	Obj->TryGetNumberField(TEXT("damage"), DamageD);
-	Obj->TryGetNumberField(TEXT("healAmount"), HealAmountD);
+	const int32 AttackerId = Ev.AttackerId;
+	const int32 TargetId = Ev.TargetId;
+	const FVector& TargetWorldPos = Ev.TargetPosition;
 
-	bool bIsCritical = false;
-	Obj->TryGetBoolField(TEXT("isCritical"), bIsCritical);
-
-	bool bIsEnemy = false;
-	Obj->TryGetBoolField(TEXT("isEnemy"), bIsEnemy);
-
-	// ---- RO damage system fields ----
-	FString HitType = TEXT("normal");
-	Obj->TryGetStringField(TEXT("hitType"), HitType);
-
-	FString Element = TEXT("neutral");
-	Obj->TryGetStringField(TEXT("element"), Element);
-
-	const int32 AttackerId = (int32)AttackerIdD;
-	const int32 TargetId = (int32)TargetIdD;
-	const int32 Damage = (int32)DamageD;
-	const int32 HealAmount = (int32)HealAmountD;
-
-	// ---- Extract target world position ----
-	double TX = 0, TY = 0, TZ = 0;
-	Obj->TryGetNumberField(TEXT("targetX"), TX);
-	Obj->TryGetNumberField(TEXT("targetY"), TY);
-	Obj->TryGetNumberField(TEXT("targetZ"), TZ);
-
-	const FVector TargetWorldPos((float)TX, (float)TY, (float)TZ);
-
-	UE_LOG(LogDamageNumbers, Log, TEXT("HandleCombatDamage: attacker=%d target=%d dmg=%d heal=%d crit=%d isEnemy=%d hitType=%s ele=%s pos=(%.0f,%.0f,%.0f)"),
-		AttackerId, TargetId, Damage, HealAmount, bIsCritical ? 1 : 0, bIsEnemy ? 1 : 0, *HitType, *Element, TX, TY, TZ);
+	UE_LOG(LogDamageNumbers, Verbose, TEXT("HandleCombatDamage: attacker=%d target=%d dmg=%d heal=%d crit=%d isEnemy=%d hitType=%s ele=%s pos=(%.0f,%.0f,%.0f)"),
+		AttackerId, TargetId, Ev.Damage, Ev.HealAmount, Ev.bIsCritical ? 1 : 0, Ev.bIsEnemy ? 1 : 0, *Ev.HitType, *Ev.Element,
+		TargetWorldPos.X, TargetWorldPos.Y, TargetWorldPos.Z);
 
 	// ---- For heals, use healAmount as the display value ----
-	const int32 DisplayValue = (HitType == TEXT("heal")) ? HealAmount : Damage;
+	const bool bIsHeal = Ev.IsHeal();
+	const int32 DisplayValue = bIsHeal ? Ev.HealAmount : Ev.Damage;
 
 	// ---- Spawn damage number for ALL combat in view (RO-style) ----
-	SpawnDamagePop(DisplayValue, bIsCritical, bIsEnemy, AttackerId, TargetId, TargetWorldPos, HitType, Element);
+	SpawnDamagePop(DisplayValue, Ev.bIsCritical, Ev.bIsEnemy, AttackerId, TargetId, TargetWorldPos, Ev.HitType, Ev.Element);
 
 	// ---- Combo total tracking for multi-hit skills ----
-	double HitNumberD = 0, TotalHitsD = 0, SkillIdD = 0;
-	Obj->TryGetNumberField(TEXT("hitNumber"), HitNumberD);
-	Obj->TryGetNumberField(TEXT("totalHits"), TotalHitsD);
-	Obj->TryGetNumberField(TEXT("skillId"), SkillIdD);
-	const int32 HitNumber = (int32)HitNumberD;
-	const int32 TotalHits = (int32)TotalHitsD;
-	const int32 SkillId = (int32)SkillIdD;
-
-	if (TotalHits > 1 && SkillId > 0 && HitType != TEXT("heal"))
+	const int32 HitNumber = Ev.HitNumber;
+	const int32 TotalHits = Ev.TotalHits;
+	const int32 SkillId = Ev.SkillId;
+
+	if (TotalHits > 1 && SkillId > 0 && !bIsHeal)
 	{
 		FString ComboKey = FString::Printf(TEXT("%d_%d_%d"), AttackerId, TargetId, SkillId);
 		FComboTracker& C = ActiveCombos.FindOrAdd(ComboKey);
@@ -239,7 +210,7 @@ void UDamageNumberSubsystem::HandleCombatDamage(const TSharedPtr<FJsonValue>& Da
 		C.TotalDamage += DisplayValue;
 		C.HitsReceived++;
 		C.TargetId = TargetId;
-		C.bIsEnemy = bIsEnemy;
+		C.bIsEnemy = Ev.bIsEnemy;
 		C.LastTargetPos = TargetWorldPos;
 
 		if (HitNumber >= TotalHits)
@@ -250,20 +221,11 @@ void UDamageNumberSubsystem::HandleCombatDamage(const TSharedPtr<FJsonValue>& Da
 	}
 
 	// ---- Dual Wield: second damage number for left-hand hit ----
-	double Damage2D = 0;
-	bool bIsDualWield = false;
-	Obj->TryGetNumberField(TEXT("damage2"), Damage2D);
-	Obj->TryGetBoolField(TEXT("isDualWield"), bIsDualWield);
-	const int32 Damage2 = (int32)Damage2D;
-	if (bIsDualWield && Damage2 > 0)
+	if (Ev.bIsDualWield && Ev.Damage2 > 0)
 	{
-		bool bIsCritical2 = false;
-		Obj->TryGetBoolField(TEXT("isCritical2"), bIsCritical2);
-		FString Element2 = TEXT("neutral");
-		Obj->TryGetStringField(TEXT("element2"), Element2);
 		// Slight upward offset so the two numbers don't overlap
 		const FVector LeftHandPos = TargetWorldPos + FVector(0.f, 0.f, 30.f);
-		SpawnDamagePop(Damage2, bIsCritical2, bIsEnemy, AttackerId, TargetId, LeftHandPos, TEXT("normal"), Element2);
+		SpawnDamagePop(Ev.Damage2, Ev.bIsCritical2, Ev.bIsEnemy, AttackerId, TargetId, LeftHandPos, TEXT("normal"), Ev.Element2);
 	}
 }
 
@@ -9,9 +9,11 @@
 #include "Subsystems/WorldSubsystem.h"
 #include "Dom/JsonValue.h"
 #include "Dom/JsonObject.h"
+#include "SocketEventTypes.h"
 #include "DamageNumberSubsystem.generated.h"
 
 class SDamageNumberOverlay;
+class FDamageNumberGlyphAtlas;
 enum class EDamagePopType : uint8;
 
 UCLASS()
@@ -32,7 +34,7 @@ public:
 
 private:
 	// ---- event handlers ----
-	void HandleCombatDamage(const TSharedPtr<FJsonValue>& Data);
+	void HandleCombatDamage(const FCombatDamageEvent& Ev);
 	void HandleCombatBlocked(const TSharedPtr<FJsonValue>& Data);
 	void HandleStatusTick(const TSharedPtr<FJsonValue>& Data);
 	void HandleStatusApplied(const TSharedPtr<FJsonValue>& Data);
@@ -87,6 +89,7 @@ private:
 	// Vertical offset in world units to position numbers above character's head
 	static constexpr float HEAD_OFFSET_Z = 120.0f;
 
+	TSharedPtr<FDamageNumberGlyphAtlas> GlyphAtlas;
 	TSharedPtr<SDamageNumberOverlay> OverlayWidget;
 	TSharedPtr<SWidget> ViewportOverlay;
 };
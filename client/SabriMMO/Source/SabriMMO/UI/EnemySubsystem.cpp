@@ -4,12 +4,16 @@
 #include "EnemySubsystem.h"
 #include "SSenseResultPopup.h"
 #include "NameTagSubsystem.h"
+#include "EntityRegistrySubsystem.h"
 #include "ZonePreloadSubsystem.h"
+#include "SnapshotInterpolationSubsystem.h"
+#include "ActorPoolSubsystem.h"
 #include "MMOGameInstance.h"
 #include "SocketEventRouter.h"
 #include "Audio/AudioSubsystem.h"
 #include "VFX/SkillVFXSubsystem.h"
 #include "Sprite/SpriteCharacterActor.h"
+#include "Sprite/SpriteInstancingSubsystem.h"
 #include "Kismet/GameplayStatics.h"
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -23,104 +27,43 @@
 DEFINE_LOG_CATEGORY_STATIC(LogEnemySubsystem, Log, All);
 
 // ============================================================
-// BP Reflection Helpers
+// BP bindings
 // ============================================================
 
-namespace
+void FEnemyBPBindings::Bind(const UClass* Class)
 {
-	void SetBPInt(AActor* A, FName N, int32 V)
-	{
-		if (!A) return;
-		if (FIntProperty* P = CastField<FIntProperty>(A->GetClass()->FindPropertyByName(N)))
-			*P->ContainerPtrToValuePtr<int32>(A) = V;
-	}
+	Movement.Bind(Class);
+	IsDead.Bind(Class, TEXT("bIsDead"));
 
-	void SetBPDouble(AActor* A, FName N, double V)
-	{
-		if (!A) return;
-		UClass* C = A->GetClass();
-		if (FDoubleProperty* P = CastField<FDoubleProperty>(C->FindPropertyByName(N)))
-			*P->ContainerPtrToValuePtr<double>(A) = V;
-		else if (FFloatProperty* P2 = CastField<FFloatProperty>(C->FindPropertyByName(N)))
-			*P2->ContainerPtrToValuePtr<float>(A) = (float)V;
-	}
+	InitializeEnemy.Bind(Class, TEXT("InitializeEnemy"));
+	InEnemyId.Bind(InitializeEnemy.Get(), TEXT("InEnemyId"));
+	InName.Bind(InitializeEnemy.Get(), TEXT("InName"));
+	InLevel.Bind(InitializeEnemy.Get(), TEXT("InLevel"));
+	InHealth.Bind(InitializeEnemy.Get(), TEXT("InHealth"));
+	InMaxHealth.Bind(InitializeEnemy.Get(), TEXT("InMaxHealth"));
 
-	void SetBPBool(AActor* A, FName N, bool V)
-	{
-		if (!A) return;
-		if (FBoolProperty* P = CastField<FBoolProperty>(A->GetClass()->FindPropertyByName(N)))
-			P->SetPropertyValue_InContainer(A, V);
-	}
+	OnEnemyDeath.Bind(Class, TEXT("OnEnemyDeath"));
+	InDeadEnemy.Bind(OnEnemyDeath.Get(), TEXT("InDeadEnemy"));
 
-	void SetBPString(AActor* A, FName N, const FString& V)
-	{
-		if (!A) return;
-		if (FStrProperty* P = CastField<FStrProperty>(A->GetClass()->FindPropertyByName(N)))
-			*P->ContainerPtrToValuePtr<FString>(A) = V;
-	}
-
-	void SetBPVector(AActor* A, FName N, const FVector& V)
-	{
-		if (!A) return;
-		if (FStructProperty* P = CastField<FStructProperty>(A->GetClass()->FindPropertyByName(N)))
-		{
-			if (P->Struct == TBaseStructure<FVector>::Get())
-				*P->ContainerPtrToValuePtr<FVector>(A) = V;
-		}
-	}
+	UpdateEnemyHealth.Bind(Class, TEXT("UpdateEnemyHealth"));
+	NewHealth.Bind(UpdateEnemyHealth.Get(), TEXT("NewHealth"));
+	NewMaxHealth.Bind(UpdateEnemyHealth.Get(), TEXT("NewMaxHealth"));
+	InCombat.Bind(UpdateEnemyHealth.Get(), TEXT("InCombat"));
 
-	bool GetBPBool(AActor* A, FName N)
-	{
-		if (!A) return false;
-		if (FBoolProperty* P = CastField<FBoolProperty>(A->GetClass()->FindPropertyByName(N)))
-			return P->GetPropertyValue_InContainer(A);
-		return false;
-	}
+	PlayAttackAnimation.Bind(Class, TEXT("PlayAttackAnimation"));
+}
 
-	// Call a parameterless BP function
-	void CallBPFunction(AActor* Actor, FName FuncName)
+namespace
+{
+	// Sprite enemies draw instanced, so they get their own pool (player sprites never are).
+	// Affinity is the body class, so a pooled poring comes back as a poring without a rebind.
+	FActorPoolKey EnemySpritePool()
 	{
-		if (!Actor) return;
-		UFunction* Func = Actor->FindFunction(FuncName);
-		if (Func) Actor->ProcessEvent(Func, nullptr);
+		return { ASpriteCharacterActor::StaticClass(), FName(TEXT("EnemySprite")) };
 	}
 
-	// Call a BP function with params. Uses Memzero + explicit FString lifecycle
-	// (NOT InitializeStruct/DestroyStruct which can overflow the alloca'd buffer
-	// due to GetStructureSize() > ParmsSize alignment differences — causes 0xc0000409).
-	void CallBPFunction(AActor* Actor, FName FuncName,
-		TFunctionRef<void(UFunction*, uint8*)> SetParams)
-	{
-		if (!Actor) return;
-		UFunction* Func = Actor->FindFunction(FuncName);
-		if (!Func) return;
-
-		if (Func->ParmsSize == 0)
-		{
-			Actor->ProcessEvent(Func, nullptr);
-			return;
-		}
-
-		uint8* Params = (uint8*)FMemory_Alloca(Func->ParmsSize);
-		FMemory::Memzero(Params, Func->ParmsSize);
-
-		// Construct FString properties in-place (POD types are fine with Memzero)
-		TArray<FStrProperty*, TInlineAllocator<4>> StringProps;
-		for (TFieldIterator<FStrProperty> It(Func); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
-		{
-			new (It->ContainerPtrToValuePtr<FString>(Params)) FString();
-			StringProps.Add(*It);
-		}
-
-		SetParams(Func, Params);
-		Actor->ProcessEvent(Func, Params);
-
-		// Destroy FStrings
-		for (FStrProperty* P : StringProps)
-		{
-			P->ContainerPtrToValuePtr<FString>(Params)->~FString();
-		}
-	}
+	// Idle sprites per class on top of the dead count in zone:spawn_manifest (slave summons, overlap)
+	constexpr int32 PrewarmHeadroom = 2;
 }
 
 // ============================================================
@@ -155,8 +98,8 @@ void UEnemySubsystem::OnWorldBeginPlay(UWorld& InWorld)
 	// Register event handlers
 	Router->RegisterHandler(TEXT("enemy:spawn"), this,
 		[this](const TSharedPtr<FJsonValue>& D) { HandleEnemySpawn(D); });
-	Router->RegisterHandler(TEXT("enemy:move"), this,
-		[this](const TSharedPtr<FJsonValue>& D) { HandleEnemyMove(D); });
+	Router->RegisterTypedHandler<FEnemyMoveEvent>(TEXT("enemy:move"), this,
+		[this](const FEnemyMoveEvent& Ev) { HandleEnemyMove(Ev); });
 	Router->RegisterHandler(TEXT("enemy:death"), this,
 		[this](const TSharedPtr<FJsonValue>& D) { HandleEnemyDeath(D); });
 	Router->RegisterHandler(TEXT("enemy:health_update"), this,
@@ -167,6 +110,8 @@ void UEnemySubsystem::OnWorldBeginPlay(UWorld& InWorld)
 		[this](const TSharedPtr<FJsonValue>& D) { HandleCombatKnockback(D); });
 	Router->RegisterHandler(TEXT("skill:sense_result"), this,
 		[this](const TSharedPtr<FJsonValue>& D) { HandleSenseResult(D); });
+	Router->RegisterHandler(TEXT("zone:spawn_manifest"), this,
+		[this](const TSharedPtr<FJsonValue>& D) { HandleSpawnManifest(D); });
 
 	// Defer readiness by one frame (prevents ProcessEvent during PostLoad)
 	bReadyToProcess = false;
@@ -175,7 +120,7 @@ void UEnemySubsystem::OnWorldBeginPlay(UWorld& InWorld)
 		bReadyToProcess = true;
 	});
 
-	UE_LOG(LogEnemySubsystem, Log, TEXT("EnemySubsystem — 7 enemy events registered (incl. sense)."));
+	UE_LOG(LogEnemySubsystem, Log, TEXT("EnemySubsystem — 8 enemy events registered (incl. sense, spawn manifest)."));
 }
 
 void UEnemySubsystem::Deinitialize()
@@ -206,8 +151,14 @@ void UEnemySubsystem::Deinitialize()
 	}
 
 	// Destroy all spawned enemy + sprite actors
+	USpriteInstancingSubsystem* Instancing = GetWorld() ? GetWorld()->GetSubsystem<USpriteInstancingSubsystem>() : nullptr;
 	for (auto& Pair : Enemies)
 	{
+		OnEnemyRemoved.Broadcast(Pair.Value);
+
+		if (Instancing && Pair.Value.SpriteInstanceId != INDEX_NONE)
+			Instancing->Unregister(Pair.Value.SpriteInstanceId);
+
 		// For sprite-only enemies, Actor == SpriteActor — only destroy once
 		if (Pair.Value.SpriteActor.IsValid() && Pair.Value.SpriteActor != Pair.Value.Actor)
 			Pair.Value.SpriteActor->Destroy();
@@ -217,8 +168,13 @@ void UEnemySubsystem::Deinitialize()
 	Enemies.Empty();
 	ActorToEnemyId.Empty();
 
+	OnEnemySpawned.Clear();
+	OnEnemyDied.Clear();
+	OnEnemyRemoved.Clear();
+
 	bReadyToProcess = false;
 	EnemyBPClass = nullptr;
+	BPBindings.Reset();
 
 	Super::Deinitialize();
 }
@@ -281,20 +237,14 @@ void UEnemySubsystem::HandleEnemySpawn(const TSharedPtr<FJsonValue>& Data)
 	// Lambda: call InitializeEnemy with 5 params via ProcessEvent
 	auto InitEnemy = [&](AActor* Enemy)
 	{
-		CallBPFunction(Enemy, TEXT("InitializeEnemy"),
-			[&](UFunction* Func, uint8* Params)
-			{
-				if (auto* P = CastField<FIntProperty>(Func->FindPropertyByName(TEXT("InEnemyId"))))
-					*P->ContainerPtrToValuePtr<int32>(Params) = EnemyId;
-				if (auto* P = CastField<FStrProperty>(Func->FindPropertyByName(TEXT("InName"))))
-					*P->ContainerPtrToValuePtr<FString>(Params) = Name;
-				if (auto* P = CastField<FIntProperty>(Func->FindPropertyByName(TEXT("InLevel"))))
-					*P->ContainerPtrToValuePtr<int32>(Params) = Level;
-				if (auto* P = CastField<FDoubleProperty>(Func->FindPropertyByName(TEXT("InHealth"))))
-					*P->ContainerPtrToValuePtr<double>(Params) = HealthD;
-				if (auto* P = CastField<FDoubleProperty>(Func->FindPropertyByName(TEXT("InMaxHealth"))))
-					*P->ContainerPtrToValuePtr<double>(Params) = MaxHealthD;
-			});
+		const FEnemyBPBindings& BP = BPBindings.Get(Enemy);
+		FBPCallFrame(BP.InitializeEnemy)
+			.Set(BP.InEnemyId, EnemyId)
+			.Set(BP.InName, Name)
+			.Set(BP.InLevel, Level)
+			.Set(BP.InHealth, HealthD)
+			.Set(BP.InMaxHealth, MaxHealthD)
+			.Call(Enemy);
 	};
 
 	// ---- Existing enemy? ----
@@ -309,7 +259,7 @@ void UEnemySubsystem::HandleEnemySpawn(const TSharedPtr<FJsonValue>& Data)
 			if (Existing->SpriteActor.IsValid())
 			{
 				// Sprite enemy: sprite IS the actor
-				Existing->SpriteActor->ServerTargetPos = Pos;
+				Existing->SpriteActor->ResetServerTargetPosition(Pos);
 				Existing->SpriteActor->SetActorLocation(Pos);
 				Existing->SpriteActor->SetActorHiddenInGame(false);
 				Existing->SpriteActor->EnableClickCollision();
@@ -329,10 +279,11 @@ void UEnemySubsystem::HandleEnemySpawn(const TSharedPtr<FJsonValue>& Data)
 				// BP enemy: re-show and re-init
 				Enemy->SetActorHiddenInGame(false);
 				Enemy->SetActorEnableCollision(true);
-				SetBPBool(Enemy, TEXT("bIsDead"), false);
+				const FEnemyBPBindings& BP = BPBindings.Get(Enemy);
+				BP.IsDead.Set(Enemy, false);
 				Enemy->SetActorLocation(Pos);
 				InitEnemy(Enemy);
-				SetBPVector(Enemy, TEXT("TargetPosition"), Pos);
+				BP.Movement.TargetPosition.Set(Enemy, Pos);
 			}
 
 			// Update struct data
@@ -341,6 +292,7 @@ void UEnemySubsystem::HandleEnemySpawn(const TSharedPtr<FJsonValue>& Data)
 			Existing->Health = HealthD;
 			Existing->MaxHealth = MaxHealthD;
 			Existing->bIsDead = false;
+			OnEnemySpawned.Broadcast(*Existing);
 
 			// Re-show name tag on respawn
 			AActor* TagTarget = Existing->SpriteActor.IsValid()
@@ -353,7 +305,7 @@ void UEnemySubsystem::HandleEnemySpawn(const TSharedPtr<FJsonValue>& Data)
 		else
 		{
 			// Alive: just update position
-			SetBPVector(Enemy, TEXT("TargetPosition"), Pos);
+			BPBindings.Get(Enemy).Movement.TargetPosition.Set(Enemy, Pos);
 		}
 		return;
 	}
@@ -405,6 +357,7 @@ void UEnemySubsystem::HandleEnemySpawn(const TSharedPtr<FJsonValue>& Data)
 
 	AActor* PrimaryActor = nullptr;
 	ASpriteCharacterActor* Sprite = nullptr;
+	int32 SpriteInstanceId = INDEX_NONE;
 
 	if (!SpriteClass.IsEmpty())
 	{
@@ -416,24 +369,32 @@ void UEnemySubsystem::HandleEnemySpawn(const TSharedPtr<FJsonValue>& Data)
 		{
 			Preload->RequestClassPreload(SpriteClass);
 		}
+		if (UAudioSubsystem* Audio = World->GetSubsystem<UAudioSubsystem>())
+		{
+			Audio->PreloadMonsterSounds(SpriteClass);
+		}
 
 		// ---- Sprite enemy: C++ only, no BP actor ----
-		Sprite = World->SpawnActor<ASpriteCharacterActor>(
-			Pos, FRotator::ZeroRotator, SpawnParams);
+		// Reuse a parked sprite when there is one; one last used by this class keeps its atlases.
+		bool bBodyBound = false;
+		if (UActorPoolSubsystem* Pool = World->GetSubsystem<UActorPoolSubsystem>())
+			Sprite = Cast<ASpriteCharacterActor>(Pool->Acquire(EnemySpritePool(), Pos, FName(*SpriteClass), &bBodyBound));
+		else
+			Sprite = World->SpawnActor<ASpriteCharacterActor>(Pos, FRotator::ZeroRotator, SpawnParams);
 		if (!Sprite)
 		{
 			UE_LOG(LogEnemySubsystem, Warning, TEXT("Failed to spawn sprite enemy %d (%s)"), EnemyId, *Name);
 			return;
 		}
 
-		Sprite->SetBodyClass(SpriteClass);
+		if (!bBodyBound)
+			Sprite->SetBodyClass(SpriteClass);
 		if (SpriteTint != FLinearColor::White)
 			Sprite->SetLayerTint(ESpriteLayer::Body, SpriteTint);
 		if (!FMath::IsNearlyEqual(SpriteScale, 1.0f))
 			Sprite->SetActorScale3D(FVector(SpriteScale));
 		Sprite->EnableClickCollision();
-		Sprite->ServerTargetPos = Pos;
-		Sprite->bUseServerMovement = true;
+		Sprite->ResetServerTargetPosition(Pos);
 
 		ESpriteWeaponMode Mode = ESpriteWeaponMode::None;
 		if (WeaponMode == 1) Mode = ESpriteWeaponMode::OneHand;
@@ -441,6 +402,15 @@ void UEnemySubsystem::HandleEnemySpawn(const TSharedPtr<FJsonValue>& Data)
 		else if (WeaponMode == 3) Mode = ESpriteWeaponMode::Bow;
 		Sprite->SetWeaponMode(Mode);
 
+		// Draw through the shared instanced batches (one component per atlas + layer)
+		// instead of this actor's own layer meshes; clicks go to a box proxy.
+		// A pooled sprite that was instanced has no meshes of its own left to draw with.
+		if (USpriteInstancingSubsystem::IsEnabled() || Sprite->IsInstancedRendering())
+		{
+			if (USpriteInstancingSubsystem* Instancing = World->GetSubsystem<USpriteInstancingSubsystem>())
+				SpriteInstanceId = Instancing->Register(Sprite);
+		}
+
 		PrimaryActor = Sprite;
 
 		UE_LOG(LogEnemySubsystem, Log, TEXT("Enemy %d sprite-only: class=%s weaponMode=%d"),
@@ -462,7 +432,7 @@ void UEnemySubsystem::HandleEnemySpawn(const TSharedPtr<FJsonValue>& Data)
 		}
 
 		InitEnemy(NewEnemy);
-		SetBPVector(NewEnemy, TEXT("TargetPosition"), Pos);
+		BPBindings.Get(NewEnemy).Movement.TargetPosition.Set(NewEnemy, Pos);
 		PrimaryActor = NewEnemy;
 	}
 
@@ -480,8 +450,12 @@ void UEnemySubsystem::HandleEnemySpawn(const TSharedPtr<FJsonValue>& Data)
 	Entry.Health = HealthD;
 	Entry.MaxHealth = MaxHealthD;
 	Entry.bIsDead = false;
+	Entry.SpriteInstanceId = SpriteInstanceId;
 	Enemies.Add(EnemyId, Entry);
 	ActorToEnemyId.Add(PrimaryActor, EnemyId);
+	if (UEntityRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UEntityRegistrySubsystem>())
+		Registry->Register(EEntityCategory::Enemy, EnemyId, PrimaryActor);
+	OnEnemySpawned.Broadcast(Enemies.FindChecked(EnemyId));
 
 	// ---- Audio bindings (sprite enemies only) ----
 	if (Sprite)
@@ -541,34 +515,109 @@ void UEnemySubsystem::HandleEnemySpawn(const TSharedPtr<FJsonValue>& Data)
 }
 
 // ============================================================
-// HandleEnemyMove — set TargetPosition + bIsMoving
+// ReleaseEnemy — drop a dead sprite enemy and park its sprite
 // ============================================================
 
-void UEnemySubsystem::HandleEnemyMove(const TSharedPtr<FJsonValue>& Data)
+void UEnemySubsystem::ReleaseEnemy(int32 EnemyId)
 {
-	if (!bReadyToProcess || !Data.IsValid()) return;
+	FEnemyEntry* Entry = Enemies.Find(EnemyId);
+	if (!Entry) return;
+
+	UWorld* World = GetWorld();
+	OnEnemyRemoved.Broadcast(*Entry);
+
+	if (Entry->StandSoundTimer.IsValid())
+		World->GetTimerManager().ClearTimer(Entry->StandSoundTimer);
+
+	if (Entry->SpriteInstanceId != INDEX_NONE)
+	{
+		if (USpriteInstancingSubsystem* Instancing = World->GetSubsystem<USpriteInstancingSubsystem>())
+			Instancing->Unregister(Entry->SpriteInstanceId);
+	}
+
+	if (AActor* Actor = Entry->Actor.Get())
+	{
+		if (UNameTagSubsystem* NTS = World->GetSubsystem<UNameTagSubsystem>())
+			NTS->UnregisterEntity(Actor);
+		ActorToEnemyId.Remove(Actor);
+
+		if (UActorPoolSubsystem* Pool = World->GetSubsystem<UActorPoolSubsystem>())
+			Pool->Release(Actor);
+		else
+			Actor->Destroy();
+	}
+
+	if (UEntityRegistrySubsystem* Registry = World->GetSubsystem<UEntityRegistrySubsystem>())
+		Registry->Unregister(EEntityCategory::Enemy, EnemyId);
+	Enemies.Remove(EnemyId);
+}
+
+// ============================================================
+// HandleSpawnManifest — pre-warm pooled sprites for the zone's monster list
+// ============================================================
+
+void UEnemySubsystem::HandleSpawnManifest(const TSharedPtr<FJsonValue>& Data)
+{
+	if (!Data.IsValid()) return;
 
 	const TSharedPtr<FJsonObject>* ObjPtr = nullptr;
 	if (!Data->TryGetObject(ObjPtr) || !ObjPtr) return;
-	const TSharedPtr<FJsonObject>& Obj = *ObjPtr;
 
-	double EnemyIdD = 0;
-	if (!Obj->TryGetNumberField(TEXT("enemyId"), EnemyIdD)) return;
-	int32 EnemyId = (int32)EnemyIdD;
+	const TSharedPtr<FJsonObject>* ClassesPtr = nullptr;
+	if (!(*ObjPtr)->TryGetObjectField(TEXT("classes"), ClassesPtr) || !ClassesPtr) return;
 
-	FEnemyEntry* Entry = Enemies.Find(EnemyId);
-	if (!Entry || !Entry->Actor.IsValid()) return;
-	AActor* Enemy = Entry->Actor.Get();
+	UWorld* World = GetWorld();
+	UActorPoolSubsystem* Pool = World ? World->GetSubsystem<UActorPoolSubsystem>() : nullptr;
+	if (!Pool) return;
 
-	double X = 0, Y = 0, Z = 0;
-	Obj->TryGetNumberField(TEXT("x"), X);
-	Obj->TryGetNumberField(TEXT("y"), Y);
-	Obj->TryGetNumberField(TEXT("z"), Z);
+	// This zone's monster list — its sounds stream in behind the loading overlay
+	UAudioSubsystem* Audio = World->GetSubsystem<UAudioSubsystem>();
 
-	FVector NewPos((float)X, (float)Y, (float)Z);
+	// Alive enemies arrive in the enemy:spawn burst right behind this; pre-warm sprites for
+	// the ones that are dead now, so their respawns (and summons) don't spawn actors mid-fight.
+	int32 Requested = 0;
+	for (const auto& Pair : (*ClassesPtr)->Values)
+	{
+		const TSharedPtr<FJsonObject>* CountsPtr = nullptr;
+		if (Pair.Key.IsEmpty() || !Pair.Value->TryGetObject(CountsPtr) || !CountsPtr) continue;
 
-	bool bIsMoving = false;
-	Obj->TryGetBoolField(TEXT("isMoving"), bIsMoving);
+		double TotalD = 0, AliveD = 0;
+		(*CountsPtr)->TryGetNumberField(TEXT("total"), TotalD);
+		(*CountsPtr)->TryGetNumberField(TEXT("alive"), AliveD);
+		const int32 Count = FMath::Max(0, (int32)TotalD - (int32)AliveD) + PrewarmHeadroom;
+
+		const FString SpriteClass = Pair.Key;
+		if (UZonePreloadSubsystem* Preload = World->GetSubsystem<UZonePreloadSubsystem>())
+			Preload->RequestClassPreload(SpriteClass);
+		if (Audio)
+			Audio->PreloadMonsterSounds(SpriteClass);
+
+		Pool->Prewarm(EnemySpritePool(), Count, FName(*SpriteClass), [SpriteClass](AActor* Actor)
+		{
+			if (ASpriteCharacterActor* Sprite = Cast<ASpriteCharacterActor>(Actor))
+				Sprite->SetBodyClass(SpriteClass);
+		});
+		Requested += Count;
+	}
+
+	UE_LOG(LogEnemySubsystem, Log, TEXT("Spawn manifest: pre-warming up to %d enemy sprites across %d classes"),
+		Requested, (*ClassesPtr)->Values.Num());
+}
+
+// ============================================================
+// HandleEnemyMove — set TargetPosition + bIsMoving
+// ============================================================
+
+void UEnemySubsystem::HandleEnemyMove(const FEnemyMoveEvent& Ev)
+{
+	if (!bReadyToProcess) return;
+
+	FEnemyEntry* Entry = Enemies.Find(Ev.EnemyId);
+	if (!Entry || !Entry->Actor.IsValid()) return;
+	AActor* Enemy = Entry->Actor.Get();
+
+	const FVector NewPos = Ev.Position;
+	const bool bIsMoving = Ev.bIsMoving;
 
 	// Sprite enemies: C++ handles movement interpolation directly (bypasses BP Tick + CMC)
 	if (Entry->SpriteActor.IsValid())
@@ -578,7 +627,11 @@ void UEnemySubsystem::HandleEnemyMove(const TSharedPtr<FJsonValue>& Data)
 		if (UCharacterMovementComponent* CMC = Enemy->FindComponentByClass<UCharacterMovementComponent>())
 			WalkSpeed = CMC->MaxWalkSpeed;
 
+		// JSON enemy:move carries its own server time; move:batch records are already inside a packet scope
+		USnapshotInterpolationSubsystem* Interp = Ev.Timestamp > 0.0 ? GetWorld()->GetSubsystem<USnapshotInterpolationSubsystem>() : nullptr;
+		if (Interp) Interp->BeginPacket(static_cast<uint32>(static_cast<uint64>(Ev.Timestamp)));
 		Entry->SpriteActor->SetServerTargetPosition(NewPos, bIsMoving, WalkSpeed);
+		if (Interp) Interp->EndPacket();
 
 		// Move SFX is no longer throttled here — it is fired by the SpriteCharacterActor's
 		// OnAnimCycleComplete delegate (frame-locked to the Walk animation cycle for
@@ -620,8 +673,9 @@ void UEnemySubsystem::HandleEnemyMove(const TSharedPtr<FJsonValue>& Data)
 	else
 	{
 		// Non-sprite enemies: use BP Tick interpolation (existing path)
-		SetBPVector(Enemy, TEXT("TargetPosition"), NewPos);
-		SetBPBool(Enemy, TEXT("bIsMoving"), bIsMoving);
+		const FBPMovementBindings& BP = BPBindings.Get(Enemy).Movement;
+		BP.TargetPosition.Set(Enemy, NewPos);
+		BP.IsMoving.Set(Enemy, bIsMoving);
 	}
 }
 
@@ -650,6 +704,7 @@ void UEnemySubsystem::HandleEnemyDeath(const TSharedPtr<FJsonValue>& Data)
 	AActor* Enemy = Entry->Actor.Get();
 
 	Entry->bIsDead = true;
+	OnEnemyDied.Broadcast(*Entry);
 
 	// Sprite enemy: sprite IS the primary actor
 	if (Entry->SpriteActor.IsValid() && Entry->SpriteActor->IsBodyReady())
@@ -669,7 +724,8 @@ void UEnemySubsystem::HandleEnemyDeath(const TSharedPtr<FJsonValue>& Data)
 			}
 		}
 
-		// Hide after corpse linger (4s)
+		// After the corpse linger (4s) the sprite goes back to the pool and the entry is
+		// dropped; the respawn arrives as a new enemy:spawn and takes a pooled sprite again.
 		TWeakObjectPtr<AActor> WeakActor = Enemy;
 		TWeakObjectPtr<UEnemySubsystem> WeakThis(this);
 		FTimerHandle TimerHandle;
@@ -678,32 +734,24 @@ void UEnemySubsystem::HandleEnemyDeath(const TSharedPtr<FJsonValue>& Data)
 			if (!WeakThis.IsValid()) return;
 
 			FEnemyEntry* E = WeakThis->Enemies.Find(EnemyId);
-			if (E && !E->bIsDead) return;  // Already respawned
+			if (!E || !E->bIsDead || E->Actor != WeakActor) return;  // Already respawned or removed
 
-			if (WeakActor.IsValid())
-				WeakActor->SetActorHiddenInGame(true);
-
-			if (UNameTagSubsystem* NTS = WeakThis->GetWorld()->GetSubsystem<UNameTagSubsystem>())
-			{
-				if (WeakActor.IsValid()) NTS->SetVisible(WeakActor.Get(), false);
-			}
+			WeakThis->ReleaseEnemy(EnemyId);
 		}, 4.0f, false);
 	}
 	else
 	{
 		// Non-sprite BP enemy: hide immediately, call BP death function
-		SetBPBool(Enemy, TEXT("bIsDead"), true);
+		const FEnemyBPBindings& BP = BPBindings.Get(Enemy);
+		BP.IsDead.Set(Enemy, true);
 		Enemy->SetActorHiddenInGame(true);
 		Enemy->SetActorEnableCollision(false);
 		if (UNameTagSubsystem* NTS = GetWorld()->GetSubsystem<UNameTagSubsystem>())
 			NTS->SetVisible(Enemy, false);
 
-		CallBPFunction(Enemy, TEXT("OnEnemyDeath"),
-			[Enemy](UFunction* Func, uint8* Params)
-			{
-				if (auto* P = CastField<FObjectProperty>(Func->FindPropertyByName(TEXT("InDeadEnemy"))))
-					*P->ContainerPtrToValuePtr<UObject*>(Params) = Enemy;
-			});
+		FBPCallFrame(BP.OnEnemyDeath)
+			.Set<UObject*>(BP.InDeadEnemy, Enemy)
+			.Call(Enemy);
 	}
 
 	UE_LOG(LogEnemySubsystem, Verbose, TEXT("Enemy %d died."), EnemyId);
@@ -751,16 +799,12 @@ void UEnemySubsystem::HandleEnemyHealthUpdate(const TSharedPtr<FJsonValue>& Data
 	Entry->Health = Health;
 	Entry->MaxHealth = MaxHealth;
 
-	CallBPFunction(Enemy, TEXT("UpdateEnemyHealth"),
-		[&](UFunction* Func, uint8* Params)
-		{
-			if (auto* P = CastField<FDoubleProperty>(Func->FindPropertyByName(TEXT("NewHealth"))))
-				*P->ContainerPtrToValuePtr<double>(Params) = Health;
-			if (auto* P = CastField<FDoubleProperty>(Func->FindPropertyByName(TEXT("NewMaxHealth"))))
-				*P->ContainerPtrToValuePtr<double>(Params) = MaxHealth;
-			if (auto* P = CastField<FBoolProperty>(Func->FindPropertyByName(TEXT("InCombat"))))
-				P->SetPropertyValue_InContainer(Params, bInCombat);
-		});
+	const FEnemyBPBindings& BP = BPBindings.Get(Enemy);
+	FBPCallFrame(BP.UpdateEnemyHealth)
+		.Set(BP.NewHealth, Health)
+		.Set(BP.NewMaxHealth, MaxHealth)
+		.Set(BP.InCombat, bInCombat)
+		.Call(Enemy);
 }
 
 // ============================================================
@@ -857,6 +901,8 @@ void UEnemySubsystem::HandleEnemyAttack(const TSharedPtr<FJsonValue>& Data)
 					TWeakObjectPtr<UEnemySubsystem> WeakThis(this);
 					int32 LungeEnemyId = EnemyId;
 
+					// Lunge is local-only: step toward ServerTargetPos instead of the snapshot buffer meanwhile
+					Entry->SpriteActor->HoldServerMovement(WindUpDelay + LungeHold + ReturnDelay + 0.1f);
 					Entry->SpriteActor->ServerTargetPos = WindUpPos;
 
 					FTimerHandle LungeTimer;
@@ -928,7 +974,7 @@ void UEnemySubsystem::HandleEnemyAttack(const TSharedPtr<FJsonValue>& Data)
 		}
 	}
 
-	CallBPFunction(Enemy, TEXT("PlayAttackAnimation"));
+	BPBindings.Get(Enemy).PlayAttackAnimation.Call(Enemy);
 }
 
 // ============================================================
@@ -961,8 +1007,9 @@ void UEnemySubsystem::HandleCombatKnockback(const TSharedPtr<FJsonValue>& Data)
 	Obj->TryGetNumberField(TEXT("newZ"), NewZ);
 
 	// Set TargetPosition for BP_EnemyCharacter Tick interpolation
-	SetBPVector(Enemy, TEXT("TargetPosition"), FVector((float)NewX, (float)NewY, (float)NewZ));
-	SetBPBool(Enemy, TEXT("bIsMoving"), true);
+	const FBPMovementBindings& BP = BPBindings.Get(Enemy).Movement;
+	BP.TargetPosition.Set(Enemy, FVector((float)NewX, (float)NewY, (float)NewZ));
+	BP.IsMoving.Set(Enemy, true);
 
 	UE_LOG(LogEnemySubsystem, Verbose, TEXT("Knockback enemy %d to (%.0f, %.0f, %.0f)"),
 		EnemyId, NewX, NewY, NewZ);
@@ -12,6 +12,8 @@
 #include "Engine/EngineTypes.h"
 #include "Engine/TimerHandle.h"
 #include "Widgets/SWidget.h"
+#include "SocketEventTypes.h"
+#include "BlueprintBindings.h"
 #include "EnemySubsystem.generated.h"
 
 class SSenseResultPopup;
@@ -36,12 +38,46 @@ struct FEnemyEntry
 	double MaxHealth = 0.0;
 	bool bIsDead = false;
 
+	// USpriteInstancingSubsystem id when the sprite draws through instancing (INDEX_NONE = own meshes)
+	int32 SpriteInstanceId = INDEX_NONE;
+
 	// Periodic stand-sound timer (RO Classic monsters with idle ambient,
 	// e.g. Pharaoh, Baphomet — Poring/Skeleton are no-op since their stand path is empty).
 	// Set on spawn if AudioSubsystem reports HasStandSound(SpriteClass).
 	FTimerHandle StandSoundTimer;
 };
 
+// BP_EnemyCharacter variables and events the subsystem drives, resolved once per class.
+// Sprite enemies have none of them, so every handle is unbound (a no-op) for their class.
+struct FEnemyBPBindings
+{
+	FBPMovementBindings Movement;
+	FBPBool IsDead;
+
+	FBPFunction InitializeEnemy;
+	TBPVar<int32> InEnemyId;
+	TBPVar<FString> InName;
+	TBPVar<int32> InLevel;
+	TBPVar<double> InHealth;
+	TBPVar<double> InMaxHealth;
+
+	FBPFunction OnEnemyDeath;
+	TBPVar<UObject*> InDeadEnemy;
+
+	FBPFunction UpdateEnemyHealth;
+	TBPVar<double> NewHealth;
+	TBPVar<double> NewMaxHealth;
+	FBPBool InCombat;
+
+	FBPFunction PlayAttackAnimation;
+
+	void Bind(const UClass* Class);
+};
+
+// Registry change notifications. Listeners key their own per-enemy state off EnemyId
+// instead of searching the world for the actor.
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnEnemyRegistryChanged, const FEnemyEntry& /*Entry*/);
+
 UCLASS()
 class SABRIMMO_API UEnemySubsystem : public UWorldSubsystem
 {
@@ -69,6 +105,17 @@ public:
 	// Sense popup management (called by SSenseResultPopup::DismissPopup)
 	void HideSensePopup();
 
+	// ---- Change notifications ----
+
+	// Entry added or a dead entry respawned (Actor is valid)
+	FOnEnemyRegistryChanged OnEnemySpawned;
+
+	// Entry marked dead (actor lingers for the corpse, entry stays until respawn/removal)
+	FOnEnemyRegistryChanged OnEnemyDied;
+
+	// Entry about to be removed from the registry (actor is being destroyed or pooled)
+	FOnEnemyRegistryChanged OnEnemyRemoved;
+
 private:
 	// Entity registry: server enemy ID -> FEnemyEntry (actor + typed data)
 	TMap<int32, FEnemyEntry> Enemies;
@@ -81,17 +128,24 @@ private:
 	UPROPERTY()
 	UClass* EnemyBPClass = nullptr;
 
+	// Replaces FindPropertyByName / FindFunction on every move, health update and attack
+	TBPBindingCache<FEnemyBPBindings> BPBindings;
+
 	// Readiness guard (prevents ProcessEvent during PostLoad)
 	bool bReadyToProcess = false;
 
 	// Socket event handlers
 	void HandleEnemySpawn(const TSharedPtr<FJsonValue>& Data);
-	void HandleEnemyMove(const TSharedPtr<FJsonValue>& Data);
+	void HandleEnemyMove(const FEnemyMoveEvent& Ev);
 	void HandleEnemyDeath(const TSharedPtr<FJsonValue>& Data);
 	void HandleEnemyHealthUpdate(const TSharedPtr<FJsonValue>& Data);
 	void HandleEnemyAttack(const TSharedPtr<FJsonValue>& Data);
 	void HandleCombatKnockback(const TSharedPtr<FJsonValue>& Data);
 	void HandleSenseResult(const TSharedPtr<FJsonValue>& Data);
+	void HandleSpawnManifest(const TSharedPtr<FJsonValue>& Data);
+
+	// Remove a dead sprite enemy after its corpse linger and return the sprite to the pool
+	void ReleaseEnemy(int32 EnemyId);
 
 	// Sense popup state
 	TSharedPtr<SSenseResultPopup> SensePopup;
@@ -0,0 +1,324 @@
+// EntityRegistrySubsystem.cpp — Id → actor registry + uniform-grid spatial hash (see header).
+
+#include "EntityRegistrySubsystem.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogEntityRegistry, Log, All);
+
+static TAutoConsoleVariable<float> CVarEntityRegistryCellSize(
+	TEXT("EntityRegistry.CellSize"),
+	1000.f,
+	TEXT("Spatial hash cell size in world units (applied when the world starts)."),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorldAndArgs GEntityRegistryStatsCmd(
+	TEXT("EntityRegistry.Stats"),
+	TEXT("Print registered entities per category and spatial hash occupancy."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UEntityRegistrySubsystem* Sub = World ? World->GetSubsystem<UEntityRegistrySubsystem>() : nullptr)
+		{
+			Sub->LogStats();
+		}
+	}));
+
+namespace
+{
+	const TCHAR* CategoryName(EEntityCategory Category)
+	{
+		switch (Category)
+		{
+		case EEntityCategory::Player:     return TEXT("players");
+		case EEntityCategory::Enemy:      return TEXT("enemies");
+		case EEntityCategory::NPC:        return TEXT("npcs");
+		case EEntityCategory::GroundItem: return TEXT("ground items");
+		case EEntityCategory::Companion:  return TEXT("companions");
+		default:                          return TEXT("?");
+		}
+	}
+}
+
+// ============================================================
+// Lifecycle
+// ============================================================
+
+bool UEntityRegistrySubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld();
+}
+
+void UEntityRegistrySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	CellSize = FMath::Max(100.f, CVarEntityRegistryCellSize.GetValueOnGameThread());
+}
+
+void UEntityRegistrySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Blueprint NPCs placed in the level only carry the "NPC" tag; pick them up once here.
+	// The C++ NPC classes register themselves in BeginPlay under the same id.
+	for (TActorIterator<AActor> It(&InWorld); It; ++It)
+	{
+		AActor* Actor = *It;
+		if (Actor && Actor->ActorHasTag(TEXT("NPC")))
+		{
+			Register(EEntityCategory::NPC, (int32)Actor->GetUniqueID(), Actor);
+		}
+	}
+
+	UE_LOG(LogEntityRegistry, Log, TEXT("EntityRegistry started — cell %.0f uu, %d tagged NPCs"),
+		CellSize, Num(EEntityCategory::NPC));
+}
+
+void UEntityRegistrySubsystem::Deinitialize()
+{
+	Records.Empty();
+	for (TMap<int32, int32>& Map : SlotById)
+	{
+		Map.Empty();
+	}
+	ActorToSlot.Empty();
+	Cells.Empty();
+	Super::Deinitialize();
+}
+
+// ============================================================
+// Registration
+// ============================================================
+
+void UEntityRegistrySubsystem::Register(EEntityCategory Category, int32 Id, AActor* Actor)
+{
+	if (!Actor || Category >= EEntityCategory::Count) return;
+
+	// One record per actor: re-registering under a new key moves it
+	if (const int32* Existing = ActorToSlot.Find(Actor))
+	{
+		const FEntityRecord& Rec = Records[*Existing];
+		if (Rec.Category == Category && Rec.Id == Id) return;
+		RemoveSlot(*Existing);
+	}
+
+	TMap<int32, int32>& ById = SlotById[static_cast<int32>(Category)];
+	if (const int32* Slot = ById.Find(Id))
+	{
+		RemoveSlot(*Slot);
+	}
+
+	FEntityRecord Rec;
+	Rec.Actor = Actor;
+	Rec.Category = Category;
+	Rec.Id = Id;
+	Rec.Location = FVector2D(Actor->GetActorLocation());
+	Rec.Cell = CellOf(Rec.Location);
+
+	const int32 NewSlot = Records.Add(MoveTemp(Rec));
+	ById.Add(Id, NewSlot);
+	ActorToSlot.Add(Actor, NewSlot);
+	AddToCell(NewSlot);
+}
+
+void UEntityRegistrySubsystem::Unregister(EEntityCategory Category, int32 Id)
+{
+	if (Category >= EEntityCategory::Count) return;
+	if (const int32* Slot = SlotById[static_cast<int32>(Category)].Find(Id))
+	{
+		RemoveSlot(*Slot);
+	}
+}
+
+void UEntityRegistrySubsystem::UnregisterActor(AActor* Actor)
+{
+	if (const int32* Slot = ActorToSlot.Find(Actor))
+	{
+		RemoveSlot(*Slot);
+	}
+}
+
+void UEntityRegistrySubsystem::RemoveSlot(int32 Slot)
+{
+	// Copy: the TMap lookups that lead here can point into maps we modify below
+	const FEntityRecord Rec = Records[Slot];
+
+	RemoveFromCell(Slot);
+	SlotById[static_cast<int32>(Rec.Category)].Remove(Rec.Id);
+	if (const int32* Mapped = ActorToSlot.Find(Rec.Actor))
+	{
+		if (*Mapped == Slot) ActorToSlot.Remove(Rec.Actor);
+	}
+	Records.RemoveAt(Slot);
+}
+
+// ============================================================
+// Lookups
+// ============================================================
+
+AActor* UEntityRegistrySubsystem::Find(EEntityCategory Category, int32 Id) const
+{
+	if (Category >= EEntityCategory::Count) return nullptr;
+	const int32* Slot = SlotById[static_cast<int32>(Category)].Find(Id);
+	return Slot ? Records[*Slot].Actor.Get() : nullptr;
+}
+
+// ============================================================
+// Spatial hash
+// ============================================================
+
+FIntPoint UEntityRegistrySubsystem::CellOf(const FVector2D& Location) const
+{
+	return FIntPoint(
+		FMath::FloorToInt32(Location.X / CellSize),
+		FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+void UEntityRegistrySubsystem::AddToCell(int32 Slot)
+{
+	Cells.FindOrAdd(Records[Slot].Cell).Add(Slot);
+}
+
+void UEntityRegistrySubsystem::RemoveFromCell(int32 Slot)
+{
+	const FIntPoint Cell = Records[Slot].Cell;
+	if (TArray<int32>* Bucket = Cells.Find(Cell))
+	{
+		Bucket->RemoveSingleSwap(Slot, EAllowShrinking::No);
+		if (Bucket->IsEmpty())
+		{
+			Cells.Remove(Cell);
+		}
+	}
+}
+
+void UEntityRegistrySubsystem::RefreshCells()
+{
+	if (RefreshedFrame == GFrameCounter) return;
+	RefreshedFrame = GFrameCounter;
+
+	LastFrameQueries = NumQueriesThisFrame;
+	NumQueriesThisFrame = 0;
+	LastRefreshMoves = 0;
+	LastRefreshPurged = 0;
+
+	TArray<int32, TInlineAllocator<16>> Dead;
+	for (auto It = Records.CreateIterator(); It; ++It)
+	{
+		FEntityRecord& Rec = *It;
+		const AActor* Actor = Rec.Actor.Get();
+		if (!Actor)
+		{
+			Dead.Add(It.GetIndex());
+			continue;
+		}
+
+		Rec.Location = FVector2D(Actor->GetActorLocation());
+		const FIntPoint NewCell = CellOf(Rec.Location);
+		if (NewCell != Rec.Cell)
+		{
+			RemoveFromCell(It.GetIndex());
+			Rec.Cell = NewCell;
+			AddToCell(It.GetIndex());
+			++LastRefreshMoves;
+		}
+	}
+
+	for (int32 Slot : Dead)
+	{
+		RemoveSlot(Slot);
+	}
+	LastRefreshPurged = Dead.Num();
+}
+
+template <typename FuncType>
+void UEntityRegistrySubsystem::ForEachInCells(const FVector2D& Min, const FVector2D& Max, uint32 Mask, FuncType&& Func)
+{
+	RefreshCells();
+	++NumQueriesThisFrame;
+
+	const FIntPoint CellMin = CellOf(Min);
+	const FIntPoint CellMax = CellOf(Max);
+
+	// A huge query rect would walk mostly empty cells — scan the occupied ones instead
+	const int64 SpanCells = (int64)(CellMax.X - CellMin.X + 1) * (int64)(CellMax.Y - CellMin.Y + 1);
+	if (SpanCells > Cells.Num())
+	{
+		for (const TPair<FIntPoint, TArray<int32>>& Pair : Cells)
+		{
+			if (Pair.Key.X < CellMin.X || Pair.Key.X > CellMax.X || Pair.Key.Y < CellMin.Y || Pair.Key.Y > CellMax.Y)
+				continue;
+			for (int32 Slot : Pair.Value)
+			{
+				const FEntityRecord& Rec = Records[Slot];
+				if (Mask & EntityMask::Of(Rec.Category)) Func(Rec);
+			}
+		}
+		return;
+	}
+
+	for (int32 CY = CellMin.Y; CY <= CellMax.Y; ++CY)
+	{
+		for (int32 CX = CellMin.X; CX <= CellMax.X; ++CX)
+		{
+			const TArray<int32>* Bucket = Cells.Find(FIntPoint(CX, CY));
+			if (!Bucket) continue;
+			for (int32 Slot : *Bucket)
+			{
+				const FEntityRecord& Rec = Records[Slot];
+				if (Mask & EntityMask::Of(Rec.Category)) Func(Rec);
+			}
+		}
+	}
+}
+
+void UEntityRegistrySubsystem::QueryRadius(const FVector& Center, float Radius, uint32 Mask, TArray<AActor*>& OutActors)
+{
+	const FVector2D C(Center);
+	const FVector2D Extent(Radius, Radius);
+	const double RadiusSq = (double)Radius * Radius;
+
+	ForEachInCells(C - Extent, C + Extent, Mask, [&](const FEntityRecord& Rec)
+	{
+		if (FVector2D::DistSquared(Rec.Location, C) <= RadiusSq)
+		{
+			if (AActor* Actor = Rec.Actor.Get()) OutActors.Add(Actor);
+		}
+	});
+}
+
+void UEntityRegistrySubsystem::QueryRect(const FBox2D& Rect, uint32 Mask, TArray<AActor*>& OutActors)
+{
+	ForEachInCells(Rect.Min, Rect.Max, Mask, [&](const FEntityRecord& Rec)
+	{
+		if (Rect.IsInside(Rec.Location))
+		{
+			if (AActor* Actor = Rec.Actor.Get()) OutActors.Add(Actor);
+		}
+	});
+}
+
+// ============================================================
+// Stats
+// ============================================================
+
+void UEntityRegistrySubsystem::LogStats() const
+{
+	FString PerCategory;
+	for (int32 i = 0; i < static_cast<int32>(EEntityCategory::Count); ++i)
+	{
+		PerCategory += FString::Printf(TEXT("%s%d %s"), i ? TEXT(", ") : TEXT(""),
+			SlotById[i].Num(), CategoryName(static_cast<EEntityCategory>(i)));
+	}
+
+	int32 MaxBucket = 0;
+	for (const TPair<FIntPoint, TArray<int32>>& Pair : Cells)
+	{
+		MaxBucket = FMath::Max(MaxBucket, Pair.Value.Num());
+	}
+
+	UE_LOG(LogEntityRegistry, Log,
+		TEXT("Entity registry: %d records (%s); %d occupied cells of %.0f uu, max %d per cell; last frame %d queries, %d re-bucketed, %d purged"),
+		Records.Num(), *PerCategory, Cells.Num(), CellSize, MaxBucket, LastFrameQueries, LastRefreshMoves, LastRefreshPurged);
+}
@@ -0,0 +1,127 @@
+// EntityRegistrySubsystem.h — Central id → actor registry with a uniform-grid spatial hash.
+// The subsystems that spawn world entities (remote players, enemies, ground items, pets /
+// homunculi / companion visuals) and the placed NPC classes register their actors here under
+// (category, server id). Consumers get O(1) id lookups, per-category iteration, and radius /
+// rectangle queries over a 2D grid instead of walking every actor in the level with
+// TActorIterator.
+//
+// Cell membership is refreshed lazily, once per frame on the first spatial query, from the
+// actors' current locations. Destroyed actors are purged in the same pass, so an owner that
+// forgets to Unregister only leaves a dead record until the next query.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Containers/SparseArray.h"
+#include "EntityRegistrySubsystem.generated.h"
+
+enum class EEntityCategory : uint8
+{
+	Player,       // remote players (id = characterId)
+	Enemy,        // id = enemyId
+	NPC,          // placed NPCs (id = UObject unique id)
+	GroundItem,   // id = groundItemId
+	Companion,    // pets, homunculi, carts / mounts / falcons
+	Count
+};
+
+/** Bitmask helpers for category-filtered queries */
+namespace EntityMask
+{
+	constexpr uint32 Of(EEntityCategory Category) { return 1u << static_cast<uint32>(Category); }
+
+	constexpr uint32 Player     = Of(EEntityCategory::Player);
+	constexpr uint32 Enemy      = Of(EEntityCategory::Enemy);
+	constexpr uint32 NPC        = Of(EEntityCategory::NPC);
+	constexpr uint32 GroundItem = Of(EEntityCategory::GroundItem);
+	constexpr uint32 Companion  = Of(EEntityCategory::Companion);
+	constexpr uint32 All        = (1u << static_cast<uint32>(EEntityCategory::Count)) - 1u;
+}
+
+UCLASS()
+class SABRIMMO_API UEntityRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	// ---- Registration ----
+
+	/** Add or re-point (Category, Id) at Actor */
+	void Register(EEntityCategory Category, int32 Id, AActor* Actor);
+	void Unregister(EEntityCategory Category, int32 Id);
+	/** Drop whatever record points at Actor (for owners that don't track the id) */
+	void UnregisterActor(AActor* Actor);
+
+	// ---- Lookups ----
+
+	/** O(1); nullptr if unknown or the actor is gone */
+	AActor* Find(EEntityCategory Category, int32 Id) const;
+
+	int32 Num(EEntityCategory Category) const { return SlotById[static_cast<int32>(Category)].Num(); }
+
+	/** Visit every live actor in Category */
+	template <typename FuncType>
+	void ForEach(EEntityCategory Category, FuncType&& Func) const
+	{
+		for (const TPair<int32, int32>& Pair : SlotById[static_cast<int32>(Category)])
+		{
+			if (AActor* Actor = Records[Pair.Value].Actor.Get())
+			{
+				Func(Pair.Key, Actor);
+			}
+		}
+	}
+
+	// ---- Spatial queries (XY plane) ----
+
+	/** Actors in Mask whose horizontal distance from Center is within Radius */
+	void QueryRadius(const FVector& Center, float Radius, uint32 Mask, TArray<AActor*>& OutActors);
+
+	/** Actors in Mask whose XY location lies inside Rect */
+	void QueryRect(const FBox2D& Rect, uint32 Mask, TArray<AActor*>& OutActors);
+
+	void LogStats() const;
+
+private:
+	struct FEntityRecord
+	{
+		TWeakObjectPtr<AActor> Actor;
+		EEntityCategory Category = EEntityCategory::Player;
+		int32 Id = 0;
+		FVector2D Location = FVector2D::ZeroVector;
+		FIntPoint Cell = FIntPoint::ZeroValue;
+	};
+
+	FIntPoint CellOf(const FVector2D& Location) const;
+	void AddToCell(int32 Slot);
+	void RemoveFromCell(int32 Slot);
+	void RemoveSlot(int32 Slot);
+
+	/** Re-bucket moved actors and purge dead ones (once per frame) */
+	void RefreshCells();
+
+	/** Visit records of Mask in the cells overlapping [Min, Max] */
+	template <typename FuncType>
+	void ForEachInCells(const FVector2D& Min, const FVector2D& Max, uint32 Mask, FuncType&& Func);
+
+	TSparseArray<FEntityRecord> Records;
+	/** Per category: id → slot in Records */
+	TMap<int32, int32> SlotById[static_cast<int32>(EEntityCategory::Count)];
+	TMap<TWeakObjectPtr<AActor>, int32> ActorToSlot;
+
+	TMap<FIntPoint, TArray<int32>> Cells;
+	float CellSize = 1000.f;
+	uint64 RefreshedFrame = MAX_uint64;
+
+	// Stats for EntityRegistry.Stats
+	int32 NumQueriesThisFrame = 0;
+	int32 LastFrameQueries = 0;
+	int32 LastRefreshMoves = 0;
+	int32 LastRefreshPurged = 0;
+};
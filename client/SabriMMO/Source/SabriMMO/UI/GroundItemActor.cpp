@@ -1,17 +1,46 @@
 #include "GroundItemActor.h"
 #include "Components/BoxComponent.h"
 #include "Components/WidgetComponent.h"
-#include "Engine/Texture2D.h"
 #include "Widgets/Images/SImage.h"
+#include "Widgets/Layout/SBox.h"
 #include "Widgets/Text/STextBlock.h"
 #include "Styling/SlateBrush.h"
-#include "EngineUtils.h"
-#include "InventorySubsystem.h"
+#include "IconCacheSubsystem.h"
+#include "SIconImage.h"
+#include "EntityRegistrySubsystem.h"
+#include "ZoneHeightfieldSubsystem.h"
 #include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
 #include "Styling/CoreStyle.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogGroundItem, Log, All);
 
+// Ground traces are vertical, so only entities this close (XY) to the trace can block them
+static constexpr float GroundTraceIgnoreRadius = 400.f;
+
+// Ignore the local pawn and registered entities (players, enemies, NPCs, companions, other
+// ground items) near Pos — the trace should only hit terrain. Sprites only block Visibility.
+static void IgnoreEntitiesNear(UWorld* World, const FVector& Pos, FCollisionQueryParams& Params)
+{
+	if (APlayerController* PC = World->GetFirstPlayerController())
+	{
+		if (APawn* LocalPawn = PC->GetPawn())
+		{
+			Params.AddIgnoredActor(LocalPawn);
+		}
+	}
+
+	UEntityRegistrySubsystem* Registry = World->GetSubsystem<UEntityRegistrySubsystem>();
+	if (!Registry) return;
+
+	TArray<AActor*> Nearby;
+	Registry->QueryRadius(Pos, GroundTraceIgnoreRadius, EntityMask::All, Nearby);
+	for (AActor* Actor : Nearby)
+	{
+		Params.AddIgnoredActor(Actor);
+	}
+}
+
 AGroundItemActor::AGroundItemActor()
 {
 	PrimaryActorTick.bCanEverTick = true;
@@ -64,22 +93,17 @@ void AGroundItemActor::SnapToGround()
 	if (!World) return;
 
 	FVector Loc = GetActorLocation();
-	FVector Start = FVector(Loc.X, Loc.Y, Loc.Z + 500.f);
-	FVector End   = FVector(Loc.X, Loc.Y, Loc.Z - 2000.f);
-	FHitResult Hit;
-	FCollisionQueryParams Params;
-	Params.AddIgnoredActor(this);
-
-	// Ignore all pawns, sprites, and ground items — only hit terrain
-	for (TActorIterator<APawn> PIt(World); PIt; ++PIt)
-		Params.AddIgnoredActor(*PIt);
-	for (TActorIterator<AGroundItemActor> GIt(World); GIt; ++GIt)
-		Params.AddIgnoredActor(*GIt);
-
-	if (World->LineTraceSingleByChannel(Hit, Start, End, ECC_WorldStatic, Params))
+	float GroundZ = 0.f;
+	if (!UZoneHeightfieldSubsystem::SampleGroundZ(World, Loc, GroundZ))
 	{
-		SetActorLocation(FVector(Loc.X, Loc.Y, Hit.ImpactPoint.Z));
+		// Multi-level cell or no cooked heightfield — trace, ignoring nearby entities
+		FCollisionQueryParams Params;
+		Params.AddIgnoredActor(this);
+		IgnoreEntitiesNear(World, Loc, Params);
+		if (!UZoneHeightfieldSubsystem::TraceGroundZ(World, Loc, Params, GroundZ))
+			return;
 	}
+	SetActorLocation(FVector(Loc.X, Loc.Y, GroundZ));
 }
 
 void AGroundItemActor::Tick(float DeltaTime)
@@ -118,7 +142,10 @@ void AGroundItemActor::Tick(float DeltaTime)
 
 		if (Alpha >= 1.f)
 		{
-			Destroy();
+			if (UActorPoolSubsystem* Pool = GetWorld()->GetSubsystem<UActorPoolSubsystem>())
+				Pool->Release(this);
+			else
+				Destroy();
 		}
 	}
 }
@@ -152,33 +179,18 @@ void AGroundItemActor::InitGroundItem(int32 InGroundItemId, const FString& InIte
 		);
 	}
 
-	// Get icon texture from InventorySubsystem (single source of truth for icon loading)
-	UWorld* World = GetWorld();
-	if (World)
-	{
-		if (UInventorySubsystem* InvSub = World->GetSubsystem<UInventorySubsystem>())
-		{
-			FSlateBrush* Brush = InvSub->GetOrCreateItemIconBrush(InIcon);
-			if (Brush)
-			{
-				IconTexture = Cast<UTexture2D>(Brush->GetResourceObject());
-			}
-		}
-	}
-
-	// Set up icon widget
-	if (IconTexture)
+	// Shared icon cache brush (placeholder until the texture streams in), drawn at 32px
+	UIconCacheSubsystem* Icons = UIconCacheSubsystem::Get(this);
+	TSharedPtr<const FSlateBrush> Brush = Icons ? Icons->GetItemIcon(InIcon) : nullptr;
+	if (Brush)
 	{
-
-		IconBrush = MakeShared<FSlateBrush>();
-		IconBrush->SetResourceObject(IconTexture);
-		IconBrush->ImageSize = FVector2D(32.f, 32.f);
-		IconBrush->DrawAs = ESlateBrushDrawType::Image;
-
 		if (IconWidget)
 		{
 			IconWidget->SetSlateWidget(
-				SNew(SImage).Image(IconBrush.Get())
+				SNew(SBox).WidthOverride(32.f).HeightOverride(32.f)
+				[
+					SNew(SIconImage).Icon(Brush)
+				]
 			);
 		}
 	}
@@ -199,26 +211,22 @@ void AGroundItemActor::PlayDropArc(const FVector& SourcePos, const FVector& Fina
 	ArcStart = SourcePos;
 	ArcEnd = FinalPos;
 
-	// Ground-snap both endpoints — ignore all pawns and ground items, only hit terrain
+	// Ground-snap both endpoints — heightfield first, trace (ignoring nearby entities) otherwise
 	UWorld* World = GetWorld();
 	if (World)
 	{
-		FCollisionQueryParams Params;
-		Params.AddIgnoredActor(this);
-		for (TActorIterator<APawn> PIt(World); PIt; ++PIt)
-			Params.AddIgnoredActor(*PIt);
-		for (TActorIterator<AGroundItemActor> GIt(World); GIt; ++GIt)
-			Params.AddIgnoredActor(*GIt);
-
-		auto SnapZ = [&](FVector& Pos)
+		auto SnapZ = [this, World](FVector& Pos)
 		{
-			FVector Start = FVector(Pos.X, Pos.Y, Pos.Z + 500.f);
-			FVector End   = FVector(Pos.X, Pos.Y, Pos.Z - 2000.f);
-			FHitResult Hit;
-			if (World->LineTraceSingleByChannel(Hit, Start, End, ECC_WorldStatic, Params))
+			float GroundZ = 0.f;
+			if (!UZoneHeightfieldSubsystem::SampleGroundZ(World, Pos, GroundZ))
 			{
-				Pos.Z = Hit.ImpactPoint.Z;
+				FCollisionQueryParams Params;
+				Params.AddIgnoredActor(this);
+				IgnoreEntitiesNear(World, Pos, Params);
+				if (!UZoneHeightfieldSubsystem::TraceGroundZ(World, Pos, Params, GroundZ))
+					return;
 			}
+			Pos.Z = GroundZ;
 		};
 
 		SnapZ(ArcStart);
@@ -235,7 +243,7 @@ void AGroundItemActor::PlayDropArc(const FVector& SourcePos, const FVector& Fina
 	SetActorTickEnabled(true);
 }
 
-void AGroundItemActor::FadeOutAndDestroy(float Duration)
+void AGroundItemActor::FadeOutAndRelease(float Duration)
 {
 	bFadingOut = true;
 	FadeDuration = FMath::Max(Duration, 0.1f);
@@ -260,3 +268,27 @@ void AGroundItemActor::SetNameVisible(bool bVisible)
 		NameWidget->SetVisibility(bVisible);
 	}
 }
+
+void AGroundItemActor::OnAcquiredFromPool()
+{
+	if (IconWidget)
+	{
+		IconWidget->SetVisibility(true);
+	}
+}
+
+void AGroundItemActor::OnReleasedToPool()
+{
+	GroundItemId = 0;
+	bAnimatingArc = false;
+	bFadingOut = false;
+	SetActorScale3D(FVector::OneVector);
+	SetClickable(true);
+	SetNameVisible(false);
+
+	// Screen-space widgets draw on the viewport layer; hide them along with the actor
+	if (IconWidget)
+	{
+		IconWidget->SetVisibility(false);
+	}
+}
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "ActorPoolSubsystem.h"
 #include "GroundItemActor.generated.h"
 
 class UBoxComponent;
@@ -11,9 +12,10 @@ class UWidgetComponent;
  * World actor representing an item on the ground.
  * Two screen-space UWidgetComponents: icon + name label (hover-only).
  * BoxComponent provides click/hover detection via ECC_Visibility.
+ * Pooled by UGroundItemSubsystem: picked-up and faded-out items are parked for the next drop.
  */
 UCLASS()
-class SABRIMMO_API AGroundItemActor : public AActor
+class SABRIMMO_API AGroundItemActor : public AActor, public IPooledActor
 {
 	GENERATED_BODY()
 
@@ -26,7 +28,8 @@ public:
 
 	void PlayDropArc(const FVector& SourcePos, const FVector& FinalPos, float Duration = 0.4f);
 	void SnapToGround();
-	void FadeOutAndDestroy(float Duration = 0.5f);
+	/** Shrink out, then go back to the actor pool */
+	void FadeOutAndRelease(float Duration = 0.5f);
 
 	int32 GetGroundItemId() const { return GroundItemId; }
 	void SetClickable(bool bClickable);
@@ -34,13 +37,14 @@ public:
 
 	virtual void Tick(float DeltaTime) override;
 
+	// IPooledActor
+	virtual void OnAcquiredFromPool() override;
+	virtual void OnReleasedToPool() override;
+
 private:
 	UPROPERTY(VisibleAnywhere) UBoxComponent* ClickBox = nullptr;
 	UPROPERTY(VisibleAnywhere) UWidgetComponent* IconWidget = nullptr;
 	UPROPERTY(VisibleAnywhere) UWidgetComponent* NameWidget = nullptr;
-	UPROPERTY() UTexture2D* IconTexture = nullptr;
-
-	TSharedPtr<FSlateBrush> IconBrush;
 
 	int32 GroundItemId = 0;
 
@@ -1,5 +1,7 @@
 #include "GroundItemSubsystem.h"
 #include "GroundItemActor.h"
+#include "EntityRegistrySubsystem.h"
+#include "ActorPoolSubsystem.h"
 #include "SabriMMO/MMOGameInstance.h"
 #include "SabriMMO/SocketEventRouter.h"
 #include "Audio/AudioSubsystem.h"
@@ -164,13 +166,15 @@ void UGroundItemSubsystem::HandleItemGroundList(const TSharedPtr<FJsonValue>& Da
 	const TArray<TSharedPtr<FJsonValue>>* ItemsArr = nullptr;
 	if (!(*Obj)->TryGetArrayField(TEXT("items"), ItemsArr)) return;
 
-	// Clear existing ground items (zone transition — fresh state)
+	// Clear existing ground items (zone transition — fresh state); actors go back to the pool
+	UActorPoolSubsystem* Pool = GetWorld() ? GetWorld()->GetSubsystem<UActorPoolSubsystem>() : nullptr;
 	for (auto& Pair : GroundItemMap)
 	{
-		if (Pair.Value.Actor.IsValid())
-		{
+		if (!Pair.Value.Actor.IsValid()) continue;
+		if (Pool)
+			Pool->Release(Pair.Value.Actor.Get());
+		else
 			Pair.Value.Actor->Destroy();
-		}
 	}
 	GroundItemMap.Empty();
 	ActorToGroundItemId.Empty();
@@ -288,14 +292,20 @@ void UGroundItemSubsystem::SpawnGroundItemFromJson(const TSharedPtr<FJsonObject>
 	// Spawn at server position — actor's BeginPlay handles ground-snap via line trace
 	FVector SpawnLoc = Entry.Position;
 
-	AGroundItemActor* Actor = World->SpawnActor<AGroundItemActor>(
-		AGroundItemActor::StaticClass(), SpawnLoc, FRotator::ZeroRotator, Params);
+	// Picked-up / despawned items are parked in the actor pool — reuse one when available
+	AGroundItemActor* Actor = nullptr;
+	if (UActorPoolSubsystem* Pool = World->GetSubsystem<UActorPoolSubsystem>())
+		Actor = Pool->Acquire<AGroundItemActor>(NAME_None, SpawnLoc);
+	else
+		Actor = World->SpawnActor<AGroundItemActor>(AGroundItemActor::StaticClass(), SpawnLoc, FRotator::ZeroRotator, Params);
 
 	if (Actor)
 	{
 		Actor->InitGroundItem(GId, Entry.ItemName, Entry.Icon, Entry.TierColor, Entry.Quantity);
 		Entry.Actor = Actor;
 		ActorToGroundItemId.Add(Actor, GId);
+		if (UEntityRegistrySubsystem* Registry = World->GetSubsystem<UEntityRegistrySubsystem>())
+			Registry->Register(EEntityCategory::GroundItem, GId, Actor);
 
 		if (bPlaySound)
 		{
@@ -349,7 +359,11 @@ void UGroundItemSubsystem::RemoveGroundItem(int32 GroundItemId, bool bFade)
 		ActorToGroundItemId.Remove(Entry->Actor.Get());
 		if (bFade)
 		{
-			Entry->Actor->FadeOutAndDestroy(0.5f);
+			Entry->Actor->FadeOutAndRelease(0.5f);
+		}
+		else if (UActorPoolSubsystem* Pool = GetWorld()->GetSubsystem<UActorPoolSubsystem>())
+		{
+			Pool->Release(Entry->Actor.Get());
 		}
 		else
 		{
@@ -358,4 +372,6 @@ void UGroundItemSubsystem::RemoveGroundItem(int32 GroundItemId, bool bFade)
 	}
 
 	GroundItemMap.Remove(GroundItemId);
+	if (UEntityRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UEntityRegistrySubsystem>())
+		Registry->Unregister(EEntityCategory::GroundItem, GroundItemId);
 }
@@ -4,6 +4,8 @@
 #include "HomunculusSubsystem.h"
 #include "MMOGameInstance.h"
 #include "SocketEventRouter.h"
+#include "EntityRegistrySubsystem.h"
+#include "SnapshotInterpolationSubsystem.h"
 #include "Sprite/SpriteCharacterActor.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
@@ -698,6 +700,8 @@ void UHomunculusSubsystem::SpawnHomunculusActor()
 	Sprite->SetActorScale3D(FVector(0.7f)); // ~70% scale, slightly bigger than the BP placeholder
 	Sprite->bUseServerMovement = false;     // local-controlled follow (own homunculus)
 	HomActor = Sprite;
+	if (UEntityRegistrySubsystem* Registry = World->GetSubsystem<UEntityRegistrySubsystem>())
+		Registry->Register(EEntityCategory::Companion, (int32)Sprite->GetUniqueID(), Sprite);
 
 	UE_LOG(LogHomUI, Log, TEXT("Spawned homunculus sprite (%s → %s) for type=%s"),
 		*HomunculusName, *SpriteClass, *HomunculusType);
@@ -713,6 +717,8 @@ void UHomunculusSubsystem::DespawnHomunculusActor()
 {
 	if (HomActor)
 	{
+		if (UEntityRegistrySubsystem* Registry = GetWorld() ? GetWorld()->GetSubsystem<UEntityRegistrySubsystem>() : nullptr)
+			Registry->UnregisterActor(HomActor);
 		HomActor->Destroy();
 		HomActor = nullptr;
 	}
@@ -783,9 +789,10 @@ void UHomunculusSubsystem::HandleOtherSummoned(const TSharedPtr<FJsonValue>& Dat
 
 	Sprite->SetBodyClass(GetSpriteClassForHomunculusType(RemoteType));
 	Sprite->SetActorScale3D(FVector(0.7f));
-	Sprite->bUseServerMovement = true;
-	Sprite->ServerTargetPos = FVector(X, Y, Z);
+	Sprite->ResetServerTargetPosition(FVector(X, Y, Z));
 	RemoteHomActors.Add(OwnerId, Sprite);
+	if (UEntityRegistrySubsystem* Registry = World->GetSubsystem<UEntityRegistrySubsystem>())
+		Registry->Register(EEntityCategory::Companion, (int32)Sprite->GetUniqueID(), Sprite);
 }
 
 void UHomunculusSubsystem::HandleOtherDismissed(const TSharedPtr<FJsonValue>& Data)
@@ -817,13 +824,26 @@ void UHomunculusSubsystem::HandlePosition(const TSharedPtr<FJsonValue>& Data)
 	Obj->TryGetNumberField(TEXT("z"), Z);
 	const int32 OwnerId = (int32)OwnerD;
 
+	// The follow tick sends moving=false once when the homunculus comes to rest
+	bool bMoving = true;
+	Obj->TryGetBoolField(TEXT("moving"), bMoving);
+
 	if (RemoteHomActors.Contains(OwnerId))
 	{
 		AActor* Actor = RemoteHomActors[OwnerId];
 		if (Actor)
 		{
 			ASpriteCharacterActor* Sprite = Cast<ASpriteCharacterActor>(Actor);
-			if (Sprite) Sprite->ServerTargetPos = FVector(X, Y, Z);
+			if (Sprite)
+			{
+				// Server follow tick is 5Hz; the snapshot buffer smooths it like other remote movement
+				double Timestamp = 0;
+				Obj->TryGetNumberField(TEXT("timestamp"), Timestamp);
+				USnapshotInterpolationSubsystem* Interp = Timestamp > 0 ? GetWorld()->GetSubsystem<USnapshotInterpolationSubsystem>() : nullptr;
+				if (Interp) Interp->BeginPacket(static_cast<uint32>(static_cast<uint64>(Timestamp)));
+				Sprite->SetServerTargetPosition(FVector(X, Y, Z), bMoving, Sprite->ServerMoveSpeed);
+				if (Interp) Interp->EndPacket();
+			}
 		}
 	}
 }
@@ -5,6 +5,7 @@
 #include "SHotbarKeybindWidget.h"
 #include "InventorySubsystem.h"
 #include "SkillTreeSubsystem.h"
+#include "IconCacheSubsystem.h"
 #include "MMOGameInstance.h"
 #include "SocketEventRouter.h"
 #include "Engine/World.h"
@@ -878,24 +879,19 @@ bool UHotbarSubsystem::CheckAndRefreshIfInventoryChanged()
 }
 
 // ============================================================
-// Icon utilities (delegate to other subsystems)
+// Icon utilities
 // ============================================================
 
-FSlateBrush* UHotbarSubsystem::GetItemIconBrush(const FString& IconName)
+const FSlateBrush* UHotbarSubsystem::GetItemIconBrush(const FString& IconName)
 {
-	if (UInventorySubsystem* InvSub = GetWorld()->GetSubsystem<UInventorySubsystem>())
-	{
-		return InvSub->GetOrCreateItemIconBrush(IconName);
-	}
-	return nullptr;
+	UIconCacheSubsystem* Icons = UIconCacheSubsystem::Get(GetWorld());
+	return Icons ? Icons->GetItemIcon(IconName).Get() : nullptr;
 }
 
-FSlateBrush* UHotbarSubsystem::GetSkillIconBrush(const FString& IconName)
+const FSlateBrush* UHotbarSubsystem::GetSkillIconBrush(const FString& IconName)
 {
-	if (USkillTreeSubsystem* SkillSub = GetWorld()->GetSubsystem<USkillTreeSubsystem>())
-	{
-		FString ContentPath = SkillSub->ResolveIconContentPath(IconName);
-		return SkillSub->GetOrCreateIconBrush(ContentPath);
-	}
-	return nullptr;
+	UIconCacheSubsystem* Icons = UIconCacheSubsystem::Get(GetWorld());
+	USkillTreeSubsystem* SkillSub = GetWorld()->GetSubsystem<USkillTreeSubsystem>();
+	if (!Icons || !SkillSub) return nullptr;
+	return Icons->GetSkillIcon(SkillSub->ResolveIconContentPath(IconName)).Get();
 }
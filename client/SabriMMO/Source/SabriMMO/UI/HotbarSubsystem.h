@@ -134,9 +134,10 @@ public:
 	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
 	virtual void Deinitialize() override;
 
-	// ---- icon utilities (delegate to InventorySubsystem/SkillTreeSubsystem) ----
-	FSlateBrush* GetItemIconBrush(const FString& IconName);
-	FSlateBrush* GetSkillIconBrush(const FString& IconName);
+	// ---- icon utilities (brushes from UIconCacheSubsystem; skill names resolved by SkillTreeSubsystem) ----
+	// For per-paint lookups only: the lookup itself keeps the icon resident, the raw pointer does not
+	const FSlateBrush* GetItemIconBrush(const FString& IconName);
+	const FSlateBrush* GetSkillIconBrush(const FString& IconName);
 
 	// ---- delegate for widget refresh ----
 	DECLARE_MULTICAST_DELEGATE(FOnHotbarDataUpdated);
@@ -0,0 +1,491 @@
+// IconCacheSubsystem.cpp — Shared async item / skill icon cache (see header).
+
+#include "IconCacheSubsystem.h"
+#include "Engine/AssetManager.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/Texture2D.h"
+#include "Engine/World.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "AssetRegistry/AssetData.h"
+#include "Misc/PackageName.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogIconCache, Log, All);
+
+static TAutoConsoleVariable<int32> CVarIconsAsync(
+	TEXT("Icons.Async"),
+	1,
+	TEXT("1 = stream icon textures in the background behind a placeholder (default).\n")
+	TEXT("0 = load on first request, blocking the game thread."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarIconsMaxResident(
+	TEXT("Icons.MaxResident"),
+	256,
+	TEXT("Icon textures kept loaded; the least recently used beyond this go back to the placeholder."),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorldAndArgs GIconsStatsCmd(
+	TEXT("Icons.Stats"),
+	TEXT("Print icon cache residency, load and hit counts."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UIconCacheSubsystem* Icons = UIconCacheSubsystem::Get(World))
+		{
+			Icons->LogStats();
+		}
+	}));
+
+namespace
+{
+	const TCHAR* ItemIconRoot = TEXT("/Game/SabriMMO/Assets/Item_Icons");
+
+	// Convention folders, in lookup order (a name present in two resolves to the first)
+	const TCHAR* const ItemIconFolders[] = {
+		TEXT("consumables"), TEXT("etc_crafting"), TEXT("weapons"), TEXT("headgear"),
+		TEXT("accessories"), TEXT("armor"), TEXT("garments"), TEXT("footgear"), TEXT("shields")
+	};
+
+	// Assets imported under a creative name instead of Icon_<server icon name>
+	struct FRenamedIcon
+	{
+		const TCHAR* IconName;
+		const TCHAR* Folder;
+		const TCHAR* Asset;
+	};
+	const FRenamedIcon RenamedItemIcons[] = {
+		// Consumables — potions, herbs, food
+		{ TEXT("red_potion"),     TEXT("consumables"),  TEXT("CrimsonVial") },
+		{ TEXT("orange_potion"),  TEXT("consumables"),  TEXT("AmberElixir") },
+		{ TEXT("yellow_potion"),  TEXT("consumables"),  TEXT("GoldenSalve") },
+		{ TEXT("blue_potion"),    TEXT("consumables"),  TEXT("AzurePhilter") },
+		{ TEXT("meat"),           TEXT("consumables"),  TEXT("RoastedHaunch") },
+		{ TEXT("strawberry"),     TEXT("consumables"),  TEXT("Strawberry") },
+		{ TEXT("green_herb"),     TEXT("consumables"),  TEXT("VerdantLeaf") },
+		{ TEXT("red_herb"),       TEXT("consumables"),  TEXT("CrimsonHerb") },
+		{ TEXT("grape"),          TEXT("consumables"),  TEXT("PurpleGrape") },
+		{ TEXT("apple"),          TEXT("consumables"),  TEXT("RubyApple") },
+		{ TEXT("carrot"),         TEXT("consumables"),  TEXT("GoldenCarrot") },
+		{ TEXT("orange"),         TEXT("consumables"),  TEXT("SunburstOrange") },
+		{ TEXT("baked_yam"),      TEXT("consumables"),  TEXT("EarthenTuber") },
+		// Etc / Crafting — loot, materials, ores
+		{ TEXT("jellopy"),        TEXT("etc_crafting"), TEXT("GloopyResidue") },
+		{ TEXT("sticky_mucus"),   TEXT("etc_crafting"), TEXT("ViscousSlime") },
+		{ TEXT("shell"),          TEXT("etc_crafting"), TEXT("ChitinShard") },
+		{ TEXT("feather"),        TEXT("etc_crafting"), TEXT("DownyPlume") },
+		{ TEXT("mushroom_spore"), TEXT("etc_crafting"), TEXT("SporeCluster") },
+		{ TEXT("long_limb"),      TEXT("etc_crafting"), TEXT("BarbedLimb") },
+		{ TEXT("fluff"),          TEXT("etc_crafting"), TEXT("SilkenTuft") },
+		// Weapons
+		{ TEXT("knife"),          TEXT("weapons"),      TEXT("RusticShiv") },
+		{ TEXT("cutter"),         TEXT("weapons"),      TEXT("KeenEdge") },
+		{ TEXT("main_gauche"),    TEXT("weapons"),      TEXT("StilettoFang") },
+		{ TEXT("sword"),          TEXT("weapons"),      TEXT("IronCleaver") },
+		{ TEXT("falchion"),       TEXT("weapons"),      TEXT("CrescentSaber") },
+		{ TEXT("bow"),            TEXT("weapons"),      TEXT("HuntingLongbow") },
+		// Armor — body armor
+		{ TEXT("cotton_shirt"),   TEXT("armor"),        TEXT("LinenTunic") },
+		{ TEXT("padded_armor"),   TEXT("armor"),        TEXT("QuiltedVest") },
+		{ TEXT("chain_mail"),     TEXT("armor"),        TEXT("RingweaveHauberk") },
+	};
+
+	// Every card shares one icon (card icon names end with "_card")
+	const TCHAR* CardIconPath = TEXT("/Game/SabriMMO/Assets/Item_Icons/cards/Icon_Card.Icon_Card");
+
+	constexpr float ItemIconSize = 28.f;
+	constexpr float SkillIconSize = 24.f;
+
+	// Anything asked for this recently is probably on screen and is never evicted
+	constexpr double EvictGraceSeconds = 2.0;
+
+	const FLinearColor PlaceholderTint(0.f, 0.f, 0.f, 0.35f);
+
+	// "/Game/Dir/Asset" -> "/Game/Dir/Asset.Asset"
+	FSoftObjectPath MakeObjectPath(const FString& PackagePath)
+	{
+		if (PackagePath.Contains(TEXT("."))) return FSoftObjectPath(PackagePath);
+		return FSoftObjectPath(PackagePath + TEXT(".") + FPackageName::GetShortName(PackagePath));
+	}
+
+	FSoftObjectPath MakeItemIconPath(const TCHAR* Folder, const FString& AssetSuffix)
+	{
+		return MakeObjectPath(FString::Printf(TEXT("%s/%s/Icon_%s"), ItemIconRoot, Folder, *AssetSuffix));
+	}
+
+	void SetPlaceholder(FSlateBrush& Brush)
+	{
+		Brush.SetResourceObject(nullptr);
+		Brush.DrawAs = ESlateBrushDrawType::RoundedBox;
+		Brush.OutlineSettings = FSlateBrushOutlineSettings(4.f);
+		Brush.TintColor = FSlateColor(PlaceholderTint);
+	}
+
+	void SetTexture(FSlateBrush& Brush, UTexture2D* Texture)
+	{
+		Brush.SetResourceObject(Texture);
+		Brush.DrawAs = ESlateBrushDrawType::Image;
+		Brush.TintColor = FSlateColor(FLinearColor::White);
+	}
+
+	// Icons are 1024px sources drawn at 24-32px. UE5 defaults (DXT + mip chain + streaming)
+	// make them blurry/blocky in Slate. Applied once per texture object.
+	void ApplyUITextureSettings(UTexture2D* Texture)
+	{
+		if (Texture->LODGroup == TEXTUREGROUP_UI && Texture->NeverStream) return;
+		Texture->LODGroup = TEXTUREGROUP_UI;
+		Texture->Filter = TF_Bilinear;
+		Texture->NeverStream = true;
+		Texture->UpdateResource();
+	}
+}
+
+// ============================================================
+// Lifecycle
+// ============================================================
+
+void UIconCacheSubsystem::Deinitialize()
+{
+	for (auto& Pair : Entries)
+	{
+		if (Pair.Value.Handle.IsValid())
+		{
+			Pair.Value.Handle->CancelHandle();
+		}
+		// A widget may outlive us by a frame; don't leave it pointing at a collectable texture
+		SetPlaceholder(*Pair.Value.Brush);
+	}
+	Entries.Empty();
+	ResidentTextures.Empty();
+	ItemPathCache.Empty();
+	SkillPathCache.Empty();
+	ItemIconIndex.Empty();
+	Super::Deinitialize();
+}
+
+UIconCacheSubsystem* UIconCacheSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = (GEngine && WorldContextObject)
+		? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
+	return GI ? GI->GetSubsystem<UIconCacheSubsystem>() : nullptr;
+}
+
+// ============================================================
+// Public API
+// ============================================================
+
+TSharedPtr<const FSlateBrush> UIconCacheSubsystem::GetItemIcon(const FString& IconName)
+{
+	++NumRequests;
+	const FSoftObjectPath Path = ResolveItemIconPath(IconName);
+	return Path.IsNull() ? nullptr : GetIcon(Path, ItemIconSize, false);
+}
+
+TSharedPtr<const FSlateBrush> UIconCacheSubsystem::GetSkillIcon(const FString& ContentPath)
+{
+	if (ContentPath.IsEmpty()) return nullptr;
+	++NumRequests;
+
+	const FSoftObjectPath* Path = SkillPathCache.Find(ContentPath);
+	if (!Path)
+	{
+		FSoftObjectPath Resolved = MakeObjectPath(ContentPath);
+		if (!AssetExists(Resolved))
+		{
+			UE_LOG(LogIconCache, Warning, TEXT("No skill icon at %s"), *ContentPath);
+			Resolved.Reset();
+		}
+		Path = &SkillPathCache.Add(ContentPath, Resolved);
+	}
+	return Path->IsNull() ? nullptr : GetIcon(*Path, SkillIconSize, false);
+}
+
+void UIconCacheSubsystem::PrefetchItemIcons(TConstArrayView<FString> IconNames)
+{
+	// One page may take at most half the budget, so it can't push out what's already on screen
+	const int32 Limit = FMath::Max(16, CVarIconsMaxResident.GetValueOnGameThread()) / 2;
+
+	TSet<FSoftObjectPath> Seen;
+	for (const FString& IconName : IconNames)
+	{
+		const FSoftObjectPath Path = ResolveItemIconPath(IconName);
+		if (Path.IsNull() || Seen.Contains(Path)) continue;
+
+		Seen.Add(Path);
+		GetIcon(Path, ItemIconSize, true);
+		if (Seen.Num() >= Limit) break;
+	}
+}
+
+// ============================================================
+// Item icon resolver
+// ============================================================
+
+FSoftObjectPath UIconCacheSubsystem::ResolveItemIconPath(const FString& IconName)
+{
+	if (IconName.IsEmpty()) return FSoftObjectPath();
+	if (const FSoftObjectPath* Cached = ItemPathCache.Find(IconName)) return *Cached;
+
+	FSoftObjectPath Path;
+	if (IconName.EndsWith(TEXT("_card")))
+	{
+		Path = FSoftObjectPath(CardIconPath);
+	}
+	else
+	{
+		// UE5 replaces special characters with underscores when importing assets. The server
+		// icon field keeps the original rAthena name (e.g. "grasshopper's_leg"), but the
+		// .uasset on disk is "grasshopper_s_leg".
+		FString Sanitized = IconName;
+		Sanitized.ReplaceCharInline(TEXT('\''), TEXT('_'));
+		Sanitized.ReplaceCharInline(TEXT('.'), TEXT('_'));
+		Sanitized.ReplaceCharInline(TEXT('!'), TEXT('_'));
+
+		for (const FRenamedIcon& Renamed : RenamedItemIcons)
+		{
+			if (Sanitized == Renamed.IconName || IconName == Renamed.IconName)
+			{
+				Path = MakeItemIconPath(Renamed.Folder, Renamed.Asset);
+				break;
+			}
+		}
+
+		// Icon_<name>, then the base name: rAthena slotted variants (sword_, sword__) are
+		// the same picture as the base item
+		FString BaseName = Sanitized;
+		while (BaseName.Len() > 0 && BaseName[BaseName.Len() - 1] == TEXT('_'))
+		{
+			BaseName.LeftChopInline(1);
+		}
+
+		BuildItemIconIndex();
+		for (const FString& Candidate : { Sanitized, BaseName })
+		{
+			if (!Path.IsNull() || Candidate.IsEmpty()) break;
+
+			if (ItemIconIndex.Num() > 0)
+			{
+				if (const FSoftObjectPath* Found = ItemIconIndex.Find(FName(*Candidate, FNAME_Find)))
+					Path = *Found;
+			}
+			else
+			{
+				// No registry data (still scanning in the editor): probe each folder
+				for (const TCHAR* Folder : ItemIconFolders)
+				{
+					const FSoftObjectPath Probe = MakeItemIconPath(Folder, Candidate);
+					if (AssetExists(Probe))
+					{
+						Path = Probe;
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	if (!Path.IsNull() && !AssetExists(Path))
+	{
+		Path.Reset();
+	}
+
+	// Misses are cached too, so a grid rebuild never repeats the search
+	ItemPathCache.Add(IconName, Path);
+	return Path;
+}
+
+void UIconCacheSubsystem::BuildItemIconIndex()
+{
+	if (bItemIconIndexBuilt) return;
+
+	IAssetRegistry* Registry = IAssetRegistry::Get();
+	if (!Registry || Registry->IsLoadingAssets()) return;
+	bItemIconIndexBuilt = true;
+
+	TArray<FAssetData> Assets;
+	Registry->GetAssetsByPath(FName(ItemIconRoot), Assets, /*bRecursive*/ true);
+
+	TMap<FName, int32> IndexedRank;
+	for (const FAssetData& Asset : Assets)
+	{
+		const FString AssetName = Asset.AssetName.ToString();
+		if (!AssetName.StartsWith(TEXT("Icon_"))) continue;
+
+		const FString Folder = FPackageName::GetShortName(Asset.PackagePath.ToString());
+		int32 Rank = INDEX_NONE;
+		for (int32 i = 0; i < UE_ARRAY_COUNT(ItemIconFolders); ++i)
+		{
+			if (Folder.Equals(ItemIconFolders[i], ESearchCase::IgnoreCase))
+			{
+				Rank = i;
+				break;
+			}
+		}
+		if (Rank == INDEX_NONE) continue;
+
+		const FName Key(*AssetName.Mid(5));
+		const int32* Existing = IndexedRank.Find(Key);
+		if (Existing && *Existing <= Rank) continue;
+
+		IndexedRank.Add(Key, Rank);
+		ItemIconIndex.Add(Key, Asset.GetSoftObjectPath());
+	}
+
+	UE_LOG(LogIconCache, Log, TEXT("Indexed %d item icons under %s"), ItemIconIndex.Num(), ItemIconRoot);
+}
+
+bool UIconCacheSubsystem::AssetExists(const FSoftObjectPath& Path) const
+{
+	IAssetRegistry* Registry = IAssetRegistry::Get();
+	if (Registry && Registry->GetAssetByObjectPath(Path).IsValid()) return true;
+	return FPackageName::DoesPackageExist(Path.GetLongPackageName());
+}
+
+// ============================================================
+// Loading and residency
+// ============================================================
+
+TSharedPtr<const FSlateBrush> UIconCacheSubsystem::GetIcon(const FSoftObjectPath& Path, float ImageSize, bool bPrefetch)
+{
+	FIconEntry* Entry = Entries.Find(Path);
+	if (!Entry)
+	{
+		Entry = &Entries.Add(Path);
+		Entry->Path = Path;
+		Entry->Brush = MakeShared<FSlateBrush>();
+		Entry->Brush->ImageSize = FVector2D(ImageSize, ImageSize);
+		SetPlaceholder(*Entry->Brush);
+	}
+
+	Entry->LastUsed = FPlatformTime::Seconds();
+	if (Entry->State == EIconState::Resident)
+	{
+		if (!bPrefetch) ++NumResidentHits;
+	}
+	else if (Entry->State == EIconState::Unloaded)
+	{
+		StartLoad(*Entry, bPrefetch);
+	}
+
+	return Entry->State == EIconState::Failed ? nullptr : Entry->Brush;
+}
+
+void UIconCacheSubsystem::StartLoad(FIconEntry& Entry, bool bPrefetch)
+{
+	++NumLoads;
+	if (bPrefetch) ++NumPrefetched;
+
+	UAssetManager* AM = UAssetManager::GetIfInitialized();
+	if (!AM || CVarIconsAsync.GetValueOnGameThread() == 0)
+	{
+		MakeResident(Entry, Cast<UTexture2D>(Entry.Path.TryLoad()));
+		return;
+	}
+
+	Entry.State = EIconState::Loading;
+	++NumLoading;
+
+	// Completes inline if the texture is already in memory — OnIconLoaded handles both
+	TSharedPtr<FStreamableHandle> Handle = AM->GetStreamableManager().RequestAsyncLoad(
+		Entry.Path,
+		FStreamableDelegate::CreateUObject(this, &UIconCacheSubsystem::OnIconLoaded, Entry.Path),
+		bPrefetch ? FStreamableManager::DefaultAsyncLoadPriority : FStreamableManager::AsyncLoadHighPriority,
+		false /* bManageActiveHandle */,
+		false /* bStartStalled */,
+		TEXT("IconCache"));
+
+	if (Entry.State == EIconState::Loading)
+	{
+		Entry.Handle = Handle;
+	}
+}
+
+void UIconCacheSubsystem::OnIconLoaded(FSoftObjectPath Path)
+{
+	FIconEntry* Entry = Entries.Find(Path);
+	if (!Entry || Entry->State != EIconState::Loading) return;
+
+	NumLoading = FMath::Max(0, NumLoading - 1);
+	MakeResident(*Entry, Cast<UTexture2D>(Path.ResolveObject()));
+}
+
+void UIconCacheSubsystem::MakeResident(FIconEntry& Entry, UTexture2D* Texture)
+{
+	Entry.Handle.Reset();
+	if (!Texture)
+	{
+		UE_LOG(LogIconCache, Warning, TEXT("Failed to load icon %s"), *Entry.Path.ToString());
+		Entry.State = EIconState::Failed;
+		Entry.Brush->DrawAs = ESlateBrushDrawType::NoDrawType;
+		return;
+	}
+
+	ApplyUITextureSettings(Texture);
+
+	Entry.Texture = Texture;
+	Entry.Bytes = Texture->CalcTextureMemorySizeEnum(TMC_ResidentMips);
+	Entry.State = EIconState::Resident;
+	ResidentTextures.Add(Texture);
+	ResidentBytes += Entry.Bytes;
+	SetTexture(*Entry.Brush, Texture);
+
+	EvictOverBudget();
+}
+
+void UIconCacheSubsystem::EvictOverBudget()
+{
+	const int32 Budget = FMath::Max(16, CVarIconsMaxResident.GetValueOnGameThread());
+	if (ResidentTextures.Num() <= Budget) return;
+
+	TArray<FIconEntry*> Resident;
+	for (auto& Pair : Entries)
+	{
+		if (Pair.Value.State == EIconState::Resident) Resident.Add(&Pair.Value);
+	}
+	Resident.Sort([](const FIconEntry& A, const FIconEntry& B) { return A.LastUsed < B.LastUsed; });
+
+	const double Now = FPlatformTime::Seconds();
+	for (FIconEntry* Entry : Resident)
+	{
+		if (ResidentTextures.Num() <= Budget || Now - Entry->LastUsed < EvictGraceSeconds) break;
+
+		// Still held by a widget or actor: on screen, even if nobody has asked for it lately
+		if (!Entry->Brush.IsUnique()) continue;
+
+		// The texture is collectable from here on, so no brush may still point at it
+		SetPlaceholder(*Entry->Brush);
+		ResidentTextures.Remove(Entry->Texture);
+		ResidentBytes -= Entry->Bytes;
+		Entry->Texture = nullptr;
+		Entry->Bytes = 0;
+		Entry->State = EIconState::Unloaded;
+		++NumEvicted;
+	}
+}
+
+// ============================================================
+// Metrics
+// ============================================================
+
+void UIconCacheSubsystem::LogStats() const
+{
+	int32 Failed = 0;
+	int32 Held = 0;
+	for (const auto& Pair : Entries)
+	{
+		if (Pair.Value.State == EIconState::Failed) ++Failed;
+		if (Pair.Value.State == EIconState::Resident && !Pair.Value.Brush.IsUnique()) ++Held;
+	}
+
+	UE_LOG(LogIconCache, Log,
+		TEXT("Icon cache: %d icons, %d/%d resident (%.1f MB, %d held by widgets), %d loading, %d failed; async %s"),
+		Entries.Num(), ResidentTextures.Num(), CVarIconsMaxResident.GetValueOnGameThread(),
+		ResidentBytes / (1024.0 * 1024.0), Held, NumLoading, Failed,
+		CVarIconsAsync.GetValueOnGameThread() ? TEXT("on") : TEXT("off"));
+	UE_LOG(LogIconCache, Log,
+		TEXT("  %llu requests, %.0f%% already resident, %llu loads (%llu prefetched), %llu evicted; %d item names resolved against %d indexed icons"),
+		NumRequests, NumRequests ? 100.0 * NumResidentHits / NumRequests : 0.0,
+		NumLoads, NumPrefetched, NumEvicted, ItemPathCache.Num(), ItemIconIndex.Num());
+}
@@ -0,0 +1,115 @@
+// IconCacheSubsystem.h — Item and skill icon brushes shared by every UI widget.
+//
+// Inventory and skill tree each kept their own brush + texture maps and loaded icons with a
+// synchronous LoadObject the first time a widget asked, so opening a full storage window
+// stalled the game thread on dozens of 1024px textures (and, being world subsystems, did it
+// again in every zone). This game-instance subsystem is now the only place icons come from:
+//
+//   - One name -> path resolver for item icons: the Item_Icons folders are indexed once from
+//     the asset registry (Icon_<name>, first match in subfolder priority order), with the
+//     few creatively renamed assets and the shared card icon layered on top.
+//   - Brushes are handed out immediately, as shared pointers. Until the texture has streamed
+//     in they draw a dim rounded placeholder; the same brush switches to the texture when it
+//     arrives, so widgets that keep the pointer pick it up on their next paint.
+//   - Resident textures are bounded by an LRU (Icons.MaxResident) over brushes nobody holds
+//     any more. Widgets keep theirs (SIconImage does it for them) while they are on screen,
+//     so a visible icon is never evicted; the budget is exceeded instead when everything
+//     resident is in use. An evicted brush reloads the next time anything asks for it.
+//   - Windows prefetch their whole page on open (PrefetchItemIcons) so the grid fills in
+//     one go instead of slot by slot.
+//
+// A null return still means "no such icon" — callers keep their colored-square fallback.
+// Icons.Stats prints residency and hit counts; Icons.Async 0 restores synchronous loads.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Engine/StreamableManager.h"
+#include "UObject/SoftObjectPath.h"
+#include "Styling/SlateBrush.h"
+#include "IconCacheSubsystem.generated.h"
+
+class UTexture2D;
+
+UCLASS()
+class SABRIMMO_API UIconCacheSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	/** The game instance's icon cache (null without a game world) */
+	static UIconCacheSubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 * Brush for a server item icon name (the item "icon" field). Null if no asset exists.
+	 * Hold the pointer for as long as the brush is drawn — held brushes are never evicted.
+	 */
+	TSharedPtr<const FSlateBrush> GetItemIcon(const FString& IconName);
+
+	/** Brush for a skill icon content path (USkillTreeSubsystem::ResolveIconContentPath). Hold it like GetItemIcon's. */
+	TSharedPtr<const FSlateBrush> GetSkillIcon(const FString& ContentPath);
+
+	/** Start streaming every icon a window is about to show (deduplicated, lower priority) */
+	void PrefetchItemIcons(TConstArrayView<FString> IconNames);
+
+	/** Item icon name -> texture path ("" if there is none). Cached per name. */
+	FSoftObjectPath ResolveItemIconPath(const FString& IconName);
+
+	void LogStats() const;
+
+private:
+	enum class EIconState : uint8
+	{
+		Unloaded,   // placeholder; never loaded or evicted
+		Loading,
+		Resident,
+		Failed      // path resolved but the load returned nothing
+	};
+
+	struct FIconEntry
+	{
+		FSoftObjectPath Path;
+		TSharedPtr<FSlateBrush> Brush;   // shared with the widgets drawing it; unique = evictable
+		TSharedPtr<FStreamableHandle> Handle;
+		UTexture2D* Texture = nullptr;   // rooted by ResidentTextures while Resident
+		EIconState State = EIconState::Unloaded;
+		double LastUsed = 0.0;
+		int64 Bytes = 0;
+	};
+
+	TSharedPtr<const FSlateBrush> GetIcon(const FSoftObjectPath& Path, float ImageSize, bool bPrefetch);
+	void StartLoad(FIconEntry& Entry, bool bPrefetch);
+	void OnIconLoaded(FSoftObjectPath Path);
+	void MakeResident(FIconEntry& Entry, UTexture2D* Texture);
+	void EvictOverBudget();
+
+	void BuildItemIconIndex();
+	bool AssetExists(const FSoftObjectPath& Path) const;
+
+	// Keyed by texture path — every item name that maps to it shares one brush
+	TMap<FSoftObjectPath, FIconEntry> Entries;
+
+	// GC root for resident textures (the brushes alone are invisible to GC)
+	UPROPERTY()
+	TSet<TObjectPtr<UTexture2D>> ResidentTextures;
+
+	// Resolver: item icon name -> path (empty path = no icon), and the Item_Icons folder index
+	TMap<FString, FSoftObjectPath> ItemPathCache;
+	TMap<FName, FSoftObjectPath> ItemIconIndex;
+	bool bItemIconIndexBuilt = false;
+
+	// Skill content path -> texture path (empty path = no asset behind it)
+	TMap<FString, FSoftObjectPath> SkillPathCache;
+
+	// Lifetime counters for Icons.Stats
+	uint64 NumRequests = 0;
+	uint64 NumResidentHits = 0;
+	uint64 NumLoads = 0;
+	uint64 NumPrefetched = 0;
+	uint64 NumEvicted = 0;
+	int32 NumLoading = 0;
+	int64 ResidentBytes = 0;
+};
@@ -12,10 +12,11 @@
 #include "ZoneTransitionSubsystem.h"
 #include "MMOGameInstance.h"
 #include "SocketEventRouter.h"
+#include "IconCacheSubsystem.h"
+#include "SIconImage.h"
 #include "Audio/AudioSubsystem.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/Pawn.h"
-#include "Engine/Texture2D.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
 #include "Kismet/GameplayStatics.h"
@@ -291,10 +292,6 @@ void UInventorySubsystem::Deinitialize()
 
 	HideDragCursor();
 
-	// Clear icon caches — release GC-rooted textures and brush memory
-	ItemIconBrushCache.Empty();
-	ItemIconTextureCache.Empty();
-
 	if (UWorld* World = GetWorld())
 	{
 		if (UMMOGameInstance* GI = Cast<UMMOGameInstance>(World->GetGameInstance()))
@@ -825,188 +822,6 @@ TArray<FInventoryItem> UInventorySubsystem::GetEquippedItems() const
 	return Equipped;
 }
 
-// ============================================================
-// Item icon loading (same pattern as SkillTreeSubsystem)
-// ============================================================
-
-FSlateBrush* UInventorySubsystem::GetOrCreateItemIconBrush(const FString& IconName)
-{
-	if (IconName.IsEmpty()) return nullptr;
-
-	// Check cache first (keyed on original server name)
-	if (TSharedPtr<FSlateBrush>* Found = ItemIconBrushCache.Find(IconName))
-	{
-		return Found->Get();
-	}
-
-	// UE5 replaces special characters with underscores when importing assets.
-	// The server icon field keeps the original rAthena name (e.g. "grasshopper's_leg"),
-	// but the .uasset on disk is "grasshopper_s_leg". Sanitize to match.
-	FString SanitizedName = IconName;
-	SanitizedName.ReplaceCharInline(TEXT('\''), TEXT('_'));
-	SanitizedName.ReplaceCharInline(TEXT('.'), TEXT('_'));
-	SanitizedName.ReplaceCharInline(TEXT('!'), TEXT('_'));
-
-	// Map server icon field → subfolder/asset name
-	// Values are "subfolder/AssetName" — resolved to /Game/SabriMMO/Assets/Item_Icons/{subfolder}/Icon_{AssetName}
-	static const TMap<FString, FString> IconAssetMap = {
-		// Consumables — potions, herbs, food
-		{TEXT("red_potion"),     TEXT("consumables/CrimsonVial")},
-		{TEXT("orange_potion"),  TEXT("consumables/AmberElixir")},
-		{TEXT("yellow_potion"),  TEXT("consumables/GoldenSalve")},
-		{TEXT("blue_potion"),    TEXT("consumables/AzurePhilter")},
-		{TEXT("meat"),           TEXT("consumables/RoastedHaunch")},
-		{TEXT("strawberry"),     TEXT("consumables/Strawberry")},
-		{TEXT("green_herb"),     TEXT("consumables/VerdantLeaf")},
-		{TEXT("red_herb"),       TEXT("consumables/CrimsonHerb")},
-		{TEXT("grape"),          TEXT("consumables/PurpleGrape")},
-		{TEXT("apple"),          TEXT("consumables/RubyApple")},
-		{TEXT("carrot"),         TEXT("consumables/GoldenCarrot")},
-		{TEXT("orange"),         TEXT("consumables/SunburstOrange")},
-		{TEXT("baked_yam"),      TEXT("consumables/EarthenTuber")},
-		// Etc / Crafting — loot, materials, ores
-		{TEXT("jellopy"),        TEXT("etc_crafting/GloopyResidue")},
-		{TEXT("sticky_mucus"),   TEXT("etc_crafting/ViscousSlime")},
-		{TEXT("shell"),          TEXT("etc_crafting/ChitinShard")},
-		{TEXT("feather"),        TEXT("etc_crafting/DownyPlume")},
-		{TEXT("mushroom_spore"), TEXT("etc_crafting/SporeCluster")},
-		{TEXT("long_limb"),      TEXT("etc_crafting/BarbedLimb")},
-		{TEXT("fluff"),          TEXT("etc_crafting/SilkenTuft")},
-		// Weapons
-		{TEXT("knife"),          TEXT("weapons/RusticShiv")},
-		{TEXT("cutter"),         TEXT("weapons/KeenEdge")},
-		{TEXT("main_gauche"),    TEXT("weapons/StilettoFang")},
-		{TEXT("sword"),          TEXT("weapons/IronCleaver")},
-		{TEXT("falchion"),       TEXT("weapons/CrescentSaber")},
-		{TEXT("bow"),            TEXT("weapons/HuntingLongbow")},
-		// Armor — body armor
-		{TEXT("cotton_shirt"),   TEXT("armor/LinenTunic")},
-		{TEXT("padded_armor"),   TEXT("armor/QuiltedVest")},
-		{TEXT("chain_mail"),     TEXT("armor/RingweaveHauberk")},
-	};
-
-	// All card items share a single generic card icon (icon names end with "_card")
-	if (IconName.EndsWith(TEXT("_card")))
-	{
-		FString ContentPath = TEXT("/Game/SabriMMO/Assets/Item_Icons/cards/Icon_Card");
-		UTexture2D* Tex = LoadObject<UTexture2D>(nullptr, *ContentPath);
-		if (Tex)
-		{
-			Tex->LODGroup = TEXTUREGROUP_UI;
-			Tex->Filter = TF_Bilinear;
-			Tex->NeverStream = true;
-			Tex->UpdateResource();
-			ItemIconTextureCache.Add(IconName, Tex);
-			TSharedPtr<FSlateBrush> Brush = MakeShared<FSlateBrush>();
-			Brush->SetResourceObject(Tex);
-			Brush->ImageSize = FVector2D(28.f, 28.f);
-			Brush->DrawAs = ESlateBrushDrawType::Image;
-			FSlateBrush* RawPtr = Brush.Get();
-			ItemIconBrushCache.Add(IconName, Brush);
-			UE_LOG(LogInventory, Log, TEXT("Loaded card icon: %s → %s"), *IconName, *ContentPath);
-			return RawPtr;
-		}
-		UE_LOG(LogInventory, Warning, TEXT("Failed to load card icon: %s"), *ContentPath);
-		ItemIconBrushCache.Add(IconName, nullptr);
-		return nullptr;
-	}
-
-	// --- Resolve content path ---
-	FString ContentPath;
-	UTexture2D* Tex = nullptr;
-
-	// 1) Check legacy override map (29 creative-named icons)
-	const FString* AssetPath = IconAssetMap.Find(SanitizedName);
-	if (!AssetPath) AssetPath = IconAssetMap.Find(IconName);
-	if (AssetPath)
-	{
-		int32 SlashIdx = INDEX_NONE;
-		AssetPath->FindLastChar(TEXT('/'), SlashIdx);
-		if (SlashIdx != INDEX_NONE)
-		{
-			FString SubFolder = AssetPath->Left(SlashIdx);
-			FString AssetName = AssetPath->Mid(SlashIdx + 1);
-			ContentPath = FString::Printf(TEXT("/Game/SabriMMO/Assets/Item_Icons/%s/Icon_%s"),
-				*SubFolder, *AssetName);
-		}
-		else
-		{
-			ContentPath = FString::Printf(TEXT("/Game/SabriMMO/Assets/Item_Icons/Icon_%s"), **AssetPath);
-		}
-		Tex = LoadObject<UTexture2D>(nullptr, *ContentPath);
-	}
-
-	// 2) Search each subfolder by convention: Icon_{icon_name}
-	//    Also try stripping trailing underscores (rAthena slotted variants:
-	//    sword_ / sword__ are the same visual item as sword)
-	if (!Tex)
-	{
-		static const TCHAR* Subfolders[] = {
-			TEXT("consumables"), TEXT("etc_crafting"), TEXT("weapons"), TEXT("headgear"),
-			TEXT("accessories"), TEXT("armor"), TEXT("garments"), TEXT("footgear"), TEXT("shields")
-		};
-
-		// Try sanitized name first, then base name with trailing underscores stripped
-		FString BaseName = SanitizedName;
-		while (BaseName.Len() > 0 && BaseName[BaseName.Len() - 1] == TEXT('_'))
-		{
-			BaseName.LeftChopInline(1);
-		}
-		const bool bHasVariantSuffix = (BaseName != SanitizedName);
-
-		for (const TCHAR* Sub : Subfolders)
-		{
-			ContentPath = FString::Printf(TEXT("/Game/SabriMMO/Assets/Item_Icons/%s/Icon_%s"),
-				Sub, *SanitizedName);
-			Tex = LoadObject<UTexture2D>(nullptr, *ContentPath);
-			if (Tex) break;
-		}
-
-		// Fall back to base name (slotted variant → base item icon)
-		if (!Tex && bHasVariantSuffix && BaseName.Len() > 0)
-		{
-			for (const TCHAR* Sub : Subfolders)
-			{
-				ContentPath = FString::Printf(TEXT("/Game/SabriMMO/Assets/Item_Icons/%s/Icon_%s"),
-					Sub, *BaseName);
-				Tex = LoadObject<UTexture2D>(nullptr, *ContentPath);
-				if (Tex) break;
-			}
-		}
-	}
-
-	if (!Tex)
-	{
-		// Cache null so we don't retry LoadObject every grid rebuild
-		ItemIconBrushCache.Add(IconName, nullptr);
-		return nullptr;
-	}
-
-	// Force UI-quality texture settings so icons stay crisp at small display sizes.
-	// Without this, UE5 defaults (DXT compression + mipmap chain + streaming) make
-	// 1024px icons look blurry/blocky when rendered at 28px in Slate.
-	Tex->LODGroup = TEXTUREGROUP_UI;
-	Tex->Filter = TF_Bilinear;
-	Tex->NeverStream = true;
-	Tex->UpdateResource();
-
-	// CRITICAL: Store texture in UPROPERTY TMap so GC sees it as referenced.
-	// Without this, UTexture2D is only reachable via FSlateBrush (inside a non-UPROPERTY
-	// TSharedPtr chain) — invisible to GC — gets garbage collected → crash during Paint.
-	ItemIconTextureCache.Add(IconName, Tex);
-
-	TSharedPtr<FSlateBrush> Brush = MakeShared<FSlateBrush>();
-	Brush->SetResourceObject(Tex);
-	Brush->ImageSize = FVector2D(28.f, 28.f);
-	Brush->DrawAs = ESlateBrushDrawType::Image;
-
-	FSlateBrush* RawPtr = Brush.Get();
-	ItemIconBrushCache.Add(IconName, Brush);
-
-	UE_LOG(LogInventory, Log, TEXT("Loaded item icon: %s"), *ContentPath);
-	return RawPtr;
-}
-
 // ============================================================
 // Tab filtering
 // ============================================================
@@ -1412,10 +1227,14 @@ void UInventorySubsystem::ShowDragCursor(const FInventoryItem& Item)
 
 	TSharedRef<SWidget> IconContent = [&]() -> TSharedRef<SWidget>
 	{
-		FSlateBrush* Brush = GetOrCreateItemIconBrush(Item.Icon);
+		TSharedPtr<const FSlateBrush> Brush;
+		if (UIconCacheSubsystem* IconCache = UIconCacheSubsystem::Get(GetWorld()))
+		{
+			Brush = IconCache->GetItemIcon(Item.Icon);
+		}
 		if (Brush)
 		{
-			return SNew(SImage).Image(Brush);
+			return SNew(SIconImage).Icon(Brush);
 		}
 		return SNew(SBorder)
 			.BorderImage(FCoreStyle::Get().GetBrush("GenericWhiteBox"))
@@ -1512,6 +1331,15 @@ void UInventorySubsystem::ToggleWidget()
 	}
 	else
 	{
+		// Start streaming every icon the grid is about to show, not slot by slot as it builds
+		if (UIconCacheSubsystem* Icons = UIconCacheSubsystem::Get(World))
+		{
+			TArray<FString> IconNames;
+			IconNames.Reserve(Items.Num());
+			for (const FInventoryItem& Item : Items) IconNames.Add(Item.Icon);
+			Icons->PrefetchItemIcons(IconNames);
+		}
+
 		InventoryWidget = SNew(SInventoryWidget).Subsystem(this);
 
 		AlignmentWrapper =
@@ -100,9 +100,6 @@ public:
 	// ---- item definition cache (static data keyed by item_id) ----
 	TMap<int32, FInventoryItem> ItemDefCache;
 
-	// ---- item icon utilities (reusable by any widget/system) ----
-	FSlateBrush* GetOrCreateItemIconBrush(const FString& IconName);
-
 	// ---- loot notifications (read by SLootNotificationOverlay) ----
 	static constexpr float LOOT_NOTIFY_DURATION = 4.0f;
 	static constexpr float LOOT_NOTIFY_FADE_TIME = 1.0f;
@@ -173,11 +170,4 @@ private:
 	FTimerHandle LootCleanupTimer;
 	void ShowLootOverlay();
 	void HideLootOverlay();
-
-	// ---- item icon brush cache (TSharedPtr so raw FSlateBrush* survives TMap rehash) ----
-	TMap<FString, TSharedPtr<FSlateBrush>> ItemIconBrushCache;
-
-	// ---- GC root for loaded textures (CRITICAL: prevents UTexture2D garbage collection) ----
-	UPROPERTY()
-	TMap<FString, TObjectPtr<UTexture2D>> ItemIconTextureCache;
 };
@@ -0,0 +1,126 @@
+// MoveBatchSubsystem.cpp — Decode move:batch packets and re-dispatch as typed move events.
+
+#include "MoveBatchSubsystem.h"
+#include "MMOGameInstance.h"
+#include "SocketEventRouter.h"
+#include "SocketEventTypes.h"
+#include "SnapshotInterpolationSubsystem.h"
+#include "SIOJConvert.h"
+#include "Engine/World.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogMoveBatch, Log, All);
+
+static FAutoConsoleCommandWithWorldAndArgs GMoveBatchStatsCmd(
+	TEXT("MoveBatch.Stats"),
+	TEXT("Print binary move:batch channel counters (packets, bytes, records, dropped deltas)."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UMoveBatchSubsystem* Sub = World ? World->GetSubsystem<UMoveBatchSubsystem>() : nullptr;
+		if (!Sub) return;
+		const uint64 Packets = Sub->GetPacketsReceived();
+		UE_LOG(LogMoveBatch, Log, TEXT("move:batch — %llu packets, %llu bytes, %llu records (%.1f B/record), %u deltas dropped"),
+			Packets, Sub->GetBytesReceived(), Sub->GetRecordsDecoded(),
+			Sub->GetRecordsDecoded() > 0 ? double(Sub->GetBytesReceived()) / double(Sub->GetRecordsDecoded()) : 0.0,
+			Sub->GetDroppedDeltas());
+	}));
+
+bool UMoveBatchSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld();
+}
+
+void UMoveBatchSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	UMMOGameInstance* GI = Cast<UMMOGameInstance>(InWorld.GetGameInstance());
+	if (!GI || !GI->IsSocketConnected()) return;
+
+	USocketEventRouter* Router = GI->GetEventRouter();
+	if (!Router) return;
+
+	Codec.Reset();
+	Router->RegisterHandler(TEXT("move:batch"), this,
+		[this](const TSharedPtr<FJsonValue>& D) { HandleMoveBatch(D); });
+}
+
+void UMoveBatchSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UMMOGameInstance* GI = Cast<UMMOGameInstance>(World->GetGameInstance()))
+		{
+			if (USocketEventRouter* Router = GI->GetEventRouter())
+			{
+				Router->UnregisterAllForOwner(this);
+			}
+		}
+	}
+	Super::Deinitialize();
+}
+
+// ============================================================
+// HandleMoveBatch — decode once, dispatch each record as a typed event
+// ============================================================
+
+void UMoveBatchSubsystem::HandleMoveBatch(const TSharedPtr<FJsonValue>& Data)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_MoveBatch_Handle);
+
+	// The binary attachment arrives as the sole argument (or the first element of an args array)
+	TSharedPtr<FJsonValue> Payload = Data;
+	if (Payload.IsValid() && Payload->Type == EJson::Array && Payload->AsArray().Num() > 0)
+	{
+		Payload = Payload->AsArray()[0];
+	}
+	if (!Payload.IsValid() || !FJsonValueBinary::IsBinary(Payload)) return;
+
+	const TArray<uint8> Bytes = FJsonValueBinary::AsBinary(Payload);
+	++PacketsReceived;
+	BytesReceived += Bytes.Num();
+
+	Scratch.Reset();
+	uint32 ServerTimeMs = 0;
+	if (!Codec.Decode(Bytes.GetData(), Bytes.Num(), Scratch, &ServerTimeMs))
+	{
+		++MalformedPackets;
+		UE_LOG(LogMoveBatch, Warning, TEXT("Malformed move:batch packet (%d bytes, %d records decoded)"),
+			Bytes.Num(), Scratch.Num());
+	}
+	RecordsDecoded += Scratch.Num();
+
+	UWorld* World = GetWorld();
+	UMMOGameInstance* GI = World ? Cast<UMMOGameInstance>(World->GetGameInstance()) : nullptr;
+	USocketEventRouter* Router = GI ? GI->GetEventRouter() : nullptr;
+	if (!Router) return;
+
+	// Every record in the batch shares the header's server time
+	USnapshotInterpolationSubsystem* Interp = World->GetSubsystem<USnapshotInterpolationSubsystem>();
+	if (Interp) Interp->BeginPacket(ServerTimeMs);
+
+	// Same typed structs the JSON path decodes to, so Enemy/OtherPlayer/WorldHealthBar
+	// subscribers cannot tell the two channels apart. Source stays null (no JSON payload).
+	for (const FMoveRecord& R : Scratch)
+	{
+		if (R.Kind == EMoveEntityKind::Enemy)
+		{
+			FEnemyMoveEvent Ev;
+			Ev.EnemyId = R.Id;
+			Ev.Position = R.Position;
+			Ev.bIsMoving = R.bIsMoving;
+			Router->DispatchTyped(TEXT("enemy:move"), Ev);
+		}
+		else
+		{
+			FPlayerMovedEvent Ev;
+			Ev.CharacterId = R.Id;
+			Ev.Position = R.Position;
+			Ev.WeaponMode = R.WeaponMode;
+			Ev.bIsMoving = R.bIsMoving;
+			Router->DispatchTyped(TEXT("player:moved"), Ev);
+		}
+	}
+
+	if (Interp) Interp->EndPacket();
+}
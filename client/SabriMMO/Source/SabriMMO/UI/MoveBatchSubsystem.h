@@ -0,0 +1,41 @@
+// MoveBatchSubsystem.h — Receives the binary 'move:batch' channel and fans each
+// record out as the typed enemy:move / player:moved events the entity subsystems
+// already consume. One Socket.io message per zone per server flush instead of one
+// JSON message per moving entity. Wire format: MoveBatchCodec.h / ro_move_codec.js.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Dom/JsonValue.h"
+#include "MoveBatchCodec.h"
+#include "MoveBatchSubsystem.generated.h"
+
+UCLASS()
+class SABRIMMO_API UMoveBatchSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	// Totals since world begin (MoveBatch.Stats console command)
+	uint64 GetPacketsReceived() const { return PacketsReceived; }
+	uint64 GetBytesReceived() const { return BytesReceived; }
+	uint64 GetRecordsDecoded() const { return RecordsDecoded; }
+	uint32 GetDroppedDeltas() const { return Codec.GetDroppedDeltaCount(); }
+
+private:
+	void HandleMoveBatch(const TSharedPtr<FJsonValue>& Data);
+
+	// Baselines are per zone; a fresh world (zone change) starts with an empty codec
+	FMoveBatchCodec Codec;
+	TArray<FMoveRecord> Scratch;
+
+	uint64 PacketsReceived = 0;
+	uint64 BytesReceived = 0;
+	uint64 RecordsDecoded = 0;
+	uint64 MalformedPackets = 0;
+};
@@ -5,8 +5,8 @@
 
 #include "NameTagSubsystem.h"
 #include "TargetingSubsystem.h"
+#include "ScreenProjectionSubsystem.h"
 #include "MMOGameInstance.h"
-#include "Sprite/SpriteAtlasData.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
 #include "GameFramework/PlayerController.h"
@@ -14,10 +14,28 @@
 #include "Widgets/SWeakWidget.h"
 #include "Framework/Application/SlateApplication.h"
 #include "Rendering/DrawElements.h"
-#include "Fonts/FontMeasure.h"
+#include "Rendering/SlateRenderer.h"
+#include "Fonts/FontCache.h"
+#include "HAL/IConsoleManager.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogNameTag, Log, All);
 
+static TAutoConsoleVariable<int32> CVarNameTagMaxDrawn(
+	TEXT("NameTag.MaxDrawn"),
+	80,
+	TEXT("Max name tags drawn per frame. The local player and the hovered actor always draw; ")
+	TEXT("the rest are kept nearest-to-camera first. 0 = unlimited."),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorldAndArgs GNameTagStatsCmd(
+	TEXT("NameTag.Stats"),
+	TEXT("Log name tag entry count, draw cap usage and layout rebuilds"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UNameTagSubsystem* Sub = World ? World->GetSubsystem<UNameTagSubsystem>() : nullptr)
+			Sub->LogStats();
+	}));
+
 // ============================================================
 // RO Classic Name Tag Colors (pre-renewal, from roBrowser source)
 // ============================================================
@@ -53,6 +71,17 @@ static FLinearColor GetMonsterNameColor(int32 PlayerLevel, int32 MonsterLevel)
 	return NameTagColors::MonsterWhite;
 }
 
+// ============================================================
+// Fonts (shared by the overlay and the layout cache)
+// ============================================================
+
+namespace NameTagFonts
+{
+	static FSlateFontInfo Name()  { return FCoreStyle::GetDefaultFontStyle("Bold", 10); }
+	static FSlateFontInfo Sub()   { return FCoreStyle::GetDefaultFontStyle("Regular", 8); }
+	static FSlateFontInfo Title() { return FCoreStyle::GetDefaultFontStyle("Bold", 9); }
+}
+
 // ============================================================
 // SNameTagOverlay — OnPaint widget rendering all name tags
 // ============================================================
@@ -80,8 +109,8 @@ public:
 		UWorld* World = Sub->GetWorld();
 		if (!World) return LayerId;
 
-		APlayerController* PC = World->GetFirstPlayerController();
-		if (!PC) return LayerId;
+		UScreenProjectionSubsystem* Projection = World->GetSubsystem<UScreenProjectionSubsystem>();
+		if (!Projection) return LayerId;
 
 		// Get hovered actor from TargetingSubsystem (for monster/NPC hover-only display)
 		UTargetingSubsystem* TargetSub = World->GetSubsystem<UTargetingSubsystem>();
@@ -89,20 +118,26 @@ public:
 
 		const int32 LocalPlayerLevel = Sub->GetLocalPlayerLevel();
 
-		// Font setup
-		const FSlateFontInfo NameFont = FCoreStyle::GetDefaultFontStyle("Bold", 10);
-		const FSlateFontInfo SubFont = FCoreStyle::GetDefaultFontStyle("Regular", 8);
-		TSharedRef<FSlateFontMeasure> FontMeasure =
-			FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
-
-		// DPI scale: screen pixels → Slate units
+		// DPI scale: screen pixels → Slate units. Text is shaped at this scale, so a
+		// change re-shapes every layout on its next draw.
 		const float DPIScale = (AllottedGeometry.GetLocalSize().X > 0.f)
 			? (AllottedGeometry.GetAbsoluteSize().X / AllottedGeometry.GetLocalSize().X) : 1.f;
 
-		const TArray<FNameTagEntry>& Entries = Sub->GetEntries();
+		const FVector CamLocation = Projection->GetView().CamLocation;
+		const TSparseArray<FNameTagEntry>& Entries = Sub->GetEntries();
+
+		// ---- Pass 1: filter + position (no text work) ----
+		struct FTagCandidate
+		{
+			int32 EntryId;
+			FVector2D SlatePos;
+			double SortKey;   // < 0 = always drawn, else camera distance squared
+		};
+		TArray<FTagCandidate, TInlineAllocator<128>> Candidates;
 
-		for (const FNameTagEntry& Entry : Entries)
+		for (auto It = Entries.CreateConstIterator(); It; ++It)
 		{
+			const FNameTagEntry& Entry = *It;
 			if (!Entry.Actor.IsValid() || !Entry.bVisible) continue;
 
 			// Options menu: hide player/enemy/NPC names if disabled
@@ -111,40 +146,63 @@ public:
 			if (Entry.Type == ENameTagEntityType::NPC && !Sub->bShowNPCNames) continue;
 
 			// RO Classic: monsters and NPCs are HOVER-ONLY
+			const bool bHovered = Entry.Actor.Get() == HoveredActor;
 			if (Entry.Type == ENameTagEntityType::Monster || Entry.Type == ENameTagEntityType::NPC)
 			{
-				if (Entry.Actor.Get() != HoveredActor) continue;
+				if (!bHovered) continue;
 			}
 
-			// Project to screen — use sprite height if available for zoom-proportional positioning
-			FVector ActorPos = Entry.Actor->GetActorLocation();
+			// Already projected this frame (nullptr = off screen) — use sprite height if
+			// available for zoom-proportional positioning
+			const FScreenAnchor* Anchor = Projection->GetAnchor(Entry.ScreenAnchor);
+			if (!Anchor) continue;
 			FVector2D ScreenPos;
 
 			if (Entry.SpriteHeight > 0.f)
 			{
-				// Sprite mode: use billboard up vector for accurate screen bounds
-				FVector2D TopScreen, BottomScreen;
-				if (!GetSpriteScreenBounds(PC, ActorPos, Entry.SpriteHeight,
-				                           TopScreen, BottomScreen))
+				// Sprite mode: billboard top/bottom give accurate screen bounds
+				if (!Anchor->bSpriteValid)
 					continue;
 
-				float SpriteScreenH = BottomScreen.Y - TopScreen.Y;
+				float SpriteScreenH = Anchor->SpriteBottom.Y - Anchor->SpriteTop.Y;
 				// Name position: proportional margin above sprite top (scales with zoom)
 				float Margin = FMath::Max(SpriteScreenH * 0.05f, 4.f);
-				ScreenPos.X = TopScreen.X;
-				ScreenPos.Y = TopScreen.Y - Margin;
+				ScreenPos.X = Anchor->SpriteTop.X;
+				ScreenPos.Y = Anchor->SpriteTop.Y - Margin;
 			}
 			else
 			{
 				// Classic mode: world Z offset
-				FVector WorldPos = ActorPos;
-				WorldPos.Z += Entry.VerticalOffset;
-				if (!PC->ProjectWorldLocationToScreen(WorldPos, ScreenPos, true))
+				if (!Anchor->bHeadValid)
 					continue;
+				ScreenPos = Anchor->Head;
 			}
 
-			// Convert screen pixels to Slate units
-			FVector2D SlatePos = ScreenPos / DPIScale;
+			FTagCandidate& C = Candidates.AddDefaulted_GetRef();
+			C.EntryId = It.GetIndex();
+			C.SlatePos = ScreenPos / DPIScale;   // Convert screen pixels to Slate units
+			C.SortKey = (bHovered || Entry.Type == ENameTagEntityType::LocalPlayer)
+				? -1.0
+				: FVector::DistSquared(CamLocation, Entry.Actor->GetActorLocation());
+		}
+
+		// ---- Draw cap: keep the highest-priority tags ----
+		Sub->LastCandidates = Candidates.Num();
+		const int32 MaxDrawn = CVarNameTagMaxDrawn.GetValueOnGameThread();
+		if (MaxDrawn > 0 && Candidates.Num() > MaxDrawn)
+		{
+			Candidates.Sort([](const FTagCandidate& A, const FTagCandidate& B) { return A.SortKey < B.SortKey; });
+			Candidates.SetNum(MaxDrawn, EAllowShrinking::No);
+		}
+		Sub->LastDrawn = Candidates.Num();
+
+		// ---- Pass 2: draw from cached layouts ----
+		for (const FTagCandidate& C : Candidates)
+		{
+			const FNameTagEntry& Entry = Entries[C.EntryId];
+			const FNameTagLayout& Layout = Sub->GetLayout(C.EntryId, DPIScale);
+			if (!Layout.Name.IsValid()) continue;
+			const FVector2D& SlatePos = C.SlatePos;
 
 			// Determine name color
 			FLinearColor NameColor;
@@ -162,23 +220,15 @@ public:
 				break;
 			}
 
-			// Build display text
-			FString DisplayText = Entry.DisplayName;
-			if (Entry.Type == ENameTagEntityType::Monster && Entry.Level > 0)
-			{
-				DisplayText = FString::Printf(TEXT("%s Lv.%d"), *Entry.DisplayName, Entry.Level);
-			}
-
-			// Measure text for centering
-			FVector2D TextSize = FontMeasure->Measure(DisplayText, NameFont);
+			// Center on the cached measurement
+			const FVector2D& TextSize = Layout.NameSize;
 			FVector2D DrawPos(SlatePos.X - TextSize.X * 0.5f, SlatePos.Y);
 
 			// RO Classic vending sign: chat-bubble style board above the name tag
 			// White text on dark brown/maroon background with gold border, like RO's vendor sign
-			if (!Entry.VendingTitle.IsEmpty())
+			if (Layout.Title.IsValid())
 			{
-				const FSlateFontInfo ShopFont = FCoreStyle::GetDefaultFontStyle("Bold", 9);
-				FVector2D ShopSize = FontMeasure->Measure(Entry.VendingTitle, ShopFont);
+				const FVector2D& ShopSize = Layout.TitleSize;
 				const float PadX = 8.f, PadY = 4.f;
 				float SignW = ShopSize.X + PadX * 2.f;
 				float SignH = ShopSize.Y + PadY * 2.f;
@@ -204,21 +254,20 @@ public:
 				// Shop title text (white/cream, centered)
 				FVector2D TitlePos(SlatePos.X - ShopSize.X * 0.5f, SignY + PadY);
 				DrawTextAt(OutDrawElements, LayerId, AllottedGeometry, TitlePos,
-					Entry.VendingTitle, ShopFont,
+					Layout.Title.ToSharedRef(),
 					FLinearColor(1.f, 0.96f, 0.85f, 1.f)); // Cream white
 			}
 
 			// Draw 4-pass black outline (RO Classic style: ±1px cardinal offsets)
 			DrawOutlinedText(OutDrawElements, LayerId, AllottedGeometry,
-				DrawPos, DisplayText, NameFont, NameColor);
+				DrawPos, Layout.Name.ToSharedRef(), NameColor);
 
 			// Draw sub-text below name (guild, party, etc.)
-			if (!Entry.SubText.IsEmpty())
+			if (Layout.Sub.IsValid())
 			{
-				FVector2D SubSize = FontMeasure->Measure(Entry.SubText, SubFont);
-				FVector2D SubPos(SlatePos.X - SubSize.X * 0.5f, DrawPos.Y + TextSize.Y + 1.f);
+				FVector2D SubPos(SlatePos.X - Layout.SubSize.X * 0.5f, DrawPos.Y + TextSize.Y + 1.f);
 				DrawOutlinedText(OutDrawElements, LayerId, AllottedGeometry,
-					SubPos, Entry.SubText, SubFont,
+					SubPos, Layout.Sub.ToSharedRef(),
 					FLinearColor(0.7f, 0.7f, 0.7f, 1.f));
 			}
 		}
@@ -229,37 +278,38 @@ public:
 private:
 	UNameTagSubsystem* Sub = nullptr;
 
-	// Draw text with 4-pass black outline + colored center (RO Classic rendering)
+	// Draw text with 4-pass black outline + colored center (RO Classic rendering).
+	// All five passes reuse the same shaped glyph sequence.
 	void DrawOutlinedText(FSlateWindowElementList& OutDrawElements, int32 LayerId,
-		const FGeometry& Geo, const FVector2D& Pos, const FString& Text,
-		const FSlateFontInfo& Font, const FLinearColor& Color) const
+		const FGeometry& Geo, const FVector2D& Pos, const FShapedGlyphSequenceRef& Glyphs,
+		const FLinearColor& Color) const
 	{
 		const float Offset = 1.f;
 		const FLinearColor& Shadow = NameTagColors::OutlineBlack;
 
 		// 4 cardinal shadow passes
-		DrawTextAt(OutDrawElements, LayerId, Geo, FVector2D(Pos.X - Offset, Pos.Y), Text, Font, Shadow);
-		DrawTextAt(OutDrawElements, LayerId, Geo, FVector2D(Pos.X + Offset, Pos.Y), Text, Font, Shadow);
-		DrawTextAt(OutDrawElements, LayerId, Geo, FVector2D(Pos.X, Pos.Y - Offset), Text, Font, Shadow);
-		DrawTextAt(OutDrawElements, LayerId, Geo, FVector2D(Pos.X, Pos.Y + Offset), Text, Font, Shadow);
+		DrawTextAt(OutDrawElements, LayerId, Geo, FVector2D(Pos.X - Offset, Pos.Y), Glyphs, Shadow);
+		DrawTextAt(OutDrawElements, LayerId, Geo, FVector2D(Pos.X + Offset, Pos.Y), Glyphs, Shadow);
+		DrawTextAt(OutDrawElements, LayerId, Geo, FVector2D(Pos.X, Pos.Y - Offset), Glyphs, Shadow);
+		DrawTextAt(OutDrawElements, LayerId, Geo, FVector2D(Pos.X, Pos.Y + Offset), Glyphs, Shadow);
 
 		// Main colored text on top
-		DrawTextAt(OutDrawElements, LayerId + 1, Geo, Pos, Text, Font, Color);
+		DrawTextAt(OutDrawElements, LayerId + 1, Geo, Pos, Glyphs, Color);
 	}
 
 	void DrawTextAt(FSlateWindowElementList& OutDrawElements, int32 LayerId,
-		const FGeometry& Geo, const FVector2D& Pos, const FString& Text,
-		const FSlateFontInfo& Font, const FLinearColor& Color) const
+		const FGeometry& Geo, const FVector2D& Pos, const FShapedGlyphSequenceRef& Glyphs,
+		const FLinearColor& Color) const
 	{
 		const FVector2f LocalSize(1000.f, 30.f); // Large enough to not clip
 		const FSlateLayoutTransform LayoutTransform(FVector2f((float)Pos.X, (float)Pos.Y));
-		FSlateDrawElement::MakeText(
+		FSlateDrawElement::MakeShapedText(
 			OutDrawElements,
 			LayerId,
 			Geo.ToPaintGeometry(LocalSize, LayoutTransform),
-			Text,
-			Font,
+			Glyphs,
 			ESlateDrawEffect::None,
+			Color,
 			Color
 		);
 	}
@@ -295,6 +345,7 @@ void UNameTagSubsystem::Deinitialize()
 {
 	HideOverlay();
 	Entries.Empty();
+	ActorToEntry.Empty();
 	Super::Deinitialize();
 }
 
@@ -318,13 +369,27 @@ void UNameTagSubsystem::RegisterEntity(AActor* Actor, const FString& Name,
 	Entry.VerticalOffset = VertOffset;
 	Entry.SpriteHeight = InSpriteHeight;
 	Entry.bVisible = true;
-	Entries.Add(Entry);
+
+	if (UScreenProjectionSubsystem* Projection = GetWorld()->GetSubsystem<UScreenProjectionSubsystem>())
+	{
+		FScreenAnchorDesc Desc;
+		Desc.HeadZOffset = VertOffset;
+		Desc.SpriteHeight = InSpriteHeight;
+		Entry.ScreenAnchor = Projection->AddAnchor(Actor, Desc);
+	}
+	ActorToEntry.Add(Actor, Entries.Add(MoveTemp(Entry)));
 }
 
 void UNameTagSubsystem::UnregisterEntity(AActor* Actor)
 {
 	if (!Actor) return;
-	Entries.RemoveAll([Actor](const FNameTagEntry& E) { return E.Actor.Get() == Actor; });
+
+	int32 EntryId = INDEX_NONE;
+	if (!ActorToEntry.RemoveAndCopyValue(Actor, EntryId)) return;
+
+	if (UScreenProjectionSubsystem* Projection = GetWorld()->GetSubsystem<UScreenProjectionSubsystem>())
+		Projection->RemoveAnchor(Entries[EntryId].ScreenAnchor);
+	Entries.RemoveAt(EntryId);
 }
 
 void UNameTagSubsystem::SetVisible(AActor* Actor, bool bVisible)
@@ -337,27 +402,77 @@ void UNameTagSubsystem::SetVisible(AActor* Actor, bool bVisible)
 
 void UNameTagSubsystem::UpdateName(AActor* Actor, const FString& NewName)
 {
-	if (FNameTagEntry* Entry = FindEntry(Actor))
+	FNameTagEntry* Entry = FindEntry(Actor);
+	if (Entry && Entry->DisplayName != NewName)
 	{
 		Entry->DisplayName = NewName;
+		Entry->Layout = FNameTagLayout();
 	}
 }
 
 void UNameTagSubsystem::SetVendingTitle(AActor* Actor, const FString& Title)
 {
-	if (FNameTagEntry* Entry = FindEntry(Actor))
+	FNameTagEntry* Entry = FindEntry(Actor);
+	if (Entry && Entry->VendingTitle != Title)
 	{
 		Entry->VendingTitle = Title;
+		Entry->Layout = FNameTagLayout();
 	}
 }
 
 FNameTagEntry* UNameTagSubsystem::FindEntry(AActor* Actor)
 {
-	for (FNameTagEntry& E : Entries)
+	const int32* EntryId = Actor ? ActorToEntry.Find(Actor) : nullptr;
+	return EntryId ? &Entries[*EntryId] : nullptr;
+}
+
+// ============================================================
+// Layout cache — shape + measure once per string change / scale change
+// ============================================================
+
+const FNameTagLayout& UNameTagSubsystem::GetLayout(int32 EntryId, float Scale)
+{
+	FNameTagEntry& Entry = Entries[EntryId];
+	FNameTagLayout& Layout = Entry.Layout;
+	if (Layout.Scale == Scale && Layout.Name.IsValid())
+		return Layout;
+
+	TSharedRef<FSlateFontCache> FontCache = FSlateApplication::Get().GetRenderer()->GetFontCache();
+	const float InvScale = (Scale > 0.f) ? 1.f / Scale : 1.f;
+
+	// Shaped at the paint scale; sizes stored in Slate units like FSlateFontMeasure::Measure
+	auto Shape = [&](const FString& Text, const FSlateFontInfo& Font,
+		FShapedGlyphSequencePtr& OutGlyphs, FVector2D& OutSize)
 	{
-		if (E.Actor.Get() == Actor) return &E;
-	}
-	return nullptr;
+		if (Text.IsEmpty())
+		{
+			OutGlyphs.Reset();
+			OutSize = FVector2D::ZeroVector;
+			return;
+		}
+		FShapedGlyphSequenceRef Glyphs = FontCache->ShapeBidirectionalText(
+			Text, Font, Scale, TextBiDi::ETextDirection::LeftToRight, GetDefaultTextShapingMethod());
+		OutSize = FVector2D(Glyphs->GetMeasuredWidth(), Glyphs->GetMaxTextHeight()) * InvScale;
+		OutGlyphs = Glyphs;
+	};
+
+	// Build display text
+	const FString DisplayText = (Entry.Type == ENameTagEntityType::Monster && Entry.Level > 0)
+		? FString::Printf(TEXT("%s Lv.%d"), *Entry.DisplayName, Entry.Level)
+		: Entry.DisplayName;
+
+	Shape(DisplayText, NameTagFonts::Name(), Layout.Name, Layout.NameSize);
+	Shape(Entry.SubText, NameTagFonts::Sub(), Layout.Sub, Layout.SubSize);
+	Shape(Entry.VendingTitle, NameTagFonts::Title(), Layout.Title, Layout.TitleSize);
+	Layout.Scale = Scale;
+	++NumLayoutBuilds;
+	return Layout;
+}
+
+void UNameTagSubsystem::LogStats() const
+{
+	UE_LOG(LogNameTag, Log, TEXT("NameTag: %d entries, last paint %d candidates / %d drawn (cap %d), %d layout builds"),
+		Entries.Num(), LastCandidates, LastDrawn, CVarNameTagMaxDrawn.GetValueOnGameThread(), NumLayoutBuilds);
 }
 
 // ============================================================
@@ -1,11 +1,16 @@
 // NameTagSubsystem.h — Renders entity name tags via Slate OnPaint overlay.
 // Phase 5 of Blueprint-to-C++ migration. Replaces per-actor WBP_PlayerNameTag WidgetComponents.
 // RO Classic behavior: player names always visible, monster/NPC names hover-only.
+// Entries live in an id-indexed sparse set; each caches its shaped text and measured size,
+// rebuilt only when its strings change or the paint scale does. NameTag.MaxDrawn caps how
+// many tags draw per frame (local player and hovered first, then nearest to the camera).
 
 #pragma once
 
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "Containers/SparseArray.h"
+#include "Fonts/ShapedTextFwd.h"
 #include "NameTagSubsystem.generated.h"
 
 UENUM()
@@ -17,6 +22,18 @@ enum class ENameTagEntityType : uint8
 	NPC
 };
 
+// Shaped text + measured sizes for one entry, built lazily at paint time
+struct FNameTagLayout
+{
+	float Scale = 0.f;                 // geometry scale it was shaped at (0 = dirty)
+	FShapedGlyphSequencePtr Name;      // DisplayName (+ " Lv.N" for monsters)
+	FShapedGlyphSequencePtr Sub;       // SubText (null if empty)
+	FShapedGlyphSequencePtr Title;     // VendingTitle (null if empty)
+	FVector2D NameSize = FVector2D::ZeroVector;   // Slate units
+	FVector2D SubSize = FVector2D::ZeroVector;
+	FVector2D TitleSize = FVector2D::ZeroVector;
+};
+
 struct FNameTagEntry
 {
 	TWeakObjectPtr<AActor> Actor;
@@ -28,6 +45,8 @@ struct FNameTagEntry
 	float VerticalOffset = 120.f; // Units above actor origin (above head in 3D)
 	float SpriteHeight = 0.f;     // If >0, use projected sprite height for positioning (scales with zoom)
 	FString VendingTitle;          // Non-empty = player is vending, show shop sign above name
+	int32 ScreenAnchor = INDEX_NONE; // UScreenProjectionSubsystem anchor (projected once per frame)
+	FNameTagLayout Layout;           // cleared by UpdateName / SetVendingTitle
 };
 
 UCLASS()
@@ -48,16 +67,27 @@ public:
 	void SetVendingTitle(AActor* Actor, const FString& Title);
 
 	// ---- Read by SNameTagOverlay in OnPaint ----
-	const TArray<FNameTagEntry>& GetEntries() const { return Entries; }
+	const TSparseArray<FNameTagEntry>& GetEntries() const { return Entries; }
 	int32 GetLocalPlayerLevel() const { return LocalPlayerLevel; }
 
+	// Entry's cached layout, (re)shaped if dirty or Scale differs from the cached one
+	const FNameTagLayout& GetLayout(int32 EntryId, float Scale);
+
 	// ---- options flags (set by OptionsSubsystem) ----
 	bool bShowPlayerNames = true;
 	bool bShowEnemyNames = true;
 	bool bShowNPCNames = true;
 
+	// ---- Stats (NameTag.Stats) ----
+	int32 NumLayoutBuilds = 0;   // layouts shaped this session
+	int32 LastCandidates = 0;    // tags that passed filters on the last paint
+	int32 LastDrawn = 0;         // tags drawn after the NameTag.MaxDrawn cap
+	void LogStats() const;
+
 private:
-	TArray<FNameTagEntry> Entries;
+	// Entries indexed by id (stable while registered); ActorToEntry maps actor -> id
+	TSparseArray<FNameTagEntry> Entries;
+	TMap<TWeakObjectPtr<AActor>, int32> ActorToEntry;
 	int32 LocalPlayerLevel = 1;
 
 	// Widget state
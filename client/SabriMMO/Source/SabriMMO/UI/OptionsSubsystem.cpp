@@ -11,6 +11,7 @@
 #include "ChatSubsystem.h"
 #include "SDamageNumberOverlay.h"
 #include "Sprite/SpriteAtlasData.h"
+#include "Sprite/SpriteSignificanceSubsystem.h"
 #include "Audio/AudioSubsystem.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
@@ -80,9 +81,10 @@ void UOptionsSubsystem::OnWorldBeginPlay(UWorld& InWorld)
 	bAutoDeclineTrades = GI->bOptionAutoDeclineTrades;
 	bAutoDeclineParty = GI->bOptionAutoDeclineParty;
 	iSpriteQuality = GI->iOptionSpriteQuality;
+	iEntityDetail = GI->iOptionEntityDetail;
 
 	// Push sprite quality to the global before any sprite textures load.
-	// Applies to every atlas loaded from this point onward via EnsureTextureLoaded().
+	// Applies to every atlas loaded from this point onward via LoadTexture().
 	FSingleAnimAtlasInfo::GlobalLODBias = FMath::Clamp(iSpriteQuality, 0, 4);
 
 	AddOptionsWidgetToViewport();
@@ -177,6 +179,9 @@ void UOptionsSubsystem::PushSettingsToSubsystems()
 		Chat->ChatPanelOpacity = fChatOpacity;
 	}
 
+	if (auto* Significance = World->GetSubsystem<USpriteSignificanceSubsystem>())
+		Significance->SetDetailLevel(iEntityDetail);
+
 	SDamageNumberOverlay::FontScaleMultiplier = fDamageNumberScale;
 
 	// Push initial volume settings to the audio bus system
@@ -230,6 +235,7 @@ void UOptionsSubsystem::SaveToGameInstance()
 	GI->bOptionAutoDeclineTrades = bAutoDeclineTrades;
 	GI->bOptionAutoDeclineParty = bAutoDeclineParty;
 	GI->iOptionSpriteQuality = iSpriteQuality;
+	GI->iOptionEntityDetail = iEntityDetail;
 	GI->SaveGameOptions();
 }
 
@@ -510,6 +516,22 @@ void UOptionsSubsystem::ApplySpriteQualityToLoadedTextures()
 		NewBias, Updated);
 }
 
+// ============================================================
+// Entity Detail (sprite update LOD budgets)
+// ============================================================
+
+void UOptionsSubsystem::SetEntityDetail(int32 NewValue)
+{
+	const int32 Clamped = FMath::Clamp(NewValue, 0, 4);
+	if (Clamped == iEntityDetail) return;
+
+	iEntityDetail = Clamped;
+	if (auto* Significance = GetWorld()->GetSubsystem<USpriteSignificanceSubsystem>())
+		Significance->SetDetailLevel(iEntityDetail);
+
+	SaveToGameInstance();
+}
+
 // ============================================================
 // Viewport Integration — Options Panel
 // ============================================================
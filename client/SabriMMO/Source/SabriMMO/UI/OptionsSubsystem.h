@@ -127,6 +127,12 @@ public:
 	int32 GetSpriteQuality() const { return iSpriteQuality; }
 	void SetSpriteQuality(int32 NewValue);
 
+	// ---- Video / Entity Detail ----
+	// Same 0 = Ultra .. 4 = Very Low scale — how many sprites keep full-rate animation,
+	// tracking, occlusion and shadows before the rest drop to reduced / far (USpriteSignificanceSubsystem).
+	int32 GetEntityDetail() const { return iEntityDetail; }
+	void SetEntityDetail(int32 NewValue);
+
 private:
 	/** Iterate already-loaded sprite atlas textures and apply current LODBias.
 	 *  Called when SetSpriteQuality changes value. New atlases loaded after this
@@ -169,6 +175,7 @@ private:
 	bool bAutoDeclineTrades = false;
 	bool bAutoDeclineParty = false;
 	int32 iSpriteQuality = 2;  // Medium by default (LODBias 2). 0=Ultra, 1=High, 2=Medium, 3=Low, 4=Very Low
+	int32 iEntityDetail = 2;   // Medium by default, same scale
 
 	TSharedPtr<SOptionsWidget> OptionsWidget;
 	TSharedPtr<SWidget> OptionsAlignmentWrapper;
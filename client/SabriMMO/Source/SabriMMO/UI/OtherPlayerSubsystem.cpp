@@ -3,7 +3,10 @@
 
 #include "OtherPlayerSubsystem.h"
 #include "NameTagSubsystem.h"
+#include "EntityRegistrySubsystem.h"
 #include "ZonePreloadSubsystem.h"
+#include "SnapshotInterpolationSubsystem.h"
+#include "ActorPoolSubsystem.h"
 #include "MMOGameInstance.h"
 #include "SocketEventRouter.h"
 #include "Sprite/SpriteCharacterActor.h"
@@ -13,40 +16,32 @@
 DEFINE_LOG_CATEGORY_STATIC(LogOtherPlayerSubsystem, Log, All);
 
 // ============================================================
-// BP Reflection Helpers
+// Sprite pool helpers
 // ============================================================
 
 namespace
 {
-	void SetBPInt(AActor* A, FName N, int32 V)
+	// Remote player sprites are pooled by body (class + gender); equipment and hair are rebound per use
+	ASpriteCharacterActor* AcquirePlayerSprite(UWorld* World, const FVector& Location, int32 ClassId, int32 Gender)
 	{
-		if (!A) return;
-		if (FIntProperty* P = CastField<FIntProperty>(A->GetClass()->FindPropertyByName(N)))
-			*P->ContainerPtrToValuePtr<int32>(A) = V;
+		UActorPoolSubsystem* Pool = World->GetSubsystem<UActorPoolSubsystem>();
+		if (!Pool)
+			return ASpriteCharacterActor::SpawnSpriteForClass(World, Location, ClassId, Gender);
+
+		bool bBodyBound = false;
+		ASpriteCharacterActor* Sprite = Pool->Acquire<ASpriteCharacterActor>(TEXT("PlayerSprite"), Location,
+			FName(*FString::Printf(TEXT("%d_%d"), ClassId, Gender)), &bBodyBound);
+		if (Sprite && !bBodyBound)
+			Sprite->SetBodyClass(ClassId, Gender);
+		return Sprite;
 	}
 
-	void SetBPBool(AActor* A, FName N, bool V)
+	void ReleasePlayerSprite(UWorld* World, ASpriteCharacterActor* Sprite)
 	{
-		if (!A) return;
-		if (FBoolProperty* P = CastField<FBoolProperty>(A->GetClass()->FindPropertyByName(N)))
-			P->SetPropertyValue_InContainer(A, V);
-	}
-
-	void SetBPString(AActor* A, FName N, const FString& V)
-	{
-		if (!A) return;
-		if (FStrProperty* P = CastField<FStrProperty>(A->GetClass()->FindPropertyByName(N)))
-			*P->ContainerPtrToValuePtr<FString>(A) = V;
-	}
-
-	void SetBPVector(AActor* A, FName N, const FVector& V)
-	{
-		if (!A) return;
-		if (FStructProperty* P = CastField<FStructProperty>(A->GetClass()->FindPropertyByName(N)))
-		{
-			if (P->Struct == TBaseStructure<FVector>::Get())
-				*P->ContainerPtrToValuePtr<FVector>(A) = V;
-		}
+		if (UActorPoolSubsystem* Pool = World->GetSubsystem<UActorPoolSubsystem>())
+			Pool->Release(Sprite);
+		else
+			Sprite->Destroy();
 	}
 }
 
@@ -84,8 +79,8 @@ void UOtherPlayerSubsystem::OnWorldBeginPlay(UWorld& InWorld)
 	}
 
 	// Register event handlers
-	Router->RegisterHandler(TEXT("player:moved"), this,
-		[this](const TSharedPtr<FJsonValue>& D) { HandlePlayerMoved(D); });
+	Router->RegisterTypedHandler<FPlayerMovedEvent>(TEXT("player:moved"), this,
+		[this](const FPlayerMovedEvent& Ev) { HandlePlayerMoved(Ev); });
 	Router->RegisterHandler(TEXT("player:left"), this,
 		[this](const TSharedPtr<FJsonValue>& D) { HandlePlayerLeft(D); });
 	Router->RegisterHandler(TEXT("player:appearance"), this,
@@ -116,14 +111,9 @@ void UOtherPlayerSubsystem::OnWorldBeginPlay(UWorld& InWorld)
 	};
 
 	// Attack animation: when another player deals damage
-	Router->RegisterHandler(TEXT("combat:damage"), this,
-		[this, SafeSetAnim](const TSharedPtr<FJsonValue>& D) {
-			if (!D.IsValid()) return;
-			const TSharedPtr<FJsonObject>& Obj = D->AsObject();
-			if (!Obj.IsValid()) return;
-			double AtkId = 0;
-			Obj->TryGetNumberField(TEXT("attackerId"), AtkId);
-			SafeSetAnim(Players.Find((int32)AtkId), ESpriteAnimState::Attack);
+	Router->RegisterTypedHandler<FCombatDamageEvent>(TEXT("combat:damage"), this,
+		[this, SafeSetAnim](const FCombatDamageEvent& Ev) {
+			SafeSetAnim(Players.Find(Ev.AttackerId), ESpriteAnimState::Attack);
 		});
 
 	// Death animation
@@ -244,6 +234,7 @@ void UOtherPlayerSubsystem::Deinitialize()
 
 	bReadyToProcess = false;
 	PlayerBPClass = nullptr;
+	BPBindings.Reset();
 
 	Super::Deinitialize();
 }
@@ -290,27 +281,17 @@ bool UOtherPlayerSubsystem::IsPlayerHidden(int32 CharacterId) const
 // HandlePlayerMoved — filter local, spawn new or update existing
 // ============================================================
 
-void UOtherPlayerSubsystem::HandlePlayerMoved(const TSharedPtr<FJsonValue>& Data)
+void UOtherPlayerSubsystem::HandlePlayerMoved(const FPlayerMovedEvent& Ev)
 {
-	if (!bReadyToProcess || !Data.IsValid()) return;
+	if (!bReadyToProcess) return;
 
-	const TSharedPtr<FJsonObject>* ObjPtr = nullptr;
-	if (!Data->TryGetObject(ObjPtr) || !ObjPtr) return;
-	const TSharedPtr<FJsonObject>& Obj = *ObjPtr;
-
-	double CharIdD = 0;
-	if (!Obj->TryGetNumberField(TEXT("characterId"), CharIdD)) return;
-	int32 CharId = (int32)CharIdD;
+	const int32 CharId = Ev.CharacterId;
 
 	// Filter local player — server broadcasts to everyone except sender,
 	// but zone-join batch sends all players including self
 	if (CharId == LocalCharacterId) return;
 
-	double X = 0, Y = 0, Z = 0;
-	Obj->TryGetNumberField(TEXT("x"), X);
-	Obj->TryGetNumberField(TEXT("y"), Y);
-	Obj->TryGetNumberField(TEXT("z"), Z);
-	FVector Pos((float)X, (float)Y, (float)Z);
+	const FVector Pos = Ev.Position;
 
 	// ---- Existing player? ----
 	FPlayerEntry* Existing = Players.Find(CharId);
@@ -318,22 +299,33 @@ void UOtherPlayerSubsystem::HandlePlayerMoved(const TSharedPtr<FJsonValue>& Data
 	{
 		AActor* Player = Existing->Actor.Get();
 
-		// Large distance = zone transition, Fly Wing, or teleport — snap instead of interpolate.
-		float Dist = FVector::Dist(Player->GetActorLocation(), Pos);
-		if (Dist > 200.f)
+		// Buffered: the interpolation subsystem feeds TargetPosition from server-time snapshots
+		// (and snaps on teleport-sized jumps) instead of the BP chasing each packet as it lands
+		USnapshotInterpolationSubsystem* Interp = GetWorld()->GetSubsystem<USnapshotInterpolationSubsystem>();
+		if (Interp && USnapshotInterpolationSubsystem::IsEnabled())
 		{
-			Player->SetActorLocation(Pos);
+			if (Ev.Timestamp > 0.0) Interp->BeginPacket(static_cast<uint32>(static_cast<uint64>(Ev.Timestamp)));
+			Interp->Push(Player, Pos, Ev.bIsMoving, EMotionApply::BlueprintTarget);
+			if (Ev.Timestamp > 0.0) Interp->EndPacket();
 		}
+		else
+		{
+			// Large distance = zone transition, Fly Wing, or teleport — snap instead of interpolate.
+			float Dist = FVector::Dist(Player->GetActorLocation(), Pos);
+			if (Dist > 200.f)
+			{
+				Player->SetActorLocation(Pos);
+			}
 
-		SetBPVector(Player, TEXT("TargetPosition"), Pos);
-		SetBPBool(Player, TEXT("bIsMoving"), true);
+			const FBPMovementBindings& BP = BPBindings.Get(Player);
+			BP.TargetPosition.Set(Player, Pos);
+			BP.IsMoving.Set(Player, true);
+		}
 
 		// Update weapon mode on every position tick (equipment changes propagate via player:moved)
 		if (Existing->SpriteActor.IsValid())
 		{
-			double WMD = 0;
-			Obj->TryGetNumberField(TEXT("weaponMode"), WMD);
-			int32 WM = (int32)WMD;
+			const int32 WM = Ev.WeaponMode;
 			ESpriteWeaponMode NewMode = ESpriteWeaponMode::None;
 			if (WM == 1) NewMode = ESpriteWeaponMode::OneHand;
 			else if (WM == 2) NewMode = ESpriteWeaponMode::TwoHand;
@@ -351,6 +343,12 @@ void UOtherPlayerSubsystem::HandlePlayerMoved(const TSharedPtr<FJsonValue>& Data
 	UWorld* World = GetWorld();
 	if (!World || !PlayerBPClass) return;
 
+	// Spawn-only fields are cold — read them from the original payload.
+	// Binary move:batch records carry no payload; the JSON player:moved sent on
+	// zone:ready spawns the player, so an unknown id here just waits for it.
+	const TSharedPtr<FJsonObject>& Obj = Ev.Source;
+	if (!Obj.IsValid()) return;
+
 	FString PlayerName;
 	Obj->TryGetStringField(TEXT("characterName"), PlayerName);
 	FString JobClass;
@@ -420,13 +418,14 @@ void UOtherPlayerSubsystem::HandlePlayerMoved(const TSharedPtr<FJsonValue>& Data
 		return;
 	}
 
-	SetBPVector(NewPlayer, TEXT("TargetPosition"), Pos);
+	BPBindings.Get(NewPlayer).TargetPosition.Set(NewPlayer, Pos);
+	if (USnapshotInterpolationSubsystem* Interp = World->GetSubsystem<USnapshotInterpolationSubsystem>())
+		Interp->Teleport(NewPlayer, Pos, EMotionApply::BlueprintTarget);
 
 	// Spawn sprite for this other player with their class/gender
 	int32 SpriteClassId = ASpriteCharacterActor::JobClassToId(JobClass);
 	int32 SpriteGender = Gender.ToLower() == TEXT("female") ? 1 : 0;
-	ASpriteCharacterActor* Sprite = ASpriteCharacterActor::SpawnSpriteForClass(
-		World, Pos, SpriteClassId, SpriteGender);
+	ASpriteCharacterActor* Sprite = AcquirePlayerSprite(World, Pos, SpriteClassId, SpriteGender);
 	// Hide the 3D mesh on the other player BP (show sprite instead)
 	if (USkeletalMeshComponent* OtherMesh = NewPlayer->FindComponentByClass<USkeletalMeshComponent>())
 	{
@@ -455,15 +454,15 @@ void UOtherPlayerSubsystem::HandlePlayerMoved(const TSharedPtr<FJsonValue>& Data
 	Entry.EquipVisuals = CachedEquipVisuals;
 	Players.Add(CharId, Entry);
 	ActorToPlayerId.Add(NewPlayer, CharId);
+	if (UEntityRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UEntityRegistrySubsystem>())
+		Registry->Register(EEntityCategory::Player, CharId, NewPlayer);
 
 	if (Sprite)
 	{
 		Sprite->AttachToOwnerActor(NewPlayer, false, CharId);
 
 		// Set weapon mode immediately from player:moved data
-		double WMD = 0;
-		Obj->TryGetNumberField(TEXT("weaponMode"), WMD);
-		int32 WM = (int32)WMD;
+		const int32 WM = Ev.WeaponMode;
 		UE_LOG(LogOtherPlayerSubsystem, Warning,
 			TEXT("Remote sprite spawn: charId=%d weaponMode=%d bodyReady=%d"),
 			CharId, WM, Sprite->IsBodyReady() ? 1 : 0);
@@ -564,9 +563,9 @@ void UOtherPlayerSubsystem::HandlePlayerLeft(const TSharedPtr<FJsonValue>& Data)
 				NTS->UnregisterEntity(Found->Actor.Get());
 		}
 
-		// Destroy sprite actor
+		// Sprite goes back to the pool; the BP pawn's Blueprint state can't be reset from here
 		if (Found->SpriteActor.IsValid())
-			Found->SpriteActor.Get()->Destroy();
+			ReleasePlayerSprite(GetWorld(), Found->SpriteActor.Get());
 
 		if (Found->Actor.IsValid())
 		{
@@ -576,6 +575,8 @@ void UOtherPlayerSubsystem::HandlePlayerLeft(const TSharedPtr<FJsonValue>& Data)
 	}
 	Players.Remove(CharId);
 	HiddenPlayerIds.Remove(CharId);
+	if (UEntityRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UEntityRegistrySubsystem>())
+		Registry->Unregister(EEntityCategory::Player, CharId);
 
 	UE_LOG(LogOtherPlayerSubsystem, Verbose, TEXT("Player %d left."), CharId);
 }
@@ -885,7 +886,7 @@ void UOtherPlayerSubsystem::HandleRemoteJobChanged(const TSharedPtr<FJsonValue>&
 		}
 		if (OldSprite)
 		{
-			OldSprite->Destroy();
+			ReleasePlayerSprite(World, OldSprite);
 		}
 		Entry->SpriteActor.Reset();
 	}
@@ -895,12 +896,11 @@ void UOtherPlayerSubsystem::HandleRemoteJobChanged(const TSharedPtr<FJsonValue>&
 	const int32 SpriteClassId = ASpriteCharacterActor::JobClassToId(NewClass);
 	const int32 SpriteGender = (Entry->Gender.ToLower() == TEXT("female")) ? 1 : 0;
 
-	ASpriteCharacterActor* NewSprite = ASpriteCharacterActor::SpawnSpriteForClass(
-		World, SpawnLoc, SpriteClassId, SpriteGender);
+	ASpriteCharacterActor* NewSprite = AcquirePlayerSprite(World, SpawnLoc, SpriteClassId, SpriteGender);
 	if (!NewSprite)
 	{
 		UE_LOG(LogOtherPlayerSubsystem, Warning,
-			TEXT("HandleRemoteJobChanged: SpawnSpriteForClass returned null for charId=%d class=%s"),
+			TEXT("HandleRemoteJobChanged: no sprite for charId=%d class=%s"),
 			CharId, *NewClass);
 		return;
 	}
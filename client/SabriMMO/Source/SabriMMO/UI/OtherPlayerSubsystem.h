@@ -7,6 +7,8 @@
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "Dom/JsonValue.h"
+#include "SocketEventTypes.h"
+#include "BlueprintBindings.h"
 #include "OtherPlayerSubsystem.generated.h"
 
 // ============================================================
@@ -74,6 +76,9 @@ private:
 	UPROPERTY()
 	UClass* PlayerBPClass = nullptr;
 
+	// TargetPosition / bIsMoving resolved once per class (written on every non-buffered player:moved)
+	TBPBindingCache<FBPMovementBindings> BPBindings;
+
 	// Local player ID — filtered from player:moved to avoid spawning self
 	int32 LocalCharacterId = 0;
 
@@ -81,7 +86,7 @@ private:
 	bool bReadyToProcess = false;
 
 	// Socket event handlers
-	void HandlePlayerMoved(const TSharedPtr<FJsonValue>& Data);
+	void HandlePlayerMoved(const FPlayerMovedEvent& Ev);
 	void HandlePlayerLeft(const TSharedPtr<FJsonValue>& Data);
 	void HandlePlayerAppearance(const TSharedPtr<FJsonValue>& Data);
 	void HandleVendingShopOpened(const TSharedPtr<FJsonValue>& Data);
@@ -4,6 +4,7 @@
 #include "PetSubsystem.h"
 #include "MMOGameInstance.h"
 #include "SocketEventRouter.h"
+#include "EntityRegistrySubsystem.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
 #include "Framework/Application/SlateApplication.h"
@@ -575,6 +576,8 @@ void UPetSubsystem::SpawnPetActor()
 	if (PetActor)
 	{
 		PetActor->SetActorScale3D(FVector(0.5f));
+		if (UEntityRegistrySubsystem* Registry = World->GetSubsystem<UEntityRegistrySubsystem>())
+			Registry->Register(EEntityCategory::Companion, (int32)PetActor->GetUniqueID(), PetActor);
 		UE_LOG(LogPet, Log, TEXT("Spawned pet placeholder actor at %s"), *SpawnLoc.ToString());
 
 		// Start follow tick (10Hz — pet follows owner)
@@ -590,6 +593,8 @@ void UPetSubsystem::DespawnPetActor()
 {
 	if (PetActor)
 	{
+		if (UEntityRegistrySubsystem* Registry = GetWorld() ? GetWorld()->GetSubsystem<UEntityRegistrySubsystem>() : nullptr)
+			Registry->UnregisterActor(PetActor);
 		PetActor->Destroy();
 		PetActor = nullptr;
 		UE_LOG(LogPet, Log, TEXT("Despawned pet actor"));
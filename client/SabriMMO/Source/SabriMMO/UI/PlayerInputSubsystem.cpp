@@ -107,6 +107,10 @@ void UPlayerInputSubsystem::OnWalkPollTick()
 			APawn* Pawn = GetLocalPawn();
 			AActor* Target = AttackTargetActor.Get();
 
+			// Enemy sprites are pooled — after death the actor may already stand for another enemy
+			if (Target && bAttackTargetIsEnemy && GetEnemyIdFromActor(Target) != AttackTargetId)
+				Target = nullptr;
+
 			if (!Pawn || !Target)
 			{
 				StopAutoAttack();
@@ -169,6 +173,15 @@ void UPlayerInputSubsystem::OnWalkPollTick()
 	{
 		AActor* ItemActor = PendingPickupActor.Get();
 		APawn* Pawn = GetLocalPawn();
+
+		// Ground item actors are pooled — a picked-up item's actor may be reused for another drop
+		if (ItemActor)
+		{
+			UGroundItemSubsystem* GIS = GetWorld()->GetSubsystem<UGroundItemSubsystem>();
+			if (GIS && GIS->GetGroundItemIdFromActor(ItemActor) != PendingPickupGroundItemId)
+				ItemActor = nullptr;
+		}
+
 		if (!Pawn || !ItemActor)
 		{
 			PendingPickupActor.Reset();
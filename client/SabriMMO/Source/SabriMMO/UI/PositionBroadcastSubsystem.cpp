@@ -1,4 +1,4 @@
-// PositionBroadcastSubsystem.cpp — 30Hz position broadcasting via persistent socket.
+// PositionBroadcastSubsystem.cpp — Adaptive position broadcasting via persistent socket (see header).
 
 #include "PositionBroadcastSubsystem.h"
 #include "MMOGameInstance.h"
@@ -8,9 +8,51 @@
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/Pawn.h"
 #include "Dom/JsonObject.h"
+#include "HAL/IConsoleManager.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogPositionBroadcast, Log, All);
 
+static TAutoConsoleVariable<float> CVarPositionMinDistance(
+	TEXT("PositionBroadcast.MinDistance"),
+	2.f,
+	TEXT("Movement (world units) since the last sent position below which a tick is suppressed."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarPositionMinYaw(
+	TEXT("PositionBroadcast.MinYaw"),
+	2.f,
+	TEXT("Yaw change (degrees) since the last sent position below which a tick is suppressed."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarPositionTurnAngle(
+	TEXT("PositionBroadcast.TurnAngle"),
+	15.f,
+	TEXT("Change in movement direction (degrees) that sends immediately instead of waiting for SteadyInterval."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarPositionSteadyInterval(
+	TEXT("PositionBroadcast.SteadyInterval"),
+	0.066f,
+	TEXT("Seconds between sends while moving in a straight line (how far the server's copy of the position can lag)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarPositionKeepaliveInterval(
+	TEXT("PositionBroadcast.KeepaliveInterval"),
+	1.f,
+	TEXT("Seconds between keepalive sends while standing still."),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorldAndArgs GPositionBroadcastStatsCmd(
+	TEXT("PositionBroadcast.Stats"),
+	TEXT("Print position packets sent, suppressed and sent as idle keepalives."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UPositionBroadcastSubsystem* Sub = World ? World->GetSubsystem<UPositionBroadcastSubsystem>() : nullptr)
+		{
+			Sub->LogStats();
+		}
+	}));
+
 bool UPositionBroadcastSubsystem::ShouldCreateSubsystem(UObject* Outer) const
 {
 	UWorld* World = Cast<UWorld>(Outer);
@@ -22,14 +64,16 @@ void UPositionBroadcastSubsystem::OnWorldBeginPlay(UWorld& InWorld)
 {
 	Super::OnWorldBeginPlay(InWorld);
 
-	// Start 30Hz position broadcast timer (~33ms interval)
+	Payload = MakeShared<FJsonObject>();
+
+	// 30Hz base tick (~33ms interval); BroadcastPosition decides whether the tick sends
 	InWorld.GetTimerManager().SetTimer(
 		PositionTimer,
 		FTimerDelegate::CreateUObject(this, &UPositionBroadcastSubsystem::BroadcastPosition),
 		0.033f, true
 	);
 
-	UE_LOG(LogPositionBroadcast, Log, TEXT("PositionBroadcastSubsystem started — 30Hz position updates."));
+	UE_LOG(LogPositionBroadcast, Log, TEXT("PositionBroadcastSubsystem started — adaptive position updates (30Hz tick)."));
 }
 
 void UPositionBroadcastSubsystem::Deinitialize()
@@ -39,6 +83,7 @@ void UPositionBroadcastSubsystem::Deinitialize()
 		World->GetTimerManager().ClearTimer(PositionTimer);
 	}
 
+	Payload.Reset();
 	Super::Deinitialize();
 }
 
@@ -56,17 +101,104 @@ void UPositionBroadcastSubsystem::BroadcastPosition()
 	APawn* Pawn = PC->GetPawn();
 	if (!Pawn) return;
 
-	FVector Location = Pawn->GetActorLocation();
-	FRotator Rotation = Pawn->GetActorRotation();
+	// The selected character can't change while this world is alive — look it up once
+	if (CharacterId == 0)
+	{
+		CharacterId = GI->GetSelectedCharacter().CharacterId;
+		if (CharacterId == 0) return;
+	}
+
+	++NumTicks;
+
+	const FVector Location = Pawn->GetActorLocation();
+	const float Yaw = Pawn->GetActorRotation().Yaw;
+	const double Now = World->GetTimeSeconds();
+
+	if (!bHasSent)
+	{
+		Send(Location, Yaw, false, Now);
+		return;
+	}
+
+	const FVector Delta = Location - LastSentLocation;
+	const float MinDistance = CVarPositionMinDistance.GetValueOnGameThread();
+	const float YawDelta = FMath::Abs(FRotator::NormalizeAxis(Yaw - LastSentYaw));
+	const bool bMoved = Delta.SizeSquared() >= FMath::Square(MinDistance);
 
-	FCharacterData SelChar = GI->GetSelectedCharacter();
+	if (!bMoved && YawDelta < CVarPositionMinYaw.GetValueOnGameThread())
+	{
+		// Standing still: report the rest position once, then only keepalives
+		if (bLastSentMoving || Now - LastSendTime >= CVarPositionKeepaliveInterval.GetValueOnGameThread())
+		{
+			if (!bLastSentMoving) ++NumKeepalives;
+			Send(Location, Yaw, false, Now);
+		}
+		else
+		{
+			++NumSuppressed;
+		}
+		return;
+	}
 
-	TSharedPtr<FJsonObject> Payload = MakeShared<FJsonObject>();
-	Payload->SetStringField(TEXT("characterId"), FString::FromInt(SelChar.CharacterId));
+	// Starting to move or bending the path: the server's extrapolation is now wrong, send now
+	const FVector2D Dir = FVector2D(Delta).GetSafeNormal();
+	bool bTurn = false;
+	if (bMoved && !Dir.IsZero())
+	{
+		const float CosTurn = FMath::Cos(FMath::DegreesToRadians(CVarPositionTurnAngle.GetValueOnGameThread()));
+		bTurn = !bLastSentMoving || LastSentDir.IsZero() || (Dir | LastSentDir) < CosTurn;
+	}
+
+	if (bTurn)
+	{
+		++NumTurnSends;
+		Send(Location, Yaw, true, Now);
+	}
+	else if (Now - LastSendTime >= CVarPositionSteadyInterval.GetValueOnGameThread())
+	{
+		Send(Location, Yaw, bMoved, Now);
+	}
+	else
+	{
+		++NumSuppressed;
+	}
+}
+
+void UPositionBroadcastSubsystem::Send(const FVector& Location, float Yaw, bool bMoving, double Now)
+{
+	UMMOGameInstance* GI = Cast<UMMOGameInstance>(GetWorld()->GetGameInstance());
+
+	if (bMoving)
+	{
+		LastSentDir = FVector2D(Location - LastSentLocation).GetSafeNormal();
+	}
+	else
+	{
+		LastSentDir = FVector2D::ZeroVector;
+	}
+
+	Payload->SetNumberField(TEXT("characterId"), CharacterId);
 	Payload->SetNumberField(TEXT("x"), Location.X);
 	Payload->SetNumberField(TEXT("y"), Location.Y);
 	Payload->SetNumberField(TEXT("z"), Location.Z);
-	Payload->SetNumberField(TEXT("yaw"), Rotation.Yaw);
+	Payload->SetNumberField(TEXT("yaw"), Yaw);
+	Payload->SetBoolField(TEXT("moving"), bMoving);
+	Payload->SetNumberField(TEXT("seq"), ++Seq);
 
 	GI->EmitSocketEvent(TEXT("player:position"), Payload);
+
+	bHasSent = true;
+	bLastSentMoving = bMoving;
+	LastSentLocation = Location;
+	LastSentYaw = Yaw;
+	LastSendTime = Now;
+	++NumSent;
+}
+
+void UPositionBroadcastSubsystem::LogStats() const
+{
+	const double SentPct = NumTicks ? 100.0 * (double)NumSent / (double)NumTicks : 0.0;
+	UE_LOG(LogPositionBroadcast, Log,
+		TEXT("Position broadcast: %llu ticks, %llu sent (%.1f%%: %llu on turn/start, %llu idle keepalives), %llu suppressed; seq %u"),
+		NumTicks, NumSent, SentPct, NumTurnSends, NumKeepalives, NumSuppressed, Seq);
 }
@@ -1,6 +1,17 @@
 // PositionBroadcastSubsystem.h — UWorldSubsystem that broadcasts the local player's
-// position to the server at 30Hz via the persistent socket on GameInstance.
+// position to the server via the persistent socket on GameInstance.
 // Replaces the position timer that was previously on BP_SocketManager.
+//
+// The timer still runs at 30Hz, but each tick decides whether a packet is worth sending:
+//   - turning or starting to move: send immediately (full 30Hz while the path bends)
+//   - moving in a straight line: send every PositionBroadcast.SteadyInterval
+//   - moved / turned less than PositionBroadcast.MinDistance / MinYaw: suppress
+//   - idle: one "moving=false" packet on stopping, then a keepalive every
+//     PositionBroadcast.KeepaliveInterval so the server knows the client is alive
+// The server does not extrapolate: it stores the last position and direction as sent and
+// forwards the moving flag into move:batch, where remote clients use moving=false to stop
+// (see the player:position handler in server/src/index.js for the contract).
+// PositionBroadcast.Stats prints sent / suppressed / keepalive counts.
 
 #pragma once
 
@@ -8,6 +19,8 @@
 #include "Subsystems/WorldSubsystem.h"
 #include "PositionBroadcastSubsystem.generated.h"
 
+class FJsonObject;
+
 UCLASS()
 class SABRIMMO_API UPositionBroadcastSubsystem : public UWorldSubsystem
 {
@@ -18,8 +31,31 @@ public:
 	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
 	virtual void Deinitialize() override;
 
+	void LogStats() const;
+
 private:
 	void BroadcastPosition();
+	void Send(const FVector& Location, float Yaw, bool bMoving, double Now);
 
 	FTimerHandle PositionTimer;
+
+	// Reused for every send — the socket serializes it synchronously inside Emit
+	TSharedPtr<FJsonObject> Payload;
+	int32 CharacterId = 0;
+
+	// Last packet actually sent
+	bool bHasSent = false;
+	bool bLastSentMoving = false;
+	FVector LastSentLocation = FVector::ZeroVector;
+	FVector2D LastSentDir = FVector2D::ZeroVector;
+	float LastSentYaw = 0.f;
+	double LastSendTime = 0.0;
+	uint32 Seq = 0;
+
+	// Lifetime counters for PositionBroadcast.Stats
+	uint64 NumTicks = 0;
+	uint64 NumSent = 0;
+	uint64 NumTurnSends = 0;
+	uint64 NumKeepalives = 0;
+	uint64 NumSuppressed = 0;
 };
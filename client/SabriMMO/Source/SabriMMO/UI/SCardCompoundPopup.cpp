@@ -3,6 +3,8 @@
 
 #include "SCardCompoundPopup.h"
 #include "InventorySubsystem.h"
+#include "IconCacheSubsystem.h"
+#include "SIconImage.h"
 #include "Widgets/Layout/SBox.h"
 #include "Widgets/Layout/SBorder.h"
 #include "Widgets/Layout/SScrollBox.h"
@@ -162,12 +164,13 @@ TSharedRef<SWidget> SCardCompoundPopup::BuildTitleBar()
 
 	TSharedRef<SWidget> CardIcon = [&]() -> TSharedRef<SWidget>
 	{
-		FSlateBrush* Brush = Sub ? Sub->GetOrCreateItemIconBrush(CardItem.Icon) : nullptr;
+		UIconCacheSubsystem* Icons = UIconCacheSubsystem::Get(Sub);
+		TSharedPtr<const FSlateBrush> Brush = Icons ? Icons->GetItemIcon(CardItem.Icon) : nullptr;
 		if (Brush)
 		{
 			return SNew(SBox).WidthOverride(20.f).HeightOverride(20.f)
 			[
-				SNew(SImage).Image(Brush)
+				SNew(SIconImage).Icon(Brush)
 			];
 		}
 		return SNew(SBox).WidthOverride(20.f).HeightOverride(20.f)
@@ -246,12 +249,13 @@ TSharedRef<SWidget> SCardCompoundPopup::BuildEquipmentRow(const FInventoryItem&
 	// Build icon
 	TSharedRef<SWidget> EquipIcon = [&]() -> TSharedRef<SWidget>
 	{
-		FSlateBrush* Brush = Sub ? Sub->GetOrCreateItemIconBrush(Equipment.Icon) : nullptr;
+		UIconCacheSubsystem* Icons = UIconCacheSubsystem::Get(Sub);
+		TSharedPtr<const FSlateBrush> Brush = Icons ? Icons->GetItemIcon(Equipment.Icon) : nullptr;
 		if (Brush)
 		{
 			return SNew(SBox).WidthOverride(RowIconSize).HeightOverride(RowIconSize)
 			[
-				SNew(SImage).Image(Brush)
+				SNew(SIconImage).Icon(Brush)
 			];
 		}
 		return SNew(SBox).WidthOverride(RowIconSize).HeightOverride(RowIconSize)
@@ -6,6 +6,8 @@
 #include "InventorySubsystem.h"
 #include "ItemInspectSubsystem.h"
 #include "ItemTooltipBuilder.h"
+#include "IconCacheSubsystem.h"
+#include "SIconImage.h"
 #include "Engine/Engine.h"
 #include "Widgets/Layout/SBox.h"
 #include "Widgets/Layout/SBorder.h"
@@ -318,18 +320,15 @@ TSharedRef<SWidget> SCartWidget::BuildItemSlot(int32 SlotIndex)
 	// Pre-build icon widget: texture icon if available, colored placeholder otherwise
 	TSharedRef<SWidget> IconWidget = [&]() -> TSharedRef<SWidget>
 	{
-		// Use InventorySubsystem's shared icon brush cache
-		FSlateBrush* Brush = nullptr;
-		if (UWorld* World = GEngine ? GEngine->GetCurrentPlayWorld() : nullptr)
+		// Shared icon brush cache
+		TSharedPtr<const FSlateBrush> Brush;
+		if (UIconCacheSubsystem* Icons = UIconCacheSubsystem::Get(GEngine ? GEngine->GetCurrentPlayWorld() : nullptr))
 		{
-			if (UInventorySubsystem* InvSub = World->GetSubsystem<UInventorySubsystem>())
-			{
-				Brush = InvSub->GetOrCreateItemIconBrush(Item.Icon);
-			}
+			Brush = Icons->GetItemIcon(Item.Icon);
 		}
 		if (Brush)
 		{
-			return SNew(SImage).Image(Brush);
+			return SNew(SIconImage).Icon(Brush);
 		}
 		// Fallback: colored square + 2-letter text
 		return SNew(SBorder)
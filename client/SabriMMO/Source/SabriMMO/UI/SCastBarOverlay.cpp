@@ -4,6 +4,8 @@
 
 #include "SCastBarOverlay.h"
 #include "CastBarSubsystem.h"
+#include "ScreenProjectionSubsystem.h"
+#include "EntityRegistrySubsystem.h"
 #include "Rendering/DrawElements.h"
 #include "Framework/Application/SlateApplication.h"
 #include "Fonts/FontMeasure.h"
@@ -12,7 +14,6 @@
 #include "Engine/GameViewportClient.h"
 #include "Widgets/SNullWidget.h"
 #include "Kismet/GameplayStatics.h"
-#include "EngineUtils.h"
 #include "GameFramework/PlayerController.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogCastBarOverlay, Log, All);
@@ -87,18 +88,10 @@ FVector SCastBarOverlay::FindCasterWorldPosition(int32 CasterId) const
 		return FVector::ZeroVector;
 	}
 
-	// Other players — find BP actor with matching CharacterId property
-	for (TActorIterator<AActor> It(World); It; ++It)
+	// Other players — registered by OtherPlayerSubsystem under their characterId
+	if (UEntityRegistrySubsystem* Registry = World->GetSubsystem<UEntityRegistrySubsystem>())
 	{
-		AActor* Actor = *It;
-		FProperty* Prop = Actor->GetClass()->FindPropertyByName(FName("CharacterId"));
-		if (!Prop) continue;
-
-		FIntProperty* IntProp = CastField<FIntProperty>(Prop);
-		if (!IntProp) continue;
-
-		int32 ActorCharId = IntProp->GetPropertyValue_InContainer(Actor);
-		if (ActorCharId == CasterId)
+		if (AActor* Actor = Registry->Find(EEntityCategory::Player, CasterId))
 		{
 			return Actor->GetActorLocation();
 		}
@@ -107,24 +100,6 @@ FVector SCastBarOverlay::FindCasterWorldPosition(int32 CasterId) const
 	return FVector::ZeroVector;
 }
 
-// ============================================================
-// World-to-screen projection
-// ============================================================
-
-bool SCastBarOverlay::ProjectWorldToScreen(const FVector& WorldPos, FVector2D& OutScreenPos) const
-{
-	UCastBarSubsystem* Sub = OwningSubsystem.Get();
-	if (!Sub) return false;
-
-	UWorld* World = Sub->GetWorld();
-	if (!World) return false;
-
-	APlayerController* PC = UGameplayStatics::GetPlayerController(World, 0);
-	if (!PC) return false;
-
-	return PC->ProjectWorldLocationToScreen(WorldPos, OutScreenPos, false);
-}
-
 // ============================================================
 // OnPaint — render cast bars above each caster's head
 // ============================================================
@@ -165,20 +140,34 @@ int32 SCastBarOverlay::OnPaint(
 	const int32 FillLayer = OutLayerId + 3;
 	const int32 TextLayer = OutLayerId + 4;
 
+	UScreenProjectionSubsystem* Projection = Sub->GetWorld()
+		? Sub->GetWorld()->GetSubsystem<UScreenProjectionSubsystem>() : nullptr;
+	if (!Projection) return OutLayerId;
+
+	// Gather caster head positions, then project them in one batch
+	TArray<const FCastBarEntry*, TInlineAllocator<16>> Casts;
+	TArray<FVector, TInlineAllocator<16>> HeadPositions;
 	for (const auto& Pair : Sub->ActiveCasts)
 	{
-		const FCastBarEntry& Cast = Pair.Value;
-
 		// Find caster world position
-		FVector WorldPos = FindCasterWorldPosition(Cast.CasterId);
+		FVector WorldPos = FindCasterWorldPosition(Pair.Value.CasterId);
 		if (WorldPos.IsZero()) continue;
 
 		// Offset above head
 		WorldPos.Z += HEAD_OFFSET_Z;
 
-		// Project to screen
-		FVector2D ScreenPos;
-		if (!ProjectWorldToScreen(WorldPos, ScreenPos)) continue;
+		Casts.Add(&Pair.Value);
+		HeadPositions.Add(WorldPos);
+	}
+
+	TArray<FScreenPoint> ScreenPoints;
+	Projection->ProjectPoints(HeadPositions, ScreenPoints);
+
+	for (int32 CastIdx = 0; CastIdx < Casts.Num(); ++CastIdx)
+	{
+		if (!ScreenPoints[CastIdx].bVisible) continue;
+		const FCastBarEntry& Cast = *Casts[CastIdx];
+		const FVector2D& ScreenPos = ScreenPoints[CastIdx].Screen;
 
 		// Calculate progress (0 → 1 as cast progresses)
 		float Progress = 0.0f;
@@ -30,9 +30,6 @@ private:
 	// Find the world position of a caster by their characterId
 	FVector FindCasterWorldPosition(int32 CasterId) const;
 
-	// Project world position to screen coordinates
-	bool ProjectWorldToScreen(const FVector& WorldPos, FVector2D& OutScreenPos) const;
-
 	TWeakObjectPtr<UCastBarSubsystem> OwningSubsystem;
 
 	// ---- Visual Constants (matching RO reference screenshot) ----
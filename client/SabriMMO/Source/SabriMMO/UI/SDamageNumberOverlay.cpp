@@ -1,11 +1,13 @@
 // SDamageNumberOverlay.cpp — RO Classic damage number rendering overlay
 // Renders per-digit numbers with parabolic sine arc, scale shrink, diagonal drift,
 // and immediate linear alpha fade — faithful to roBrowser's Damage.js implementation.
+// Digits and labels are quads from the baked glyph atlas, submitted in one batch.
 
 #include "SDamageNumberOverlay.h"
+#include "DamageNumberGlyphAtlas.h"
 #include "Rendering/DrawElements.h"
+#include "Rendering/SlateRenderer.h"
 #include "Framework/Application/SlateApplication.h"
-#include "Fonts/FontMeasure.h"
 #include "Styling/CoreStyle.h"
 #include "Engine/Engine.h"
 #include "Engine/GameViewportClient.h"
@@ -63,6 +65,16 @@ void SDamageNumberOverlay::Construct(const FArguments& InArgs)
 		CritStarburstBrush.DrawAs = ESlateBrushDrawType::Image;
 	}
 
+	// Fixed RO labels live in the glyph atlas next to the digits
+	GlyphAtlas = InArgs._GlyphAtlas;
+	if (GlyphAtlas.IsValid())
+	{
+		LabelMiss = GlyphAtlas->FindOrAddLabel(TEXT("Miss"));
+		LabelDodge = GlyphAtlas->FindOrAddLabel(TEXT("Dodge"));
+		LabelPerfectDodge = GlyphAtlas->FindOrAddLabel(TEXT("Lucky Dodge"));
+		LabelBlock = GlyphAtlas->FindOrAddLabel(TEXT("Block"));
+	}
+
 	// SCompoundWidget requires a ChildSlot — use an invisible null widget
 	ChildSlot
 	[
@@ -80,20 +92,23 @@ void SDamageNumberOverlay::Construct(const FArguments& InArgs)
 // Add a new damage pop-up
 // ============================================================
 
-void SDamageNumberOverlay::AddDamagePop(int32 Value, EDamagePopType Type, FVector2D ScreenPosition, const FString& Element, const FLinearColor* CustomColor)
+FDamagePopEntry& SDamageNumberOverlay::SpawnEntry(FVector2D ScreenPosition, double Now)
 {
-	const double Now = FPlatformTime::Seconds();
-
 	// Stacking: count recent entries near this position and offset upward
 	int32 StackCount = 0;
-	for (int32 i = 0; i < MAX_ENTRIES; ++i)
+	if (ActiveCount > 0)
 	{
-		const FDamagePopEntry& E = Entries[i];
-		if (!E.bActive) continue;
-		if ((Now - E.SpawnTime) > STACK_CHECK_TIME) continue;
-		if (FVector2D::Distance(E.ScreenAnchor, ScreenPosition) < STACK_CHECK_RADIUS)
+		const FVector2f Pos(ScreenPosition);
+		const float RadiusSq = STACK_CHECK_RADIUS * STACK_CHECK_RADIUS;
+		for (int32 i = 0; i < MAX_ENTRIES; ++i)
 		{
-			++StackCount;
+			const FDamagePopEntry& E = Entries[i];
+			if (!E.bActive) continue;
+			if ((Now - E.SpawnTime) > STACK_CHECK_TIME) continue;
+			if (FVector2f::DistSquared(E.ScreenAnchor, Pos) < RadiusSq)
+			{
+				++StackCount;
+			}
 		}
 	}
 
@@ -102,27 +117,55 @@ void SDamageNumberOverlay::AddDamagePop(int32 Value, EDamagePopType Type, FVecto
 	AdjustedPos.Y += StackCount * STACK_OFFSET_Y;  // Negative constant = upward in screen space
 
 	FDamagePopEntry& Entry = Entries[NextEntryIndex];
+	Entry = FDamagePopEntry();
 	Entry.bActive = true;
-	Entry.Value = Value;
-	Entry.Type = Type;
-	Entry.ScreenAnchor = AdjustedPos;
+	Entry.ScreenAnchor = FVector2f(AdjustedPos);
 	Entry.SpawnTime = Now;
 	Entry.RandomXBias = FMath::FRandRange(-RANDOM_X_RANGE, RANDOM_X_RANGE);
-	Entry.Element = Element;
-	Entry.TextLabel.Empty();
-	if (CustomColor)
+
+	NextEntryIndex = (NextEntryIndex + 1) % MAX_ENTRIES;
+	++ActiveCount;
+	return Entry;
+}
+
+void SDamageNumberOverlay::AddDamagePop(int32 Value, EDamagePopType Type, FVector2D ScreenPosition, const FString& Element, const FLinearColor* CustomColor)
+{
+	const double Now = FPlatformTime::Seconds();
+	const bool bEvenSlot = (NextEntryIndex % 2 == 0);
+
+	FDamagePopEntry& Entry = SpawnEntry(ScreenPosition, Now);
+	Entry.Value = Value;
+	Entry.Type = Type;
+
+	// Fixed RO labels replace the digits for miss-type pops
+	switch (Type)
 	{
-		Entry.CustomColor = *CustomColor;
-		Entry.bHasCustomColor = true;
+	case EDamagePopType::Miss:         Entry.LabelId = LabelMiss; break;
+	case EDamagePopType::Dodge:        Entry.LabelId = LabelDodge; break;
+	case EDamagePopType::PerfectDodge: Entry.LabelId = LabelPerfectDodge; break;
+	case EDamagePopType::Block:        Entry.LabelId = LabelBlock; break;
+	default: break;
 	}
-	else
+	const bool bIsLabel = (Type == EDamagePopType::Miss || Type == EDamagePopType::Dodge ||
+		Type == EDamagePopType::PerfectDodge || Type == EDamagePopType::Block);
+
+	// ---- Resolve color + font size once ----
+	Entry.Color = CustomColor ? *CustomColor : GetFillColor(Type);
+	Entry.FontSize = CustomColor
+		? (float)STATUS_TEXT_FONT_SIZE * FontScaleMultiplier
+		: (float)GetFontSize(Type);
+
+	if (!Element.IsEmpty() && Element != TEXT("neutral") && !bIsLabel && Type != EDamagePopType::Heal)
 	{
-		Entry.bHasCustomColor = false;
+		const FLinearColor EleTint = GetElementTint(Element);
+		if (EleTint != FLinearColor::White)
+		{
+			Entry.Color = FLinearColor::LerpUsingHSV(Entry.Color, EleTint, 0.4f);
+		}
 	}
 
 	// RO Classic: per-type lifetime and drift direction
-	if (Type == EDamagePopType::Miss || Type == EDamagePopType::Dodge ||
-		Type == EDamagePopType::PerfectDodge || Type == EDamagePopType::Block)
+	if (bIsLabel)
 	{
 		Entry.Lifetime = LIFETIME_MISS;
 		Entry.DriftDirection = 0.0f;
@@ -141,50 +184,27 @@ void SDamageNumberOverlay::AddDamagePop(int32 Value, EDamagePopType Type, FVecto
 	{
 		Entry.Lifetime = LIFETIME_DAMAGE;
 		// Alternate left/right drift with slight random magnitude variation
-		Entry.DriftDirection = ((NextEntryIndex % 2 == 0) ? 1.0f : -1.0f) * FMath::FRandRange(0.7f, 1.0f);
+		Entry.DriftDirection = (bEvenSlot ? 1.0f : -1.0f) * FMath::FRandRange(0.7f, 1.0f);
 	}
 
-	NextEntryIndex = (NextEntryIndex + 1) % MAX_ENTRIES;
-	++ActiveCount;
-
-	UE_LOG(LogDamageOverlay, Log, TEXT("AddDamagePop: %d dmg, type=%d, ele=%s, screen=(%.0f, %.0f), stack=%d, active=%d"),
-		Value, (int32)Type, *Element, AdjustedPos.X, AdjustedPos.Y, StackCount, ActiveCount);
+	UE_LOG(LogDamageOverlay, Verbose, TEXT("AddDamagePop: %d dmg, type=%d, ele=%s, screen=(%.0f, %.0f), active=%d"),
+		Value, (int32)Type, *Element, Entry.ScreenAnchor.X, Entry.ScreenAnchor.Y, ActiveCount);
 }
 
 void SDamageNumberOverlay::AddTextPop(const FString& Text, const FLinearColor& Color, FVector2D ScreenPosition)
 {
-	const double Now = FPlatformTime::Seconds();
+	// Status names are pre-baked by the subsystem; anything new is appended to the atlas here
+	const int32 LabelId = GlyphAtlas.IsValid() ? GlyphAtlas->FindOrAddLabel(Text) : INDEX_NONE;
+	if (LabelId == INDEX_NONE) return;
 
-	// Stacking (same logic as AddDamagePop)
-	int32 StackCount = 0;
-	for (int32 i = 0; i < MAX_ENTRIES; ++i)
-	{
-		const FDamagePopEntry& E = Entries[i];
-		if (!E.bActive) continue;
-		if ((Now - E.SpawnTime) > STACK_CHECK_TIME) continue;
-		if (FVector2D::Distance(E.ScreenAnchor, ScreenPosition) < STACK_CHECK_RADIUS)
-			++StackCount;
-	}
-
-	FVector2D AdjustedPos = ScreenPosition;
-	AdjustedPos.Y += StackCount * STACK_OFFSET_Y;
-
-	FDamagePopEntry& Entry = Entries[NextEntryIndex];
-	Entry.bActive = true;
+	FDamagePopEntry& Entry = SpawnEntry(ScreenPosition, FPlatformTime::Seconds());
 	Entry.Value = 0;
-	Entry.Type = EDamagePopType::Miss; // Reuse Miss type for font sizing fallback
-	Entry.ScreenAnchor = AdjustedPos;
-	Entry.SpawnTime = Now;
-	Entry.RandomXBias = FMath::FRandRange(-RANDOM_X_RANGE, RANDOM_X_RANGE);
-	Entry.Element = TEXT("");
-	Entry.TextLabel = Text;
-	Entry.CustomColor = Color;
-	Entry.bHasCustomColor = true;
+	Entry.Type = EDamagePopType::Miss; // Reuse Miss type for the rise animation
+	Entry.LabelId = LabelId;
+	Entry.Color = Color;
+	Entry.FontSize = (float)STATUS_TEXT_FONT_SIZE * FontScaleMultiplier;
 	Entry.Lifetime = LIFETIME_MISS;
 	Entry.DriftDirection = 0.0f;
-
-	NextEntryIndex = (NextEntryIndex + 1) % MAX_ENTRIES;
-	++ActiveCount;
 }
 
 // ============================================================
@@ -218,25 +238,6 @@ EActiveTimerReturnType SDamageNumberOverlay::OnAnimationTick(double InCurrentTim
 	return EActiveTimerReturnType::Continue;
 }
 
-// ============================================================
-// Font measurement cache
-// ============================================================
-
-void SDamageNumberOverlay::EnsureFontMeasured() const
-{
-	if (bFontCacheValid) return;
-
-	if (!FSlateApplication::IsInitialized()) return;
-	TSharedRef<FSlateFontMeasure> FontMeasure =
-		FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
-
-	FSlateFontInfo MeasureFont = FCoreStyle::GetDefaultFontStyle("Bold", NORMAL_FONT_SIZE);
-	FVector2D Size = FontMeasure->Measure(TEXT("0"), MeasureFont);
-	CachedDigitWidth = (float)Size.X;
-	CachedDigitHeight = (float)Size.Y;
-	bFontCacheValid = true;
-}
-
 // ============================================================
 // Color/size helpers
 // ============================================================
@@ -260,11 +261,6 @@ FLinearColor SDamageNumberOverlay::GetFillColor(EDamagePopType Type)
 	}
 }
 
-FLinearColor SDamageNumberOverlay::GetOutlineColor(EDamagePopType Type)
-{
-	return RODamageColors::OutlineDark;
-}
-
 int32 SDamageNumberOverlay::GetFontSize(EDamagePopType Type)
 {
 	int32 Base;
@@ -284,17 +280,6 @@ int32 SDamageNumberOverlay::GetFontSize(EDamagePopType Type)
 	return FMath::RoundToInt((float)Base * FontScaleMultiplier);
 }
 
-float SDamageNumberOverlay::GetOutlineSize(EDamagePopType Type)
-{
-	switch (Type)
-	{
-	case EDamagePopType::CriticalDamage: return OUTLINE_SIZE_CRIT;
-	case EDamagePopType::PlayerCritHit:  return OUTLINE_SIZE_CRIT;
-	case EDamagePopType::ComboTotal:     return OUTLINE_SIZE_CRIT;
-	default:                             return OUTLINE_SIZE_NORMAL;
-	}
-}
-
 FLinearColor SDamageNumberOverlay::GetElementTint(const FString& Element)
 {
 	if (Element == TEXT("water"))  return RODamageColors::EleWater;
@@ -329,8 +314,7 @@ int32 SDamageNumberOverlay::OnPaint(
 		OutDrawElements, LayerId, InWidgetStyle, bParentEnabled);
 
 	if (ActiveCount <= 0) return OutLayerId;
-
-	EnsureFontMeasured();
+	if (!GlyphAtlas.IsValid() || !GlyphAtlas->IsReady()) return OutLayerId;
 
 	const double Now = FPlatformTime::Seconds();
 	const ESlateDrawEffect DrawEffects = ESlateDrawEffect::None;
@@ -338,14 +322,35 @@ int32 SDamageNumberOverlay::OnPaint(
 	// Get the DPI scale to convert screen-pixel positions to Slate local coordinates
 	const float GeometryScale = AllottedGeometry.GetAccumulatedLayoutTransform().GetScale();
 	const float InvScale = (GeometryScale > 0.0f) ? (1.0f / GeometryScale) : 1.0f;
-
-	// Font measure service for per-size digit width
-	TSharedRef<FSlateFontMeasure> FontMeasure =
-		FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
+	const FSlateRenderTransform& RenderTransform = AllottedGeometry.GetAccumulatedRenderTransform();
 
 	// Use a higher layer for damage text so it renders on top
 	const int32 TextLayerId = OutLayerId + 1;
 
+	BatchVerts.Reset();
+	BatchIndexes.Reset();
+
+	// Append one glyph quad (local Slate units) to the batch
+	auto AddQuad = [this, &RenderTransform](const FVector2f& TopLeft, const FVector2f& Size,
+		const FDamageGlyph& Glyph, const FColor& Color)
+	{
+		const SlateIndex Base = (SlateIndex)BatchVerts.Num();
+		BatchVerts.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(RenderTransform,
+			TopLeft, FVector2f(Glyph.UVMin.X, Glyph.UVMin.Y), Color));
+		BatchVerts.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(RenderTransform,
+			FVector2f(TopLeft.X + Size.X, TopLeft.Y), FVector2f(Glyph.UVMax.X, Glyph.UVMin.Y), Color));
+		BatchVerts.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(RenderTransform,
+			FVector2f(TopLeft.X, TopLeft.Y + Size.Y), FVector2f(Glyph.UVMin.X, Glyph.UVMax.Y), Color));
+		BatchVerts.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(RenderTransform,
+			TopLeft + Size, FVector2f(Glyph.UVMax.X, Glyph.UVMax.Y), Color));
+
+		BatchIndexes.Add(Base + 0); BatchIndexes.Add(Base + 1); BatchIndexes.Add(Base + 2);
+		BatchIndexes.Add(Base + 2); BatchIndexes.Add(Base + 1); BatchIndexes.Add(Base + 3);
+	};
+
+	const FDamageGlyph& DigitCell = GlyphAtlas->GetDigit(0);
+	const float InvBakeSize = 1.0f / (float)FDamageNumberGlyphAtlas::BAKE_FONT_SIZE;
+
 	for (int32 i = 0; i < MAX_ENTRIES; ++i)
 	{
 		const FDamagePopEntry& Entry = Entries[i];
@@ -361,7 +366,7 @@ int32 SDamageNumberOverlay::OnPaint(
 		                          Entry.Type == EDamagePopType::Dodge ||
 		                          Entry.Type == EDamagePopType::PerfectDodge ||
 		                          Entry.Type == EDamagePopType::Block ||
-		                          !Entry.TextLabel.IsEmpty());
+		                          Entry.LabelId != INDEX_NONE);
 
 		// ---- Per-type animation curves (RO Classic) ----
 		float OffsetX = 0.0f;
@@ -407,70 +412,19 @@ int32 SDamageNumberOverlay::OnPaint(
 			Scale = FMath::Max(0.01f, (1.0f - t) * SCALE_START);
 		}
 
-		// ---- Font setup with dynamic scale ----
-		const int32 BaseFontSize = Entry.bHasCustomColor
-			? FMath::RoundToInt((float)STATUS_TEXT_FONT_SIZE * FontScaleMultiplier)
-			: GetFontSize(Entry.Type);
-		const int32 ScaledFontSz = FMath::Max(6, FMath::RoundToInt((float)BaseFontSize * Scale));
-		const float OutlineSz = GetOutlineSize(Entry.Type);
-
-		FSlateFontInfo DigitFont = FCoreStyle::GetDefaultFontStyle("Bold", ScaledFontSz);
-		DigitFont.OutlineSettings.OutlineSize = FMath::Max(1, (int32)OutlineSz);
-		DigitFont.OutlineSettings.OutlineColor = GetOutlineColor(Entry.Type);
-
-		const FVector2D DigitMeasure = FontMeasure->Measure(TEXT("0"), DigitFont);
-		const float DigitW = (float)DigitMeasure.X;
-		const float DigitH = (float)DigitMeasure.Y;
-
-		// ---- Build display text ----
-		FString DisplayText;
-		bool bIsTextLabel = false;
-		if (!Entry.TextLabel.IsEmpty())
-		{
-			DisplayText = Entry.TextLabel;
-			bIsTextLabel = true;
-		}
-		else if (Entry.Type == EDamagePopType::Miss)
-		{
-			DisplayText = TEXT("Miss");
-			bIsTextLabel = true;
-		}
-		else if (Entry.Type == EDamagePopType::Dodge)
-		{
-			DisplayText = TEXT("Dodge");
-			bIsTextLabel = true;
-		}
-		else if (Entry.Type == EDamagePopType::PerfectDodge)
-		{
-			DisplayText = TEXT("Lucky Dodge");
-			bIsTextLabel = true;
-		}
-		else if (Entry.Type == EDamagePopType::Block)
-		{
-			DisplayText = TEXT("Block");
-			bIsTextLabel = true;
-		}
-		else
-		{
-			DisplayText = FString::FromInt(FMath::Abs(Entry.Value));
-		}
-		const int32 NumChars = DisplayText.Len();
+		// ---- Glyph scale: baked size -> animated font size ----
+		const float FontSz = FMath::Max(MIN_FONT_SIZE, Entry.FontSize * Scale);
+		const float GlyphScale = FontSz * InvBakeSize;
+		const float DigitW = DigitCell.Size.X * GlyphScale;
+		const float DigitH = DigitCell.Size.Y * GlyphScale;
 
 		// ---- Tint color with alpha ----
-		FLinearColor TintColor = Entry.bHasCustomColor ? Entry.CustomColor : GetFillColor(Entry.Type);
-
-		if (!Entry.Element.IsEmpty() && Entry.Element != TEXT("neutral") && !bIsTextLabel && Entry.Type != EDamagePopType::Heal)
-		{
-			const FLinearColor EleTint = GetElementTint(Entry.Element);
-			if (EleTint != FLinearColor::White)
-			{
-				TintColor = FLinearColor::LerpUsingHSV(TintColor, EleTint, 0.4f);
-			}
-		}
+		FLinearColor TintColor = Entry.Color;
 		TintColor.A = Alpha;
+		const FColor VertColor = TintColor.ToFColor(true);
 
 		// ---- Screen position with animation offsets ----
-		const FVector2D BasePos(
+		const FVector2f BasePos(
 			(Entry.ScreenAnchor.X + Entry.RandomXBias + OffsetX) * InvScale,
 			(Entry.ScreenAnchor.Y + OffsetY) * InvScale
 		);
@@ -483,9 +437,7 @@ int32 SDamageNumberOverlay::OnPaint(
 			// Size proportional to digit group — large enough to frame the number
 			const float BurstSize = DigitH * 4.0f;
 			// Center exactly on BasePos (which is the center of the digit group)
-			const FVector2f BurstPos(
-				(float)(BasePos.X - BurstSize * 0.5f),
-				(float)(BasePos.Y - BurstSize * 0.5f));
+			const FVector2f BurstPos(BasePos.X - BurstSize * 0.5f, BasePos.Y - BurstSize * 0.5f);
 			// Full color — texture is already the desired red/orange
 			const FLinearColor BurstColor(1.0f, 1.0f, 1.0f, Alpha);
 			FSlateDrawElement::MakeBox(
@@ -499,61 +451,52 @@ int32 SDamageNumberOverlay::OnPaint(
 				BurstColor);
 		}
 
-		// ---- Render ----
-		if (bIsTextLabel)
+		// ---- Emit quads ----
+		if (Entry.LabelId != INDEX_NONE)
 		{
-			const FVector2D TextMeasure = FontMeasure->Measure(DisplayText, DigitFont);
-			const float TextW = (float)TextMeasure.X;
-
-			const FVector2f DrawPos(
-				(float)(BasePos.X - TextW * 0.5f),
-				(float)(BasePos.Y - DigitH * 0.5f)
-			);
+			const FDamageGlyph* Label = GlyphAtlas->GetLabel(Entry.LabelId);
+			if (!Label) continue;
 
-			FSlateDrawElement::MakeText(
-				OutDrawElements,
-				TextLayerId,
-				AllottedGeometry.ToPaintGeometry(
-					FVector2D(TextW, DigitH),
-					FSlateLayoutTransform(DrawPos)
-				),
-				DisplayText,
-				DigitFont,
-				DrawEffects,
-				TintColor
-			);
+			const FVector2f Size = Label->Size * GlyphScale;
+			AddQuad(BasePos - Size * 0.5f, Size, *Label, VertColor);
 		}
 		else
 		{
-			// Per-digit rendering (scaling handles visual interest, no time-based spread)
+			// Per-digit quads, centered as a group (scaling handles visual interest, no time-based spread)
+			uint8 DigitBuf[12];
+			int32 NumChars = 0;
+			uint32 Remaining = (uint32)FMath::Abs(Entry.Value);
+			do
+			{
+				DigitBuf[NumChars++] = (uint8)(Remaining % 10);
+				Remaining /= 10;
+			} while (Remaining > 0 && NumChars < UE_ARRAY_COUNT(DigitBuf));
+
 			const float EffectiveDigitSpacing = DigitW + DIGIT_BASE_GAP;
+			const FVector2f DigitSize(DigitW, DigitH);
 
 			for (int32 c = 0; c < NumChars; ++c)
 			{
+				// DigitBuf is least-significant first
+				const int32 Digit = DigitBuf[NumChars - 1 - c];
 				const float DigitCenterOffset = (c - (NumChars - 1) * 0.5f) * EffectiveDigitSpacing;
-
 				const FVector2f DrawPos(
-					(float)(BasePos.X + DigitCenterOffset - DigitW * 0.5f),
-					(float)(BasePos.Y - DigitH * 0.5f)
-				);
-
-				const FString SingleChar = DisplayText.Mid(c, 1);
-
-				FSlateDrawElement::MakeText(
-					OutDrawElements,
-					TextLayerId,
-					AllottedGeometry.ToPaintGeometry(
-						FVector2D(DigitW, DigitH),
-						FSlateLayoutTransform(DrawPos)
-					),
-					SingleChar,
-					DigitFont,
-					DrawEffects,
-					TintColor
-				);
+					BasePos.X + DigitCenterOffset - DigitW * 0.5f,
+					BasePos.Y - DigitH * 0.5f);
+
+				AddQuad(DrawPos, DigitSize, GlyphAtlas->GetDigit(Digit), VertColor);
 			}
 		}
 	}
 
+	// ---- One draw element for every pop on screen ----
+	if (BatchIndexes.Num() > 0)
+	{
+		const FSlateResourceHandle Handle =
+			FSlateApplication::Get().GetRenderer()->GetResourceHandle(GlyphAtlas->GetBrush());
+		FSlateDrawElement::MakeCustomVerts(OutDrawElements, TextLayerId, Handle,
+			BatchVerts, BatchIndexes, nullptr, 0, 0, DrawEffects);
+	}
+
 	return TextLayerId;
 }
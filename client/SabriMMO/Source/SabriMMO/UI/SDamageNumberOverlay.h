@@ -1,6 +1,7 @@
 // SDamageNumberOverlay.h — Fullscreen transparent Slate overlay that renders
 // RO Classic damage numbers via OnPaint with parabolic sine arc, scale shrink,
 // diagonal drift, and per-type animation curves. Faithful to roBrowser Damage.js.
+// Glyphs come from FDamageNumberGlyphAtlas; all pops draw as one MakeCustomVerts batch.
 
 #pragma once
 
@@ -9,6 +10,9 @@
 #include "Widgets/DeclarativeSyntaxSupport.h"
 #include "Fonts/SlateFontInfo.h"
 #include "Engine/Texture2D.h"
+#include "Rendering/RenderingCommon.h"
+
+class FDamageNumberGlyphAtlas;
 
 // Damage pop-up type — determines color and scale
 enum class EDamagePopType : uint8
@@ -26,22 +30,23 @@ enum class EDamagePopType : uint8
 	ComboTotal       // Yellow — multi-hit skill total (3s duration, rapid pop-in)
 };
 
-// Single damage pop-up entry in the pool
+// Single damage pop-up entry in the pool. Plain data: color, font size and label are
+// resolved at spawn so OnPaint does no string work.
 struct FDamagePopEntry
 {
-	bool bActive = false;
-	int32 Value = 0;
-	EDamagePopType Type = EDamagePopType::NormalDamage;
-	FVector2D ScreenAnchor = FVector2D::ZeroVector;  // Screen-space anchor at spawn
 	double SpawnTime = 0.0;
-	float RandomXBias = 0.0f;  // Slight random horizontal offset for organic feel
-	FString Element;           // Attack element for coloring (e.g., "fire", "water")
-	FString TextLabel;         // If non-empty, renders this text instead of Value digits
-	FLinearColor CustomColor = FLinearColor::White;  // Used when TextLabel is set
-	bool bHasCustomColor = false;
+	FVector2f ScreenAnchor = FVector2f::ZeroVector;  // Screen-space anchor at spawn
+	FLinearColor Color = FLinearColor::White;        // Fill tint (type/custom color + element tint)
+	int32 Value = 0;
+	int32 LabelId = INDEX_NONE;   // Glyph atlas label drawn instead of Value digits
+	float RandomXBias = 0.0f;     // Slight random horizontal offset for organic feel
+	float FontSize = 20.0f;       // Base font size (options scale applied)
 	float Lifetime = 1.5f;        // Per-entry duration (type-dependent)
 	float DriftDirection = 1.0f;  // Horizontal drift sign (+1 right, -1 left, 0 none)
+	EDamagePopType Type = EDamagePopType::NormalDamage;
+	bool bActive = false;
 };
+static_assert(std::is_trivially_copyable_v<FDamagePopEntry>, "FDamagePopEntry must stay plain data");
 
 class SDamageNumberOverlay : public SCompoundWidget
 {
@@ -50,6 +55,7 @@ public:
 		: _CritStarburstTexture(nullptr)
 	{}
 		SLATE_ARGUMENT(UTexture2D*, CritStarburstTexture)
+		SLATE_ARGUMENT(TSharedPtr<FDamageNumberGlyphAtlas>, GlyphAtlas)
 	SLATE_END_ARGS()
 
 	void Construct(const FArguments& InArgs);
@@ -72,12 +78,26 @@ private:
 	// Active timer — drives continuous repainting while entries are alive
 	EActiveTimerReturnType OnAnimationTick(double InCurrentTime, float InDeltaTime);
 
+	// Claim the next pool slot and fill the fields shared by damage and text pops
+	FDamagePopEntry& SpawnEntry(FVector2D ScreenPosition, double Now);
+
 	// Entry pool (circular buffer)
-	static constexpr int32 MAX_ENTRIES = 64;
+	static constexpr int32 MAX_ENTRIES = 512;
 	FDamagePopEntry Entries[MAX_ENTRIES];
 	int32 NextEntryIndex = 0;
 	int32 ActiveCount = 0;  // Rough count of active entries (for timer optimization)
 
+	// Baked digit/label glyphs (shared with UDamageNumberSubsystem)
+	TSharedPtr<FDamageNumberGlyphAtlas> GlyphAtlas;
+	int32 LabelMiss = INDEX_NONE;
+	int32 LabelDodge = INDEX_NONE;
+	int32 LabelPerfectDodge = INDEX_NONE;
+	int32 LabelBlock = INDEX_NONE;
+
+	// Quad batch scratch, rebuilt each paint (reused to avoid reallocating)
+	mutable TArray<FSlateVertex> BatchVerts;
+	mutable TArray<SlateIndex> BatchIndexes;
+
 	// ---- Animation Constants (RO Classic faithful) ----
 	// Per-type durations
 	static constexpr float LIFETIME_DAMAGE = 1.5f;        // Normal/crit/skill damage
@@ -117,24 +137,15 @@ private:
 	static constexpr int32 HEAL_FONT_SIZE = 19;
 	static constexpr int32 DODGE_FONT_SIZE = 18;
 	static constexpr int32 STATUS_TEXT_FONT_SIZE = 17;
-	static constexpr float OUTLINE_SIZE_NORMAL = 2.0f;
-	static constexpr float OUTLINE_SIZE_CRIT = 3.0f;
+	static constexpr float MIN_FONT_SIZE = 6.0f;
 
 	// ---- Helpers ----
 	static FLinearColor GetFillColor(EDamagePopType Type);
-	static FLinearColor GetOutlineColor(EDamagePopType Type);
 	static int32 GetFontSize(EDamagePopType Type);
-	static float GetOutlineSize(EDamagePopType Type);
 
 	/** Get tint color based on attack element (for elemental damage coloring). */
 	static FLinearColor GetElementTint(const FString& Element);
 
 	// Critical starburst brush (rendered behind crit numbers)
 	FSlateBrush CritStarburstBrush;
-
-	// Cached font measure service (avoid repeated lookups)
-	mutable bool bFontCacheValid = false;
-	mutable float CachedDigitWidth = 0.0f;
-	mutable float CachedDigitHeight = 0.0f;
-	void EnsureFontMeasured() const;
 };
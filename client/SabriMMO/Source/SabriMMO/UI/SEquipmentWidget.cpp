@@ -6,6 +6,8 @@
 #include "InventorySubsystem.h"
 #include "ItemInspectSubsystem.h"
 #include "ItemTooltipBuilder.h"
+#include "IconCacheSubsystem.h"
+#include "SIconImage.h"
 #include "Engine/Engine.h"
 #include "Widgets/Layout/SBox.h"
 #include "Widgets/Layout/SBorder.h"
@@ -180,11 +182,11 @@ TSharedRef<SWidget> SEquipmentWidget::BuildEquipSlot(const FString& SlotPosition
 			FInventoryItem Item = Sub->GetEquippedItem(SlotPos);
 			if (Item.IsValid())
 			{
-				UInventorySubsystem* InvSub = GetInventorySubsystem();
-				FSlateBrush* Brush = InvSub ? InvSub->GetOrCreateItemIconBrush(Item.Icon) : nullptr;
+				UIconCacheSubsystem* Icons = UIconCacheSubsystem::Get(Sub);
+				TSharedPtr<const FSlateBrush> Brush = Icons ? Icons->GetItemIcon(Item.Icon) : nullptr;
 				if (Brush)
 				{
-					return SNew(SImage).Image(Brush);
+					return SNew(SIconImage).Icon(Brush);
 				}
 			}
 		}
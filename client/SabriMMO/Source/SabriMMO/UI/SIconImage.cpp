@@ -0,0 +1,9 @@
+// SIconImage.cpp — SImage that holds its icon cache brush (see header)
+
+#include "SIconImage.h"
+
+void SIconImage::Construct(const FArguments& InArgs)
+{
+	Icon = InArgs._Icon;
+	SImage::Construct(SImage::FArguments().Image(Icon.Get()));
+}
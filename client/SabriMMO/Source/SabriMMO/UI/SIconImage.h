@@ -0,0 +1,21 @@
+// SIconImage.h — SImage that holds its icon cache brush, keeping the icon resident while shown
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/Images/SImage.h"
+
+class SIconImage : public SImage
+{
+public:
+	SLATE_BEGIN_ARGS(SIconImage) {}
+		/** Brush from UIconCacheSubsystem::GetItemIcon / GetSkillIcon */
+		SLATE_ARGUMENT(TSharedPtr<const FSlateBrush>, Icon)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+private:
+	/** The cache only evicts brushes nobody else references */
+	TSharedPtr<const FSlateBrush> Icon;
+};
@@ -4,6 +4,8 @@
 #include "SIdentifyPopup.h"
 #include "InventorySubsystem.h"
 #include "MMOGameInstance.h"
+#include "IconCacheSubsystem.h"
+#include "SIconImage.h"
 #include "Dom/JsonObject.h"
 #include "Widgets/Layout/SBox.h"
 #include "Widgets/Layout/SBorder.h"
@@ -252,12 +254,13 @@ TSharedRef<SWidget> SIdentifyPopup::BuildItemRow(const FInventoryItem& Item)
 	// Build icon
 	TSharedRef<SWidget> ItemIcon = [&]() -> TSharedRef<SWidget>
 	{
-		FSlateBrush* Brush = Sub ? Sub->GetOrCreateItemIconBrush(Item.Icon) : nullptr;
+		UIconCacheSubsystem* Icons = UIconCacheSubsystem::Get(Sub);
+		TSharedPtr<const FSlateBrush> Brush = Icons ? Icons->GetItemIcon(Item.Icon) : nullptr;
 		if (Brush)
 		{
 			return SNew(SBox).WidthOverride(IdentifyRowIconSize).HeightOverride(IdentifyRowIconSize)
 			[
-				SNew(SImage).Image(Brush)
+				SNew(SIconImage).Icon(Brush)
 			];
 		}
 		return SNew(SBox).WidthOverride(IdentifyRowIconSize).HeightOverride(IdentifyRowIconSize)
@@ -6,6 +6,8 @@
 #include "StorageSubsystem.h"
 #include "ItemInspectSubsystem.h"
 #include "ItemTooltipBuilder.h"
+#include "IconCacheSubsystem.h"
+#include "SIconImage.h"
 #include "Engine/Engine.h"
 #include "Engine/GameViewportClient.h"
 #include "Widgets/SWindow.h"
@@ -440,10 +442,11 @@ TSharedRef<SWidget> SInventoryWidget::BuildItemSlot(int32 SlotIndex)
 	// Pre-build icon widget: texture icon if available, colored placeholder otherwise
 	TSharedRef<SWidget> IconWidget = [&]() -> TSharedRef<SWidget>
 	{
-		FSlateBrush* Brush = Sub ? Sub->GetOrCreateItemIconBrush(Item.Icon) : nullptr;
+		UIconCacheSubsystem* Icons = UIconCacheSubsystem::Get(Sub);
+		TSharedPtr<const FSlateBrush> Brush = Icons ? Icons->GetItemIcon(Item.Icon) : nullptr;
 		if (Brush)
 		{
-			return SNew(SImage).Image(Brush);
+			return SNew(SIconImage).Icon(Brush);
 		}
 		// Fallback: colored square + 2-letter text
 		return SNew(SBorder)
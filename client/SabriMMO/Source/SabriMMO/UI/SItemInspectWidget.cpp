@@ -2,6 +2,8 @@
 #include "ItemInspectSubsystem.h"
 #include "ItemTooltipBuilder.h"
 #include "InventorySubsystem.h"
+#include "IconCacheSubsystem.h"
+#include "SIconImage.h"
 #include "Engine/Engine.h"
 #include "Widgets/Images/SImage.h"
 #include "Widgets/Layout/SBox.h"
@@ -256,28 +258,25 @@ void SItemInspectWidget::RebuildContent()
 
 TSharedRef<SWidget> SItemInspectWidget::BuildIconArea()
 {
-	// Try to get the actual icon texture from InventorySubsystem's cache
-	FSlateBrush* IconBrush = nullptr;
+	// Try to get the actual icon from the shared icon cache
+	TSharedPtr<const FSlateBrush> IconBrush;
 	if (!CurrentItem.Icon.IsEmpty())
 	{
-		if (UWorld* World = GEngine ? GEngine->GetCurrentPlayWorld() : nullptr)
+		if (UIconCacheSubsystem* Icons = UIconCacheSubsystem::Get(GEngine ? GEngine->GetCurrentPlayWorld() : nullptr))
 		{
-			if (UInventorySubsystem* InvSub = World->GetSubsystem<UInventorySubsystem>())
-			{
-				IconBrush = InvSub->GetOrCreateItemIconBrush(CurrentItem.Icon);
-			}
+			IconBrush = Icons->GetItemIcon(CurrentItem.Icon);
 		}
 	}
 
 	// Icon fills the entire 128x128 area edge-to-edge at full quality
-	TSharedRef<SWidget> IconContent = (IconBrush != nullptr)
+	TSharedRef<SWidget> IconContent = IconBrush.IsValid()
 		? StaticCastSharedRef<SWidget>(
 			SNew(SBox)
 			.WidthOverride(IconSize)
 			.HeightOverride(IconSize)
 			[
-				SNew(SImage)
-				.Image(IconBrush)
+				SNew(SIconImage)
+				.Icon(IconBrush)
 			]
 		)
 		: StaticCastSharedRef<SWidget>(
@@ -18,7 +18,7 @@
 #include "EnemySubsystem.h"
 #include "OtherPlayerSubsystem.h"
 #include "PartySubsystem.h"
-#include "EngineUtils.h"
+#include "EntityRegistrySubsystem.h"
 
 // RO Classic minimap colors
 namespace MinimapColors
@@ -434,15 +434,20 @@ void SMinimapWidget::DrawNPCDots(const FGeometry& Geo, FSlateWindowElementList&
 	if (!Sub || !Sub->GetWorld()) return;
 	float Alpha = (Sub->OpacityState == 1) ? 0.5f : 1.f;
 
-	for (TActorIterator<AActor> It(Sub->GetWorld()); It; ++It)
-	{
-		AActor* Actor = *It;
-		if (!Actor) continue;
-		bool bIsNPC = Actor->ActorHasTag(TEXT("NPC")) ||
-			Actor->GetClass()->GetName().Contains(TEXT("KafraNPC")) ||
-			Actor->GetClass()->GetName().Contains(TEXT("ShopNPC"));
-		if (!bIsNPC) continue;
+	UEntityRegistrySubsystem* Registry = Sub->GetWorld()->GetSubsystem<UEntityRegistrySubsystem>();
+	ACharacter* PlayerChar = UGameplayStatics::GetPlayerCharacter(Sub->GetWorld(), 0);
+	if (!Registry || !PlayerChar) return;
 
+	// Only NPCs inside the visible map square (same extent as WorldToMinimapPixel)
+	const int32 ClampedZoom = FMath::Clamp(Sub->ZoomLevel, 0, 4);
+	const float HalfOrtho = 4000.f / UMinimapSubsystem::ZoomFactors[ClampedZoom] * 0.5f;
+	const FVector2D Center(PlayerChar->GetActorLocation());
+	const FBox2D VisibleRect(Center - FVector2D(HalfOrtho), Center + FVector2D(HalfOrtho));
+
+	TArray<AActor*> NPCs;
+	Registry->QueryRect(VisibleRect, EntityMask::NPC, NPCs);
+	for (AActor* Actor : NPCs)
+	{
 		FVector2D Pixel = WorldToMinimapPixel(Actor->GetActorLocation());
 		DrawDot(OutElements, LayerId, Geo, Pixel.X, Pixel.Y, 4.f,
 			MinimapColors::NPCDot * FLinearColor(1, 1, 1, Alpha), MapSize);
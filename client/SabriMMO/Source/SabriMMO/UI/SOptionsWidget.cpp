@@ -522,6 +522,20 @@ TSharedRef<SWidget> SOptionsWidget::BuildVideoContent()
 					Sub->SetSpriteQuality(Idx);
 			})) ]
 
+		// ---- Entity Detail (how many sprites keep full-rate animation / shadows / occlusion) ----
+		+ SScrollBox::Slot().Padding(0, 2)
+		[ BuildDropdownRow(FText::FromString(TEXT("Entity Detail")),
+			&SpriteQualityOptions, &EntityDetailCombo,
+			MakeShared<TFunction<int32()>>([this]() -> int32 {
+				if (UOptionsSubsystem* Sub = OwningSubsystem.Get())
+					return FMath::Clamp(Sub->GetEntityDetail(), 0, 4);
+				return 2;
+			}),
+			MakeShared<TFunction<void(int32)>>([this](int32 Idx) {
+				if (UOptionsSubsystem* Sub = OwningSubsystem.Get())
+					Sub->SetEntityDetail(Idx);
+			})) ]
+
 		// ---- Apply / Auto-Detect buttons ----
 		+ SScrollBox::Slot().Padding(0, 8, 0, 2)
 		[
@@ -574,6 +588,7 @@ void SOptionsWidget::PopulateVideoOptions()
 
 	// Sprite Quality — index = LODBias (0=Ultra, 1=High, 2=Medium, 3=Low, 4=Very Low).
 	// Order intentionally inverted from the other quality dropdowns so index 0 is best.
+	// Entity Detail (sprite update LOD budgets) uses the same labels and scale.
 	SpriteQualityOptions.Add(MakeShared<FString>(TEXT("Ultra")));
 	SpriteQualityOptions.Add(MakeShared<FString>(TEXT("High")));
 	SpriteQualityOptions.Add(MakeShared<FString>(TEXT("Medium")));
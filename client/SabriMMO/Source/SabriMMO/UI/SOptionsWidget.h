@@ -100,6 +100,7 @@ private:
 	TSharedPtr<SComboBox<TSharedPtr<FString>>> PostProcCombo;
 	TSharedPtr<SComboBox<TSharedPtr<FString>>> FoliageCombo;
 	TSharedPtr<SComboBox<TSharedPtr<FString>>> SpriteQualityCombo;
+	TSharedPtr<SComboBox<TSharedPtr<FString>>> EntityDetailCombo;
 
 	// ---- Resolution confirmation ----
 	TSharedPtr<SWidget> ConfirmOverlay;
@@ -6,6 +6,8 @@
 #include "InventorySubsystem.h"
 #include "ItemInspectSubsystem.h"
 #include "ItemTooltipBuilder.h"
+#include "IconCacheSubsystem.h"
+#include "SIconImage.h"
 #include "Engine/Engine.h"
 #include "Widgets/Layout/SBox.h"
 #include "Widgets/Layout/SBorder.h"
@@ -719,14 +721,11 @@ TSharedRef<SWidget> SShopWidget::BuildShopItemRow(int32 ItemIndex)
 	const FShopItem& Item = Sub->ShopItems[ItemIndex];
 	const FLinearColor RowColor = (ItemIndex % 2 == 0) ? ShopColors::RowBg : ShopColors::RowBgAlt;
 
-	// Try to get icon from InventorySubsystem
-	FSlateBrush* IconBrush = nullptr;
-	if (UWorld* World = Sub->GetWorld())
+	// Try to get icon from the shared icon cache
+	TSharedPtr<const FSlateBrush> IconBrush;
+	if (UIconCacheSubsystem* Icons = UIconCacheSubsystem::Get(Sub))
 	{
-		if (UInventorySubsystem* InvSub = World->GetSubsystem<UInventorySubsystem>())
-		{
-			IconBrush = InvSub->GetOrCreateItemIconBrush(Item.Icon);
-		}
+		IconBrush = Icons->GetItemIcon(Item.Icon);
 	}
 
 	TSharedRef<SHorizontalBox> Row = SNew(SHorizontalBox);
@@ -739,7 +738,7 @@ TSharedRef<SWidget> SShopWidget::BuildShopItemRow(int32 ItemIndex)
 			[
 				SNew(SBox).WidthOverride(24.f).HeightOverride(24.f)
 				[
-					SNew(SImage).Image(IconBrush)
+					SNew(SIconImage).Icon(IconBrush)
 				]
 			];
 	}
@@ -879,13 +878,10 @@ TSharedRef<SWidget> SShopWidget::BuildSellItemRow(const FInventoryItem& Item, in
 	if (!Sub) return SNullWidget::NullWidget;
 
 	// Get icon
-	FSlateBrush* IconBrush = nullptr;
-	if (UWorld* World = Sub->GetWorld())
+	TSharedPtr<const FSlateBrush> IconBrush;
+	if (UIconCacheSubsystem* Icons = UIconCacheSubsystem::Get(Sub))
 	{
-		if (UInventorySubsystem* InvSub = World->GetSubsystem<UInventorySubsystem>())
-		{
-			IconBrush = InvSub->GetOrCreateItemIconBrush(Item.Icon);
-		}
+		IconBrush = Icons->GetItemIcon(Item.Icon);
 	}
 
 	TSharedRef<SHorizontalBox> Row = SNew(SHorizontalBox);
@@ -897,7 +893,7 @@ TSharedRef<SWidget> SShopWidget::BuildSellItemRow(const FInventoryItem& Item, in
 			[
 				SNew(SBox).WidthOverride(24.f).HeightOverride(24.f)
 				[
-					SNew(SImage).Image(IconBrush)
+					SNew(SIconImage).Icon(IconBrush)
 				]
 			];
 	}
@@ -2,6 +2,8 @@
 
 #include "SSkillTooltipWidget.h"
 #include "SkillTreeSubsystem.h"
+#include "IconCacheSubsystem.h"
+#include "SIconImage.h"
 #include "Widgets/Layout/SBox.h"
 #include "Widgets/Layout/SBorder.h"
 #include "Widgets/SBoxPanel.h"
@@ -163,7 +165,8 @@ TSharedRef<SWidget> SSkillTooltipWidget::BuildHeader(const FSkillEntry& Skill, U
 	TSharedRef<SHorizontalBox> Header = SNew(SHorizontalBox);
 
 	// Icon
-	FSlateBrush* IconBrush = Sub ? Sub->GetOrCreateIconBrush(Skill.IconPath) : nullptr;
+	UIconCacheSubsystem* Icons = UIconCacheSubsystem::Get(Sub);
+	TSharedPtr<const FSlateBrush> IconBrush = Icons ? Icons->GetSkillIcon(Skill.IconPath) : nullptr;
 	if (IconBrush)
 	{
 		Header->AddSlot()
@@ -175,7 +178,7 @@ TSharedRef<SWidget> SSkillTooltipWidget::BuildHeader(const FSkillEntry& Skill, U
 			.WidthOverride(28.f)
 			.HeightOverride(28.f)
 			[
-				SNew(SImage).Image(IconBrush)
+				SNew(SIconImage).Icon(IconBrush)
 			]
 		];
 	}
@@ -5,6 +5,8 @@
 #include "SSkillTreeWidget.h"
 #include "SSkillTooltipWidget.h"
 #include "SkillTreeSubsystem.h"
+#include "IconCacheSubsystem.h"
+#include "SIconImage.h"
 #include "Widgets/Layout/SBox.h"
 #include "Widgets/Layout/SBorder.h"
 #include "Widgets/Layout/SScrollBox.h"
@@ -513,10 +515,11 @@ void SSkillTreeWidget::DoRebuildSkillGrid()
 				SlotBg = SKColors::SkillLocked;
 
 			// Icon brush
-			FSlateBrush* IconBrush = Sub->GetOrCreateIconBrush(Skill->IconPath);
+			UIconCacheSubsystem* Icons = UIconCacheSubsystem::Get(Sub);
+			TSharedPtr<const FSlateBrush> IconBrush = Icons ? Icons->GetSkillIcon(Skill->IconPath) : nullptr;
 
 			// Draggable skill (learned active/toggle only)
-			const bool bDraggableSkill = bLearned && Skill->Type != TEXT("passive") && IconBrush != nullptr;
+			const bool bDraggableSkill = bLearned && Skill->Type != TEXT("passive") && IconBrush.IsValid();
 			const FString CapIconPath = Skill->IconPath;
 			const FString CapDisplayName = Skill->DisplayName;
 
@@ -551,7 +554,7 @@ void SSkillTreeWidget::DoRebuildSkillGrid()
 								return FReply::Unhandled();
 							})
 							[
-								SNew(SImage).Image(IconBrush)
+								SNew(SIconImage).Icon(IconBrush)
 							]
 						]
 					)
@@ -560,7 +563,7 @@ void SSkillTreeWidget::DoRebuildSkillGrid()
 						.WidthOverride(32.f)
 						.HeightOverride(32.f)
 						[
-							SNew(SImage).Image(IconBrush)
+							SNew(SIconImage).Icon(IconBrush)
 						]
 					);
 
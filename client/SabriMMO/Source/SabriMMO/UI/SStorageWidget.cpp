@@ -7,6 +7,8 @@
 #include "CartSubsystem.h"
 #include "ItemInspectSubsystem.h"
 #include "ItemTooltipBuilder.h"
+#include "IconCacheSubsystem.h"
+#include "SIconImage.h"
 #include "Engine/Engine.h"
 #include "Widgets/Layout/SBox.h"
 #include "Widgets/Layout/SBorder.h"
@@ -446,17 +448,14 @@ TSharedRef<SWidget> SStorageWidget::BuildItemSlot(int32 SlotIndex)
 
 	TSharedRef<SWidget> IconWidget = [&]() -> TSharedRef<SWidget>
 	{
-		FSlateBrush* Brush = nullptr;
-		if (UWorld* World = GEngine ? GEngine->GetCurrentPlayWorld() : nullptr)
+		TSharedPtr<const FSlateBrush> Brush;
+		if (UIconCacheSubsystem* Icons = UIconCacheSubsystem::Get(GEngine ? GEngine->GetCurrentPlayWorld() : nullptr))
 		{
-			if (UInventorySubsystem* InvSub = World->GetSubsystem<UInventorySubsystem>())
-			{
-				Brush = InvSub->GetOrCreateItemIconBrush(Item.Icon);
-			}
+			Brush = Icons->GetItemIcon(Item.Icon);
 		}
 		if (Brush)
 		{
-			return SNew(SImage).Image(Brush);
+			return SNew(SIconImage).Icon(Brush);
 		}
 		return SNew(SBorder)
 			.BorderImage(FCoreStyle::Get().GetBrush("GenericWhiteBox"))
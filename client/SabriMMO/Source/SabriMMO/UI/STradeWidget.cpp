@@ -7,6 +7,7 @@
 #include "TradeSubsystem.h"
 #include "InventorySubsystem.h"
 #include "ItemInspectSubsystem.h"
+#include "IconCacheSubsystem.h"
 #include "Widgets/Layout/SBox.h"
 #include "Widgets/Layout/SBorder.h"
 #include "Widgets/SOverlay.h"
@@ -303,9 +304,10 @@ TSharedRef<SWidget> STradeWidget::BuildItemSlot(int32 SlotIndex, bool bIsMyItem)
 									if (SlotIndex >= Items.Num()) return nullptr;
 									UWorld* World = GEngine->GetCurrentPlayWorld();
 									if (!World) return nullptr;
-									UInventorySubsystem* InvSub = World->GetSubsystem<UInventorySubsystem>();
-									if (!InvSub) return nullptr;
-									return InvSub->GetOrCreateItemIconBrush(Items[SlotIndex].Icon);
+									UIconCacheSubsystem* Icons = UIconCacheSubsystem::Get(World);
+									if (!Icons) return nullptr;
+									// Asked for every paint, which keeps it fresh in the cache's LRU
+									return Icons->GetItemIcon(Items[SlotIndex].Icon).Get();
 								}))
 						]
 					]
@@ -5,6 +5,8 @@
 #include "VendingSubsystem.h"
 #include "InventorySubsystem.h"
 #include "BasicInfoSubsystem.h"
+#include "IconCacheSubsystem.h"
+#include "SIconImage.h"
 #include "Widgets/Layout/SBox.h"
 #include "Widgets/Layout/SBorder.h"
 #include "Widgets/Layout/SScrollBox.h"
@@ -288,15 +290,15 @@ TSharedRef<SWidget> SVendingBrowsePopup::BuildItemRow(const FVendBrowseItem& Ite
 			UWorld* World = Sub->GetWorld();
 			if (World)
 			{
-				UInventorySubsystem* InvSub = World->GetSubsystem<UInventorySubsystem>();
-				if (InvSub)
+				UIconCacheSubsystem* Icons = UIconCacheSubsystem::Get(World);
+				if (Icons)
 				{
-					FSlateBrush* Brush = InvSub->GetOrCreateItemIconBrush(Item.Icon);
+					TSharedPtr<const FSlateBrush> Brush = Icons->GetItemIcon(Item.Icon);
 					if (Brush)
 					{
 						return SNew(SBox).WidthOverride(BrowseIconSize).HeightOverride(BrowseIconSize)
 						[
-							SNew(SImage).Image(Brush)
+							SNew(SIconImage).Icon(Brush)
 						];
 					}
 				}
@@ -4,6 +4,8 @@
 #include "SVendingSetupPopup.h"
 #include "VendingSubsystem.h"
 #include "InventorySubsystem.h"
+#include "IconCacheSubsystem.h"
+#include "SIconImage.h"
 #include "Widgets/Layout/SBox.h"
 #include "Widgets/Layout/SBorder.h"
 #include "Widgets/Layout/SScrollBox.h"
@@ -242,15 +244,15 @@ TSharedRef<SWidget> SVendingSetupPopup::BuildItemRow(int32 Index)
 			UWorld* World = Sub->GetWorld();
 			if (World)
 			{
-				UInventorySubsystem* InvSub = World->GetSubsystem<UInventorySubsystem>();
-				if (InvSub)
+				UIconCacheSubsystem* Icons = UIconCacheSubsystem::Get(World);
+				if (Icons)
 				{
-					FSlateBrush* Brush = InvSub->GetOrCreateItemIconBrush(Item.Icon);
+					TSharedPtr<const FSlateBrush> Brush = Icons->GetItemIcon(Item.Icon);
 					if (Brush)
 					{
 						return SNew(SBox).WidthOverride(SetupIconSize).HeightOverride(SetupIconSize)
 						[
-							SNew(SImage).Image(Brush)
+							SNew(SIconImage).Icon(Brush)
 						];
 					}
 				}
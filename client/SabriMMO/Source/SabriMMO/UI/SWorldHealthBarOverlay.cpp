@@ -3,7 +3,7 @@
 
 #include "SWorldHealthBarOverlay.h"
 #include "WorldHealthBarSubsystem.h"
-#include "Sprite/SpriteAtlasData.h"
+#include "ScreenProjectionSubsystem.h"
 #include "Rendering/DrawElements.h"
 #include "Framework/Application/SlateApplication.h"
 #include "Styling/CoreStyle.h"
@@ -67,7 +67,10 @@ int32 SWorldHealthBarOverlay::OnPaint(
 		OutDrawElements, LayerId, InWidgetStyle, bParentEnabled);
 
 	UWorldHealthBarSubsystem* Sub = OwningSubsystem.Get();
-	if (!Sub) return OutLayerId;
+	if (!Sub || !Sub->GetWorld()) return OutLayerId;
+
+	UScreenProjectionSubsystem* Projection = Sub->GetWorld()->GetSubsystem<UScreenProjectionSubsystem>();
+	if (!Projection) return OutLayerId;
 
 	// DPI scale factor: convert screen-pixel coordinates to Slate local coordinates
 	const float GeometryScale = AllottedGeometry.GetAccumulatedLayoutTransform().GetScale();
@@ -94,7 +97,7 @@ int32 SWorldHealthBarOverlay::OnPaint(
 			const float SpriteH = 150.f; // SpriteSize.Y
 
 			FVector2D ScreenPos;
-			if (GetSpriteScreenBounds(BarPC, ActorPos, SpriteH, TopScreen, BottomScreen))
+			if (Projection->ProjectSpriteBounds(ActorPos, SpriteH, TopScreen, BottomScreen))
 			{
 				float SpriteScreenH = BottomScreen.Y - TopScreen.Y;
 				// Position health bar just below sprite bottom (scales with zoom)
@@ -126,26 +129,39 @@ int32 SWorldHealthBarOverlay::OnPaint(
 
 	// ---- Draw enemy bars (skip if disabled in options) ----
 	if (!Sub->bShowEnemyBars) goto SkipEnemyBars;
-	for (const auto& Pair : Sub->EnemyHealthMap)
 	{
-		const FEnemyBarData& Enemy = Pair.Value;
+		// Gather every shown bar's feet position, then project them in one batch.
+		// Only active bars (in combat, alive) are walked — not every enemy in the zone.
+		TArray<const FEnemyBarData*, TInlineAllocator<64>> BarEnemies;
+		TArray<FVector, TInlineAllocator<64>> FeetPositions;
+		for (const int32 EnemyId : Sub->GetActiveBarIds())
+		{
+			const FEnemyBarData* EnemyPtr = Sub->EnemyHealthMap.Find(EnemyId);
+			if (!EnemyPtr) continue;
+			const FEnemyBarData& Enemy = *EnemyPtr;
 
-		// Skip: not visible or dead
-		if (!Enemy.bBarVisible || Enemy.bIsDead) continue;
+			// Get enemy feet position (linked actor for smooth tracking, fallback to socket position)
+			FVector EnemyFeetPos;
+			if (!Sub->GetEnemyFeetPosition(Enemy, EnemyFeetPos)) continue;
 
-		// Get enemy feet position (cached actor for smooth tracking, fallback to socket position)
-		FVector EnemyFeetPos;
-		if (!Sub->GetEnemyFeetPosition(Enemy, EnemyFeetPos)) continue;
+			BarEnemies.Add(&Enemy);
+			FeetPositions.Add(EnemyFeetPos);
+		}
+		TArray<FScreenPoint> ScreenPoints;
+		Projection->ProjectPoints(FeetPositions, ScreenPoints);
 
-		FVector2D ScreenPos;
-		if (!Sub->ProjectWorldToScreen(EnemyFeetPos, ScreenPos)) continue;
+		for (int32 i = 0; i < BarEnemies.Num(); ++i)
+		{
+			if (!ScreenPoints[i].bVisible) continue;
+			const FEnemyBarData& Enemy = *BarEnemies[i];
 
-		const float HPPercent = FMath::Clamp(
-			(float)Enemy.CurrentHP / (float)FMath::Max(Enemy.MaxHP, 1), 0.f, 1.f);
-		const bool bCritical = HPPercent <= CRITICAL_THRESHOLD;
+			const float HPPercent = FMath::Clamp(
+				(float)Enemy.CurrentHP / (float)FMath::Max(Enemy.MaxHP, 1), 0.f, 1.f);
+			const bool bCritical = HPPercent <= CRITICAL_THRESHOLD;
 
-		DrawEnemyBar(OutDrawElements, BarLayerId, AllottedGeometry, InvScale,
-			ScreenPos, HPPercent, bCritical);
+			DrawEnemyBar(OutDrawElements, BarLayerId, AllottedGeometry, InvScale,
+				ScreenPoints[i].Screen, HPPercent, bCritical);
+		}
 	}
 
 	SkipEnemyBars:
@@ -0,0 +1,347 @@
+// ScreenProjectionSubsystem.cpp — Per-frame view snapshot + batched world-to-screen (see header).
+
+#include "ScreenProjectionSubsystem.h"
+#include "Sprite/SpriteAtlasData.h"
+#include "Engine/World.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/GameViewportClient.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+#include "SceneView.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogScreenProjection, Log, All);
+
+static FAutoConsoleCommandWithWorldAndArgs GScreenProjectionStatsCmd(
+	TEXT("ScreenProjection.Stats"),
+	TEXT("Print registered overlay anchors and the last batched projection cost."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UScreenProjectionSubsystem* Sub = World ? World->GetSubsystem<UScreenProjectionSubsystem>() : nullptr)
+		{
+			Sub->LogStats();
+		}
+	}));
+
+namespace
+{
+	// Anchors whose points all land further than this outside the view rect are culled
+	constexpr float CullMarginPx = 128.f;
+
+	// Points per anchor in the batch: base, head, sprite bottom, sprite top
+	constexpr int32 PointsPerAnchor = 4;
+}
+
+// ============================================================
+// Lifecycle
+// ============================================================
+
+bool UScreenProjectionSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld();
+}
+
+void UScreenProjectionSubsystem::Deinitialize()
+{
+	Anchors.Empty();
+	Projected.Empty();
+	ProjectedOnScreen.Empty();
+	Super::Deinitialize();
+}
+
+// ============================================================
+// View snapshot
+// ============================================================
+
+bool UScreenProjectionSubsystem::CaptureView()
+{
+	UWorld* World = GetWorld();
+	APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+	APlayerCameraManager* Camera = PC ? PC->PlayerCameraManager.Get() : nullptr;
+
+	// Reuse this frame's snapshot unless the camera has updated since (mid-tick capture)
+	if (View.Frame == GFrameCounter && View.bValid && Camera)
+	{
+		const FMinimalViewInfo& POV = Camera->GetCameraCacheView();
+		if (POV.Location == View.CamLocation && POV.Rotation == View.CamRotation)
+			return true;
+	}
+	else if (View.Frame == GFrameCounter && !View.bValid)
+	{
+		return false;
+	}
+
+	if (View.Frame != GFrameCounter)
+	{
+		LastAdHocPoints = AdHocPointsThisFrame;
+		AdHocPointsThisFrame = 0;
+	}
+	View.Frame = GFrameCounter;
+	View.bValid = false;
+	++View.Serial;
+
+	ULocalPlayer* LP = PC ? PC->GetLocalPlayer() : nullptr;
+	if (!LP || !LP->ViewportClient || !Camera) return false;
+
+	// Same source as UGameplayStatics::ProjectWorldToScreen, taken once instead of per call
+	FSceneViewProjectionData ProjectionData;
+	if (!LP->GetProjectionData(LP->ViewportClient->Viewport, ProjectionData)) return false;
+
+	View.ViewOrigin = ProjectionData.ViewOrigin;
+	View.TranslatedViewProjection = FMatrix44f(ProjectionData.ViewRotationMatrix * ProjectionData.ProjectionMatrix);
+	View.ViewRect = ProjectionData.GetConstrainedViewRect();
+
+	const FMinimalViewInfo& POV = Camera->GetCameraCacheView();
+	View.CamLocation = POV.Location;
+	View.CamRotation = POV.Rotation;
+	View.CamForward = Camera->GetCameraRotation().Vector();
+	FRotator BillboardRot = (-View.CamForward).Rotation();
+	BillboardRot.Roll = 0.f;
+	View.BillboardUp = BillboardRot.RotateVector(FVector::UpVector);
+
+	View.bValid = true;
+	return true;
+}
+
+const FScreenProjectionView& UScreenProjectionSubsystem::GetView()
+{
+	CaptureView();
+	return View;
+}
+
+// ============================================================
+// Batched transform
+// ============================================================
+
+void UScreenProjectionSubsystem::ProjectSoA(int32 Num, const float* X, const float* Y, const float* Z,
+	float* OutX, float* OutY, uint8* OutFront) const
+{
+	// Straight-line float math over contiguous arrays so the compiler can vectorize it.
+	// Mirrors FSceneView::ProjectWorldToScreen (row vector * matrix, divide by W).
+	const FMatrix44f& M = View.TranslatedViewProjection;
+	const float HalfW = View.ViewRect.Width() * 0.5f;
+	const float HalfH = View.ViewRect.Height() * 0.5f;
+	const float CenterX = View.ViewRect.Min.X + HalfW;
+	const float CenterY = View.ViewRect.Min.Y + HalfH;
+
+	for (int32 i = 0; i < Num; ++i)
+	{
+		const float Px = X[i], Py = Y[i], Pz = Z[i];
+		const float Cx = Px * M.M[0][0] + Py * M.M[1][0] + Pz * M.M[2][0] + M.M[3][0];
+		const float Cy = Px * M.M[0][1] + Py * M.M[1][1] + Pz * M.M[2][1] + M.M[3][1];
+		const float Cw = Px * M.M[0][3] + Py * M.M[1][3] + Pz * M.M[2][3] + M.M[3][3];
+
+		const bool bFront = Cw > 0.f;
+		const float RHW = bFront ? 1.f / Cw : 0.f;
+		OutX[i] = CenterX + Cx * RHW * HalfW;
+		OutY[i] = CenterY - Cy * RHW * HalfH;
+		OutFront[i] = bFront ? 1 : 0;
+	}
+}
+
+bool UScreenProjectionSubsystem::ProjectPoint(const FVector& WorldPos, FVector2D& OutScreenPos)
+{
+	if (!CaptureView()) return false;
+	++AdHocPointsThisFrame;
+
+	const FVector3f Rel(WorldPos - View.ViewOrigin);
+	float SX, SY;
+	uint8 bFront;
+	ProjectSoA(1, &Rel.X, &Rel.Y, &Rel.Z, &SX, &SY, &bFront);
+	if (!bFront) return false;
+	OutScreenPos = FVector2D(SX, SY);
+	return true;
+}
+
+void UScreenProjectionSubsystem::ProjectPoints(TConstArrayView<FVector> WorldPoints, TArray<FScreenPoint>& Out)
+{
+	const int32 Num = WorldPoints.Num();
+	Out.SetNum(Num, EAllowShrinking::No);
+	if (Num == 0) return;
+
+	if (!CaptureView())
+	{
+		for (FScreenPoint& P : Out) P = FScreenPoint();
+		return;
+	}
+	AdHocPointsThisFrame += Num;
+
+	ScratchX.SetNumUninitialized(Num, EAllowShrinking::No);
+	ScratchY.SetNumUninitialized(Num, EAllowShrinking::No);
+	ScratchZ.SetNumUninitialized(Num, EAllowShrinking::No);
+	ScratchOutX.SetNumUninitialized(Num, EAllowShrinking::No);
+	ScratchOutY.SetNumUninitialized(Num, EAllowShrinking::No);
+	ScratchFront.SetNumUninitialized(Num, EAllowShrinking::No);
+
+	for (int32 i = 0; i < Num; ++i)
+	{
+		const FVector Rel = WorldPoints[i] - View.ViewOrigin;
+		ScratchX[i] = (float)Rel.X;
+		ScratchY[i] = (float)Rel.Y;
+		ScratchZ[i] = (float)Rel.Z;
+	}
+
+	ProjectSoA(Num, ScratchX.GetData(), ScratchY.GetData(), ScratchZ.GetData(),
+		ScratchOutX.GetData(), ScratchOutY.GetData(), ScratchFront.GetData());
+
+	const FIntRect& R = View.ViewRect;
+	for (int32 i = 0; i < Num; ++i)
+	{
+		const float SX = ScratchOutX[i];
+		const float SY = ScratchOutY[i];
+		Out[i].Screen = FVector2D(SX, SY);
+		Out[i].bVisible = ScratchFront[i]
+			&& SX >= R.Min.X - CullMarginPx && SX <= R.Max.X + CullMarginPx
+			&& SY >= R.Min.Y - CullMarginPx && SY <= R.Max.Y + CullMarginPx;
+	}
+}
+
+bool UScreenProjectionSubsystem::ProjectSpriteBounds(const FVector& BasePos, float SpriteHeight,
+	FVector2D& OutTop, FVector2D& OutBottom)
+{
+	if (!CaptureView()) return false;
+
+	// Quad is pushed toward the camera by the billboard depth offset (see GetSpriteScreenBounds)
+	const FVector Bottom = BasePos - View.CamForward * GSpriteCameraDepthOffset;
+	const FVector Top = Bottom + View.BillboardUp * SpriteHeight;
+	return ProjectPoint(Bottom, OutBottom) && ProjectPoint(Top, OutTop);
+}
+
+// ============================================================
+// Anchors
+// ============================================================
+
+int32 UScreenProjectionSubsystem::AddAnchor(AActor* Actor, const FScreenAnchorDesc& Desc)
+{
+	if (!Actor) return INDEX_NONE;
+
+	FAnchorRecord Record;
+	Record.Actor = Actor;
+	Record.Desc = Desc;
+	ProjectedSerial = 0;  // include it if something queries again this frame
+	return Anchors.Add(Record);
+}
+
+void UScreenProjectionSubsystem::UpdateAnchor(int32 Handle, const FScreenAnchorDesc& Desc)
+{
+	if (Anchors.IsValidIndex(Handle))
+	{
+		Anchors[Handle].Desc = Desc;
+	}
+}
+
+void UScreenProjectionSubsystem::RemoveAnchor(int32 Handle)
+{
+	if (Anchors.IsValidIndex(Handle))
+	{
+		Anchors.RemoveAt(Handle);
+	}
+}
+
+const FScreenAnchor* UScreenProjectionSubsystem::GetAnchor(int32 Handle)
+{
+	if (!Anchors.IsValidIndex(Handle)) return nullptr;
+	if (!CaptureView()) return nullptr;
+	if (ProjectedSerial != View.Serial)
+	{
+		ProjectAnchors();
+	}
+	if (!Projected.IsValidIndex(Handle) || !ProjectedOnScreen[Handle]) return nullptr;
+	return &Projected[Handle];
+}
+
+void UScreenProjectionSubsystem::ProjectAnchors()
+{
+	ProjectedSerial = View.Serial;
+
+	const int32 MaxIndex = Anchors.GetMaxIndex();
+	Projected.SetNum(MaxIndex, EAllowShrinking::No);
+	ProjectedOnScreen.Init(false, MaxIndex);
+	LastAnchorPoints = 0;
+	if (MaxIndex == 0 || !View.bValid) return;
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Gather: one location read per actor, four points per anchor, all relative to the camera
+	const int32 MaxPoints = MaxIndex * PointsPerAnchor;
+	ScratchX.SetNumUninitialized(MaxPoints, EAllowShrinking::No);
+	ScratchY.SetNumUninitialized(MaxPoints, EAllowShrinking::No);
+	ScratchZ.SetNumUninitialized(MaxPoints, EAllowShrinking::No);
+	ScratchOutX.SetNumUninitialized(MaxPoints, EAllowShrinking::No);
+	ScratchOutY.SetNumUninitialized(MaxPoints, EAllowShrinking::No);
+	ScratchFront.SetNumUninitialized(MaxPoints, EAllowShrinking::No);
+
+	TArray<int32, TInlineAllocator<256>> Live;
+	const FVector SpriteDepth = View.CamForward * GSpriteCameraDepthOffset;
+	for (auto It = Anchors.CreateConstIterator(); It; ++It)
+	{
+		const AActor* Actor = It->Actor.Get();
+		if (!Actor) continue;
+
+		const FScreenAnchorDesc& Desc = It->Desc;
+		const FVector Loc = Actor->GetActorLocation() - View.ViewOrigin;
+		const FVector Base(Loc.X, Loc.Y, Loc.Z + Desc.BaseZOffset);
+		const FVector SpriteBottom = Base - SpriteDepth;
+		const FVector SpriteTop = SpriteBottom + View.BillboardUp * Desc.SpriteHeight;
+
+		const int32 P = Live.Num() * PointsPerAnchor;
+		ScratchX[P + 0] = (float)Base.X;         ScratchY[P + 0] = (float)Base.Y;         ScratchZ[P + 0] = (float)Base.Z;
+		ScratchX[P + 1] = (float)Loc.X;          ScratchY[P + 1] = (float)Loc.Y;          ScratchZ[P + 1] = (float)(Loc.Z + Desc.HeadZOffset);
+		ScratchX[P + 2] = (float)SpriteBottom.X; ScratchY[P + 2] = (float)SpriteBottom.Y; ScratchZ[P + 2] = (float)SpriteBottom.Z;
+		ScratchX[P + 3] = (float)SpriteTop.X;    ScratchY[P + 3] = (float)SpriteTop.Y;    ScratchZ[P + 3] = (float)SpriteTop.Z;
+		Live.Add(It.GetIndex());
+	}
+
+	const int32 NumPoints = Live.Num() * PointsPerAnchor;
+	ProjectSoA(NumPoints, ScratchX.GetData(), ScratchY.GetData(), ScratchZ.GetData(),
+		ScratchOutX.GetData(), ScratchOutY.GetData(), ScratchFront.GetData());
+
+	// Scatter + cull
+	const FIntRect& R = View.ViewRect;
+	auto InRect = [&R](float SX, float SY)
+	{
+		return SX >= R.Min.X - CullMarginPx && SX <= R.Max.X + CullMarginPx
+			&& SY >= R.Min.Y - CullMarginPx && SY <= R.Max.Y + CullMarginPx;
+	};
+
+	for (int32 L = 0; L < Live.Num(); ++L)
+	{
+		const int32 Handle = Live[L];
+		const int32 P = L * PointsPerAnchor;
+		FScreenAnchor& A = Projected[Handle];
+
+		A.Base = FVector2D(ScratchOutX[P + 0], ScratchOutY[P + 0]);
+		A.Head = FVector2D(ScratchOutX[P + 1], ScratchOutY[P + 1]);
+		A.SpriteBottom = FVector2D(ScratchOutX[P + 2], ScratchOutY[P + 2]);
+		A.SpriteTop = FVector2D(ScratchOutX[P + 3], ScratchOutY[P + 3]);
+		A.bBaseValid = ScratchFront[P + 0] != 0;
+		A.bHeadValid = ScratchFront[P + 1] != 0;
+		A.bSpriteValid = Anchors[Handle].Desc.SpriteHeight > 0.f && ScratchFront[P + 2] && ScratchFront[P + 3];
+
+		ProjectedOnScreen[Handle] =
+			(A.bBaseValid && InRect(A.Base.X, A.Base.Y)) ||
+			(A.bHeadValid && InRect(A.Head.X, A.Head.Y)) ||
+			(A.bSpriteValid && (InRect(A.SpriteTop.X, A.SpriteTop.Y) || InRect(A.SpriteBottom.X, A.SpriteBottom.Y)));
+	}
+
+	LastAnchorPoints = NumPoints;
+	LastBatchMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+}
+
+// ============================================================
+// Stats
+// ============================================================
+
+void UScreenProjectionSubsystem::LogStats() const
+{
+	int32 NumOnScreen = 0;
+	for (TConstSetBitIterator<> It(ProjectedOnScreen); It; ++It)
+	{
+		++NumOnScreen;
+	}
+	UE_LOG(LogScreenProjection, Log,
+		TEXT("Screen projection: %d anchors (%d on screen), last batch %d points in %.3f ms, %d ad-hoc points last frame, view %s"),
+		Anchors.Num(), NumOnScreen, LastAnchorPoints, LastBatchMs, LastAdHocPoints,
+		View.bValid ? *FString::Printf(TEXT("%dx%d"), View.ViewRect.Width(), View.ViewRect.Height()) : TEXT("invalid"));
+}
@@ -0,0 +1,139 @@
+// ScreenProjectionSubsystem.h — Shared per-frame world-to-screen projection for Slate overlays.
+// Captures the local player's view-projection matrix and view rect once per frame (lazily,
+// on the first query; re-captured if the camera moves later in the same frame, since socket
+// handlers can query mid-tick and overlays paint after the camera update) and projects every
+// registered actor anchor in one batched pass. Overlays read already-projected, culled
+// screen positions instead of each doing a GetPlayerController + ProjectWorldLocationToScreen
+// per entity per paint.
+//
+// Screen positions are viewport pixels, identical to
+// APlayerController::ProjectWorldLocationToScreen(..., bPlayerViewportRelative=false).
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Containers/SparseArray.h"
+#include "ScreenProjectionSubsystem.generated.h"
+
+/** The local player's view for one frame */
+struct FScreenProjectionView
+{
+	bool bValid = false;
+	uint64 Frame = 0;
+	/** Bumped on every capture; anchor projections are keyed by it */
+	uint32 Serial = 0;
+
+	/** Camera POV the snapshot was taken from */
+	FVector CamLocation = FVector::ZeroVector;
+	FRotator CamRotation = FRotator::ZeroRotator;
+
+	/** Camera location; the matrix below works on positions relative to it (float-precision safe) */
+	FVector ViewOrigin = FVector::ZeroVector;
+	FMatrix44f TranslatedViewProjection = FMatrix44f::Identity;
+	FIntRect ViewRect;
+
+	FVector CamForward = FVector::ForwardVector;
+	/** Up axis of a camera-facing sprite billboard (matches ASpriteCharacterActor's rotation) */
+	FVector BillboardUp = FVector::UpVector;
+};
+
+/** A registered anchor: actor location plus fixed offsets, projected once per frame */
+struct FScreenAnchorDesc
+{
+	/** Added to the actor location for the base point (e.g. -capsule half height for feet) */
+	float BaseZOffset = 0.f;
+	/** Added to the actor location for the head point (name tags' VerticalOffset) */
+	float HeadZOffset = 0.f;
+	/** If > 0, sprite billboard top/bottom are projected from the base point */
+	float SpriteHeight = 0.f;
+};
+
+/** Projected anchor for the current frame */
+struct FScreenAnchor
+{
+	FVector2D Base = FVector2D::ZeroVector;
+	FVector2D Head = FVector2D::ZeroVector;
+	FVector2D SpriteTop = FVector2D::ZeroVector;
+	FVector2D SpriteBottom = FVector2D::ZeroVector;
+
+	bool bBaseValid = false;
+	bool bHeadValid = false;
+	/** Both sprite points in front of the camera (only when SpriteHeight > 0) */
+	bool bSpriteValid = false;
+};
+
+/** One projected point of a ProjectPoints batch */
+struct FScreenPoint
+{
+	FVector2D Screen = FVector2D::ZeroVector;
+	/** In front of the camera and within the view rect (plus cull margin) */
+	bool bVisible = false;
+};
+
+UCLASS()
+class SABRIMMO_API UScreenProjectionSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	// ---- Anchors (projected in one batch per frame) ----
+	int32 AddAnchor(AActor* Actor, const FScreenAnchorDesc& Desc);
+	void UpdateAnchor(int32 Handle, const FScreenAnchorDesc& Desc);
+	void RemoveAnchor(int32 Handle);
+
+	/** This frame's projection of an anchor; nullptr if invalid, actor gone, or entirely off screen */
+	const FScreenAnchor* GetAnchor(int32 Handle);
+
+	// ---- Ad-hoc projection against the same per-frame snapshot ----
+
+	/** This frame's view snapshot (captured on first use) */
+	const FScreenProjectionView& GetView();
+
+	/** Single point; same contract as ProjectWorldLocationToScreen (true when in front of the camera) */
+	bool ProjectPoint(const FVector& WorldPos, FVector2D& OutScreenPos);
+
+	/** Batched projection of caller-supplied points; Out is resized to match */
+	void ProjectPoints(TConstArrayView<FVector> WorldPoints, TArray<FScreenPoint>& Out);
+
+	/** Sprite billboard top/bottom on screen from its base (feet) position — see GetSpriteScreenBounds */
+	bool ProjectSpriteBounds(const FVector& BasePos, float SpriteHeight, FVector2D& OutTop, FVector2D& OutBottom);
+
+	int32 NumAnchors() const { return Anchors.Num(); }
+	void LogStats() const;
+
+private:
+	struct FAnchorRecord
+	{
+		TWeakObjectPtr<AActor> Actor;
+		FScreenAnchorDesc Desc;
+	};
+
+	bool CaptureView();
+	void ProjectAnchors();
+
+	/** Core batched transform: float SoA in (relative to ViewOrigin), screen XY + visibility out */
+	void ProjectSoA(int32 Num, const float* X, const float* Y, const float* Z,
+		float* OutX, float* OutY, uint8* OutFront) const;
+
+	FScreenProjectionView View;
+
+	TSparseArray<FAnchorRecord> Anchors;
+	/** Indexed like Anchors' backing storage */
+	TArray<FScreenAnchor> Projected;
+	TBitArray<> ProjectedOnScreen;
+	uint32 ProjectedSerial = 0;  // View.Serial the anchors were projected with (0 = stale)
+
+	// Scratch (reused every frame)
+	TArray<float> ScratchX, ScratchY, ScratchZ, ScratchOutX, ScratchOutY;
+	TArray<uint8> ScratchFront;
+
+	// Stats for ScreenProjection.Stats
+	int32 LastAnchorPoints = 0;
+	int32 LastAdHocPoints = 0;
+	int32 AdHocPointsThisFrame = 0;
+	double LastBatchMs = 0.0;
+};
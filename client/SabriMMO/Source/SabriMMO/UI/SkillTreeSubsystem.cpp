@@ -10,6 +10,8 @@
 #include "DrawDebugHelpers.h"
 #include "MMOGameInstance.h"
 #include "SocketEventRouter.h"
+#include "IconCacheSubsystem.h"
+#include "SIconImage.h"
 #include "Audio/AudioSubsystem.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
@@ -23,7 +25,6 @@
 #include "Widgets/Images/SImage.h"
 #include "Styling/CoreStyle.h"
 #include "Serialization/JsonSerializer.h"
-#include "Engine/Texture2D.h"
 #include "UObject/UnrealType.h"
 #include "GameFramework/PlayerController.h"
 #include "Blueprint/AIBlueprintHelperLibrary.h"
@@ -378,9 +379,6 @@ void USkillTreeSubsystem::Deinitialize()
 	HideSkillDragCursor();
 	bSkillDragging = false;
 
-	// Clear icon caches — release GC-rooted textures and brush memory
-	IconBrushCache.Empty();
-	IconTextureCache.Empty();
 	DynamicIconPaths.Empty();
 
 	if (UWorld* World = GetWorld())
@@ -833,49 +831,6 @@ FString USkillTreeSubsystem::ResolveIconContentPath(const FString& IconName) con
 	return FString::Printf(TEXT("/Game/SabriMMO/Assets/Skill_Icons/Novice/%s"), *IconName);
 }
 
-FSlateBrush* USkillTreeSubsystem::GetOrCreateIconBrush(const FString& ContentPath)
-{
-	if (ContentPath.IsEmpty()) return nullptr;
-
-	if (TSharedPtr<FSlateBrush>* Found = IconBrushCache.Find(ContentPath))
-	{
-		return Found->Get();
-	}
-
-	UTexture2D* Tex = LoadObject<UTexture2D>(nullptr, *ContentPath);
-	if (!Tex)
-	{
-		UE_LOG(LogSkillTree, Warning, TEXT("Failed to load skill icon: %s"), *ContentPath);
-		// Cache a null entry so we don't re-attempt LoadObject every rebuild
-		IconBrushCache.Add(ContentPath, nullptr);
-		return nullptr;
-	}
-
-	// Force UI-quality texture settings so icons stay crisp at small display sizes.
-	// Without this, UE5 defaults (DXT compression + mipmap chain + streaming) make
-	// 1024px icons look blurry/blocky when rendered at 24-32px in Slate.
-	Tex->LODGroup = TEXTUREGROUP_UI;
-	Tex->Filter = TF_Bilinear;          // No trilinear (no mipmaps to blend)
-	Tex->NeverStream = true;
-	Tex->UpdateResource();
-
-	// CRITICAL: Store the texture in a UPROPERTY TMap so the GC sees it as referenced.
-	// Without this, the UTexture2D is only reachable via FSlateBrush (inside a non-UPROPERTY
-	// TSharedPtr chain) — invisible to GC — and gets garbage collected → crash during Paint.
-	IconTextureCache.Add(ContentPath, Tex);
-
-	TSharedPtr<FSlateBrush> Brush = MakeShared<FSlateBrush>();
-	Brush->SetResourceObject(Tex);
-	Brush->ImageSize = FVector2D(24.f, 24.f);
-	Brush->DrawAs = ESlateBrushDrawType::Image;
-
-	FSlateBrush* RawPtr = Brush.Get();
-	IconBrushCache.Add(ContentPath, Brush);
-
-	UE_LOG(LogSkillTree, Log, TEXT("Loaded skill icon: %s"), *ContentPath);
-	return RawPtr;
-}
-
 // ============================================================
 // Event Handlers
 // ============================================================
@@ -1023,6 +978,20 @@ void USkillTreeSubsystem::HandleSkillData(const TSharedPtr<FJsonValue>& Data)
 	UE_LOG(LogSkillTree, Log, TEXT("HandleSkillData — %d class groups, %d skill points, class=%s"),
 		SkillGroups.Num(), SkillPoints, *JobClass);
 
+	// Stream this class's cast / impact sounds now rather than on the first cast
+	if (UAudioSubsystem* Audio = GetWorld() ? GetWorld()->GetSubsystem<UAudioSubsystem>() : nullptr)
+	{
+		TArray<int32> SkillIds;
+		for (const FSkillClassGroup& Group : SkillGroups)
+		{
+			for (const FSkillEntry& Skill : Group.Skills)
+			{
+				SkillIds.Add(Skill.SkillId);
+			}
+		}
+		Audio->PreloadSkillSounds(SkillIds);
+	}
+
 	// Rebuild the widget content if it exists — this is the key path that populates
 	// tabs/skills when data arrives after the widget was already shown in "Loading..." state
 	if (SkillTreeWidget.IsValid())
@@ -2056,10 +2025,14 @@ void USkillTreeSubsystem::ShowSkillDragCursor(const FString& IconPath)
 
 	TSharedRef<SWidget> IconContent = [&]() -> TSharedRef<SWidget>
 	{
-		FSlateBrush* Brush = GetOrCreateIconBrush(IconPath);
+		TSharedPtr<const FSlateBrush> Brush;
+		if (UIconCacheSubsystem* IconCache = UIconCacheSubsystem::Get(World))
+		{
+			Brush = IconCache->GetSkillIcon(IconPath);
+		}
 		if (Brush)
 		{
-			return SNew(SImage).Image(Brush);
+			return SNew(SIconImage).Icon(Brush);
 		}
 		// Fallback: gold square
 		return SNew(SBorder)
@@ -226,7 +226,6 @@ public:
 
 	// ---- icon utilities ----
 	FString ResolveIconContentPath(const FString& IconName) const;
-	FSlateBrush* GetOrCreateIconBrush(const FString& ContentPath);
 
 	/** Cached icon name -> content path map, populated from server skill data */
 	TMap<FString, FString> DynamicIconPaths;
@@ -300,15 +299,6 @@ private:
 	TSharedPtr<SWidget>          AlignmentWrapper;
 	TSharedPtr<SWidget>          ViewportOverlay;
 
-	// ---- icon brush cache (TSharedPtr so raw FSlateBrush* survives TMap rehash) ----
-	TMap<FString, TSharedPtr<FSlateBrush>> IconBrushCache;
-
-	// ---- GC root for loaded textures (CRITICAL: prevents UTexture2D garbage collection) ----
-	// Without this UPROPERTY, textures stored only in FSlateBrush (via non-UPROPERTY TSharedPtr)
-	// are invisible to GC and get collected → dangling pointer → crash during Paint.
-	UPROPERTY()
-	TMap<FString, TObjectPtr<UTexture2D>> IconTextureCache;
-
 	// ---- hotbar skill tracking (0-based slotIndex → skillId) ----
 	TMap<int32, int32> HotbarSkillMap;
 	void HandleHotbarAllData(const TSharedPtr<FJsonValue>& Data);
@@ -0,0 +1,332 @@
+// SnapshotInterpolationSubsystem.cpp — Server-time snapshot interpolation for remote movement (see header).
+
+#include "SnapshotInterpolationSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/DateTime.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSnapshotInterp, Log, All);
+
+static TAutoConsoleVariable<int32> CVarNetInterp(
+	TEXT("Net.Interp"),
+	1,
+	TEXT("1 = draw remote players / enemies / homunculi from the snapshot buffer, 0 = chase the latest packet."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarNetInterpDelay(
+	TEXT("Net.InterpDelay"),
+	0.1f,
+	TEXT("Minimum seconds remote entities are drawn behind the estimated server time."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarNetInterpIntervals(
+	TEXT("Net.InterpIntervals"),
+	1.5f,
+	TEXT("Per-entity delay floor as a multiple of its measured send interval (enemies send every 200 ms)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarNetInterpMaxExtrapolation(
+	TEXT("Net.InterpMaxExtrapolation"),
+	0.25f,
+	TEXT("Seconds an entity keeps moving past its newest snapshot before it holds."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarNetInterpSnapDistance(
+	TEXT("Net.InterpSnapDistance"),
+	400.f,
+	TEXT("A jump between consecutive snapshots longer than this (world units) snaps instead of sliding."),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorldAndArgs GNetInterpStatsCmd(
+	TEXT("Net.InterpStats"),
+	TEXT("Print tracked entities, clock state and last-frame interpolated / extrapolated / held samples."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (USnapshotInterpolationSubsystem* Sub = World ? World->GetSubsystem<USnapshotInterpolationSubsystem>() : nullptr)
+		{
+			Sub->LogStats();
+		}
+	}));
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommandWithWorldAndArgs GNetRecordMovesCmd(
+	TEXT("Net.RecordMoves"),
+	TEXT("Net.RecordMoves [seconds=30] — capture incoming remote positions to Saved/MoveStreams/*.csv for replay tests."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (USnapshotInterpolationSubsystem* Sub = World ? World->GetSubsystem<USnapshotInterpolationSubsystem>() : nullptr)
+		{
+			Sub->StartRecording(Args.Num() > 0 ? FCString::Atof(*Args[0]) : 30.f);
+		}
+	}));
+#endif
+
+// ============================================================
+// Lifecycle
+// ============================================================
+
+bool USnapshotInterpolationSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld();
+}
+
+void USnapshotInterpolationSubsystem::Deinitialize()
+{
+#if !UE_BUILD_SHIPPING
+	FlushRecording();
+#endif
+	Entries.Empty();
+	BPBindings.Reset();
+	Super::Deinitialize();
+}
+
+TStatId USnapshotInterpolationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USnapshotInterpolationSubsystem, STATGROUP_Tickables);
+}
+
+bool USnapshotInterpolationSubsystem::IsEnabled()
+{
+	return CVarNetInterp.GetValueOnGameThread() != 0;
+}
+
+// ============================================================
+// Incoming positions
+// ============================================================
+
+void USnapshotInterpolationSubsystem::BeginPacket(uint32 ServerTimeMs)
+{
+	const double Local = FPlatformTime::Seconds();
+	const bool bHadClock = Clock.IsValid();
+	PacketServerTime = Clock.Observe(ServerTimeMs, Local);
+	bInPacket = true;
+
+	// Until the first timestamp everything was stamped on the local timeline — move it over
+	if (!bHadClock)
+	{
+		for (TPair<TWeakObjectPtr<AActor>, FMotionEntry>& Pair : Entries)
+		{
+			FSnapshotBuffer& Buffer = Pair.Value.Buffer;
+			if (Buffer.Num() > 0) Buffer.Reset(PacketServerTime, Buffer.Newest().Position);
+		}
+		FrameNumber = 0;
+	}
+
+#if !UE_BUILD_SHIPPING
+	PacketServerMs = ServerTimeMs;
+#endif
+}
+
+void USnapshotInterpolationSubsystem::EndPacket()
+{
+	bInPacket = false;
+}
+
+double USnapshotInterpolationSubsystem::StampTime() const
+{
+	if (bInPacket) return PacketServerTime;
+	const double Local = FPlatformTime::Seconds();
+	return Clock.IsValid() ? Clock.Now(Local) : Local;
+}
+
+USnapshotInterpolationSubsystem::FMotionEntry& USnapshotInterpolationSubsystem::FindOrAddEntry(AActor* Actor, EMotionApply Apply)
+{
+	FMotionEntry& Entry = Entries.FindOrAdd(Actor);
+	if (Entry.Apply != Apply || (Apply == EMotionApply::BlueprintTarget && !Entry.Bindings))
+	{
+		Entry.Apply = Apply;
+		if (Apply == EMotionApply::BlueprintTarget)
+		{
+			Entry.Bindings = &BPBindings.Get(Actor);
+		}
+	}
+	return Entry;
+}
+
+void USnapshotInterpolationSubsystem::Push(AActor* Actor, const FVector& Position, bool bMoving, EMotionApply Apply)
+{
+	if (!Actor) return;
+
+	FMotionEntry& Entry = FindOrAddEntry(Actor, Apply);
+	if (Entry.Buffer.Push(StampTime(), Position, bMoving, CVarNetInterpSnapDistance.GetValueOnGameThread()))
+	{
+		++NumPushed;
+	}
+	else
+	{
+		++NumDropped;
+	}
+
+#if !UE_BUILD_SHIPPING
+	if (RecordUntil > 0.0) RecordPush(Actor, Position, bMoving);
+#endif
+}
+
+void USnapshotInterpolationSubsystem::Teleport(AActor* Actor, const FVector& Position, EMotionApply Apply)
+{
+	if (!Actor) return;
+	FindOrAddEntry(Actor, Apply).Buffer.Reset(StampTime(), Position);
+}
+
+void USnapshotInterpolationSubsystem::Hold(AActor* Actor, float Seconds)
+{
+	if (FMotionEntry* Entry = Entries.Find(Actor))
+	{
+		Entry->HoldUntil = FPlatformTime::Seconds() + Seconds;
+	}
+}
+
+void USnapshotInterpolationSubsystem::Remove(AActor* Actor)
+{
+	Entries.Remove(Actor);
+}
+
+// ============================================================
+// Sampling
+// ============================================================
+
+void USnapshotInterpolationSubsystem::BeginFrame()
+{
+	if (FrameNumber == GFrameCounter) return;
+	FrameNumber = GFrameCounter;
+
+	FMemory::Memcpy(LastFrameSamples, FrameSamples, sizeof(FrameSamples));
+	FMemory::Memzero(FrameSamples, sizeof(FrameSamples));
+
+	FrameLocalTime = FPlatformTime::Seconds();
+	FrameServerTime = Clock.IsValid() ? Clock.Now(FrameLocalTime) : FrameLocalTime;
+}
+
+ESnapshotSample USnapshotInterpolationSubsystem::SampleEntry(const FMotionEntry& Entry, FVector& OutPosition, bool& bOutMoving) const
+{
+	// Sparse senders (enemies at 5Hz) need more delay than the 30Hz player stream
+	const double Delay = FMath::Max(
+		(double)CVarNetInterpDelay.GetValueOnGameThread(),
+		(double)CVarNetInterpIntervals.GetValueOnGameThread() * Entry.Buffer.GetMeanInterval());
+
+	return Entry.Buffer.Sample(FrameServerTime - Delay,
+		CVarNetInterpMaxExtrapolation.GetValueOnGameThread(), OutPosition, bOutMoving);
+}
+
+void USnapshotInterpolationSubsystem::CountSample(ESnapshotSample Kind)
+{
+	++FrameSamples[static_cast<int32>(Kind)];
+}
+
+bool USnapshotInterpolationSubsystem::SampleSprite(AActor* Actor, FVector& OutPosition, bool& bOutMoving)
+{
+	if (!IsEnabled()) return false;
+
+	const FMotionEntry* Entry = Entries.Find(Actor);
+	if (!Entry || Entry->Buffer.Num() == 0) return false;
+
+	BeginFrame();
+	if (Entry->HoldUntil > FrameLocalTime) return false;
+
+	const ESnapshotSample Kind = SampleEntry(*Entry, OutPosition, bOutMoving);
+	CountSample(Kind);
+	return Kind != ESnapshotSample::None;
+}
+
+void USnapshotInterpolationSubsystem::Tick(float DeltaTime)
+{
+	BeginFrame();
+
+#if !UE_BUILD_SHIPPING
+	if (RecordUntil > 0.0 && FrameLocalTime >= RecordUntil) FlushRecording();
+#endif
+
+	const bool bEnabled = IsEnabled();
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		AActor* Actor = It.Key().Get();
+		if (!Actor)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		// Disabled: OtherPlayerSubsystem writes the newest packet straight to the BP, as before
+		FMotionEntry& Entry = It.Value();
+		if (bEnabled && Entry.Apply == EMotionApply::BlueprintTarget && Entry.Buffer.Num() > 0)
+		{
+			ApplyBlueprint(Actor, Entry);
+		}
+	}
+}
+
+void USnapshotInterpolationSubsystem::ApplyBlueprint(AActor* Actor, FMotionEntry& Entry)
+{
+	FVector Pos;
+	bool bMoving = false;
+	const ESnapshotSample Kind = SampleEntry(Entry, Pos, bMoving);
+	CountSample(Kind);
+
+	// Teleport / Fly Wing / zone-in: place the actor, don't let the BP walk it there
+	if (Entry.Buffer.ConsumeSnap())
+	{
+		Actor->SetActorLocation(Entry.Buffer.Newest().Position);
+	}
+
+	// The BP clears bIsMoving itself when it reaches TargetPosition
+	if (Pos.Equals(Entry.LastApplied, 0.1f)) return;
+	Entry.Bindings->TargetPosition.Set(Actor, Pos);
+	Entry.Bindings->IsMoving.Set(Actor, true);
+	Entry.LastApplied = Pos;
+}
+
+// ============================================================
+// Recording (replayed by ASabriMMONetworkTests::Test_Position_Interpolation)
+// ============================================================
+
+#if !UE_BUILD_SHIPPING
+void USnapshotInterpolationSubsystem::StartRecording(float Seconds)
+{
+	FlushRecording();
+	RecordBuffer = TEXT("local_seconds,server_ms,id,x,y,z,moving\n");
+	RecordUntil = FPlatformTime::Seconds() + FMath::Max(1.f, Seconds);
+	UE_LOG(LogSnapshotInterp, Log, TEXT("Recording remote movement for %.0f s"), Seconds);
+}
+
+void USnapshotInterpolationSubsystem::RecordPush(const AActor* Actor, const FVector& Position, bool bMoving)
+{
+	RecordBuffer += FString::Printf(TEXT("%.4f,%s,%u,%.1f,%.1f,%.1f,%d\n"),
+		FPlatformTime::Seconds(),
+		bInPacket ? *FString::Printf(TEXT("%u"), PacketServerMs) : TEXT("-1"),
+		Actor->GetUniqueID(), Position.X, Position.Y, Position.Z, bMoving ? 1 : 0);
+}
+
+void USnapshotInterpolationSubsystem::FlushRecording()
+{
+	if (RecordUntil <= 0.0) return;
+	RecordUntil = 0.0;
+
+	const FString Path = FPaths::ProjectSavedDir() / TEXT("MoveStreams") /
+		FString::Printf(TEXT("moves_%s.csv"), *FDateTime::Now().ToString());
+	if (FFileHelper::SaveStringToFile(RecordBuffer, *Path))
+	{
+		UE_LOG(LogSnapshotInterp, Log, TEXT("Saved movement recording to %s"), *Path);
+	}
+	RecordBuffer.Empty();
+}
+#endif
+
+// ============================================================
+// Stats
+// ============================================================
+
+void USnapshotInterpolationSubsystem::LogStats() const
+{
+	UE_LOG(LogSnapshotInterp, Log,
+		TEXT("Snapshot interp (%s): %d entities, clock %s; %llu pushed, %llu dropped out of order; last frame %d interpolated, %d extrapolated, %d held"),
+		IsEnabled() ? TEXT("on") : TEXT("off"), Entries.Num(), Clock.IsValid() ? TEXT("synced") : TEXT("local"),
+		NumPushed, NumDropped,
+		LastFrameSamples[static_cast<int32>(ESnapshotSample::Interpolated)],
+		LastFrameSamples[static_cast<int32>(ESnapshotSample::Extrapolated)],
+		LastFrameSamples[static_cast<int32>(ESnapshotSample::Held)]);
+}
@@ -0,0 +1,116 @@
+// SnapshotInterpolationSubsystem.h — Buffered, server-time interpolation for remote movement.
+//
+// Remote players, enemies and remote homunculi used to chase the latest packet directly:
+// jitter in arrival times showed up as speed-ups and stutter. Every position update now goes
+// into that actor's FSnapshotBuffer stamped with server time (the move:batch header, or the
+// JSON "timestamp"), and the actor is drawn where it was Net.InterpDelay (or a multiple of
+// its send interval, whichever is larger) ago, so the buffer almost always brackets it.
+// Late or missing packets extrapolate along the last segment for Net.InterpMaxExtrapolation
+// seconds and then hold.
+//
+//   Sprite actors (bUseServerMovement) pull their position in UpdateOwnerTracking (SampleSprite).
+//   Blueprint actors (remote players) get TargetPosition / bIsMoving written each tick.
+//
+// Local-only followers (own pet / homunculus) are not server-driven and don't use this.
+// Net.InterpStats prints per-frame sample kinds; Net.RecordMoves <seconds> (non-shipping)
+// captures the incoming stream to Saved/MoveStreams for the network test replay.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SnapshotBuffer.h"
+#include "BlueprintBindings.h"
+#include "SnapshotInterpolationSubsystem.generated.h"
+
+enum class EMotionApply : uint8
+{
+	Sprite,            // ASpriteCharacterActor pulls the sample itself
+	BlueprintTarget,   // write the BP's TargetPosition / bIsMoving
+};
+
+UCLASS()
+class SABRIMMO_API USnapshotInterpolationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	static bool IsEnabled();
+
+	/** Server timestamp of the packet being dispatched. Pushes until EndPacket are stamped with it. */
+	void BeginPacket(uint32 ServerTimeMs);
+	void EndPacket();
+
+	/** Queue a server position for Actor (stamped with the current packet, else the estimated server time) */
+	void Push(AActor* Actor, const FVector& Position, bool bMoving, EMotionApply Apply);
+
+	/** Drop Actor's history and rest at Position (spawn, respawn, local teleport) */
+	void Teleport(AActor* Actor, const FVector& Position, EMotionApply Apply);
+
+	/** Let local code (attack lunge) move a sprite directly for Seconds */
+	void Hold(AActor* Actor, float Seconds);
+
+	void Remove(AActor* Actor);
+
+	/** Interpolated position for a sprite actor. False when the sprite should use its own stepping. */
+	bool SampleSprite(AActor* Actor, FVector& OutPosition, bool& bOutMoving);
+
+	void LogStats() const;
+
+#if !UE_BUILD_SHIPPING
+	void StartRecording(float Seconds);
+#endif
+
+private:
+	struct FMotionEntry
+	{
+		FSnapshotBuffer Buffer;
+		EMotionApply Apply = EMotionApply::Sprite;
+		double HoldUntil = 0.0;   // FPlatformTime::Seconds
+
+		// TargetPosition / bIsMoving for BlueprintTarget entries (from BPBindings)
+		const FBPMovementBindings* Bindings = nullptr;
+		FVector LastApplied = FVector(TNumericLimits<float>::Max());
+	};
+
+	FMotionEntry& FindOrAddEntry(AActor* Actor, EMotionApply Apply);
+	double StampTime() const;
+	void BeginFrame();
+	ESnapshotSample SampleEntry(const FMotionEntry& Entry, FVector& OutPosition, bool& bOutMoving) const;
+	void ApplyBlueprint(AActor* Actor, FMotionEntry& Entry);
+	void CountSample(ESnapshotSample Kind);
+
+	FServerClock Clock;
+	bool bInPacket = false;
+	double PacketServerTime = 0.0;
+
+	// Per-frame render clock (shared by Tick and SampleSprite)
+	uint64 FrameNumber = 0;
+	double FrameLocalTime = 0.0;
+	double FrameServerTime = 0.0;
+
+	TMap<TWeakObjectPtr<AActor>, FMotionEntry> Entries;
+	TBPBindingCache<FBPMovementBindings> BPBindings;
+
+	// Lifetime counters
+	uint64 NumPushed = 0;
+	uint64 NumDropped = 0;
+
+	// Last complete frame, for Net.InterpStats
+	int32 FrameSamples[4] = {};
+	int32 LastFrameSamples[4] = {};
+
+#if !UE_BUILD_SHIPPING
+	void RecordPush(const AActor* Actor, const FVector& Position, bool bMoving);
+	void FlushRecording();
+
+	double RecordUntil = 0.0;
+	uint32 PacketServerMs = 0;
+	FString RecordBuffer;
+#endif
+};
@@ -5,6 +5,7 @@
 #include "StorageSubsystem.h"
 #include "SStorageWidget.h"
 #include "ChatSubsystem.h"
+#include "IconCacheSubsystem.h"
 #include "MMOGameInstance.h"
 #include "SocketEventRouter.h"
 #include "Audio/AudioSubsystem.h"
@@ -96,6 +97,15 @@ void UStorageSubsystem::HandleStorageOpened(const TSharedPtr<FJsonValue>& Data)
 		ParseStorageItemsFromArray(ItemsArray);
 	}
 
+	// Start streaming the icons before the grid builds so it fills in at once
+	if (UIconCacheSubsystem* Icons = UIconCacheSubsystem::Get(GetWorld()))
+	{
+		TArray<FString> IconNames;
+		IconNames.Reserve(StorageItems.Num());
+		for (const FInventoryItem& Item : StorageItems) IconNames.Add(Item.Icon);
+		Icons->PrefetchItemIcons(IconNames);
+	}
+
 	bIsOpen = true;
 	++DataVersion;
 	ShowWidget();
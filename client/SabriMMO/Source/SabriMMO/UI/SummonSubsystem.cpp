@@ -3,6 +3,7 @@
 
 #include "SummonSubsystem.h"
 #include "SSummonOverlay.h"
+#include "ScreenProjectionSubsystem.h"
 #include "MMOGameInstance.h"
 #include "SocketEventRouter.h"
 #include "Engine/World.h"
@@ -102,9 +103,8 @@ bool USummonSubsystem::ProjectWorldToScreen(const FVector& WorldPos, FVector2D&
 {
 	UWorld* World = GetWorld();
 	if (!World) return false;
-	APlayerController* PC = World->GetFirstPlayerController();
-	if (!PC) return false;
-	return PC->ProjectWorldLocationToScreen(WorldPos, OutScreenPos, false);
+	UScreenProjectionSubsystem* Projection = World->GetSubsystem<UScreenProjectionSubsystem>();
+	return Projection && Projection->ProjectPoint(WorldPos, OutScreenPos);
 }
 
 // ── Emit ─────────────────────────────────────────────────────────
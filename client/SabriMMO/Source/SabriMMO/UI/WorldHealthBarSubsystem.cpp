@@ -4,20 +4,18 @@
 
 #include "WorldHealthBarSubsystem.h"
 #include "SWorldHealthBarOverlay.h"
+#include "ScreenProjectionSubsystem.h"
 #include "EnemySubsystem.h"
 #include "MMOGameInstance.h"
 #include "SocketEventRouter.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
-#include "EngineUtils.h"
 #include "Kismet/GameplayStatics.h"
-#include "TimerManager.h"
 #include "Framework/Application/SlateApplication.h"
 #include "Widgets/SWeakWidget.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/Character.h"
 #include "Components/CapsuleComponent.h"
-#include "ShopNPC.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogWorldHealthBar, Log, All);
 
@@ -47,10 +45,10 @@ void UWorldHealthBarSubsystem::OnWorldBeginPlay(UWorld& InWorld)
 	{
 		Router->RegisterHandler(TEXT("combat:health_update"), this,
 			[this](const TSharedPtr<FJsonValue>& D) { HandleHealthUpdate(D); });
-		Router->RegisterHandler(TEXT("combat:damage"), this,
-			[this](const TSharedPtr<FJsonValue>& D) { HandleCombatDamage(D); });
-		Router->RegisterHandler(TEXT("skill:effect_damage"), this,
-			[this](const TSharedPtr<FJsonValue>& D) { HandleCombatDamage(D); });
+		Router->RegisterTypedHandler<FCombatDamageEvent>(TEXT("combat:damage"), this,
+			[this](const FCombatDamageEvent& Ev) { HandleCombatDamage(Ev); });
+		Router->RegisterTypedHandler<FCombatDamageEvent>(TEXT("skill:effect_damage"), this,
+			[this](const FCombatDamageEvent& Ev) { HandleCombatDamage(Ev); });
 		Router->RegisterHandler(TEXT("combat:death"), this,
 			[this](const TSharedPtr<FJsonValue>& D) { HandleCombatDeath(D); });
 		Router->RegisterHandler(TEXT("combat:respawn"), this,
@@ -59,31 +57,29 @@ void UWorldHealthBarSubsystem::OnWorldBeginPlay(UWorld& InWorld)
 			[this](const TSharedPtr<FJsonValue>& D) { HandlePlayerStats(D); });
 		Router->RegisterHandler(TEXT("enemy:health_update"), this,
 			[this](const TSharedPtr<FJsonValue>& D) { HandleEnemyHealthUpdate(D); });
-		Router->RegisterHandler(TEXT("enemy:spawn"), this,
-			[this](const TSharedPtr<FJsonValue>& D) { HandleEnemySpawn(D); });
-		Router->RegisterHandler(TEXT("enemy:move"), this,
-			[this](const TSharedPtr<FJsonValue>& D) { HandleEnemyMove(D); });
-		Router->RegisterHandler(TEXT("enemy:death"), this,
-			[this](const TSharedPtr<FJsonValue>& D) { HandleEnemyDeath(D); });
 	}
 
-	// Only show overlay and start caching when socket is connected (game level)
+	// Enemy spawn/death/removal come from the EnemySubsystem registry, which already
+	// owns the enemyId -> actor link (no actor searching or position matching here).
+	if (UEnemySubsystem* ES = InWorld.GetSubsystem<UEnemySubsystem>())
+	{
+		ES->OnEnemySpawned.AddUObject(this, &UWorldHealthBarSubsystem::OnEnemySpawned);
+		ES->OnEnemyDied.AddUObject(this, &UWorldHealthBarSubsystem::OnEnemyDied);
+		ES->OnEnemyRemoved.AddUObject(this, &UWorldHealthBarSubsystem::OnEnemyRemoved);
+		BoundEnemySubsystem = ES;
+
+		// Pick up anything registered before we bound
+		for (const auto& Pair : ES->GetAllEnemies())
+		{
+			OnEnemySpawned(Pair.Value);
+			if (Pair.Value.bIsDead) OnEnemyDied(Pair.Value);
+		}
+	}
+
+	// Only show overlay when socket is connected (game level)
 	if (GI->IsSocketConnected())
 	{
 		ShowOverlay();
-
-		// Start periodic actor caching (match enemy data to actual world actors for smooth position tracking)
-		InWorld.GetTimerManager().SetTimer(
-			ActorCacheTimer,
-			FTimerDelegate::CreateLambda([this]()
-			{
-				CacheEnemyActors();
-				CacheNPCActors();
-			}),
-			2.0f,
-			true,
-			0.5f  // Initial delay: let actors spawn first
-		);
 	}
 
 	UE_LOG(LogWorldHealthBar, Log, TEXT("WorldHealthBarSubsystem started — events registered via EventRouter. LocalCharId=%d"), LocalCharacterId);
@@ -93,10 +89,16 @@ void UWorldHealthBarSubsystem::Deinitialize()
 {
 	HideOverlay();
 
-	if (UWorld* World = GetWorld())
+	if (UEnemySubsystem* ES = BoundEnemySubsystem.Get())
 	{
-		World->GetTimerManager().ClearTimer(ActorCacheTimer);
+		ES->OnEnemySpawned.RemoveAll(this);
+		ES->OnEnemyDied.RemoveAll(this);
+		ES->OnEnemyRemoved.RemoveAll(this);
+	}
+	BoundEnemySubsystem.Reset();
 
+	if (UWorld* World = GetWorld())
+	{
 		if (UMMOGameInstance* GI = Cast<UMMOGameInstance>(World->GetGameInstance()))
 		{
 			if (USocketEventRouter* Router = GI->GetEventRouter())
@@ -107,6 +109,7 @@ void UWorldHealthBarSubsystem::Deinitialize()
 	}
 
 	EnemyHealthMap.Empty();
+	ActiveBarIds.Empty();
 
 	UE_LOG(LogWorldHealthBar, Log, TEXT("WorldHealthBarSubsystem deinitialized."));
 	Super::Deinitialize();
@@ -168,10 +171,9 @@ bool UWorldHealthBarSubsystem::ProjectWorldToScreen(const FVector& WorldPos, FVe
 	UWorld* World = GetWorld();
 	if (!World) return false;
 
-	APlayerController* PC = UGameplayStatics::GetPlayerController(World, 0);
-	if (!PC) return false;
-
-	return PC->ProjectWorldLocationToScreen(WorldPos, OutScreenPos, false);
+	// Shared per-frame view snapshot — no controller lookup per call
+	UScreenProjectionSubsystem* Projection = World->GetSubsystem<UScreenProjectionSubsystem>();
+	return Projection && Projection->ProjectPoint(WorldPos, OutScreenPos);
 }
 
 // ============================================================
@@ -258,57 +260,35 @@ void UWorldHealthBarSubsystem::HandleHealthUpdate(const TSharedPtr<FJsonValue>&
 	bPlayerDead     = (PlayerCurrentHP <= 0);
 }
 
-void UWorldHealthBarSubsystem::HandleCombatDamage(const TSharedPtr<FJsonValue>& Data)
+void UWorldHealthBarSubsystem::HandleCombatDamage(const FCombatDamageEvent& Ev)
 {
-	if (!Data.IsValid()) return;
-	const TSharedPtr<FJsonObject>* ObjPtr = nullptr;
-	if (!Data->TryGetObject(ObjPtr) || !ObjPtr) return;
-	const TSharedPtr<FJsonObject>& Obj = *ObjPtr;
-
-	double TargetIdD = 0;
-	Obj->TryGetNumberField(TEXT("targetId"), TargetIdD);
-	int32 TargetId = (int32)TargetIdD;
-
-	bool bIsEnemy = false;
-	Obj->TryGetBoolField(TEXT("isEnemy"), bIsEnemy);
-
-	double TH = 0, TMH = 0;
-	Obj->TryGetNumberField(TEXT("targetHealth"),    TH);
-	Obj->TryGetNumberField(TEXT("targetMaxHealth"), TMH);
+	const int32 TargetId = Ev.TargetId;
+	const int32 TH = Ev.TargetHealth;
+	const int32 TMH = Ev.TargetMaxHealth;
 
 	// Enemy target — update enemy health + position
-	if (bIsEnemy)
+	if (Ev.bIsEnemy)
 	{
 		FEnemyBarData& Enemy = EnemyHealthMap.FindOrAdd(TargetId);
 		Enemy.EnemyId = TargetId;
-		Enemy.CurrentHP = FMath::Max((int32)TH, 0);
-		if ((int32)TMH > 0) Enemy.MaxHP = (int32)TMH;
-		const bool bWasVisible = Enemy.bBarVisible;
+		Enemy.CurrentHP = FMath::Max(TH, 0);
+		if (TMH > 0) Enemy.MaxHP = TMH;
 		Enemy.bBarVisible = true;
 		Enemy.bIsDead = (Enemy.CurrentHP <= 0);
 
-		// Update position from damage event (MUST happen before eager cache)
-		double TX = 0, TY = 0, TZ = 0;
-		Obj->TryGetNumberField(TEXT("targetX"), TX);
-		Obj->TryGetNumberField(TEXT("targetY"), TY);
-		Obj->TryGetNumberField(TEXT("targetZ"), TZ);
-		if (TX != 0.0 || TY != 0.0 || TZ != 0.0)
+		// Socket position is only used until the registry links the actor
+		if (!Ev.TargetPosition.IsZero())
 		{
-			Enemy.WorldPosition = FVector((float)TX, (float)TY, (float)TZ);
+			Enemy.WorldPosition = Ev.TargetPosition;
 		}
 
-		// Eagerly cache actor on first visibility so we skip the fallback position path.
-		// WorldPosition must be set first — CacheEnemyActors skips entries with zero position.
-		if (!bWasVisible && !Enemy.CachedActor.IsValid())
-		{
-			CacheEnemyActors();
-		}
+		RefreshActiveBar(Enemy);
 	}
 	// Player target — update player HP
 	else if (LocalCharacterId > 0 && TargetId == LocalCharacterId)
 	{
-		PlayerCurrentHP = FMath::Max((int32)TH, 0);
-		if ((int32)TMH > 0) PlayerMaxHP = (int32)TMH;
+		PlayerCurrentHP = FMath::Max(TH, 0);
+		if (TMH > 0) PlayerMaxHP = TMH;
 		bPlayerDead = (PlayerCurrentHP <= 0);
 	}
 }
@@ -412,181 +392,64 @@ void UWorldHealthBarSubsystem::HandleEnemyHealthUpdate(const TSharedPtr<FJsonVal
 	if ((int32)MH > 0) Enemy.MaxHP = (int32)MH;
 	Enemy.bBarVisible = bInCombat;
 	Enemy.bIsDead = (Enemy.CurrentHP <= 0);
+	RefreshActiveBar(Enemy);
 }
 
-void UWorldHealthBarSubsystem::HandleEnemySpawn(const TSharedPtr<FJsonValue>& Data)
-{
-	if (!Data.IsValid()) return;
-	const TSharedPtr<FJsonObject>* ObjPtr = nullptr;
-	if (!Data->TryGetObject(ObjPtr) || !ObjPtr) return;
-	const TSharedPtr<FJsonObject>& Obj = *ObjPtr;
-
-	double EnemyIdD = 0;
-	Obj->TryGetNumberField(TEXT("enemyId"), EnemyIdD);
-	int32 EnemyId = (int32)EnemyIdD;
-	if (EnemyId <= 0) return;
-
-	double H = 0, MH = 0;
-	Obj->TryGetNumberField(TEXT("health"),    H);
-	Obj->TryGetNumberField(TEXT("maxHealth"), MH);
+// ============================================================
+// Enemy registry notifications — UEnemySubsystem hands us the actor
+// by id, so bars track it directly from the first frame
+// ============================================================
 
-	double X = 0, Y = 0, Z = 0;
-	Obj->TryGetNumberField(TEXT("x"), X);
-	Obj->TryGetNumberField(TEXT("y"), Y);
-	Obj->TryGetNumberField(TEXT("z"), Z);
+void UWorldHealthBarSubsystem::OnEnemySpawned(const FEnemyEntry& Entry)
+{
+	if (Entry.EnemyId <= 0) return;
 
-	FEnemyBarData& Enemy = EnemyHealthMap.FindOrAdd(EnemyId);
-	Enemy.EnemyId = EnemyId;
-	Enemy.CurrentHP = (int32)H;
-	Enemy.MaxHP = FMath::Max((int32)MH, 1);
-	Enemy.WorldPosition = FVector((float)X, (float)Y, (float)Z);
+	FEnemyBarData& Enemy = EnemyHealthMap.FindOrAdd(Entry.EnemyId);
+	Enemy.EnemyId = Entry.EnemyId;
+	Enemy.CurrentHP = (int32)Entry.Health;
+	Enemy.MaxHP = FMath::Max((int32)Entry.MaxHealth, 1);
 	Enemy.bBarVisible = false;  // Hidden by default on spawn
 	Enemy.bIsDead = false;
-	Enemy.CachedActor = nullptr; // Clear cached actor — new spawn needs fresh lookup
+	Enemy.CachedActor = Entry.Actor;
+	if (AActor* Actor = Entry.Actor.Get())
+	{
+		Enemy.WorldPosition = Actor->GetActorLocation();
+	}
+	RefreshActiveBar(Enemy);
 }
 
-void UWorldHealthBarSubsystem::HandleEnemyMove(const TSharedPtr<FJsonValue>& Data)
+void UWorldHealthBarSubsystem::OnEnemyDied(const FEnemyEntry& Entry)
 {
-	if (!Data.IsValid()) return;
-	const TSharedPtr<FJsonObject>* ObjPtr = nullptr;
-	if (!Data->TryGetObject(ObjPtr) || !ObjPtr) return;
-	const TSharedPtr<FJsonObject>& Obj = *ObjPtr;
-
-	double EnemyIdD = 0;
-	Obj->TryGetNumberField(TEXT("enemyId"), EnemyIdD);
-	int32 EnemyId = (int32)EnemyIdD;
-	if (EnemyId <= 0) return;
-
-	FEnemyBarData* Enemy = EnemyHealthMap.Find(EnemyId);
+	FEnemyBarData* Enemy = EnemyHealthMap.Find(Entry.EnemyId);
 	if (!Enemy) return;
 
-	double X = 0, Y = 0, Z = 0;
-	Obj->TryGetNumberField(TEXT("x"), X);
-	Obj->TryGetNumberField(TEXT("y"), Y);
-	Obj->TryGetNumberField(TEXT("z"), Z);
-
-	Enemy->WorldPosition = FVector((float)X, (float)Y, (float)Z);
+	Enemy->CurrentHP = 0;
+	Enemy->bIsDead = true;
+	Enemy->bBarVisible = false;
+	RefreshActiveBar(*Enemy);
 }
 
-void UWorldHealthBarSubsystem::HandleEnemyDeath(const TSharedPtr<FJsonValue>& Data)
+void UWorldHealthBarSubsystem::OnEnemyRemoved(const FEnemyEntry& Entry)
 {
-	if (!Data.IsValid()) return;
-	const TSharedPtr<FJsonObject>* ObjPtr = nullptr;
-	if (!Data->TryGetObject(ObjPtr) || !ObjPtr) return;
-	const TSharedPtr<FJsonObject>& Obj = *ObjPtr;
-
-	double EnemyIdD = 0;
-	Obj->TryGetNumberField(TEXT("enemyId"), EnemyIdD);
-	int32 EnemyId = (int32)EnemyIdD;
-	if (EnemyId <= 0) return;
-
-	FEnemyBarData* Enemy = EnemyHealthMap.Find(EnemyId);
-	if (Enemy)
-	{
-		Enemy->CurrentHP = 0;
-		Enemy->bIsDead = true;
-		Enemy->bBarVisible = false;
-		Enemy->CachedActor = nullptr; // Clear cached actor on death
-	}
+	EnemyHealthMap.Remove(Entry.EnemyId);
+	ActiveBarIds.Remove(Entry.EnemyId);
 }
 
-// ============================================================
-// Actor Caching — match enemy data entries to actual world actors
-// for smooth real-time position tracking (no socket lag)
-// ============================================================
-
-void UWorldHealthBarSubsystem::CacheEnemyActors()
+void UWorldHealthBarSubsystem::RefreshActiveBar(const FEnemyBarData& Enemy)
 {
-	UWorld* World = GetWorld();
-	if (!World) return;
-
-	// Collect enemy actors from EnemySubsystem registry (replaces class name heuristic)
-	TArray<AActor*> CandidateActors;
-	if (UEnemySubsystem* ES = World->GetSubsystem<UEnemySubsystem>())
+	if (Enemy.bBarVisible && !Enemy.bIsDead)
 	{
-		for (const auto& Pair : ES->GetAllEnemies())
-		{
-			const FEnemyEntry& Entry = Pair.Value;
-			if (Entry.bIsDead) continue;
-			AActor* Actor = Entry.Actor.Get();
-			if (Actor) CandidateActors.Add(Actor);
-		}
+		ActiveBarIds.Add(Enemy.EnemyId);
 	}
-
-	// For each enemy data entry that needs a cached actor, find the closest matching world actor
-	for (auto& Pair : EnemyHealthMap)
+	else
 	{
-		FEnemyBarData& Enemy = Pair.Value;
-
-		// Skip if already cached and still valid
-		if (Enemy.CachedActor.IsValid()) continue;
-
-		// Skip if we have no socket position to match against
-		if (Enemy.WorldPosition.IsZero()) continue;
-
-		// Find the closest candidate actor (2D distance, ignore Z differences from capsule offset)
-		AActor* BestMatch = nullptr;
-		float BestDistSq = FLT_MAX;
-		const float MaxMatchDistSq = 500.f * 500.f; // 500 UE units max match distance
-
-		for (AActor* Candidate : CandidateActors)
-		{
-			// Skip actors already claimed by another enemy entry
-			bool bAlreadyClaimed = false;
-			for (const auto& OtherPair : EnemyHealthMap)
-			{
-				if (OtherPair.Key != Pair.Key && OtherPair.Value.CachedActor.Get() == Candidate)
-				{
-					bAlreadyClaimed = true;
-					break;
-				}
-			}
-			if (bAlreadyClaimed) continue;
-
-			FVector ActorPos = Candidate->GetActorLocation();
-			// 2D distance (XY only) for matching — Z can differ due to capsule half-height
-			float DistSq = FVector::DistSquaredXY(ActorPos, Enemy.WorldPosition);
-
-			if (DistSq < BestDistSq && DistSq < MaxMatchDistSq)
-			{
-				BestDistSq = DistSq;
-				BestMatch = Candidate;
-			}
-		}
-
-		if (BestMatch)
-		{
-			Enemy.CachedActor = BestMatch;
-		}
-	}
-}
-
-// ============================================================
-// Cache NPC actors — collect all AShopNPC actors for name rendering
-// ============================================================
-
-void UWorldHealthBarSubsystem::CacheNPCActors()
-{
-	UWorld* World = GetWorld();
-	if (!World) return;
-
-	NPCNames.Empty();
-
-	for (TActorIterator<AShopNPC> It(World); It; ++It)
-	{
-		AShopNPC* NPC = *It;
-		if (!NPC) continue;
-
-		FNPCNameData Data;
-		Data.DisplayName = NPC->NPCDisplayName;
-		Data.Actor = NPC;
-		NPCNames.Add(Data);
+		ActiveBarIds.Remove(Enemy.EnemyId);
 	}
 }
 
 // ============================================================
-// Get enemy feet position — use cached actor for smooth tracking,
-// fallback to socket position if actor not cached
+// Get enemy feet position — use the linked actor for smooth tracking,
+// fallback to socket position if the registry hasn't linked one yet
 // ============================================================
 
 bool UWorldHealthBarSubsystem::GetEnemyFeetPosition(const FEnemyBarData& Enemy, FVector& OutPos) const
@@ -8,16 +8,12 @@
 #include "Subsystems/WorldSubsystem.h"
 #include "Dom/JsonValue.h"
 #include "Dom/JsonObject.h"
+#include "SocketEventTypes.h"
 #include "WorldHealthBarSubsystem.generated.h"
 
 class SWorldHealthBarOverlay;
-
-// Per-NPC name label state (screen-space text above NPC actors)
-struct FNPCNameData
-{
-	FString DisplayName;
-	TWeakObjectPtr<AActor> Actor;
-};
+class UEnemySubsystem;
+struct FEnemyEntry;
 
 // Per-enemy health bar state
 struct FEnemyBarData
@@ -27,9 +23,9 @@ struct FEnemyBarData
 	int32 MaxHP = 1;
 	bool bBarVisible = false;   // shown when enemy is in combat / damaged
 	bool bIsDead = false;
-	FVector WorldPosition = FVector::ZeroVector;
+	FVector WorldPosition = FVector::ZeroVector;   // socket position, fallback when no actor
 
-	// Cached reference to the actual enemy actor in the world.
+	// Enemy actor, linked by id from UEnemySubsystem's spawn notification.
 	// Used for real-time position tracking (smooth, no lag).
 	TWeakObjectPtr<AActor> CachedActor;
 };
@@ -47,11 +43,11 @@ public:
 	int32 PlayerMaxSP = 100;
 	bool bPlayerDead = false;
 
-	// ---- Enemy health data (keyed by enemyId) ----
+	// ---- Enemy health data (keyed by enemyId, mirrors UEnemySubsystem's registry) ----
 	TMap<int32, FEnemyBarData> EnemyHealthMap;
 
-	// ---- NPC name labels (screen-space text above NPC actors) ----
-	TArray<FNPCNameData> NPCNames;
+	// Ids whose bar is drawn (bBarVisible && !bIsDead) — the overlay iterates only these
+	const TSet<int32>& GetActiveBarIds() const { return ActiveBarIds; }
 
 	// ---- options flags (set by OptionsSubsystem) ----
 	bool bShowEnemyBars = true;
@@ -73,14 +69,19 @@ public:
 private:
 	// ---- Event handlers ----
 	void HandleHealthUpdate(const TSharedPtr<FJsonValue>& Data);
-	void HandleCombatDamage(const TSharedPtr<FJsonValue>& Data);
+	void HandleCombatDamage(const FCombatDamageEvent& Ev);
 	void HandleCombatDeath(const TSharedPtr<FJsonValue>& Data);
 	void HandleCombatRespawn(const TSharedPtr<FJsonValue>& Data);
 	void HandlePlayerStats(const TSharedPtr<FJsonValue>& Data);
 	void HandleEnemyHealthUpdate(const TSharedPtr<FJsonValue>& Data);
-	void HandleEnemySpawn(const TSharedPtr<FJsonValue>& Data);
-	void HandleEnemyMove(const TSharedPtr<FJsonValue>& Data);
-	void HandleEnemyDeath(const TSharedPtr<FJsonValue>& Data);
+
+	// ---- UEnemySubsystem registry notifications ----
+	void OnEnemySpawned(const FEnemyEntry& Entry);
+	void OnEnemyDied(const FEnemyEntry& Entry);
+	void OnEnemyRemoved(const FEnemyEntry& Entry);
+
+	// Add/remove Enemy from ActiveBarIds to match its visible/dead flags
+	void RefreshActiveBar(const FEnemyBarData& Enemy);
 
 	void PopulateFromGameInstance();
 
@@ -88,15 +89,12 @@ private:
 	void ShowOverlay();
 	void HideOverlay();
 
-	// ---- Actor caching ----
-	void CacheEnemyActors();
-	void CacheNPCActors();
-
 	// ---- State ----
 	bool bOverlayAdded = false;
 	int32 LocalCharacterId = 0;
 
-	FTimerHandle ActorCacheTimer;
+	TSet<int32> ActiveBarIds;
+	TWeakObjectPtr<UEnemySubsystem> BoundEnemySubsystem;
 
 	TSharedPtr<SWorldHealthBarOverlay> OverlayWidget;
 	TSharedPtr<SWidget> ViewportOverlay;
@@ -0,0 +1,410 @@
+// ZoneHeightfieldSubsystem.cpp — Cooked per-zone ground height grid: runtime lookup + offline cook.
+
+#include "ZoneHeightfieldSubsystem.h"
+#include "MMOGameInstance.h"
+#include "Engine/World.h"
+#include "Components/PrimitiveComponent.h"
+#include "NavigationSystem.h"
+#include "NavMesh/RecastNavMesh.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogZoneHeightfield, Log, All);
+
+DECLARE_STATS_GROUP(TEXT("ZoneHeightfield"), STATGROUP_ZoneHeightfield, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Heightfield lookups"), STAT_ZoneHeightfield_Lookups, STATGROUP_ZoneHeightfield);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Heightfield hits"), STAT_ZoneHeightfield_Hits, STATGROUP_ZoneHeightfield);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ground traces"), STAT_ZoneHeightfield_Traces, STATGROUP_ZoneHeightfield);
+
+static TAutoConsoleVariable<int32> CVarZoneHeightfieldEnable(
+	TEXT("ZoneHeightfield.Enable"),
+	1,
+	TEXT("Answer ground snaps from the cooked zone heightfield (0 = always line trace, for comparison)."),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorldAndArgs GZoneHeightfieldStatsCmd(
+	TEXT("ZoneHeightfield.Stats"),
+	TEXT("Print the loaded zone heightfield and lookup / fallback trace counts."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UZoneHeightfieldSubsystem* Sub = World ? World->GetSubsystem<UZoneHeightfieldSubsystem>() : nullptr)
+		{
+			Sub->LogStats();
+		}
+	}));
+
+#if !UE_BUILD_SHIPPING
+// Console command: CookZoneHeightfield [zone_name] [cell_size]
+static FAutoConsoleCommandWithWorldAndArgs GCookZoneHeightfieldCmd(
+	TEXT("CookZoneHeightfield"),
+	TEXT("Bake the current level's static collision into Content/SabriMMO/Heightfields/<zone>.hfield. Usage: CookZoneHeightfield [zone_name] [cell_size]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (!World) return;
+
+		FString Zone = Args.Num() > 0 ? Args[0] : FString();
+		if (Zone.IsEmpty())
+		{
+			if (UMMOGameInstance* GI = Cast<UMMOGameInstance>(World->GetGameInstance()))
+				Zone = GI->CurrentZoneName;
+		}
+		if (Zone.IsEmpty())
+		{
+			UE_LOG(LogZoneHeightfield, Error, TEXT("[Heightfield] Usage: CookZoneHeightfield <zone_name> [cell_size]"));
+			return;
+		}
+
+		const float CellSize = Args.Num() > 1 ? FCString::Atof(*Args[1]) : 50.f;
+		const FString OutputPath = UZoneHeightfieldSubsystem::GetHeightfieldPath(Zone);
+		FString Report;
+		if (UZoneHeightfieldSubsystem::Cook(World, OutputPath, CellSize, Report))
+		{
+			UE_LOG(LogZoneHeightfield, Log, TEXT("[Heightfield] %s"), *Report);
+			UZoneHeightfieldSubsystem* Sub = World->GetSubsystem<UZoneHeightfieldSubsystem>();
+			if (Sub && Sub->GetZoneName() == Zone)
+			{
+				Sub->Load(Zone);
+			}
+		}
+		else
+		{
+			UE_LOG(LogZoneHeightfield, Error, TEXT("[Heightfield] Cook failed: %s"), *Report);
+		}
+	}));
+#endif
+
+// ============================================================
+// On-disk layout (little-endian): header, float heights[NumX*NumY], uint8 flags[NumX*NumY]
+// ============================================================
+
+namespace ZoneHeightfieldFormat
+{
+	struct FHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		int32 NumX;
+		int32 NumY;
+		float OriginX;
+		float OriginY;
+		float CellSize;
+		uint32 NumFlagged;
+	};
+	static_assert(sizeof(FHeader) == 32, "Heightfield header layout changed — bump Version");
+
+	// Four corners further apart than this straddle a ledge or wall; bilinear would float or
+	// sink the sprite, so the caller traces instead
+	constexpr float MaxCornerSpread = 100.f;
+}
+
+using namespace ZoneHeightfieldFormat;
+
+// ============================================================
+// Lifecycle
+// ============================================================
+
+bool UZoneHeightfieldSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld();
+}
+
+void UZoneHeightfieldSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Each zone is its own level, so the zone name is final by the time this world starts
+	if (UMMOGameInstance* GI = Cast<UMMOGameInstance>(InWorld.GetGameInstance()))
+	{
+		Load(GI->CurrentZoneName);
+	}
+}
+
+void UZoneHeightfieldSubsystem::Deinitialize()
+{
+	Reset();
+	Super::Deinitialize();
+}
+
+void UZoneHeightfieldSubsystem::Reset()
+{
+	NumX = NumY = 0;
+	CellSize = 0.f;
+	NumFlagged = 0;
+	Heights.Empty();
+	Flags.Empty();
+}
+
+FString UZoneHeightfieldSubsystem::GetHeightfieldPath(const FString& InZoneName)
+{
+	return FPaths::ProjectContentDir() / TEXT("SabriMMO/Heightfields") / (InZoneName + TEXT(".hfield"));
+}
+
+bool UZoneHeightfieldSubsystem::Load(const FString& InZoneName)
+{
+	Reset();
+	ZoneName = InZoneName;
+	if (ZoneName.IsEmpty()) return false;
+
+	const FString Path = GetHeightfieldPath(ZoneName);
+	TArray<uint8> Bytes;
+	if (!FPlatformFileManager::Get().GetPlatformFile().FileExists(*Path) || !FFileHelper::LoadFileToArray(Bytes, *Path))
+	{
+		UE_LOG(LogZoneHeightfield, Log, TEXT("No cooked heightfield for zone '%s' — ground snaps will line trace"), *ZoneName);
+		return false;
+	}
+
+	const FHeader* H = reinterpret_cast<const FHeader*>(Bytes.GetData());
+	const int64 NumSamples = Bytes.Num() >= (int64)sizeof(FHeader) ? (int64)H->NumX * H->NumY : 0;
+	const bool bValid = NumSamples > 0
+		&& H->Magic == Magic && H->Version == Version
+		&& H->NumX > 1 && H->NumY > 1 && H->CellSize > 0.f
+		&& (int64)sizeof(FHeader) + NumSamples * (sizeof(float) + sizeof(uint8)) == Bytes.Num();
+	if (!bValid)
+	{
+		UE_LOG(LogZoneHeightfield, Warning, TEXT("Heightfield %s is invalid or from another version — re-run CookZoneHeightfield"), *Path);
+		return false;
+	}
+
+	Heights.SetNumUninitialized(NumSamples);
+	Flags.SetNumUninitialized(NumSamples);
+	const uint8* Payload = Bytes.GetData() + sizeof(FHeader);
+	FMemory::Memcpy(Heights.GetData(), Payload, NumSamples * sizeof(float));
+	FMemory::Memcpy(Flags.GetData(), Payload + NumSamples * sizeof(float), NumSamples);
+
+	NumX = H->NumX;
+	NumY = H->NumY;
+	Origin = FVector2D(H->OriginX, H->OriginY);
+	CellSize = H->CellSize;
+	NumFlagged = (int32)H->NumFlagged;
+
+	UE_LOG(LogZoneHeightfield, Log, TEXT("Loaded heightfield for '%s': %dx%d @ %.0f uu, %d flagged samples (%.1f KB)"),
+		*ZoneName, NumX, NumY, CellSize, NumFlagged, Bytes.Num() / 1024.f);
+	return true;
+}
+
+// ============================================================
+// Runtime lookup
+// ============================================================
+
+bool UZoneHeightfieldSubsystem::GetGroundZ(double X, double Y, float& OutZ)
+{
+	if (NumX == 0 || !CVarZoneHeightfieldEnable.GetValueOnGameThread()) return false;
+
+	INC_DWORD_STAT(STAT_ZoneHeightfield_Lookups);
+	++NumLookups;
+
+	const double FX = (X - Origin.X) / CellSize;
+	const double FY = (Y - Origin.Y) / CellSize;
+	if (FX < 0.0 || FY < 0.0) return false;
+
+	const int32 IX = (int32)FX;
+	const int32 IY = (int32)FY;
+	if (IX >= NumX - 1 || IY >= NumY - 1) return false;
+
+	const int32 I00 = IY * NumX + IX;
+	const int32 I10 = I00 + 1;
+	const int32 I01 = I00 + NumX;
+	const int32 I11 = I01 + 1;
+	if (Flags[I00] | Flags[I10] | Flags[I01] | Flags[I11]) return false;
+
+	const float Z00 = Heights[I00], Z10 = Heights[I10], Z01 = Heights[I01], Z11 = Heights[I11];
+	const float MinZ = FMath::Min(FMath::Min(Z00, Z10), FMath::Min(Z01, Z11));
+	const float MaxZ = FMath::Max(FMath::Max(Z00, Z10), FMath::Max(Z01, Z11));
+	if (MaxZ - MinZ > MaxCornerSpread) return false;
+
+	const float TX = (float)(FX - IX);
+	const float TY = (float)(FY - IY);
+	OutZ = FMath::Lerp(FMath::Lerp(Z00, Z10, TX), FMath::Lerp(Z01, Z11, TX), TY);
+
+	INC_DWORD_STAT(STAT_ZoneHeightfield_Hits);
+	++NumLookupHits;
+	return true;
+}
+
+bool UZoneHeightfieldSubsystem::TraceGroundZ(UWorld* World, const FVector& Loc, const FCollisionQueryParams& Params, float& OutZ)
+{
+	if (!World) return false;
+
+	INC_DWORD_STAT(STAT_ZoneHeightfield_Traces);
+	if (UZoneHeightfieldSubsystem* Sub = World->GetSubsystem<UZoneHeightfieldSubsystem>())
+	{
+		++Sub->NumTraces;
+	}
+
+	FHitResult Hit;
+	const FVector Start(Loc.X, Loc.Y, Loc.Z + 500.f);
+	const FVector End(Loc.X, Loc.Y, Loc.Z - 2000.f);
+	if (World->LineTraceSingleByChannel(Hit, Start, End, ECC_WorldStatic, Params))
+	{
+		OutZ = Hit.ImpactPoint.Z;
+		return true;
+	}
+	return false;
+}
+
+bool UZoneHeightfieldSubsystem::SampleGroundZ(UWorld* World, const FVector& Loc, float& OutZ)
+{
+	UZoneHeightfieldSubsystem* Sub = World ? World->GetSubsystem<UZoneHeightfieldSubsystem>() : nullptr;
+	return Sub && Sub->GetGroundZ(Loc.X, Loc.Y, OutZ);
+}
+
+bool UZoneHeightfieldSubsystem::FindGroundZ(UWorld* World, const FVector& Loc, const FCollisionQueryParams& Params, float& OutZ)
+{
+	return SampleGroundZ(World, Loc, OutZ) || TraceGroundZ(World, Loc, Params, OutZ);
+}
+
+void UZoneHeightfieldSubsystem::LogStats() const
+{
+	if (NumX == 0)
+	{
+		UE_LOG(LogZoneHeightfield, Log, TEXT("Zone heightfield: none loaded for '%s'; %llu fallback traces"), *ZoneName, NumTraces);
+		return;
+	}
+	UE_LOG(LogZoneHeightfield, Log,
+		TEXT("Zone heightfield '%s': %dx%d @ %.0f uu (%d flagged); %llu lookups, %llu answered (%.1f%%), %llu fallback traces%s"),
+		*ZoneName, NumX, NumY, CellSize, NumFlagged, NumLookups, NumLookupHits,
+		NumLookups ? 100.0 * NumLookupHits / NumLookups : 0.0, NumTraces,
+		CVarZoneHeightfieldEnable.GetValueOnGameThread() ? TEXT("") : TEXT(" [disabled]"));
+}
+
+// ============================================================
+// Offline cook
+// ============================================================
+
+#if !UE_BUILD_SHIPPING
+bool UZoneHeightfieldSubsystem::Cook(UWorld* World, const FString& OutputPath, float InCellSize, FString& OutReport)
+{
+	if (!World)
+	{
+		OutReport = TEXT("no world");
+		return false;
+	}
+	if (InCellSize < 10.f)
+	{
+		OutReport = FString::Printf(TEXT("cell size %.1f too small"), InCellSize);
+		return false;
+	}
+
+	// Grid covers the walkable area: the navmesh bounds (same navmesh ExportNavMesh writes)
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World);
+	ARecastNavMesh* NavMesh = NavSys ? Cast<ARecastNavMesh>(NavSys->GetDefaultNavDataInstance(FNavigationSystem::DontCreate)) : nullptr;
+	const FBox Bounds = NavMesh ? NavMesh->GetNavMeshBounds() : FBox(ForceInit);
+	if (!Bounds.IsValid)
+	{
+		OutReport = TEXT("no RecastNavMesh bounds — build the navmesh for this level first");
+		return false;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	const FVector2D GridOrigin(Bounds.Min.X - InCellSize, Bounds.Min.Y - InCellSize);
+	const int32 GridX = FMath::CeilToInt32((Bounds.Max.X - GridOrigin.X) / InCellSize) + 2;
+	const int32 GridY = FMath::CeilToInt32((Bounds.Max.Y - GridOrigin.Y) / InCellSize) + 2;
+	const double TopZ = Bounds.Max.Z + 1000.0;
+	const double BottomZ = Bounds.Min.Z - 1000.0;
+
+	// Surfaces closer than this collapse into one (stairs, decals on terrain); further apart a
+	// character fits between them and the sample is multi-level
+	constexpr float MinLayerGap = 200.f;
+	constexpr int32 MaxProbes = 16;
+
+	TArray<float> OutHeights;
+	TArray<uint8> OutFlags;
+	OutHeights.SetNumZeroed(GridX * GridY);
+	OutFlags.SetNumZeroed(GridX * GridY);
+
+	// Match the runtime ground trace (simple collision, WorldStatic) but keep going through
+	// each hit so stacked surfaces are found
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(ZoneHeightfieldCook), false);
+	uint32 NumFlaggedOut = 0;
+	int64 NumTracesOut = 0;
+
+	for (int32 IY = 0; IY < GridY; ++IY)
+	{
+		for (int32 IX = 0; IX < GridX; ++IX)
+		{
+			const double X = GridOrigin.X + IX * InCellSize;
+			const double Y = GridOrigin.Y + IY * InCellSize;
+
+			float TopSurface = 0.f;
+			float LastSurface = 0.f;
+			int32 NumSurfaces = 0;
+			double StartZ = TopZ;
+
+			for (int32 Probe = 0; Probe < MaxProbes && StartZ > BottomZ; ++Probe)
+			{
+				FHitResult Hit;
+				++NumTracesOut;
+				if (!World->LineTraceSingleByChannel(Hit, FVector(X, Y, StartZ), FVector(X, Y, BottomZ), ECC_WorldStatic, Params))
+					break;
+
+				// Movable actors (NPC capsules, placeholders) aren't ground
+				const UPrimitiveComponent* Comp = Hit.GetComponent();
+				const bool bStaticGround = Comp && Comp->Mobility == EComponentMobility::Static && !Hit.bStartPenetrating;
+				if (bStaticGround)
+				{
+					const float Z = (float)Hit.ImpactPoint.Z;
+					if (NumSurfaces == 0)
+					{
+						TopSurface = Z;
+						LastSurface = Z;
+						NumSurfaces = 1;
+					}
+					else if (LastSurface - Z >= MinLayerGap)
+					{
+						LastSurface = Z;
+						++NumSurfaces;
+					}
+				}
+
+				// Step below the hit (further when starting inside a body) and continue
+				StartZ = Hit.ImpactPoint.Z - (Hit.bStartPenetrating ? 50.0 : 5.0);
+			}
+
+			const int32 Index = IY * GridX + IX;
+			OutHeights[Index] = TopSurface;
+			if (NumSurfaces == 0)
+			{
+				OutFlags[Index] = Sample_NoGround;
+			}
+			else if (NumSurfaces > 1)
+			{
+				OutFlags[Index] = Sample_MultiLevel;
+			}
+			if (OutFlags[Index]) ++NumFlaggedOut;
+		}
+	}
+
+	FHeader Header;
+	Header.Magic = Magic;
+	Header.Version = Version;
+	Header.NumX = GridX;
+	Header.NumY = GridY;
+	Header.OriginX = (float)GridOrigin.X;
+	Header.OriginY = (float)GridOrigin.Y;
+	Header.CellSize = InCellSize;
+	Header.NumFlagged = NumFlaggedOut;
+
+	TArray<uint8> Bytes;
+	Bytes.Reserve(sizeof(FHeader) + OutHeights.Num() * sizeof(float) + OutFlags.Num());
+	Bytes.Append(reinterpret_cast<const uint8*>(&Header), sizeof(FHeader));
+	Bytes.Append(reinterpret_cast<const uint8*>(OutHeights.GetData()), OutHeights.Num() * sizeof(float));
+	Bytes.Append(OutFlags.GetData(), OutFlags.Num());
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree(*FPaths::GetPath(OutputPath));
+	if (!FFileHelper::SaveArrayToFile(Bytes, *OutputPath))
+	{
+		OutReport = FString::Printf(TEXT("could not write %s"), *OutputPath);
+		return false;
+	}
+
+	OutReport = FString::Printf(TEXT("Wrote %s: %dx%d samples @ %.0f uu, %u flagged (%.1f%%), %lld probe traces, %.1f KB in %.1f s"),
+		*OutputPath, GridX, GridY, InCellSize, NumFlaggedOut, 100.0 * NumFlaggedOut / (GridX * GridY),
+		NumTracesOut, Bytes.Num() / 1024.f, FPlatformTime::Seconds() - StartTime);
+	return true;
+}
+#endif
@@ -0,0 +1,87 @@
+// ZoneHeightfieldSubsystem.h — Per-zone 2D ground height grid for sprite / item ground snapping.
+//
+// Server-moved sprite enemies used to fire a 2500-unit downward line trace every tick, and
+// every ground item drop fired two more. CookZoneHeightfield bakes the zone's static
+// collision once, offline, into Content/SabriMMO/Heightfields/<zone>.hfield: a grid of
+// ground heights over the navmesh bounds, with samples flagged where there is no ground or
+// more than one standable surface (bridges, overhangs, tree canopies). The file is loaded
+// when the zone's world begins play and GetGroundZ answers with a bilinear lookup.
+//
+// Flagged cells, cells straddling a cliff, and zones without a cooked file fall back to the
+// same line trace as before (TraceGroundZ), so a missing or stale cook only costs speed.
+//   CookZoneHeightfield [zone_name] [cell_size]
+// "stat ZoneHeightfield" shows lookups and fallback traces per frame.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ZoneHeightfieldSubsystem.generated.h"
+
+struct FCollisionQueryParams;
+
+UCLASS()
+class SABRIMMO_API UZoneHeightfieldSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static constexpr uint32 Magic = 0x444C4648;   // 'HFLD'
+	static constexpr uint32 Version = 1;
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	static FString GetHeightfieldPath(const FString& ZoneName);
+
+	/** Ground Z under (X, Y) from the cooked grid. False when the grid can't answer (caller traces). */
+	bool GetGroundZ(double X, double Y, float& OutZ);
+
+	/** Downward WorldStatic trace from Loc.Z + 500 to Loc.Z - 2000 (the original ground snap) */
+	static bool TraceGroundZ(UWorld* World, const FVector& Loc, const FCollisionQueryParams& Params, float& OutZ);
+
+	/** Heightfield lookup for World's zone only (no trace) */
+	static bool SampleGroundZ(UWorld* World, const FVector& Loc, float& OutZ);
+
+	/** SampleGroundZ, else TraceGroundZ */
+	static bool FindGroundZ(UWorld* World, const FVector& Loc, const FCollisionQueryParams& Params, float& OutZ);
+
+	bool IsLoaded() const { return NumX > 0; }
+	const FString& GetZoneName() const { return ZoneName; }
+
+	/** Load (or reload after a cook) the grid for ZoneName */
+	bool Load(const FString& InZoneName);
+
+	void LogStats() const;
+
+#if !UE_BUILD_SHIPPING
+	/** Probe World's static collision over its navmesh bounds and write the grid to OutputPath */
+	static bool Cook(UWorld* World, const FString& OutputPath, float CellSize, FString& OutReport);
+#endif
+
+private:
+	enum ESampleFlags : uint8
+	{
+		Sample_NoGround   = 1 << 0,   // nothing standable under this sample
+		Sample_MultiLevel = 1 << 1,   // two or more standable surfaces — height depends on the caller's Z
+	};
+
+	void Reset();
+
+	FString ZoneName;
+
+	// Grid of NumX * NumY samples; sample (ix, iy) sits at Origin + (ix, iy) * CellSize
+	FVector2D Origin = FVector2D::ZeroVector;
+	float CellSize = 0.f;
+	int32 NumX = 0;
+	int32 NumY = 0;
+	TArray<float> Heights;
+	TArray<uint8> Flags;
+	int32 NumFlagged = 0;
+
+	// Lifetime counters for ZoneHeightfield.Stats
+	uint64 NumLookups = 0;
+	uint64 NumLookupHits = 0;
+	uint64 NumTraces = 0;
+};
@@ -157,16 +157,9 @@ void UZonePreloadSubsystem::RequestClassPreload(const FString& SpriteClass)
 	FResolvedClass& Resolved = ClassPathsCache.FindOrAdd(SpriteClass);
 	if (Resolved.AssetPaths.Num() == 0)
 	{
-		FString ManifestPath = FindClassManifestPath(SpriteClass);
-		if (ManifestPath.IsEmpty())
+		if (!ResolveAssetPaths(FSpriteClassCache::Get().FindOrLoadBody(SpriteClass), Resolved))
 		{
-			UE_LOG(LogZonePreload, Warning, TEXT("No manifest found for class '%s'"),
-				*SpriteClass);
-			return;
-		}
-		if (!ResolveAssetPaths(ManifestPath, Resolved))
-		{
-			UE_LOG(LogZonePreload, Warning, TEXT("Failed to parse manifest for '%s'"),
+			UE_LOG(LogZonePreload, Warning, TEXT("No usable manifest for class '%s'"),
 				*SpriteClass);
 			return;
 		}
@@ -205,14 +198,13 @@ void UZonePreloadSubsystem::RequestLayerPreload(ESpriteLayer Layer, int32 ViewSp
 	FResolvedClass& Resolved = ClassPathsCache.FindOrAdd(Key);
 	if (Resolved.AssetPaths.Num() == 0)
 	{
-		FString ManifestPath = FindLayerManifestPath(Layer, ViewSpriteId, GenderSubDir);
-		if (ManifestPath.IsEmpty())
+		FSpriteClassDefinitionPtr Definition = FSpriteClassCache::Get().FindOrLoadLayer(Layer, ViewSpriteId, GenderSubDir);
+		if (!ResolveAssetPaths(Definition, Resolved))
 		{
 			UE_LOG(LogZonePreload, Warning, TEXT("No layer manifest for %s view=%d gender='%s'"),
 				*ASpriteCharacterActor::GetLayerSubDir(Layer), ViewSpriteId, *GenderSubDir);
 			return;
 		}
-		if (!ResolveAssetPaths(ManifestPath, Resolved)) return;
 	}
 
 	TSharedPtr<FStreamableHandle> Handle = StartAsyncLoad(Key, Resolved);
@@ -257,9 +249,7 @@ void UZonePreloadSubsystem::PinClass(const FString& SpriteClass)
 	FResolvedClass& Resolved = ClassPathsCache.FindOrAdd(SpriteClass);
 	if (Resolved.AssetPaths.Num() == 0)
 	{
-		FString ManifestPath = FindClassManifestPath(SpriteClass);
-		if (ManifestPath.IsEmpty()) return;
-		if (!ResolveAssetPaths(ManifestPath, Resolved)) return;
+		if (!ResolveAssetPaths(FSpriteClassCache::Get().FindOrLoadBody(SpriteClass), Resolved)) return;
 	}
 
 	TSharedPtr<FStreamableHandle> Handle = StartAsyncLoad(SpriteClass, Resolved);
@@ -323,108 +313,14 @@ int32 UZonePreloadSubsystem::GetResidentClassCount() const
 // Manifest resolution
 // ============================================================
 
-FString UZonePreloadSubsystem::FindClassManifestPath(const FString& SpriteClass) const
-{
-	const FString BodyRoot = FPaths::ProjectContentDir() / TEXT("SabriMMO/Sprites/Atlases/Body");
-	const FString ManifestFileName = FString::Printf(TEXT("%s_manifest.json"), *SpriteClass);
-
-	// Search order matches SpriteCharacterActor::SetBodyClass(FString):
-	//   1. Body/{class}/         (player classes)
-	//   2. Body/enemies/{class}/ (enemies)
-	//   3. Body/                 (legacy flat)
-	const TArray<FString> CandidateDirs = {
-		BodyRoot / SpriteClass,
-		BodyRoot / TEXT("enemies") / SpriteClass,
-		BodyRoot,
-	};
-
-	IPlatformFile& PF = FPlatformFileManager::Get().GetPlatformFile();
-	for (const FString& Dir : CandidateDirs)
-	{
-		const FString Candidate = Dir / ManifestFileName;
-		if (PF.FileExists(*Candidate))
-			return Candidate;
-	}
-	return FString();
-}
-
-FString UZonePreloadSubsystem::FindLayerManifestPath(ESpriteLayer Layer, int32 ViewSpriteId,
-                                                     const FString& GenderSubDir) const
-{
-	const FString SubDir = ASpriteCharacterActor::GetLayerSubDir(Layer);
-	if (SubDir.IsEmpty()) return FString();
-
-	const FString LayerRoot = FPaths::ProjectContentDir() / TEXT("SabriMMO/Sprites/Atlases") / SubDir;
-	const FString BaseName = FString::Printf(TEXT("%s_%d"), *SubDir.ToLower(), ViewSpriteId);
-	const FString ManifestFileName = FString::Printf(TEXT("%s_manifest.json"), *BaseName);
-
-	IPlatformFile& PF = FPlatformFileManager::Get().GetPlatformFile();
-
-	// Same search order as SpriteCharacterActor::LoadEquipmentLayer:
-	//   1. Each item subdir + gender subfolder (e.g., Weapon/dagger/female/)
-	//   2. Item subdir directly (Weapon/dagger/)
-	//   3. Layer root flat (Weapon/)
-	TArray<FString> SubDirs;
-	IFileManager::Get().FindFiles(SubDirs, *(LayerRoot / TEXT("*")), false, true);
-	for (const FString& SD : SubDirs)
-	{
-		const FString ItemDir = LayerRoot / SD;
-
-		if (!GenderSubDir.IsEmpty())
-		{
-			const FString GenderPath = ItemDir / GenderSubDir / ManifestFileName;
-			if (PF.FileExists(*GenderPath)) return GenderPath;
-		}
-
-		const FString FlatPath = ItemDir / ManifestFileName;
-		if (PF.FileExists(*FlatPath)) return FlatPath;
-	}
-
-	const FString RootPath = LayerRoot / ManifestFileName;
-	if (PF.FileExists(*RootPath)) return RootPath;
-
-	return FString();
-}
-
-bool UZonePreloadSubsystem::ResolveAssetPaths(const FString& ManifestPath,
+bool UZonePreloadSubsystem::ResolveAssetPaths(const FSpriteClassDefinitionPtr& Definition,
                                               FResolvedClass& OutResolved) const
 {
-	FString JsonStr;
-	if (!FFileHelper::LoadFileToString(JsonStr, *ManifestPath))
-		return false;
-
-	TSharedPtr<FJsonObject> Root;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonStr);
-	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
-		return false;
-
-	const TArray<TSharedPtr<FJsonValue>>* AtlasArr;
-	if (!Root->TryGetArrayField(TEXT("atlases"), AtlasArr))
+	// Manifest search + JSON parsing are shared with ASpriteCharacterActor via FSpriteClassCache
+	if (!Definition.IsValid())
 		return false;
 
-	const FString JsonDir = FPaths::GetPath(ManifestPath);
-	const FString ContentBase = FPaths::ProjectContentDir() / TEXT("SabriMMO/Sprites/Atlases");
-	FString AssetSubPath = TEXT("Body");
-	if (JsonDir.StartsWith(ContentBase))
-		AssetSubPath = JsonDir.Mid(ContentBase.Len() + 1);
-
-	OutResolved.AssetPaths.Reserve(AtlasArr->Num());
-
-	for (const TSharedPtr<FJsonValue>& Val : *AtlasArr)
-	{
-		const TSharedPtr<FJsonObject>& AtlasObj = Val->AsObject();
-		if (!AtlasObj.IsValid()) continue;
-
-		FString FileName = AtlasObj->GetStringField(TEXT("file"));
-		if (FileName.IsEmpty()) continue;
-
-		// /Game/SabriMMO/Sprites/Atlases/<sub>/<file>.<file>
-		const FString PackagePath = FString::Printf(
-			TEXT("/Game/SabriMMO/Sprites/Atlases/%s/%s.%s"),
-			*AssetSubPath, *FileName, *FileName);
-
-		OutResolved.AssetPaths.Add(FSoftObjectPath(PackagePath));
-	}
+	OutResolved.AssetPaths = Definition->AssetPaths;
 
 	// Rough estimate: ~21 MB per atlas at current settings (BC7 + future mips).
 	// This drives LRU eviction decisions; precise accounting isn't required.
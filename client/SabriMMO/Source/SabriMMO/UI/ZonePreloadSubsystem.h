@@ -15,6 +15,7 @@
 #include "Engine/StreamableManager.h"
 #include "UObject/SoftObjectPath.h"
 #include "Sprite/SpriteAtlasData.h"
+#include "Sprite/SpriteClassCache.h"
 #include "Dom/JsonValue.h"
 #include "ZonePreloadSubsystem.generated.h"
 
@@ -103,7 +104,7 @@ private:
 	TSet<FString> InFlightClasses;
 	int32 InFlightCount = 0;
 
-	// ---- Cached parsed manifests (avoid re-parsing JSON for same class) ----
+	// ---- Preload lists per class key (manifests themselves live in FSpriteClassCache) ----
 	struct FResolvedClass
 	{
 		TArray<FSoftObjectPath> AssetPaths;
@@ -113,15 +114,8 @@ private:
 
 	// ---- Internal helpers ----
 
-	/** Locate the manifest file for a sprite class (Body subdirs + enemies/). */
-	FString FindClassManifestPath(const FString& SpriteClass) const;
-
-	/** Locate the manifest for an equipment layer (Weapon/<item>/<gender>/). */
-	FString FindLayerManifestPath(ESpriteLayer Layer, int32 ViewSpriteId,
-	                              const FString& GenderSubDir) const;
-
-	/** Parse manifest JSON, derive list of FSoftObjectPath for every atlas. */
-	bool ResolveAssetPaths(const FString& ManifestPath, FResolvedClass& OutResolved) const;
+	/** Copy the atlas FSoftObjectPaths of a cached sprite definition + estimate their size. */
+	bool ResolveAssetPaths(const FSpriteClassDefinitionPtr& Definition, FResolvedClass& OutResolved) const;
 
 	/** Start the async load for a resolved class. Returns the handle. */
 	TSharedPtr<FStreamableHandle> StartAsyncLoad(const FString& ClassKey,
@@ -4,6 +4,7 @@
 
 #include "ZoneTransitionSubsystem.h"
 #include "ZonePreloadSubsystem.h"
+#include "ActorPoolSubsystem.h"
 #include "MMOGameInstance.h"
 #include "SocketEventRouter.h"
 #include "Audio/AudioSubsystem.h"
@@ -513,7 +514,13 @@ void UZoneTransitionSubsystem::WaitForPreloadAndHideOverlay()
 			if (!W) return;
 
 			UZonePreloadSubsystem* Preload = W->GetSubsystem<UZonePreloadSubsystem>();
-			const bool bAnyInFlight = Preload && Preload->IsLoadingInProgress();
+			UActorPoolSubsystem* Pool = W->GetSubsystem<UActorPoolSubsystem>();
+			UAudioSubsystem* Audio = W->GetSubsystem<UAudioSubsystem>();
+			// Pooled enemy sprites from zone:spawn_manifest are built behind the overlay too,
+			// and so is the zone's monster / ambient sound set
+			const bool bAnyInFlight = (Preload && Preload->IsLoadingInProgress())
+				|| (Pool && Pool->IsPrewarming())
+				|| (Audio && Audio->IsPreloadInProgress());
 			const double Now = FPlatformTime::Seconds();
 			const double ElapsedSinceStart = Now - PreloadWaitStartTime;
 
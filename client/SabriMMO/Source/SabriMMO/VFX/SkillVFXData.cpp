@@ -1,12 +1,13 @@
 // SkillVFXData.cpp — Skill VFX config registry.
-// Rebuilt every call (no static caching) so Live Coding patches take effect immediately.
+// Built once on first lookup into a dense table indexed by skill id. Edits take effect
+// after `SkillVFX.Reload` or automatically when a Live Coding patch completes.
 //
 // ===== HOW TO ADD A NEW SKILL VFX =====
 //
 // 1. Copy any existing block below (pick one with a similar template type)
 // 2. Change the SkillId and comment
 // 3. Set only the fields that differ from defaults — everything else is already sensible
-// 4. Run PIE — check LogSkillVFX output for asset load warnings
+// 4. Run PIE (or Live Coding + SkillVFX.Reload) — check LogSkillVFX output for asset load warnings
 //
 // Template types:
 //   BoltFromSky     — N bolts strike from above (Cold/Fire/Lightning Bolt)
@@ -47,6 +48,14 @@
 //
 
 #include "SkillVFXData.h"
+#include "HAL/IConsoleManager.h"
+#include "Modules/ModuleManager.h"
+
+#if WITH_LIVE_CODING
+#include "ILiveCodingModule.h"
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogSkillVFXData, Log, All);
 
 // Helper: create a config with just the required fields, everything else defaults.
 // Use named-field style: set C.Field = value for anything non-default.
@@ -1150,17 +1159,134 @@ static TMap<int32, FSkillVFXConfig> BuildSkillVFXConfigs()
 	return Configs;
 }
 
+// ============================================================
+// Registry — immutable, dense by skill id
+// ============================================================
+
+namespace
+{
+	/** Built once from BuildSkillVFXConfigs(). Lookups are one bounds check + two array reads. */
+	struct FSkillVFXRegistry
+	{
+		TArray<FSkillVFXConfig> Configs;
+		/** Skill id -> index into Configs + 1 (0 = no VFX). Sized to the highest configured id. */
+		TArray<uint16> IndexBySkillId;
+
+		FSkillVFXRegistry()
+		{
+			TMap<int32, FSkillVFXConfig> Built = BuildSkillVFXConfigs();
+			Built.KeySort(TLess<int32>());
+
+			int32 MaxSkillId = 0;
+			for (const auto& Pair : Built)
+			{
+				if (Pair.Key > 0) MaxSkillId = FMath::Max(MaxSkillId, Pair.Key);
+			}
+			IndexBySkillId.SetNumZeroed(MaxSkillId + 1);
+			Configs.Reserve(Built.Num());
+			for (auto& Pair : Built)
+			{
+				if (Pair.Key <= 0) continue;
+				IndexBySkillId[Pair.Key] = uint16(Configs.Add(MoveTemp(Pair.Value)) + 1);
+			}
+		}
+
+		const FSkillVFXConfig* Find(int32 SkillId) const
+		{
+			if (!IndexBySkillId.IsValidIndex(SkillId)) return nullptr;
+			const uint16 Slot = IndexBySkillId[SkillId];
+			return Slot ? &Configs[Slot - 1] : nullptr;
+		}
+	};
+
+	TUniquePtr<FSkillVFXRegistry> GRegistry;
+
+	/** Registries replaced by a reload. Kept alive so config references handed out
+	 *  before the reload (e.g. held across a bolt timer) never dangle. Dev-only path. */
+	TArray<TUniquePtr<FSkillVFXRegistry>> GRetiredRegistries;
+
+	const FSkillVFXRegistry& GetRegistry()
+	{
+		if (!GRegistry)
+		{
+			GRegistry = MakeUnique<FSkillVFXRegistry>();
+
+#if WITH_LIVE_CODING
+			// BuildSkillVFXConfigs may have been patched — pick up the edits
+			if (ILiveCodingModule* LiveCoding = FModuleManager::GetModulePtr<ILiveCodingModule>(LIVE_CODING_MODULE_NAME))
+			{
+				static bool bHooked = false;
+				if (!bHooked)
+				{
+					bHooked = true;
+					LiveCoding->GetOnPatchCompleteDelegate().AddStatic(&SkillVFXDataHelper::ReloadSkillVFXConfigs);
+				}
+			}
+#endif
+		}
+		return *GRegistry;
+	}
+}
+
+static FAutoConsoleCommand GSkillVFXReloadCmd(
+	TEXT("SkillVFX.Reload"),
+	TEXT("Rebuild the skill VFX config registry (after editing SkillVFXData.cpp via Live Coding)."),
+	FConsoleCommandDelegate::CreateStatic(&SkillVFXDataHelper::ReloadSkillVFXConfigs));
+
+// Console command: SkillVFX.Bench [iterations] — per-lookup cost, registry vs. full rebuild
+static FAutoConsoleCommand GSkillVFXBenchCmd(
+	TEXT("SkillVFX.Bench"),
+	TEXT("Time GetSkillVFXConfig per lookup against the old rebuild-per-call path. Usage: SkillVFX.Bench [iterations]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const int32 Iterations = FMath::Max(1, Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 100000);
+		static const int32 SkillIds[] = { 19, 20, 21, 83, 89, 90, 91, 2, 5, 28, 1806, 99999 };
+		constexpr int32 NumIds = UE_ARRAY_COUNT(SkillIds);
+
+		SkillVFXDataHelper::GetSkillVFXConfig(0);  // build outside the timed loop
+
+		uint64 Checksum = 0;
+		double Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			Checksum += uint64(SkillVFXDataHelper::GetSkillVFXConfig(SkillIds[i % NumIds]).Template);
+		}
+		const double RegistrySeconds = FPlatformTime::Seconds() - Start;
+
+		// Old behaviour rebuilt the whole table each call — far slower, so fewer runs
+		const int32 RebuildIterations = FMath::Clamp(Iterations / 1000, 10, 1000);
+		Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < RebuildIterations; ++i)
+		{
+			const TMap<int32, FSkillVFXConfig> Configs = BuildSkillVFXConfigs();
+			if (const FSkillVFXConfig* Found = Configs.Find(SkillIds[i % NumIds]))
+				Checksum += uint64(Found->Template);
+		}
+		const double RebuildSeconds = FPlatformTime::Seconds() - Start;
+
+		const double RegistryNs = RegistrySeconds * 1e9 / Iterations;
+		const double RebuildNs = RebuildSeconds * 1e9 / RebuildIterations;
+		UE_LOG(LogSkillVFXData, Log,
+			TEXT("SkillVFX.Bench: registry %.1f ns/lookup (%d runs) | rebuild-per-call %.1f us/lookup (%d runs) | %.0fx faster [checksum %llu]"),
+			RegistryNs, Iterations, RebuildNs / 1000.0, RebuildIterations,
+			RegistryNs > 0.0 ? RebuildNs / RegistryNs : 0.0, Checksum);
+	}));
+
 const FSkillVFXConfig& SkillVFXDataHelper::GetSkillVFXConfig(int32 SkillId)
 {
-	// Rebuild every call so Live Coding patches pick up changes immediately.
-	// This only runs on skill events (not per-frame), so cost is negligible.
-	static TMap<int32, FSkillVFXConfig> Configs = BuildSkillVFXConfigs();
-	Configs = BuildSkillVFXConfigs();
+	static const FSkillVFXConfig EmptyConfig;
+	const FSkillVFXConfig* Found = GetRegistry().Find(SkillId);
+	return Found ? *Found : EmptyConfig;
+}
 
-	static FSkillVFXConfig EmptyConfig;
-	if (const FSkillVFXConfig* Found = Configs.Find(SkillId))
+void SkillVFXDataHelper::ReloadSkillVFXConfigs()
+{
+	check(IsInGameThread());
+	if (GRegistry)
 	{
-		return *Found;
+		GRetiredRegistries.Add(MoveTemp(GRegistry));
 	}
-	return EmptyConfig;
+	GRegistry = MakeUnique<FSkillVFXRegistry>();
+	UE_LOG(LogSkillVFXData, Log, TEXT("Skill VFX registry rebuilt: %d configs, table size %d"),
+		GRegistry->Configs.Num(), GRegistry->IndexBySkillId.Num());
 }
@@ -128,6 +128,10 @@ namespace SkillVFXDataHelper
 		return FLinearColor(0.3f, 0.8f, 1.0f, 1.0f); // neutral / default cyan
 	}
 
-	/** Declared in header, defined in SkillVFXData.cpp to avoid Live Coding issues with inline statics. */
+	/** Declared in header, defined in SkillVFXData.cpp to avoid Live Coding issues with inline statics.
+	 *  The registry is built on first call; returned references stay valid for the process lifetime. */
 	const FSkillVFXConfig& GetSkillVFXConfig(int32 SkillId);
+
+	/** Rebuild the registry from SkillVFXData.cpp (SkillVFX.Reload, or automatically after a Live Coding patch). */
+	void ReloadSkillVFXConfigs();
 }
@@ -0,0 +1,335 @@
+// SkillVFXPool.cpp — Pooled one-shot Niagara/Cascade components (see header).
+
+#include "SkillVFXPool.h"
+#include "NiagaraComponent.h"
+#include "NiagaraSystem.h"
+#include "Particles/ParticleSystem.h"
+#include "Particles/ParticleSystemComponent.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSkillVFXPool, Log, All);
+
+static TAutoConsoleVariable<int32> CVarSkillVFXPoolMaxLive(
+	TEXT("SkillVFX.PoolMaxLive"),
+	96,
+	TEXT("Hard cap on simultaneously active pooled skill VFX components (all templates)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarSkillVFXPoolMaxIdle(
+	TEXT("SkillVFX.PoolMaxIdle"),
+	16,
+	TEXT("Idle components kept per VFX template; extras are destroyed on release."),
+	ECVF_Default);
+
+// ============================================================
+// FSkillVFXHandle
+// ============================================================
+
+UFXSystemComponent* FSkillVFXHandle::Get() const
+{
+	const USkillVFXComponentPool* P = Pool.Get();
+	return P ? P->Resolve(*this) : nullptr;
+}
+
+void FSkillVFXHandle::Release() const
+{
+	if (UFXSystemComponent* Comp = Get())
+	{
+		Pool->Release(Comp);
+	}
+}
+
+// ============================================================
+// Lifecycle
+// ============================================================
+
+void USkillVFXComponentPool::Initialize(UWorld* InWorld)
+{
+	World = InWorld;
+}
+
+void USkillVFXComponentPool::Shutdown()
+{
+	// DeactivateImmediate fires OnSystemFinished -> Release(), which can reshape the entry
+	// arrays. Take the components out first so that Release finds nothing to touch.
+	TArray<UFXSystemComponent*> Components;
+	for (const auto& Pair : Pools)
+	{
+		for (const FSkillVFXPoolEntry& Entry : Pair.Value.Entries)
+		{
+			Components.Add(Entry.Component);
+		}
+	}
+	Pools.Empty();
+	TotalLive = 0;
+
+	for (UFXSystemComponent* Comp : Components)
+	{
+		if (IsValid(Comp))
+		{
+			Comp->DeactivateImmediate();
+			Comp->DestroyComponent();
+		}
+	}
+}
+
+// ============================================================
+// Acquire / release
+// ============================================================
+
+UFXSystemComponent* USkillVFXComponentPool::CreateComponent(UFXSystemAsset* Template)
+{
+	UWorld* W = World.Get();
+	if (!W) return nullptr;
+
+	UFXSystemComponent* Comp = nullptr;
+	if (UNiagaraSystem* NiagaraSystem = Cast<UNiagaraSystem>(Template))
+	{
+		UNiagaraComponent* NC = NewObject<UNiagaraComponent>(W);
+		NC->SetAutoActivate(false);
+		NC->SetAutoDestroy(false);
+		NC->SetAsset(NiagaraSystem);
+		NC->OnSystemFinished.AddUniqueDynamic(this, &USkillVFXComponentPool::OnNiagaraFinished);
+		Comp = NC;
+	}
+	else if (UParticleSystem* CascadeSystem = Cast<UParticleSystem>(Template))
+	{
+		UParticleSystemComponent* PSC = NewObject<UParticleSystemComponent>(W);
+		PSC->bAutoActivate = false;
+		PSC->bAutoDestroy = false;
+		PSC->SetTemplate(CascadeSystem);
+		PSC->OnSystemFinished.AddUniqueDynamic(this, &USkillVFXComponentPool::OnCascadeFinished);
+		Comp = PSC;
+	}
+	if (!Comp) return nullptr;
+
+	Comp->RegisterComponentWithWorld(W);
+	return Comp;
+}
+
+FSkillVFXHandle USkillVFXComponentPool::Acquire(UFXSystemAsset* Template, const FVector& Location,
+	const FRotator& Rotation, const FVector& Scale, ESkillVFXPriority Priority)
+{
+	FSkillVFXHandle Handle;
+	if (!Template || !World.IsValid()) return Handle;
+
+	if (TotalLive >= FMath::Max(1, CVarSkillVFXPoolMaxLive.GetValueOnGameThread()) && !EvictFor(Priority))
+	{
+		++NumRejected;
+		return Handle;
+	}
+
+	FSkillVFXTemplatePool& Pool = Pools.FindOrAdd(Template);
+	const double Now = FPlatformTime::Seconds();
+
+	// Spawned-per-second window
+	++Pool.WindowAcquires;
+	if (Now - Pool.WindowStart >= 1.0)
+	{
+		Pool.AcquiresPerSecond = Pool.WindowStart > 0.0 ? float(Pool.WindowAcquires / (Now - Pool.WindowStart)) : 0.f;
+		Pool.WindowAcquires = 0;
+		Pool.WindowStart = Now;
+	}
+
+	// Drop components destroyed behind our back (level streaming, world teardown)
+	for (int32 i = Pool.Entries.Num() - 1; i >= 0; --i)
+	{
+		if (!IsValid(Pool.Entries[i].Component))
+		{
+			if (Pool.Entries[i].bInUse) { --Pool.NumLive; --TotalLive; }
+			Pool.Entries.RemoveAtSwap(i);
+		}
+	}
+
+	FSkillVFXPoolEntry* Entry = Pool.Entries.FindByPredicate(
+		[](const FSkillVFXPoolEntry& E) { return !E.bInUse; });
+
+	if (Entry)
+	{
+		++Pool.NumReused;
+	}
+	else
+	{
+		UFXSystemComponent* Comp = CreateComponent(Template);
+		if (!Comp) return Handle;
+		++Pool.NumCreated;
+		Entry = &Pool.Entries.AddDefaulted_GetRef();
+		Entry->Component = Comp;
+	}
+
+	Entry->bInUse = true;
+	Entry->AcquireTime = Now;
+	Entry->Priority = Priority;
+	++Pool.NumLive;
+	++TotalLive;
+
+	UFXSystemComponent* Comp = Entry->Component;
+	Comp->SetWorldLocationAndRotation(Location, Rotation);
+	Comp->SetWorldScale3D(Scale);
+	Comp->SetVisibility(true);
+	Comp->Activate(true);
+
+	Handle.Pool = this;
+	Handle.Component = Comp;
+	Handle.Generation = Entry->Generation;
+	return Handle;
+}
+
+void USkillVFXComponentPool::Release(UFXSystemComponent* Component)
+{
+	FSkillVFXTemplatePool* Pool = nullptr;
+	FSkillVFXPoolEntry* Entry = FindEntry(Component, &Pool);
+	if (!Entry || !Entry->bInUse) return;
+
+	// Flip state first: DeactivateImmediate fires OnSystemFinished synchronously
+	Entry->bInUse = false;
+	++Entry->Generation;
+	--Pool->NumLive;
+	--TotalLive;
+
+	Component->DeactivateImmediate();
+	Component->SetVisibility(false);
+
+	int32 NumIdle = 0;
+	for (const FSkillVFXPoolEntry& E : Pool->Entries)
+	{
+		if (!E.bInUse) ++NumIdle;
+	}
+	if (NumIdle > FMath::Max(0, CVarSkillVFXPoolMaxIdle.GetValueOnGameThread()))
+	{
+		Pool->Entries.RemoveAtSwap(UE_PTRDIFF_TO_INT32(Entry - Pool->Entries.GetData()));
+		Component->DestroyComponent();
+	}
+}
+
+void USkillVFXComponentPool::Prewarm(UFXSystemAsset* Template, int32 Count)
+{
+	if (!Template) return;
+
+	FSkillVFXTemplatePool& Pool = Pools.FindOrAdd(Template);
+	const int32 Target = FMath::Min(Count, FMath::Max(0, CVarSkillVFXPoolMaxIdle.GetValueOnGameThread()));
+	while (Pool.Entries.Num() < Target)
+	{
+		UFXSystemComponent* Comp = CreateComponent(Template);
+		if (!Comp) break;
+		Comp->SetVisibility(false);
+		++Pool.NumCreated;
+		Pool.Entries.AddDefaulted_GetRef().Component = Comp;
+	}
+}
+
+UFXSystemComponent* USkillVFXComponentPool::Resolve(const FSkillVFXHandle& Handle) const
+{
+	UFXSystemComponent* Comp = Handle.Component.Get();
+	if (!Comp) return nullptr;
+
+	const FSkillVFXTemplatePool* Pool = Pools.Find(Comp->GetFXSystemAsset());
+	if (!Pool) return nullptr;
+	for (const FSkillVFXPoolEntry& Entry : Pool->Entries)
+	{
+		if (Entry.Component == Comp)
+		{
+			return (Entry.bInUse && Entry.Generation == Handle.Generation) ? Comp : nullptr;
+		}
+	}
+	return nullptr;
+}
+
+FSkillVFXPoolEntry* USkillVFXComponentPool::FindEntry(UFXSystemComponent* Component, FSkillVFXTemplatePool** OutPool)
+{
+	if (!Component) return nullptr;
+
+	FSkillVFXTemplatePool* Pool = Pools.Find(Component->GetFXSystemAsset());
+	if (!Pool) return nullptr;
+	for (FSkillVFXPoolEntry& Entry : Pool->Entries)
+	{
+		if (Entry.Component == Component)
+		{
+			if (OutPool) *OutPool = Pool;
+			return &Entry;
+		}
+	}
+	return nullptr;
+}
+
+bool USkillVFXComponentPool::EvictFor(ESkillVFXPriority Priority)
+{
+	// Lowest priority first, oldest within a priority; never evict something that outranks the request
+	UFXSystemComponent* Victim = nullptr;
+	FSkillVFXTemplatePool* VictimPool = nullptr;
+	ESkillVFXPriority VictimPriority = Priority;
+	double VictimTime = TNumericLimits<double>::Max();
+
+	for (auto& Pair : Pools)
+	{
+		for (const FSkillVFXPoolEntry& Entry : Pair.Value.Entries)
+		{
+			if (!Entry.bInUse || !IsValid(Entry.Component) || Entry.Priority > Priority) continue;
+			if (Entry.Priority < VictimPriority || (Entry.Priority == VictimPriority && Entry.AcquireTime < VictimTime))
+			{
+				Victim = Entry.Component;
+				VictimPool = &Pair.Value;
+				VictimPriority = Entry.Priority;
+				VictimTime = Entry.AcquireTime;
+			}
+		}
+	}
+
+	if (!Victim) return false;
+	++VictimPool->NumEvicted;
+	Release(Victim);
+	return true;
+}
+
+void USkillVFXComponentPool::ReleaseExpired(double MaxLifetimeSeconds)
+{
+	const double Cutoff = FPlatformTime::Seconds() - MaxLifetimeSeconds;
+	TArray<UFXSystemComponent*> Expired;
+	for (const auto& Pair : Pools)
+	{
+		for (const FSkillVFXPoolEntry& Entry : Pair.Value.Entries)
+		{
+			if (Entry.bInUse && Entry.AcquireTime < Cutoff && IsValid(Entry.Component))
+			{
+				Expired.Add(Entry.Component);
+			}
+		}
+	}
+	for (UFXSystemComponent* Comp : Expired)
+	{
+		Release(Comp);
+	}
+}
+
+void USkillVFXComponentPool::OnNiagaraFinished(UNiagaraComponent* Component)
+{
+	Release(Component);
+}
+
+void USkillVFXComponentPool::OnCascadeFinished(UParticleSystemComponent* Component)
+{
+	Release(Component);
+}
+
+// ============================================================
+// Stats
+// ============================================================
+
+void USkillVFXComponentPool::LogStats() const
+{
+	const double Now = FPlatformTime::Seconds();
+	UE_LOG(LogSkillVFXPool, Log, TEXT("SkillVFX pool: %d live / cap %d, %d templates, %llu rejected at cap"),
+		TotalLive, CVarSkillVFXPoolMaxLive.GetValueOnGameThread(), Pools.Num(), NumRejected);
+
+	for (const auto& Pair : Pools)
+	{
+		const FSkillVFXTemplatePool& Pool = Pair.Value;
+		const int32 NumPooled = Pool.Entries.Num() - Pool.NumLive;
+		// Window not rolled for a while means nothing has spawned recently
+		const float Rate = (Now - Pool.WindowStart) < 2.0 ? Pool.AcquiresPerSecond : 0.f;
+		UE_LOG(LogSkillVFXPool, Log, TEXT("  %-40s live %3d  pooled %3d  spawned/s %5.1f  created %llu  reused %llu  evicted %llu"),
+			Pair.Key ? *Pair.Key->GetName() : TEXT("<null>"), Pool.NumLive, NumPooled, Rate,
+			Pool.NumCreated, Pool.NumReused, Pool.NumEvicted);
+	}
+}
@@ -0,0 +1,137 @@
+// SkillVFXPool.h — Per-template pool of one-shot Niagara/Cascade components for USkillVFXSubsystem.
+// Bolts, projectiles, AoE impacts, auto-attack hits and ground strikes acquire a component
+// here instead of spawning a fresh one; it returns to the pool when the system finishes.
+// Live components are capped (SkillVFX.PoolMaxLive). At the cap, the oldest effect of the
+// lowest priority (others < party < local player) is evicted, or the request is dropped
+// if everything live outranks it. Looping / tracked effects (buff auras, Fire Wall,
+// casting circles, warp portals) do not use the pool.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "SkillVFXPool.generated.h"
+
+class UFXSystemAsset;
+class UFXSystemComponent;
+class UNiagaraComponent;
+class UParticleSystemComponent;
+class USkillVFXComponentPool;
+
+/** Who an effect belongs to — decides what gets evicted when the pool is full. */
+UENUM()
+enum class ESkillVFXPriority : uint8
+{
+	Other = 0,
+	Party,
+	LocalPlayer
+};
+
+/**
+ * Reference to a pooled component that stays safe after the component is recycled:
+ * Get() returns nullptr once the effect it was acquired for has been released.
+ */
+struct FSkillVFXHandle
+{
+	TWeakObjectPtr<USkillVFXComponentPool> Pool;
+	TWeakObjectPtr<UFXSystemComponent> Component;
+	uint32 Generation = 0;
+
+	UFXSystemComponent* Get() const;
+
+	template<typename T>
+	T* GetAs() const { return Cast<T>(Get()); }
+
+	bool IsValid() const { return Get() != nullptr; }
+
+	/** Stop the effect now and return its component to the pool. No-op if already recycled. */
+	void Release() const;
+};
+
+USTRUCT()
+struct FSkillVFXPoolEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<UFXSystemComponent> Component;
+
+	uint32 Generation = 0;
+	double AcquireTime = 0.0;
+	ESkillVFXPriority Priority = ESkillVFXPriority::Other;
+	bool bInUse = false;
+};
+
+USTRUCT()
+struct FSkillVFXTemplatePool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FSkillVFXPoolEntry> Entries;
+
+	int32 NumLive = 0;
+
+	/** Components created (pre-warm + cold misses) */
+	uint64 NumCreated = 0;
+	/** Acquires served by an idle pooled component */
+	uint64 NumReused = 0;
+	/** Live effects cut short to make room for a higher-priority one */
+	uint64 NumEvicted = 0;
+
+	// Acquires per second over a rolling one-second window
+	int32 WindowAcquires = 0;
+	double WindowStart = 0.0;
+	float AcquiresPerSecond = 0.f;
+};
+
+UCLASS()
+class SABRIMMO_API USkillVFXComponentPool : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	void Initialize(UWorld* InWorld);
+
+	/** Destroy every pooled component (world teardown). */
+	void Shutdown();
+
+	/**
+	 * Activate a component for Template at the given transform. Returns an invalid handle
+	 * if the pool is at its cap and every live effect has higher priority.
+	 */
+	FSkillVFXHandle Acquire(UFXSystemAsset* Template, const FVector& Location, const FRotator& Rotation,
+		const FVector& Scale, ESkillVFXPriority Priority);
+
+	/** Create idle components up front so the first casts in a zone don't allocate. */
+	void Prewarm(UFXSystemAsset* Template, int32 Count);
+
+	/** Deactivate and recycle a pooled component (or destroy it if the idle list is full). */
+	void Release(UFXSystemComponent* Component);
+
+	UFXSystemComponent* Resolve(const FSkillVFXHandle& Handle) const;
+
+	/** Force-release effects that never reported completion (looping one-shot assets). */
+	void ReleaseExpired(double MaxLifetimeSeconds);
+
+	int32 GetNumLive() const { return TotalLive; }
+	void LogStats() const;
+
+private:
+	UFUNCTION()
+	void OnNiagaraFinished(UNiagaraComponent* Component);
+
+	UFUNCTION()
+	void OnCascadeFinished(UParticleSystemComponent* Component);
+
+	UFXSystemComponent* CreateComponent(UFXSystemAsset* Template);
+	FSkillVFXPoolEntry* FindEntry(UFXSystemComponent* Component, FSkillVFXTemplatePool** OutPool = nullptr);
+	bool EvictFor(ESkillVFXPriority Priority);
+
+	UPROPERTY()
+	TMap<TObjectPtr<UFXSystemAsset>, FSkillVFXTemplatePool> Pools;
+
+	TWeakObjectPtr<UWorld> World;
+	int32 TotalLive = 0;
+	uint64 NumRejected = 0;
+};
@@ -5,6 +5,8 @@
 #include "MMOGameInstance.h"
 #include "UI/EnemySubsystem.h"
 #include "UI/OtherPlayerSubsystem.h"
+#include "UI/PartySubsystem.h"
+#include "UI/SkillTreeSubsystem.h"
 #include "Audio/AudioSubsystem.h"
 #include "CharacterData.h"
 #include "SocketEventRouter.h"
@@ -20,9 +22,39 @@
 #include "Serialization/JsonSerializer.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/Pawn.h"
+#include "HAL/IConsoleManager.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogSkillVFX, Log, All);
 
+static TAutoConsoleVariable<float> CVarSkillVFXPoolMaxLifetime(
+	TEXT("SkillVFX.PoolMaxLifetime"),
+	10.f,
+	TEXT("Seconds after which a pooled one-shot effect that never finished is force-recycled."),
+	ECVF_Default);
+
+// Console command: SkillVFX.PoolStats — live / pooled / spawned-per-second per template
+static FAutoConsoleCommandWithWorldAndArgs GSkillVFXPoolStatsCmd(
+	TEXT("SkillVFX.PoolStats"),
+	TEXT("Print skill VFX component pool counts per template (live, pooled, spawned/s, evictions)."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (!World) return;
+		if (USkillVFXSubsystem* VFX = World->GetSubsystem<USkillVFXSubsystem>())
+		{
+			if (USkillVFXComponentPool* Pool = VFX->GetComponentPool())
+			{
+				Pool->LogStats();
+			}
+		}
+	}));
+
+// Skills seen per zone this session (survives level transitions) — pre-warm input
+static TMap<FString, TSet<int32>>& GetZoneSkillHistory()
+{
+	static TMap<FString, TSet<int32>> History;
+	return History;
+}
+
 // ============================================================
 // Lifecycle
 // ============================================================
@@ -100,12 +132,16 @@ void USkillVFXSubsystem::OnWorldBeginPlay(UWorld& InWorld)
 	UE_LOG(LogSkillVFX, Log, TEXT("SkillVFXSubsystem started — loaded %d/8 Niagara templates, CastCircleMat=%s"),
 		LoadedCount, MI_CastingCircle ? TEXT("YES") : TEXT("NO"));
 
+	ComponentPool = NewObject<USkillVFXComponentPool>(this);
+	ComponentPool->Initialize(&InWorld);
+
 	// Register socket event handlers via persistent EventRouter
 	UMMOGameInstance* GI = Cast<UMMOGameInstance>(InWorld.GetGameInstance());
 	if (GI)
 	{
 		FCharacterData SelChar = GI->GetSelectedCharacter();
 		LocalCharacterId = SelChar.CharacterId;
+		ZoneName = GI->CurrentZoneName;
 
 		USocketEventRouter* Router = GI->GetEventRouter();
 		if (Router)
@@ -144,6 +180,19 @@ void USkillVFXSubsystem::OnWorldBeginPlay(UWorld& InWorld)
 		bReadyToProcess = true;
 	});
 
+	// Pre-warm once the skill tree has arrived; sweep pooled effects that never finish
+	InWorld.GetTimerManager().SetTimer(PoolPrewarmTimer,
+		FTimerDelegate::CreateUObject(this, &USkillVFXSubsystem::PrewarmComponentPool), 1.5f, false);
+	InWorld.GetTimerManager().SetTimer(PoolSweepTimer,
+		FTimerDelegate::CreateWeakLambda(this, [this]()
+		{
+			if (ComponentPool)
+			{
+				ComponentPool->ReleaseExpired(FMath::Max(1.f, CVarSkillVFXPoolMaxLifetime.GetValueOnGameThread()));
+			}
+		}),
+		1.0f, true);
+
 	// Re-activate non-looping Cascade buff particles every 2s so they persist until buff removal.
 	// Cascade PSCs can report IsActive()==true even after all particles have faded,
 	// so we unconditionally re-activate to ensure continuous visual emission.
@@ -217,6 +266,8 @@ void USkillVFXSubsystem::Deinitialize()
 	if (UWorld* World = GetWorld())
 	{
 		World->GetTimerManager().ClearTimer(CascadeLoopTimer);
+		World->GetTimerManager().ClearTimer(PoolPrewarmTimer);
+		World->GetTimerManager().ClearTimer(PoolSweepTimer);
 
 		if (UMMOGameInstance* GI = Cast<UMMOGameInstance>(World->GetGameInstance()))
 		{
@@ -227,6 +278,11 @@ void USkillVFXSubsystem::Deinitialize()
 		}
 	}
 
+	if (ComponentPool)
+	{
+		ComponentPool->Shutdown();
+	}
+
 	UE_LOG(LogSkillVFX, Log, TEXT("SkillVFXSubsystem deinitialized."));
 	Super::Deinitialize();
 }
@@ -261,6 +317,7 @@ void USkillVFXSubsystem::HandleCastStart(const TSharedPtr<FJsonValue>& Data)
 	if (CastTimeSec <= 0.f) return;
 
 	const FSkillVFXConfig& Config = SkillVFXDataHelper::GetSkillVFXConfig(SkillId);
+	RecordZoneSkill(SkillId, Config);
 
 	// RO style: casting circle always appears at the CASTER's feet.
 	// Try actor location first (accurate real-time position), fall back to
@@ -438,10 +495,13 @@ void USkillVFXSubsystem::HandleSkillEffectDamage(const TSharedPtr<FJsonValue>& D
 	if (!bVFXEnabled) return;
 	if (Config.Template == ESkillVFXTemplate::None) return;
 
+	RecordZoneSkill(SkillId, Config);
+	const ESkillVFXPriority Priority = GetEffectPriority(static_cast<int32>(AttackerIdD), static_cast<int32>(TargetIdD));
+
 	switch (Config.Template)
 	{
 	case ESkillVFXTemplate::BoltFromSky:
-		SpawnBoltFromSky(TargetLoc, Config, TotalHits);
+		SpawnBoltFromSky(TargetLoc, Config, TotalHits, Priority);
 		break;
 
 	case ESkillVFXTemplate::Projectile:
@@ -469,18 +529,18 @@ void USkillVFXSubsystem::HandleSkillEffectDamage(const TSharedPtr<FJsonValue>& D
 					FVector PrimaryLoc = GetActorLocationById(static_cast<int32>(PrimaryTargetIdD), bPrimaryIsEnemy);
 					if (!PrimaryLoc.IsNearlyZero()) ProjectileDestination = PrimaryLoc;
 				}
-				SpawnProjectileEffect(AttackerLoc, ProjectileDestination, Config);
+				SpawnProjectileEffect(AttackerLoc, ProjectileDestination, Config, Priority);
 			}
 		}
 		else if (TotalHits > 1)
 		{
 			// Multi-hit projectile (Soul Strike): N projectiles staggered by 200ms
-			SpawnMultiHitProjectile(AttackerLoc, TargetLoc, Config, TotalHits);
+			SpawnMultiHitProjectile(AttackerLoc, TargetLoc, Config, TotalHits, Priority);
 		}
 		else
 		{
 			// Single-target single-hit projectile
-			SpawnProjectileEffect(AttackerLoc, TargetLoc, Config);
+			SpawnProjectileEffect(AttackerLoc, TargetLoc, Config, Priority);
 		}
 		break;
 	}
@@ -491,7 +551,7 @@ void USkillVFXSubsystem::HandleSkillEffectDamage(const TSharedPtr<FJsonValue>& D
 		{
 			// Self-centered AoE (Magnum Break) spawns at caster, not target
 			FVector AoELocation = Config.bSelfCentered ? AttackerLoc : TargetLoc;
-			SpawnAoEImpact(AoELocation, Config);
+			SpawnAoEImpact(AoELocation, Config, Priority);
 		}
 		break;
 
@@ -503,11 +563,11 @@ void USkillVFXSubsystem::HandleSkillEffectDamage(const TSharedPtr<FJsonValue>& D
 
 	case ESkillVFXTemplate::GroundAoERain:
 		// Spawn per-hit (each hit = one lightning strike in the area)
-		SpawnGroundAoERain(TargetLoc, Config, HitNumber);
+		SpawnGroundAoERain(TargetLoc, Config, HitNumber, Priority);
 		break;
 
 	case ESkillVFXTemplate::HealFlash:
-		SpawnHealFlash(TargetLoc, Config);
+		SpawnHealFlash(TargetLoc, Config, Priority);
 		break;
 
 	case ESkillVFXTemplate::SelfBuff:
@@ -520,7 +580,7 @@ void USkillVFXSubsystem::HandleSkillEffectDamage(const TSharedPtr<FJsonValue>& D
 		}
 		else
 		{
-			SpawnVFXAtLocation(Config, TargetLoc);
+			SpawnVFXAtLocation(Config, TargetLoc, FRotator::ZeroRotator, FVector::OneVector, Priority);
 		}
 		break;
 	}
@@ -544,7 +604,7 @@ void USkillVFXSubsystem::HandleSkillEffectDamage(const TSharedPtr<FJsonValue>& D
 		else if (!TargetLoc.IsNearlyZero())
 		{
 			UE_LOG(LogSkillVFX, Warning, TEXT("TargetDebuff FALLBACK to SpawnVFXAtLocation (no actor found)"));
-			SpawnVFXAtLocation(Config, TargetLoc + FVector(0, 0, 50.f));
+			SpawnVFXAtLocation(Config, TargetLoc + FVector(0, 0, 50.f), FRotator::ZeroRotator, FVector::OneVector, Priority);
 		}
 		break;
 	}
@@ -616,7 +676,7 @@ void USkillVFXSubsystem::HandleBuffApplied(const TSharedPtr<FJsonValue>& Data)
 			FVector BuffLoc = GetActorLocationById(TargetId, bIsEnemy);
 			if (!BuffLoc.IsNearlyZero())
 			{
-				SpawnVFXAtLocation(Config, BuffLoc);
+				SpawnVFXAtLocation(Config, BuffLoc, FRotator::ZeroRotator, FVector::OneVector, GetEffectPriority(0, TargetId));
 			}
 		}
 	}
@@ -689,7 +749,7 @@ void USkillVFXSubsystem::HandleBuffApplied(const TSharedPtr<FJsonValue>& Data)
 			FVector TargetLoc = GetActorLocationById(TargetId, bIsEnemy);
 			if (!TargetLoc.IsNearlyZero())
 			{
-				SpawnVFXAtLocation(Config, TargetLoc + FVector(0, 0, 150.f));
+				SpawnVFXAtLocation(Config, TargetLoc + FVector(0, 0, 150.f), FRotator::ZeroRotator, FVector::OneVector, GetEffectPriority(0, TargetId));
 			}
 		}
 	}
@@ -699,7 +759,7 @@ void USkillVFXSubsystem::HandleBuffApplied(const TSharedPtr<FJsonValue>& Data)
 		FVector TargetLoc = GetActorLocationById(TargetId, bIsEnemy);
 		if (!TargetLoc.IsNearlyZero())
 		{
-			SpawnVFXAtLocation(Config, TargetLoc);
+			SpawnVFXAtLocation(Config, TargetLoc, FRotator::ZeroRotator, FVector::OneVector, GetEffectPriority(0, TargetId));
 		}
 	}
 }
@@ -922,7 +982,7 @@ void USkillVFXSubsystem::HandleCombatHealthUpdate(const TSharedPtr<FJsonValue>&
 		CharId, HealAmountD, Location.X, Location.Y, Location.Z, (int32)Config.Template, *Config.VFXOverridePath, Config.Scale);
 	if (Config.Template != ESkillVFXTemplate::None)
 	{
-		SpawnHealFlash(Location, Config);
+		SpawnHealFlash(Location, Config, GetEffectPriority(0, CharId));
 	}
 }
 
@@ -930,7 +990,7 @@ void USkillVFXSubsystem::HandleCombatHealthUpdate(const TSharedPtr<FJsonValue>&
 // VFX spawning — per template type
 // ============================================================
 
-void USkillVFXSubsystem::SpawnBoltFromSky(FVector TargetLocation, const FSkillVFXConfig& Config, int32 TotalHits)
+void USkillVFXSubsystem::SpawnBoltFromSky(FVector TargetLocation, const FSkillVFXConfig& Config, int32 TotalHits, ESkillVFXPriority Priority)
 {
 	UWorld* World = GetWorld();
 	if (!World) return;
@@ -938,21 +998,20 @@ void USkillVFXSubsystem::SpawnBoltFromSky(FVector TargetLocation, const FSkillVF
 	TotalHits = FMath::Clamp(TotalHits, 1, 10);
 
 	// Pre-resolve assets once (not per bolt)
-	UParticleSystem* CascadeSys = nullptr;
-	UNiagaraSystem* NiagaraSys = nullptr;
+	UFXSystemAsset* BoltSys = nullptr;
 	const bool bUseCascade = !Config.VFXOverridePath.IsEmpty() && Config.bIsCascade;
 
 	if (bUseCascade)
 	{
-		CascadeSys = GetOrLoadCascadeOverride(Config.VFXOverridePath);
-		if (!CascadeSys) return;
+		BoltSys = GetOrLoadCascadeOverride(Config.VFXOverridePath);
+		if (!BoltSys) return;
 	}
 	else
 	{
 		if (!Config.VFXOverridePath.IsEmpty())
-			NiagaraSys = GetOrLoadNiagaraOverride(Config.VFXOverridePath);
-		if (!NiagaraSys) NiagaraSys = NS_BoltFromSky;
-		if (!NiagaraSys) return;
+			BoltSys = GetOrLoadNiagaraOverride(Config.VFXOverridePath);
+		if (!BoltSys) BoltSys = NS_BoltFromSky;
+		if (!BoltSys) return;
 	}
 
 	// Spawn one bolt per hit, staggered by BoltInterval
@@ -967,10 +1026,11 @@ void USkillVFXSubsystem::SpawnBoltFromSky(FVector TargetLocation, const FSkillVF
 
 		FTimerHandle SpawnTimer;
 		World->GetTimerManager().SetTimer(SpawnTimer,
-			[this, WeakWorld, CapturedTarget, CapturedConfig, bUseCascade, CascadeSys, NiagaraSys]()
+			[this, WeakWorld, CapturedTarget, CapturedConfig, BoltSys, Priority]()
 			{
 				UWorld* W = WeakWorld.Get();
 				if (!W) return;
+				if (!IsValid(BoltSys)) return;
 
 				// Random XY offset so each bolt is visually distinct
 				const float SpawnHeight = FMath::Max(CapturedConfig.BoltSpawnHeight, 100.f);
@@ -982,24 +1042,9 @@ void USkillVFXSubsystem::SpawnBoltFromSky(FVector TargetLocation, const FSkillVF
 				FRotator SpawnRot = FRotator(-90.f, 0.f, 0.f);
 				FVector BoltScale = FVector(CapturedConfig.Scale);
 
-				USceneComponent* MovingComp = nullptr;
-
-				if (bUseCascade)
-				{
-					if (!IsValid(CascadeSys)) return;
-					UParticleSystemComponent* PSC = UGameplayStatics::SpawnEmitterAtLocation(
-						W, CascadeSys, SpawnLoc, SpawnRot, BoltScale, false);
-					MovingComp = PSC;
-				}
-				else
-				{
-					if (!IsValid(NiagaraSys)) return;
-					UNiagaraComponent* NComp = SpawnNiagaraAtLocation(NiagaraSys, SpawnLoc, SpawnRot, BoltScale);
-					if (NComp) SetNiagaraColor(NComp, CapturedConfig.PrimaryColor);
-					MovingComp = NComp;
-				}
-
-				if (!MovingComp) return;
+				const FSkillVFXHandle Bolt = SpawnPooledVFX(BoltSys, SpawnLoc, SpawnRot, BoltScale,
+					Priority, CapturedConfig.PrimaryColor);
+				if (!Bolt.IsValid()) return;
 
 				// Animate bolt moving downward — 0.3s travel time
 				const float TravelTime = 0.3f;
@@ -1008,7 +1053,7 @@ void USkillVFXSubsystem::SpawnBoltFromSky(FVector TargetLocation, const FSkillVF
 
 				struct FBoltMoveData
 				{
-					TWeakObjectPtr<USceneComponent> Comp;
+					FSkillVFXHandle Handle;
 					FVector Start;
 					FVector End;
 					int32 CurrentStep;
@@ -1016,7 +1061,7 @@ void USkillVFXSubsystem::SpawnBoltFromSky(FVector TargetLocation, const FSkillVF
 				};
 
 				TSharedPtr<FBoltMoveData> MoveData = MakeShared<FBoltMoveData>();
-				MoveData->Comp = MovingComp;
+				MoveData->Handle = Bolt;
 				MoveData->Start = SpawnLoc;
 				MoveData->End = CapturedTarget + FVector(0, 0, 50.f);
 				MoveData->CurrentStep = 0;
@@ -1026,7 +1071,9 @@ void USkillVFXSubsystem::SpawnBoltFromSky(FVector TargetLocation, const FSkillVF
 				W->GetTimerManager().SetTimer(MoveTimer,
 					[MoveData]()
 					{
-						if (!MoveData->Comp.IsValid()) return;
+						// Null once recycled (evicted) — never move someone else's effect
+						UFXSystemComponent* Comp = MoveData->Handle.Get();
+						if (!Comp) return;
 
 						MoveData->CurrentStep++;
 						float Alpha = FMath::Clamp(
@@ -1035,56 +1082,34 @@ void USkillVFXSubsystem::SpawnBoltFromSky(FVector TargetLocation, const FSkillVF
 						Alpha = Alpha * Alpha; // Ease-in acceleration
 
 						FVector NewPos = FMath::Lerp(MoveData->Start, MoveData->End, Alpha);
-						MoveData->Comp->SetWorldLocation(NewPos);
+						Comp->SetWorldLocation(NewPos);
 					},
 					TickInterval, true, 0.f);
 
-				// After travel ends: stop movement, then destroy after linger time
+				// After travel ends: stop movement, then return to the pool after linger time
 				// CascadeLifetime doubles as linger time for all bolt types
 				const float LingerTime = FMath::Max(CapturedConfig.CascadeLifetime, 0.f);
 				TWeakObjectPtr<UWorld> WeakW = W;
-				TWeakObjectPtr<USceneComponent> WeakComp = MovingComp;
 				FTimerHandle CleanupTimer;
 				W->GetTimerManager().SetTimer(CleanupTimer,
-					[WeakW, MoveTimer, WeakComp, LingerTime]() mutable
+					[WeakW, MoveTimer, Bolt, LingerTime]() mutable
 					{
 						// Stop movement
 						if (WeakW.IsValid())
 						{
 							WeakW->GetTimerManager().ClearTimer(MoveTimer);
 						}
-						// If no linger, destroy now
+						// If no linger, release now
 						if (LingerTime <= 0.f)
 						{
-							if (WeakComp.IsValid())
-							{
-								if (UNiagaraComponent* NC = Cast<UNiagaraComponent>(WeakComp.Get()))
-									NC->DeactivateImmediate();
-								else if (UParticleSystemComponent* PSC = Cast<UParticleSystemComponent>(WeakComp.Get()))
-								{
-									PSC->DeactivateImmediate();
-									PSC->DestroyComponent();
-								}
-							}
+							Bolt.Release();
 						}
 						else if (WeakW.IsValid())
 						{
-							// Destroy after linger
+							// Release after linger
 							FTimerHandle LingerTimer;
 							WeakW->GetTimerManager().SetTimer(LingerTimer,
-								[WeakComp]()
-								{
-									if (WeakComp.IsValid())
-									{
-										if (UNiagaraComponent* NC = Cast<UNiagaraComponent>(WeakComp.Get()))
-											NC->DeactivateImmediate();
-										else if (UParticleSystemComponent* PSC = Cast<UParticleSystemComponent>(WeakComp.Get()))
-										{
-											PSC->DeactivateImmediate();
-											PSC->DestroyComponent();
-										}
-									}
-								},
+								[Bolt]() { Bolt.Release(); },
 								LingerTime, false);
 						}
 					},
@@ -1094,7 +1119,7 @@ void USkillVFXSubsystem::SpawnBoltFromSky(FVector TargetLocation, const FSkillVF
 	}
 }
 
-void USkillVFXSubsystem::SpawnProjectileEffect(FVector AttackerLocation, FVector TargetLocation, const FSkillVFXConfig& Config)
+void USkillVFXSubsystem::SpawnProjectileEffect(FVector AttackerLocation, FVector TargetLocation, const FSkillVFXConfig& Config, ESkillVFXPriority Priority)
 {
 	UWorld* World = GetWorld();
 	if (!World) return;
@@ -1107,36 +1132,22 @@ void USkillVFXSubsystem::SpawnProjectileEffect(FVector AttackerLocation, FVector
 	FRotator SpawnRot = Direction.Rotation();
 	FVector ProjScale = FVector(Config.Scale);
 
-	USceneComponent* MovingComp = nullptr;
-
+	UFXSystemAsset* ProjSys = nullptr;
 	if (!Config.VFXOverridePath.IsEmpty())
 	{
 		if (Config.bIsCascade)
-		{
-			UParticleSystem* CascadeSys = GetOrLoadCascadeOverride(Config.VFXOverridePath);
-			if (!CascadeSys) return;
-			UParticleSystemComponent* PSC = UGameplayStatics::SpawnEmitterAtLocation(
-				World, CascadeSys, SpawnLoc, SpawnRot, ProjScale, false);
-			MovingComp = PSC;
-		}
+			ProjSys = GetOrLoadCascadeOverride(Config.VFXOverridePath);
 		else
-		{
-			UNiagaraSystem* NiagaraSys = GetOrLoadNiagaraOverride(Config.VFXOverridePath);
-			if (!NiagaraSys) return;
-			UNiagaraComponent* NComp = SpawnNiagaraAtLocation(NiagaraSys, SpawnLoc, SpawnRot, ProjScale);
-			if (NComp) SetNiagaraColor(NComp, Config.PrimaryColor);
-			MovingComp = NComp;
-		}
+			ProjSys = GetOrLoadNiagaraOverride(Config.VFXOverridePath);
 	}
 	else
 	{
-		if (!NS_Projectile) return;
-		UNiagaraComponent* NComp = SpawnNiagaraAtLocation(NS_Projectile, SpawnLoc, SpawnRot, ProjScale);
-		if (NComp) SetNiagaraColor(NComp, Config.PrimaryColor);
-		MovingComp = NComp;
+		ProjSys = NS_Projectile;
 	}
+	if (!ProjSys) return;
 
-	if (!MovingComp) return;
+	const FSkillVFXHandle Projectile = SpawnPooledVFX(ProjSys, SpawnLoc, SpawnRot, ProjScale, Priority, Config.PrimaryColor);
+	if (!Projectile.IsValid()) return;
 
 	// Animate projectile from caster to target over travel time
 	float Distance = FVector::Dist(SpawnLoc, EndLoc);
@@ -1146,7 +1157,7 @@ void USkillVFXSubsystem::SpawnProjectileEffect(FVector AttackerLocation, FVector
 
 	struct FProjMoveData
 	{
-		TWeakObjectPtr<USceneComponent> Comp;
+		FSkillVFXHandle Handle;
 		FVector Start;
 		FVector End;
 		int32 CurrentStep;
@@ -1154,7 +1165,7 @@ void USkillVFXSubsystem::SpawnProjectileEffect(FVector AttackerLocation, FVector
 	};
 
 	TSharedPtr<FProjMoveData> MoveData = MakeShared<FProjMoveData>();
-	MoveData->Comp = MovingComp;
+	MoveData->Handle = Projectile;
 	MoveData->Start = SpawnLoc;
 	MoveData->End = EndLoc;
 	MoveData->CurrentStep = 0;
@@ -1164,18 +1175,18 @@ void USkillVFXSubsystem::SpawnProjectileEffect(FVector AttackerLocation, FVector
 	World->GetTimerManager().SetTimer(MoveTimer,
 		[MoveData]()
 		{
-			if (!MoveData->Comp.IsValid()) return;
+			UFXSystemComponent* Comp = MoveData->Handle.Get();
+			if (!Comp) return;
 			MoveData->CurrentStep++;
 			float Alpha = FMath::Clamp(
 				static_cast<float>(MoveData->CurrentStep) / static_cast<float>(MoveData->MaxSteps), 0.f, 1.f);
 			FVector NewPos = FMath::Lerp(MoveData->Start, MoveData->End, Alpha);
-			MoveData->Comp->SetWorldLocation(NewPos);
+			Comp->SetWorldLocation(NewPos);
 		},
 		TickInterval, true, 0.f);
 
 	// Cleanup: deactivate projectile when it arrives + spawn impact explosion + clear timer
 	TWeakObjectPtr<UWorld> WeakWorld = World;
-	TWeakObjectPtr<USceneComponent> WeakMoving = MovingComp;
 	FVector CapturedEndLoc = EndLoc;
 	FLinearColor CapturedColor = Config.PrimaryColor;
 	float CapturedScale = Config.Scale;
@@ -1183,19 +1194,15 @@ void USkillVFXSubsystem::SpawnProjectileEffect(FVector AttackerLocation, FVector
 	TWeakObjectPtr<USkillVFXSubsystem> WeakThis = this;
 	FTimerHandle CleanupTimer;
 	World->GetTimerManager().SetTimer(CleanupTimer,
-		[WeakWorld, MoveTimer, WeakMoving, CapturedEndLoc, CapturedColor, CapturedScale, CapturedImpactPath, WeakThis]() mutable
+		[WeakWorld, MoveTimer, Projectile, CapturedEndLoc, CapturedColor, CapturedScale, CapturedImpactPath, WeakThis, Priority]() mutable
 		{
 			if (WeakWorld.IsValid())
 				WeakWorld->GetTimerManager().ClearTimer(MoveTimer);
-			// Deactivate the projectile VFX on arrival
-			if (WeakMoving.IsValid())
+			// Cascade projectiles loop — recycle on arrival.
+			// Niagara returns to the pool by itself when the system finishes.
+			if (Projectile.GetAs<UParticleSystemComponent>())
 			{
-				if (UParticleSystemComponent* PSC = Cast<UParticleSystemComponent>(WeakMoving.Get()))
-				{
-					PSC->DeactivateImmediate();
-					PSC->DestroyComponent();
-				}
-				// Niagara auto-destroys via bAutoDestroy=true
+				Projectile.Release();
 			}
 			// Spawn impact explosion at target location
 			if (WeakThis.IsValid() && !CapturedImpactPath.IsEmpty())
@@ -1203,19 +1210,15 @@ void USkillVFXSubsystem::SpawnProjectileEffect(FVector AttackerLocation, FVector
 				UNiagaraSystem* ImpactSys = WeakThis->GetOrLoadNiagaraOverride(CapturedImpactPath);
 				if (ImpactSys)
 				{
-					UNiagaraComponent* ImpactComp = WeakThis->SpawnNiagaraAtLocation(
-						ImpactSys, CapturedEndLoc, FRotator::ZeroRotator, FVector(CapturedScale));
-					if (ImpactComp)
-					{
-						WeakThis->SetNiagaraColor(ImpactComp, CapturedColor);
-					}
+					WeakThis->SpawnPooledVFX(ImpactSys, CapturedEndLoc, FRotator::ZeroRotator,
+						FVector(CapturedScale), Priority, CapturedColor);
 				}
 			}
 		},
 		TravelTime + 0.05f, false);
 }
 
-void USkillVFXSubsystem::SpawnMultiHitProjectile(FVector AttackerLocation, FVector TargetLocation, const FSkillVFXConfig& Config, int32 TotalHits)
+void USkillVFXSubsystem::SpawnMultiHitProjectile(FVector AttackerLocation, FVector TargetLocation, const FSkillVFXConfig& Config, int32 TotalHits, ESkillVFXPriority Priority)
 {
 	UWorld* World = GetWorld();
 	if (!World) return;
@@ -1246,7 +1249,7 @@ void USkillVFXSubsystem::SpawnMultiHitProjectile(FVector AttackerLocation, FVect
 
 		FTimerHandle SpawnTimer;
 		World->GetTimerManager().SetTimer(SpawnTimer,
-			[WeakWorld, WeakThis, NiagaraSys, CapturedStart, CapturedEnd, CapturedConfig]()
+			[WeakWorld, WeakThis, NiagaraSys, CapturedStart, CapturedEnd, CapturedConfig, Priority]()
 			{
 				UWorld* W = WeakWorld.Get();
 				if (!W || !WeakThis.IsValid()) return;
@@ -1263,9 +1266,9 @@ void USkillVFXSubsystem::SpawnMultiHitProjectile(FVector AttackerLocation, FVect
 				FRotator SpawnRot = Direction.Rotation();
 				FVector ProjScale = FVector(CapturedConfig.Scale);
 
-				UNiagaraComponent* NComp = WeakThis->SpawnNiagaraAtLocation(NiagaraSys, SpawnLoc, SpawnRot, ProjScale);
-				if (!NComp) return;
-				WeakThis->SetNiagaraColor(NComp, CapturedConfig.PrimaryColor);
+				const FSkillVFXHandle Projectile = WeakThis->SpawnPooledVFX(
+					NiagaraSys, SpawnLoc, SpawnRot, ProjScale, Priority, CapturedConfig.PrimaryColor);
+				if (!Projectile.IsValid()) return;
 
 				// Animate projectile from caster to target
 				float Distance = FVector::Dist(SpawnLoc, EndLoc);
@@ -1275,7 +1278,7 @@ void USkillVFXSubsystem::SpawnMultiHitProjectile(FVector AttackerLocation, FVect
 
 				struct FProjMoveData
 				{
-					TWeakObjectPtr<USceneComponent> Comp;
+					FSkillVFXHandle Handle;
 					FVector Start;
 					FVector End;
 					int32 CurrentStep;
@@ -1283,7 +1286,7 @@ void USkillVFXSubsystem::SpawnMultiHitProjectile(FVector AttackerLocation, FVect
 				};
 
 				TSharedPtr<FProjMoveData> MoveData = MakeShared<FProjMoveData>();
-				MoveData->Comp = NComp;
+				MoveData->Handle = Projectile;
 				MoveData->Start = SpawnLoc;
 				MoveData->End = EndLoc;
 				MoveData->CurrentStep = 0;
@@ -1293,25 +1296,25 @@ void USkillVFXSubsystem::SpawnMultiHitProjectile(FVector AttackerLocation, FVect
 				W->GetTimerManager().SetTimer(MoveTimer,
 					[MoveData]()
 					{
-						if (!MoveData->Comp.IsValid()) return;
+						UFXSystemComponent* Comp = MoveData->Handle.Get();
+						if (!Comp) return;
 						MoveData->CurrentStep++;
 						float Alpha = FMath::Clamp(
 							static_cast<float>(MoveData->CurrentStep) / static_cast<float>(MoveData->MaxSteps), 0.f, 1.f);
 						FVector NewPos = FMath::Lerp(MoveData->Start, MoveData->End, Alpha);
-						MoveData->Comp->SetWorldLocation(NewPos);
+						Comp->SetWorldLocation(NewPos);
 					},
 					TickInterval, true, 0.f);
 
 				// Cleanup on arrival
 				TWeakObjectPtr<UWorld> WeakW = W;
-				TWeakObjectPtr<USceneComponent> WeakComp = NComp;
 				FTimerHandle CleanupTimer;
 				W->GetTimerManager().SetTimer(CleanupTimer,
-					[WeakW, MoveTimer, WeakComp]() mutable
+					[WeakW, MoveTimer]() mutable
 					{
 						if (WeakW.IsValid())
 							WeakW->GetTimerManager().ClearTimer(MoveTimer);
-						// Niagara auto-destroys via bAutoDestroy=true
+						// Niagara returns to the pool when the system finishes
 					},
 					TravelTime + 0.05f, false);
 			},
@@ -1319,53 +1322,44 @@ void USkillVFXSubsystem::SpawnMultiHitProjectile(FVector AttackerLocation, FVect
 	}
 }
 
-void USkillVFXSubsystem::SpawnAoEImpact(FVector Location, const FSkillVFXConfig& Config)
+void USkillVFXSubsystem::SpawnAoEImpact(FVector Location, const FSkillVFXConfig& Config, ESkillVFXPriority Priority)
 {
 	if (!Config.VFXOverridePath.IsEmpty())
 	{
-		SpawnVFXAtLocation(Config, Location);
+		SpawnVFXAtLocation(Config, Location, FRotator::ZeroRotator, FVector::OneVector, Priority);
 		return;
 	}
 
 	if (!NS_AoEImpact) return;
-	UNiagaraComponent* Comp = SpawnNiagaraAtLocation(NS_AoEImpact, Location);
-	if (Comp) SetNiagaraColor(Comp, Config.PrimaryColor);
+	SpawnPooledVFX(NS_AoEImpact, Location, FRotator::ZeroRotator, FVector::OneVector, Priority, Config.PrimaryColor);
 }
 
-void USkillVFXSubsystem::SpawnAutoAttackHitEffect(FVector Location, bool bIsCritical)
+void USkillVFXSubsystem::SpawnAutoAttackHitEffect(FVector Location, bool bIsCritical, int32 AttackerId, int32 TargetId)
 {
 	if (!NS_AutoAttackHit || !bVFXEnabled) return;
 	// Quick hit impact at target — fewer but bigger particles, more scatter
 	FVector Scale = bIsCritical ? FVector(0.8f) : FVector(0.5f);
-	UNiagaraComponent* Comp = SpawnNiagaraAtLocation(NS_AutoAttackHit, Location, FRotator::ZeroRotator, Scale);
-	if (Comp)
-	{
-		FLinearColor Color = bIsCritical
-			? FLinearColor(0.9f, 0.9f, 0.15f)   // Yellow for crit
-			: FLinearColor(1.0f, 1.0f, 1.0f);   // White for normal
-		SetNiagaraColor(Comp, Color);
-	}
+	FLinearColor Color = bIsCritical
+		? FLinearColor(0.9f, 0.9f, 0.15f)   // Yellow for crit
+		: FLinearColor(1.0f, 1.0f, 1.0f);   // White for normal
+	SpawnPooledVFX(NS_AutoAttackHit, Location, FRotator::ZeroRotator, Scale,
+		GetEffectPriority(AttackerId, TargetId), Color);
 }
 
-void USkillVFXSubsystem::SpawnGroundStrikeEffect(FVector Location)
+void USkillVFXSubsystem::SpawnGroundStrikeEffect(FVector Location, int32 AttackerId, int32 TargetId)
 {
 	if (!bVFXEnabled) return;
 
 	// Use the earth/dark stone impact for a ground eruption look.
-	UNiagaraSystem* GroundVFX = Cast<UNiagaraSystem>(StaticLoadObject(
-		UNiagaraSystem::StaticClass(), nullptr,
-		TEXT("/Game/Mixed_Magic_VFX_Pack/VFX/NS_Dark_Stone_Impact.NS_Dark_Stone_Impact")));
+	UNiagaraSystem* GroundVFX = GetOrLoadNiagaraOverride(
+		TEXT("/Game/Mixed_Magic_VFX_Pack/VFX/NS_Dark_Stone_Impact.NS_Dark_Stone_Impact"));
 	if (!GroundVFX)
 		GroundVFX = NS_AutoAttackHit;  // fallback
 	if (!GroundVFX) return;
 
-	UNiagaraComponent* Comp = SpawnNiagaraAtLocation(
-		GroundVFX, Location, FRotator(-90.f, 0.f, 0.f), FVector(0.6f));
-	if (Comp)
-	{
-		// Earth/green tint for vine attack
-		SetNiagaraColor(Comp, FLinearColor(0.3f, 0.55f, 0.15f));
-	}
+	// Earth/green tint for vine attack
+	SpawnPooledVFX(GroundVFX, Location, FRotator(-90.f, 0.f, 0.f), FVector(0.6f),
+		GetEffectPriority(AttackerId, TargetId), FLinearColor(0.3f, 0.55f, 0.15f));
 }
 
 void USkillVFXSubsystem::SpawnGroundPersistent(FVector Location, const FSkillVFXConfig& Config, int32 SkillId)
@@ -1381,7 +1375,7 @@ void USkillVFXSubsystem::SpawnGroundPersistent(FVector Location, const FSkillVFX
 	if (Comp) SetNiagaraColor(Comp, Config.PrimaryColor);
 }
 
-void USkillVFXSubsystem::SpawnGroundAoERain(FVector Location, const FSkillVFXConfig& Config, int32 HitNumber)
+void USkillVFXSubsystem::SpawnGroundAoERain(FVector Location, const FSkillVFXConfig& Config, int32 HitNumber, ESkillVFXPriority Priority)
 {
 	float RandAngle = FMath::FRandRange(0.f, 2.f * PI);
 	float RandDist = FMath::FRandRange(0.f, Config.AoERadius);
@@ -1390,13 +1384,12 @@ void USkillVFXSubsystem::SpawnGroundAoERain(FVector Location, const FSkillVFXCon
 
 	if (!Config.VFXOverridePath.IsEmpty())
 	{
-		SpawnVFXAtLocation(Config, StrikeLoc);
+		SpawnVFXAtLocation(Config, StrikeLoc, FRotator::ZeroRotator, FVector::OneVector, Priority);
 		return;
 	}
 
 	if (!NS_GroundAoERain) return;
-	UNiagaraComponent* Comp = SpawnNiagaraAtLocation(NS_GroundAoERain, StrikeLoc);
-	if (Comp) SetNiagaraColor(Comp, Config.PrimaryColor);
+	SpawnPooledVFX(NS_GroundAoERain, StrikeLoc, FRotator::ZeroRotator, FVector::OneVector, Priority, Config.PrimaryColor);
 }
 
 void USkillVFXSubsystem::SpawnSelfBuff(AActor* TargetActor, const FSkillVFXConfig& Config, int32 SkillId, int32 TargetId)
@@ -1438,17 +1431,16 @@ void USkillVFXSubsystem::SpawnTargetDebuff(AActor* TargetActor, const FSkillVFXC
 	if (Comp) SetNiagaraColor(Comp, Config.PrimaryColor);
 }
 
-void USkillVFXSubsystem::SpawnHealFlash(FVector Location, const FSkillVFXConfig& Config)
+void USkillVFXSubsystem::SpawnHealFlash(FVector Location, const FSkillVFXConfig& Config, ESkillVFXPriority Priority)
 {
 	if (!Config.VFXOverridePath.IsEmpty())
 	{
-		SpawnVFXAtLocation(Config, Location);
+		SpawnVFXAtLocation(Config, Location, FRotator::ZeroRotator, FVector::OneVector, Priority);
 		return;
 	}
 
 	if (!NS_HealFlash) return;
-	UNiagaraComponent* Comp = SpawnNiagaraAtLocation(NS_HealFlash, Location);
-	if (Comp) SetNiagaraColor(Comp, Config.PrimaryColor);
+	SpawnPooledVFX(NS_HealFlash, Location, FRotator::ZeroRotator, FVector::OneVector, Priority, Config.PrimaryColor);
 }
 
 // ============================================================
@@ -1646,7 +1638,7 @@ UParticleSystem* USkillVFXSubsystem::GetOrLoadCascadeOverride(const FString& Pat
 }
 
 void USkillVFXSubsystem::SpawnVFXAtLocation(const FSkillVFXConfig& Config, FVector Location,
-	FRotator Rotation, FVector Scale)
+	FRotator Rotation, FVector Scale, ESkillVFXPriority Priority)
 {
 	UWorld* World = GetWorld();
 	if (!World) return;
@@ -1657,42 +1649,46 @@ void USkillVFXSubsystem::SpawnVFXAtLocation(const FSkillVFXConfig& Config, FVect
 	if (Config.bIsCascade && !Config.VFXOverridePath.IsEmpty())
 	{
 		UParticleSystem* CascadeSystem = GetOrLoadCascadeOverride(Config.VFXOverridePath);
-		if (CascadeSystem)
+		if (!CascadeSystem) return;
+
+		if (Config.bLooping)
 		{
-			UParticleSystemComponent* PSC = UGameplayStatics::SpawnEmitterAtLocation(
-				World, CascadeSystem, Location, Rotation, FinalScale, false); // bAutoDestroy=false — we manage lifetime
+			// Persistent — caller-independent lifetime, stays out of the pool
+			UGameplayStatics::SpawnEmitterAtLocation(
+				World, CascadeSystem, Location, Rotation, FinalScale, false);
+			return;
+		}
 
-			// Cascade effects with looping emitters never auto-destroy.
-			// Force cleanup after CascadeLifetime (or default 0.5s for one-shot, skip for persistent/looping).
-			if (PSC && !Config.bLooping)
-			{
-				float Lifetime = (Config.CascadeLifetime > 0.f) ? Config.CascadeLifetime : 0.5f;
-				TWeakObjectPtr<UParticleSystemComponent> WeakPSC = PSC;
-				FTimerHandle CascadeCleanup;
-				World->GetTimerManager().SetTimer(CascadeCleanup,
-					[WeakPSC]()
-					{
-						if (WeakPSC.IsValid())
-						{
-							WeakPSC->DeactivateImmediate();
-							WeakPSC->DestroyComponent();
-						}
-					},
-					Lifetime, false);
-			}
+		// Cascade effects with looping emitters never finish on their own.
+		// Force recycle after CascadeLifetime (or default 0.5s for one-shot).
+		const FSkillVFXHandle Handle = SpawnPooledVFX(CascadeSystem, Location, Rotation, FinalScale, Priority);
+		if (Handle.IsValid())
+		{
+			float Lifetime = (Config.CascadeLifetime > 0.f) ? Config.CascadeLifetime : 0.5f;
+			FTimerHandle CascadeCleanup;
+			World->GetTimerManager().SetTimer(CascadeCleanup,
+				[Handle]() { Handle.Release(); },
+				Lifetime, false);
 		}
 	}
 	else if (!Config.VFXOverridePath.IsEmpty())
 	{
 		UNiagaraSystem* NiagaraSystem = GetOrLoadNiagaraOverride(Config.VFXOverridePath);
-		if (NiagaraSystem)
+		if (!NiagaraSystem) return;
+
+		UNiagaraComponent* Comp = nullptr;
+		if (Config.bLooping)
 		{
-			UNiagaraComponent* Comp = SpawnNiagaraAtLocation(NiagaraSystem, Location, Rotation, FinalScale);
-			if (Comp)
-			{
-				SetNiagaraColor(Comp, Config.PrimaryColor);
-				SetNiagaraScale(Comp, Config.Scale);
-			}
+			Comp = SpawnNiagaraAtLocation(NiagaraSystem, Location, Rotation, FinalScale);
+		}
+		else
+		{
+			Comp = SpawnPooledVFX(NiagaraSystem, Location, Rotation, FinalScale, Priority).GetAs<UNiagaraComponent>();
+		}
+		if (Comp)
+		{
+			SetNiagaraColor(Comp, Config.PrimaryColor);
+			SetNiagaraScale(Comp, Config.Scale);
 		}
 	}
 }
@@ -1759,6 +1755,115 @@ void USkillVFXSubsystem::SpawnVFXAttached(const FSkillVFXConfig& Config, USceneC
 	}
 }
 
+// ============================================================
+// Component pool
+// ============================================================
+
+FSkillVFXHandle USkillVFXSubsystem::SpawnPooledVFX(UFXSystemAsset* System, FVector Location, FRotator Rotation,
+	FVector Scale, ESkillVFXPriority Priority, FLinearColor Color)
+{
+	if (!System || !ComponentPool) return FSkillVFXHandle();
+
+	const FSkillVFXHandle Handle = ComponentPool->Acquire(System, Location, Rotation, Scale, Priority);
+	if (UNiagaraComponent* Comp = Handle.GetAs<UNiagaraComponent>())
+	{
+		SetNiagaraColor(Comp, Color);
+	}
+	return Handle;
+}
+
+ESkillVFXPriority USkillVFXSubsystem::GetEffectPriority(int32 AttackerId, int32 TargetId) const
+{
+	if (LocalCharacterId > 0 && (AttackerId == LocalCharacterId || TargetId == LocalCharacterId))
+	{
+		return ESkillVFXPriority::LocalPlayer;
+	}
+
+	if (UWorld* World = GetWorld())
+	{
+		if (const UPartySubsystem* Party = World->GetSubsystem<UPartySubsystem>())
+		{
+			if (Party->bInParty)
+			{
+				for (const FPartyMember& Member : Party->Members)
+				{
+					if (Member.CharacterId > 0 && (Member.CharacterId == AttackerId || Member.CharacterId == TargetId))
+					{
+						return ESkillVFXPriority::Party;
+					}
+				}
+			}
+		}
+	}
+	return ESkillVFXPriority::Other;
+}
+
+UFXSystemAsset* USkillVFXSubsystem::ResolveTemplateAsset(const FSkillVFXConfig& Config)
+{
+	if (!Config.VFXOverridePath.IsEmpty())
+	{
+		if (Config.bIsCascade) return GetOrLoadCascadeOverride(Config.VFXOverridePath);
+		return GetOrLoadNiagaraOverride(Config.VFXOverridePath);
+	}
+
+	switch (Config.Template)
+	{
+	case ESkillVFXTemplate::BoltFromSky:   return NS_BoltFromSky;
+	case ESkillVFXTemplate::Projectile:    return NS_Projectile;
+	case ESkillVFXTemplate::AoEImpact:     return NS_AoEImpact;
+	case ESkillVFXTemplate::GroundAoERain: return NS_GroundAoERain;
+	case ESkillVFXTemplate::HealFlash:     return NS_HealFlash;
+	default:                               return nullptr;  // attached / looping templates aren't pooled
+	}
+}
+
+void USkillVFXSubsystem::RecordZoneSkill(int32 SkillId, const FSkillVFXConfig& Config)
+{
+	if (SkillId <= 0 || Config.Template == ESkillVFXTemplate::None || ZoneName.IsEmpty()) return;
+	GetZoneSkillHistory().FindOrAdd(ZoneName).Add(SkillId);
+}
+
+void USkillVFXSubsystem::PrewarmComponentPool()
+{
+	UWorld* World = GetWorld();
+	if (!World || !ComponentPool) return;
+
+	// Skills the local character knows + skills seen cast in this zone earlier this session
+	// (monster skills included — the client has no mob skill table of its own)
+	TSet<int32> SkillIds;
+	if (const USkillTreeSubsystem* SkillTree = World->GetSubsystem<USkillTreeSubsystem>())
+	{
+		for (const auto& Pair : SkillTree->LearnedSkills)
+		{
+			if (Pair.Value > 0) SkillIds.Add(Pair.Key);
+		}
+	}
+	if (const TSet<int32>* Seen = GetZoneSkillHistory().Find(ZoneName))
+	{
+		SkillIds.Append(*Seen);
+	}
+
+	int32 NumTemplates = 0;
+	for (const int32 SkillId : SkillIds)
+	{
+		const FSkillVFXConfig& Config = SkillVFXDataHelper::GetSkillVFXConfig(SkillId);
+		if (Config.bLooping) continue;
+
+		if (UFXSystemAsset* Asset = ResolveTemplateAsset(Config))
+		{
+			// Bolts and multi-hit projectiles fire up to 10 components per cast
+			const bool bMultiHit = Config.Template == ESkillVFXTemplate::BoltFromSky
+				|| Config.Template == ESkillVFXTemplate::Projectile;
+			ComponentPool->Prewarm(Asset, bMultiHit ? 10 : 3);
+			++NumTemplates;
+		}
+	}
+	ComponentPool->Prewarm(NS_AutoAttackHit, 8);
+
+	UE_LOG(LogSkillVFX, Log, TEXT("VFX pool pre-warmed for zone '%s': %d skills -> %d templates"),
+		*ZoneName, SkillIds.Num(), NumTemplates);
+}
+
 // ============================================================
 // Actor lookup helpers
 // ============================================================
@@ -1,6 +1,7 @@
 // SkillVFXSubsystem.h — UWorldSubsystem that spawns Niagara VFX for skill effects.
 // Wraps Socket.io events (skill:cast_start, skill:effect_damage, skill:buff_applied/removed)
 // and dispatches to parameterised Niagara templates based on SkillVFXData configs.
+// One-shot effects draw their components from USkillVFXComponentPool (SkillVFXPool.h).
 
 #pragma once
 
@@ -9,12 +10,14 @@
 #include "Dom/JsonValue.h"
 #include "Dom/JsonObject.h"
 #include "SkillVFXData.h"
+#include "SkillVFXPool.h"
 #include "SkillVFXSubsystem.generated.h"
 
 class UNiagaraSystem;
 class UNiagaraComponent;
 class UParticleSystem;
 class UParticleSystemComponent;
+class UFXSystemAsset;
 class ACastingCircleActor;
 
 UCLASS()
@@ -40,11 +43,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "SkillVFX")
 	UNiagaraComponent* SpawnLoopingPortalEffect(FVector Location);
 
-	/** Spawn a brief hit impact particle at target location (auto-attack hits). */
-	void SpawnAutoAttackHitEffect(FVector Location, bool bIsCritical = false);
+	/** Spawn a brief hit impact particle at target location (auto-attack hits).
+	 *  Attacker/target ids decide the pool eviction priority (0 = unknown). */
+	void SpawnAutoAttackHitEffect(FVector Location, bool bIsCritical = false, int32 AttackerId = 0, int32 TargetId = 0);
 
 	/** Spawn an earth-colored upward burst at target feet (ranged ground attacks like Mandragora vines). */
-	void SpawnGroundStrikeEffect(FVector Location);
+	void SpawnGroundStrikeEffect(FVector Location, int32 AttackerId = 0, int32 TargetId = 0);
+
+	/** Local player involved > party member involved > everyone else. */
+	ESkillVFXPriority GetEffectPriority(int32 AttackerId, int32 TargetId = 0) const;
+
+	USkillVFXComponentPool* GetComponentPool() const { return ComponentPool; }
 
 	// ---- toggle effects (like RO's /effect command) ----
 	UFUNCTION(BlueprintCallable, Category = "SkillVFX")
@@ -66,15 +75,15 @@ private:
 	void HandleCombatHealthUpdate(const TSharedPtr<FJsonValue>& Data);
 
 	// ---- VFX spawning per template type ----
-	void SpawnBoltFromSky(FVector TargetLocation, const FSkillVFXConfig& Config, int32 TotalHits);
-	void SpawnProjectileEffect(FVector AttackerLocation, FVector TargetLocation, const FSkillVFXConfig& Config);
-	void SpawnMultiHitProjectile(FVector AttackerLocation, FVector TargetLocation, const FSkillVFXConfig& Config, int32 TotalHits);
-	void SpawnAoEImpact(FVector Location, const FSkillVFXConfig& Config);
+	void SpawnBoltFromSky(FVector TargetLocation, const FSkillVFXConfig& Config, int32 TotalHits, ESkillVFXPriority Priority);
+	void SpawnProjectileEffect(FVector AttackerLocation, FVector TargetLocation, const FSkillVFXConfig& Config, ESkillVFXPriority Priority);
+	void SpawnMultiHitProjectile(FVector AttackerLocation, FVector TargetLocation, const FSkillVFXConfig& Config, int32 TotalHits, ESkillVFXPriority Priority);
+	void SpawnAoEImpact(FVector Location, const FSkillVFXConfig& Config, ESkillVFXPriority Priority);
 	void SpawnGroundPersistent(FVector Location, const FSkillVFXConfig& Config, int32 SkillId);
-	void SpawnGroundAoERain(FVector Location, const FSkillVFXConfig& Config, int32 HitNumber);
+	void SpawnGroundAoERain(FVector Location, const FSkillVFXConfig& Config, int32 HitNumber, ESkillVFXPriority Priority);
 	void SpawnSelfBuff(AActor* TargetActor, const FSkillVFXConfig& Config, int32 SkillId, int32 TargetId);
 	void SpawnTargetDebuff(AActor* TargetActor, const FSkillVFXConfig& Config, int32 SkillId);
-	void SpawnHealFlash(FVector Location, const FSkillVFXConfig& Config);
+	void SpawnHealFlash(FVector Location, const FSkillVFXConfig& Config, ESkillVFXPriority Priority);
 
 	// ---- casting circle ----
 	void SpawnCastingCircle(int32 CasterId, FVector Location, const FSkillVFXConfig& Config, float CastDuration);
@@ -85,6 +94,10 @@ private:
 		FRotator Rotation = FRotator::ZeroRotator, FVector Scale = FVector::OneVector);
 	UNiagaraComponent* SpawnNiagaraAttached(UNiagaraSystem* System, USceneComponent* AttachTo);
 	void SetNiagaraColor(UNiagaraComponent* Comp, FLinearColor Color);
+
+	/** One-shot effect from the component pool (Niagara or Cascade). Tints Niagara with Color. */
+	FSkillVFXHandle SpawnPooledVFX(UFXSystemAsset* System, FVector Location, FRotator Rotation, FVector Scale,
+		ESkillVFXPriority Priority, FLinearColor Color = FLinearColor::White);
 	void SetNiagaraScale(UNiagaraComponent* Comp, float Scale);
 
 	// ---- actor lookup ----
@@ -141,9 +154,27 @@ private:
 
 	// ---- unified VFX spawning (handles both Niagara and Cascade) ----
 	void SpawnVFXAtLocation(const FSkillVFXConfig& Config, FVector Location,
-		FRotator Rotation = FRotator::ZeroRotator, FVector Scale = FVector::OneVector);
+		FRotator Rotation = FRotator::ZeroRotator, FVector Scale = FVector::OneVector,
+		ESkillVFXPriority Priority = ESkillVFXPriority::Other);
 	void SpawnVFXAttached(const FSkillVFXConfig& Config, USceneComponent* AttachTo);
 
+	// ---- component pool ----
+	UPROPERTY()
+	TObjectPtr<USkillVFXComponentPool> ComponentPool;
+
+	/** Asset a config's one-shot effect would spawn (override or base template). */
+	UFXSystemAsset* ResolveTemplateAsset(const FSkillVFXConfig& Config);
+
+	/** Pre-create components for the local player's skills and skills seen in this zone before. */
+	void PrewarmComponentPool();
+
+	/** Remember skills cast in the current zone so the next visit can pre-warm them. */
+	void RecordZoneSkill(int32 SkillId, const FSkillVFXConfig& Config);
+
+	FTimerHandle PoolPrewarmTimer;
+	FTimerHandle PoolSweepTimer;
+	FString ZoneName;
+
 	// ---- active effect tracking ----
 	TMap<int32, TWeakObjectPtr<ACastingCircleActor>> ActiveCastingCircles; // CasterId → Circle
 
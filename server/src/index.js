@@ -39,6 +39,8 @@ const { ZONE_REGISTRY, getZone, getAllEnemySpawns, getZoneNames } = require('./r
 // Import NavMesh pathfinding module (loads OBJ files exported from UE5, builds Detour navmeshes)
 const { initNavMeshes, findNavMeshPath, findClosestNavMeshPoint, hasNavMesh } = require('./ro_navmesh');
 const { initSpawnRegions, generateSpawnsFromPool, hasSpawnRegions } = require('./ro_spawn_regions');
+// Import binary movement channel (batched, delta-coded 'move:batch' packets replacing per-entity JSON moves)
+const { MoveBatcher, MOVE_KIND_ENEMY } = require('./ro_move_codec');
 // Import RO pre-renewal damage formulas (element table, size penalty, HIT/FLEE, critical, DEF)
 const {
     ELEMENT_TABLE, SIZE_PENALTY,
@@ -157,6 +159,21 @@ const io = new Server(server, {
     }
 });
 
+// Binary movement channel — routine enemy/player position updates are batched per zone
+// and flushed at ~30 Hz as one 'move:batch' binary attachment. Set BINARY_MOVE_CHANNEL=0
+// to fall back to the per-entity JSON 'enemy:move' / 'player:moved' events.
+const BINARY_MOVE_CHANNEL = process.env.BINARY_MOVE_CHANNEL !== '0';
+const moveBatcher = new MoveBatcher((zone, buf) => io.to('zone:' + zone).emit('move:batch', buf));
+if (BINARY_MOVE_CHANNEL) moveBatcher.start();
+
+// Client position contract ('player:position', UPositionBroadcastSubsystem):
+//   { characterId, x, y, z, yaw, moving, seq }
+// The client only sends when something changed: immediately on starting to move or turning,
+// every ~66 ms while moving in a straight line, one moving=false packet on stopping, then a
+// keepalive every ~1 s while idle. A moving player's player.lastX/lastY lags by at most one
+// steady interval; an idle player is exactly there. 'moving' is forwarded into move:batch;
+// older clients omit it and are treated as always moving.
+
 // Store connected players
 const connectedPlayers = new Map();
 
@@ -6020,6 +6037,10 @@ function broadcastToZone(zone, event, data) {
         const tgtEnemy = enemies.get(data.targetId);
         if (tgtEnemy) data.targetName = tgtEnemy.name;
     }
+    // A JSON enemy:move (teleport, knockback, snap) supersedes any batched move queued this frame
+    if (event === 'enemy:move' && data.enemyId) {
+        moveBatcher.cancel(zone, MOVE_KIND_ENEMY, data.enemyId);
+    }
     io.to('zone:' + zone).emit(event, data);
 }
 function broadcastToZoneExcept(socket, zone, event, data) {
@@ -7015,6 +7036,7 @@ io.on('connection', (socket) => {
         logger.debug(`[RECV] player:position from ${socket.id}: ${JSON.stringify(data)}`);
         const characterId = parseInt(data.characterId);
         const { x, y, z } = data;
+        const isMoving = data.moving !== false;
         const player = connectedPlayers.get(characterId);
         const characterName = player ? player.characterName : 'Unknown';
 
@@ -7183,7 +7205,7 @@ io.on('connection', (socket) => {
         }
 
         // Movement cancels casting (RO: cannot move while casting)
-        // Only interrupt if the player actually moved (client sends constant position updates even when idle)
+        // Only interrupt if the player actually moved (idle keepalives and yaw-only updates repeat the position)
         if (activeCasts.has(characterId)) {
             const lastPos = player ? { x: player.lastX, y: player.lastY, z: player.lastZ } : null;
             const MOVE_THRESHOLD = 5; // UE units — ignore sub-5-unit jitter
@@ -7344,6 +7366,12 @@ io.on('connection', (socket) => {
 
         // Broadcast to other players in same zone
         const posZone = player ? (player.zone || 'prontera_south') : 'prontera_south';
+        if (BINARY_MOVE_CHANNEL && player) {
+            // Receivers already spawned this player from the zone:ready player:moved; routine
+            // position ticks only need id/pos/weaponMode. The sender ignores its own record.
+            moveBatcher.queuePlayer(posZone, characterId, x, y, z, isMoving, player.weaponMode || 0);
+            return;
+        }
         broadcastToZoneExcept(socket, posZone, 'player:moved', {
             characterId,
             characterName,
@@ -7510,6 +7538,9 @@ io.on('connection', (socket) => {
         const { characterId, player } = playerInfo;
         const zone = player.zone || 'prontera_south';
 
+        // The new client has no move:batch baselines — next flush sends absolute positions to the zone
+        moveBatcher.resetZone(zone);
+
         // Broadcast this player's arrival to others in the zone (include equipVisuals for weapon sprites)
         broadcastToZoneExcept(socket, zone, 'player:moved', {
             characterId,
@@ -7575,6 +7606,20 @@ io.on('connection', (socket) => {
             }
         }
 
+        // Per-class sprite counts for this zone (dead ones included) so the client can
+        // pre-warm pooled sprites for respawns while the loading screen is still up.
+        // Slaves are left out — they only exist while their master has them summoned.
+        const spawnManifest = {};
+        for (const enemy of enemies.values()) {
+            if (enemy.zone !== zone || !enemy.spriteClass || enemy._isSlave) continue;
+            const counts = spawnManifest[enemy.spriteClass] || (spawnManifest[enemy.spriteClass] = { total: 0, alive: 0 });
+            counts.total++;
+            if (!enemy.isDead) counts.alive++;
+        }
+        if (Object.keys(spawnManifest).length > 0) {
+            socket.emit('zone:spawn_manifest', { zone, classes: spawnManifest });
+        }
+
         // Send all zone enemies to this client
         for (const [eid, enemy] of enemies.entries()) {
             if (!enemy.isDead && enemy.zone === zone) {
@@ -30830,8 +30875,17 @@ setInterval(() => {
         if (moveDist > 2) {
             hom._lastBroadcastX = movedX;
             hom._lastBroadcastY = movedY;
+            hom._broadcastMoving = true;
+            broadcastToZone(hom.zone || 'prontera_south', 'homunculus:position', {
+                ownerId, x: movedX, y: movedY, z: hom.z || 0,
+                moving: true, timestamp: now
+            });
+        } else if (hom._broadcastMoving) {
+            // Came to rest: one moving=false packet so clients stop here instead of extrapolating
+            hom._broadcastMoving = false;
             broadcastToZone(hom.zone || 'prontera_south', 'homunculus:position', {
-                ownerId, x: movedX, y: movedY, z: hom.z || 0
+                ownerId, x: movedX, y: movedY, z: hom.z || 0,
+                moving: false, timestamp: now
             });
         }
     }
@@ -33313,11 +33367,16 @@ function enemyMoveToward(enemy, targetX, targetY, now, speed) {
     if (now - (enemy.lastMoveBroadcast || 0) >= ENEMY_AI.MOVE_BROADCAST_MS) {
         enemy.lastMoveBroadcast = now;
         const moveZone = enemy.zone || 'prontera_south';
+        if (BINARY_MOVE_CHANNEL) {
+            moveBatcher.queueEnemy(moveZone, enemy.enemyId, enemy.x, enemy.y, enemy.z, true);
+            return;
+        }
         broadcastToZone(moveZone, 'enemy:move', {
             enemyId: enemy.enemyId,
             x: enemy.x, y: enemy.y, z: enemy.z,
             targetX, targetY,
-            isMoving: true
+            isMoving: true,
+            timestamp: now
         });
     }
 }
@@ -33325,6 +33384,10 @@ function enemyMoveToward(enemy, targetX, targetY, now, speed) {
 // Broadcast enemy stopped moving
 function enemyStopMoving(enemy) {
     const stopZone = enemy.zone || 'prontera_south';
+    if (BINARY_MOVE_CHANNEL) {
+        moveBatcher.queueEnemy(stopZone, enemy.enemyId, enemy.x, enemy.y, enemy.z, false);
+        return;
+    }
     broadcastToZone(stopZone, 'enemy:move', {
         enemyId: enemy.enemyId,
         x: enemy.x, y: enemy.y, z: enemy.z,
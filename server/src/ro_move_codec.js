@@ -0,0 +1,275 @@
+// ============================================================
+// Binary Movement Channel — compact 'move:batch' packets
+// Replaces per-entity JSON 'enemy:move' / 'player:moved' position
+// updates with one binary Socket.io attachment per zone per flush.
+//
+// Wire format (little-endian), version 1:
+//   u8   version
+//   u8   reserved (0)
+//   u16  record count
+//   u32  server time (Date.now() mod 2^32)
+//   records[count]:
+//     u8      header   bit0 kind (0=enemy, 1=player)
+//                      bit1 absolute (else delta vs. last sent position)
+//                      bit2 isMoving
+//                      bit3 weaponMode byte follows
+//     varint  entity id
+//     zigzag varint x, y, z   (absolute or delta, in POSITION_QUANTUM units)
+//     [u8     weaponMode]
+//
+// Deltas are coded against the last position SENT to the zone (per-zone
+// baseline), so every client in the room shares the same reference. A zone's
+// baselines are dropped when a client joins it (zone:ready) and every
+// KEYFRAME_INTERVAL_MS, which forces absolute records for everyone.
+//
+// The client decoder lives in client/.../MoveBatchCodec.cpp — keep in sync.
+//
+// Usage:
+//   const batcher = new MoveBatcher((zone, buf) => io.to('zone:' + zone).emit('move:batch', buf));
+//   batcher.queueEnemy(zone, enemy.enemyId, x, y, z, isMoving);
+//   batcher.start();
+// ============================================================
+
+'use strict';
+
+const MOVE_BATCH_VERSION   = 1;
+const MOVE_KIND_ENEMY      = 0;
+const MOVE_KIND_PLAYER     = 1;
+
+const FLAG_KIND_PLAYER     = 0x01;
+const FLAG_ABSOLUTE        = 0x02;
+const FLAG_MOVING          = 0x04;
+const FLAG_WEAPON_MODE     = 0x08;
+
+const POSITION_QUANTUM     = 1;      // UE units per quantization step
+const HEADER_BYTES         = 8;
+const MAX_RECORD_BYTES     = 1 + 5 + 3 * 5 + 1;
+const MAX_RECORDS_PER_PACKET = 0xFFFF;
+
+const MOVE_BATCH_INTERVAL_MS = 33;   // ~30 Hz flush
+const KEYFRAME_INTERVAL_MS   = 5000;
+
+// ─── Varint helpers ──────────────────────────────────────────
+
+function zigzag(n) {
+    return n >= 0 ? n * 2 : -n * 2 - 1;
+}
+
+function unzigzag(n) {
+    return (n & 1) ? -(n + 1) / 2 : n / 2;
+}
+
+function writeVarint(buf, offset, value) {
+    // value is a non-negative integer < 2^35
+    while (value >= 0x80) {
+        buf[offset++] = (value & 0x7F) | 0x80;
+        value = Math.floor(value / 128);
+    }
+    buf[offset++] = value;
+    return offset;
+}
+
+function readVarint(buf, state) {
+    let result = 0;
+    let scale = 1;
+    for (let i = 0; i < 5; i++) {
+        if (state.offset >= buf.length) throw new Error('move:batch truncated varint');
+        const byte = buf[state.offset++];
+        result += (byte & 0x7F) * scale;
+        if ((byte & 0x80) === 0) return result;
+        scale *= 128;
+    }
+    throw new Error('move:batch varint too long');
+}
+
+function quantize(v) {
+    return Math.round((v || 0) / POSITION_QUANTUM);
+}
+
+function baselineKey(kind, id) {
+    return kind * 0x100000000 + (id >>> 0);
+}
+
+// ─── Encode / decode ─────────────────────────────────────────
+
+/**
+ * Encode records into one move:batch Buffer.
+ * @param {Array<{kind, id, x, y, z, isMoving, weaponMode?}>} records
+ * @param {Map} baselines  key → { x, y, z, weaponMode } (quantized); updated in place
+ * @param {number} serverTimeMs
+ */
+function encodeMoveBatch(records, baselines, serverTimeMs = Date.now()) {
+    const count = Math.min(records.length, MAX_RECORDS_PER_PACKET);
+    const buf = Buffer.allocUnsafe(HEADER_BYTES + count * MAX_RECORD_BYTES);
+    buf.writeUInt8(MOVE_BATCH_VERSION, 0);
+    buf.writeUInt8(0, 1);
+    buf.writeUInt16LE(count, 2);
+    buf.writeUInt32LE((serverTimeMs >>> 0), 4);
+
+    let offset = HEADER_BYTES;
+    for (let i = 0; i < count; i++) {
+        const r = records[i];
+        const key = baselineKey(r.kind, r.id);
+        const qx = quantize(r.x), qy = quantize(r.y), qz = quantize(r.z);
+        const base = baselines.get(key);
+
+        let header = r.kind === MOVE_KIND_PLAYER ? FLAG_KIND_PLAYER : 0;
+        if (!base) header |= FLAG_ABSOLUTE;
+        if (r.isMoving) header |= FLAG_MOVING;
+        const hasWeaponMode = r.kind === MOVE_KIND_PLAYER && r.weaponMode !== undefined
+            && (!base || base.weaponMode !== r.weaponMode);
+        if (hasWeaponMode) header |= FLAG_WEAPON_MODE;
+
+        buf[offset++] = header;
+        offset = writeVarint(buf, offset, r.id >>> 0);
+        if (base) {
+            offset = writeVarint(buf, offset, zigzag(qx - base.x));
+            offset = writeVarint(buf, offset, zigzag(qy - base.y));
+            offset = writeVarint(buf, offset, zigzag(qz - base.z));
+        } else {
+            offset = writeVarint(buf, offset, zigzag(qx));
+            offset = writeVarint(buf, offset, zigzag(qy));
+            offset = writeVarint(buf, offset, zigzag(qz));
+        }
+        if (hasWeaponMode) buf[offset++] = r.weaponMode & 0xFF;
+
+        baselines.set(key, {
+            x: qx, y: qy, z: qz,
+            weaponMode: hasWeaponMode ? r.weaponMode : (base ? base.weaponMode : undefined),
+        });
+    }
+    return buf.subarray(0, offset);
+}
+
+/**
+ * Decode a move:batch Buffer (mirror of the C++ FMoveBatchCodec::Decode — used by tests/tools).
+ * Delta records without a baseline are returned with valid=false.
+ */
+function decodeMoveBatch(buf, baselines) {
+    if (buf.length < HEADER_BYTES) throw new Error('move:batch too short');
+    const version = buf.readUInt8(0);
+    if (version !== MOVE_BATCH_VERSION) throw new Error(`move:batch version ${version} unsupported`);
+    const count = buf.readUInt16LE(2);
+    const serverTimeMs = buf.readUInt32LE(4);
+
+    const state = { offset: HEADER_BYTES };
+    const records = [];
+    for (let i = 0; i < count; i++) {
+        const header = buf[state.offset++];
+        const kind = (header & FLAG_KIND_PLAYER) ? MOVE_KIND_PLAYER : MOVE_KIND_ENEMY;
+        const id = readVarint(buf, state);
+        const vx = unzigzag(readVarint(buf, state));
+        const vy = unzigzag(readVarint(buf, state));
+        const vz = unzigzag(readVarint(buf, state));
+        const weaponMode = (header & FLAG_WEAPON_MODE) ? buf[state.offset++] : undefined;
+
+        const key = baselineKey(kind, id);
+        const base = baselines.get(key);
+        let valid = true, qx = vx, qy = vy, qz = vz;
+        if (!(header & FLAG_ABSOLUTE)) {
+            if (!base) { valid = false; }
+            else { qx += base.x; qy += base.y; qz += base.z; }
+        }
+        const wm = weaponMode !== undefined ? weaponMode : (base ? base.weaponMode : undefined);
+        if (valid) baselines.set(key, { x: qx, y: qy, z: qz, weaponMode: wm });
+
+        records.push({
+            kind, id, valid,
+            x: qx * POSITION_QUANTUM, y: qy * POSITION_QUANTUM, z: qz * POSITION_QUANTUM,
+            isMoving: (header & FLAG_MOVING) !== 0,
+            weaponMode: wm,
+        });
+    }
+    return { serverTimeMs, records };
+}
+
+// ─── Per-zone batcher ────────────────────────────────────────
+
+class MoveBatcher {
+    /**
+     * @param {(zone: string, buf: Buffer) => void} emitFn  sends one packet to a zone room
+     */
+    constructor(emitFn, { intervalMs = MOVE_BATCH_INTERVAL_MS, keyframeMs = KEYFRAME_INTERVAL_MS } = {}) {
+        this.emitFn = emitFn;
+        this.intervalMs = intervalMs;
+        this.keyframeMs = keyframeMs;
+        this.zones = new Map();   // zone → { pending: Map<key, record>, baselines: Map, lastKeyframe }
+        this.timer = null;
+        this.stats = { packets: 0, records: 0, bytes: 0 };
+    }
+
+    _zone(zone) {
+        let z = this.zones.get(zone);
+        if (!z) {
+            z = { pending: new Map(), baselines: new Map(), lastKeyframe: Date.now() };
+            this.zones.set(zone, z);
+        }
+        return z;
+    }
+
+    queueEnemy(zone, enemyId, x, y, z, isMoving) {
+        // Latest state wins — at most one record per entity per flush
+        this._zone(zone).pending.set(baselineKey(MOVE_KIND_ENEMY, enemyId),
+            { kind: MOVE_KIND_ENEMY, id: enemyId, x, y, z, isMoving: !!isMoving });
+    }
+
+    queuePlayer(zone, characterId, x, y, z, isMoving, weaponMode) {
+        this._zone(zone).pending.set(baselineKey(MOVE_KIND_PLAYER, characterId),
+            { kind: MOVE_KIND_PLAYER, id: characterId, x, y, z, isMoving: !!isMoving, weaponMode: weaponMode || 0 });
+    }
+
+    /** Drop a queued record (e.g. entity teleported via a JSON event in the same frame). */
+    cancel(zone, kind, id) {
+        const z = this.zones.get(zone);
+        if (z) z.pending.delete(baselineKey(kind, id));
+    }
+
+    /** Force absolute records for the zone on the next flush (a client just joined it). */
+    resetZone(zone) {
+        const z = this.zones.get(zone);
+        if (z) {
+            z.baselines.clear();
+            z.lastKeyframe = Date.now();
+        }
+    }
+
+    flush(now = Date.now()) {
+        for (const [zone, z] of this.zones.entries()) {
+            if (now - z.lastKeyframe >= this.keyframeMs) {
+                z.baselines.clear();
+                z.lastKeyframe = now;
+            }
+            if (z.pending.size === 0) continue;
+
+            const records = Array.from(z.pending.values());
+            z.pending.clear();
+            for (let start = 0; start < records.length; start += MAX_RECORDS_PER_PACKET) {
+                const chunk = records.slice(start, start + MAX_RECORDS_PER_PACKET);
+                const buf = encodeMoveBatch(chunk, z.baselines, now);
+                this.stats.packets++;
+                this.stats.records += chunk.length;
+                this.stats.bytes += buf.length;
+                this.emitFn(zone, buf);
+            }
+        }
+    }
+
+    start() {
+        if (!this.timer) this.timer = setInterval(() => this.flush(), this.intervalMs);
+    }
+
+    stop() {
+        if (this.timer) { clearInterval(this.timer); this.timer = null; }
+    }
+}
+
+module.exports = {
+    MOVE_BATCH_VERSION,
+    MOVE_KIND_ENEMY,
+    MOVE_KIND_PLAYER,
+    POSITION_QUANTUM,
+    MOVE_BATCH_INTERVAL_MS,
+    encodeMoveBatch,
+    decodeMoveBatch,
+    MoveBatcher,
+};
@@ -0,0 +1,201 @@
+/**
+ * test_move_codec.js — Binary movement channel (move:batch) verification
+ *
+ * Round-trips ro_move_codec encode/decode (absolute + delta records, weapon mode,
+ * keyframe reset, missing-baseline handling) and reports bytes per entity per
+ * second against the JSON enemy:move / player:moved baseline.
+ *
+ * Run: node server/tests/test_move_codec.js
+ */
+
+'use strict';
+
+const {
+    MOVE_KIND_ENEMY, MOVE_KIND_PLAYER, POSITION_QUANTUM,
+    encodeMoveBatch, decodeMoveBatch, MoveBatcher
+} = require('../src/ro_move_codec.js');
+
+let passed = 0;
+let failed = 0;
+const failures = [];
+
+function assert(condition, message) {
+    if (condition) {
+        passed++;
+    } else {
+        failed++;
+        failures.push(message);
+        console.log(`  FAIL: ${message}`);
+    }
+}
+
+function assertEqual(actual, expected, message) {
+    if (actual === expected) {
+        passed++;
+    } else {
+        failed++;
+        const msg = `${message} — expected ${expected}, got ${actual}`;
+        failures.push(msg);
+        console.log(`  FAIL: ${msg}`);
+    }
+}
+
+// Deterministic PRNG so byte counts are stable run to run
+let seed = 12345;
+function rand() {
+    seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+    return seed / 0x7fffffff;
+}
+
+// ============================================================
+// Test 1: Absolute round trip
+// ============================================================
+console.log('\n=== Test 1: Absolute Round Trip ===');
+{
+    const enc = new Map(), dec = new Map();
+    const records = [
+        { kind: MOVE_KIND_ENEMY, id: 2000001, x: 1234.4, y: -5678.6, z: 300, isMoving: true },
+        { kind: MOVE_KIND_PLAYER, id: 42, x: -100000, y: 100000, z: 580, isMoving: false, weaponMode: 2 },
+    ];
+    const buf = encodeMoveBatch(records, enc, 0xDEADBEEF);
+    const out = decodeMoveBatch(buf, dec);
+    assertEqual(out.serverTimeMs, 0xDEADBEEF, 'Server time survives round trip');
+    assertEqual(out.records.length, 2, 'Record count');
+    assertEqual(out.records[0].id, 2000001, 'Enemy id');
+    assertEqual(out.records[0].kind, MOVE_KIND_ENEMY, 'Enemy kind');
+    assertEqual(out.records[0].x, 1234, 'Enemy x quantized');
+    assertEqual(out.records[0].y, -5679, 'Enemy y quantized');
+    assert(out.records[0].isMoving, 'Enemy isMoving');
+    assertEqual(out.records[1].kind, MOVE_KIND_PLAYER, 'Player kind');
+    assertEqual(out.records[1].x, -100000, 'Player x (large negative)');
+    assertEqual(out.records[1].y, 100000, 'Player y (large positive)');
+    assertEqual(out.records[1].weaponMode, 2, 'Player weapon mode');
+    assert(!out.records[1].isMoving, 'Player isMoving=false');
+}
+
+// ============================================================
+// Test 2: Delta round trip over many frames
+// ============================================================
+console.log('\n=== Test 2: Delta Round Trip ===');
+{
+    const enc = new Map(), dec = new Map();
+    const ents = [];
+    for (let i = 0; i < 50; i++) {
+        ents.push({ kind: i % 5 === 0 ? MOVE_KIND_PLAYER : MOVE_KIND_ENEMY, id: 2000000 + i,
+            x: rand() * 20000 - 10000, y: rand() * 20000 - 10000, z: 300 + rand() * 50, weaponMode: 1 });
+    }
+    let maxErr = 0, invalid = 0;
+    for (let frame = 0; frame < 90; frame++) {
+        for (const e of ents) { e.x += rand() * 20 - 10; e.y += rand() * 20 - 10; e.isMoving = true; }
+        const out = decodeMoveBatch(encodeMoveBatch(ents, enc, frame), dec);
+        out.records.forEach((r, i) => {
+            if (!r.valid) invalid++;
+            maxErr = Math.max(maxErr, Math.abs(r.x - ents[i].x), Math.abs(r.y - ents[i].y), Math.abs(r.z - ents[i].z));
+        });
+    }
+    assertEqual(invalid, 0, 'No unresolved deltas when decoder saw every packet');
+    assert(maxErr <= POSITION_QUANTUM / 2 + 1e-9, `Max position error ${maxErr.toFixed(3)} within half a quantum`);
+}
+
+// ============================================================
+// Test 3: Weapon mode only sent on change
+// ============================================================
+console.log('\n=== Test 3: Weapon Mode Delta ===');
+{
+    const enc = new Map(), dec = new Map();
+    const p = { kind: MOVE_KIND_PLAYER, id: 7, x: 0, y: 0, z: 0, isMoving: true, weaponMode: 1 };
+    const first = encodeMoveBatch([p], enc, 0);
+    p.x = 5;
+    const same = encodeMoveBatch([p], enc, 0);
+    p.weaponMode = 3;
+    const changed = encodeMoveBatch([p], enc, 0);
+    assertEqual(changed.length, same.length + 1, 'Weapon mode byte only present when it changes');
+    decodeMoveBatch(first, dec);
+    decodeMoveBatch(same, dec);
+    const out = decodeMoveBatch(changed, dec);
+    assertEqual(out.records[0].weaponMode, 3, 'Decoded weapon mode after change');
+}
+
+// ============================================================
+// Test 4: Late joiner / keyframe
+// ============================================================
+console.log('\n=== Test 4: Late Joiner + Keyframe ===');
+{
+    const sent = [];
+    const batcher = new MoveBatcher((zone, buf) => sent.push(buf), { keyframeMs: 1e9 });
+    batcher.queueEnemy('prontera', 2000001, 100, 100, 300, true);
+    batcher.flush(1000);
+    batcher.queueEnemy('prontera', 2000001, 110, 100, 300, true);
+    batcher.flush(1033);
+
+    const lateDecoder = new Map();
+    const late = decodeMoveBatch(sent[1], lateDecoder);
+    assert(!late.records[0].valid, 'Delta without baseline is flagged invalid');
+
+    batcher.resetZone('prontera');
+    batcher.queueEnemy('prontera', 2000001, 120, 100, 300, true);
+    batcher.flush(1066);
+    const after = decodeMoveBatch(sent[2], lateDecoder);
+    assert(after.records[0].valid, 'Record after resetZone is absolute');
+    assertEqual(after.records[0].x, 120, 'Absolute x after resetZone');
+
+    batcher.queueEnemy('prontera', 2000001, 130, 100, 300, true);
+    batcher.queueEnemy('prontera', 2000001, 140, 100, 300, false);
+    batcher.flush(1100);
+    const coalesced = decodeMoveBatch(sent[3], lateDecoder);
+    assertEqual(coalesced.records.length, 1, 'Multiple queues per flush coalesce to one record');
+    assertEqual(coalesced.records[0].x, 140, 'Latest queued position wins');
+
+    batcher.queueEnemy('prontera', 2000001, 150, 100, 300, true);
+    batcher.cancel('prontera', MOVE_KIND_ENEMY, 2000001);
+    batcher.flush(1133);
+    assertEqual(sent.length, 4, 'Cancelled record is not sent');
+}
+
+// ============================================================
+// Test 5: Bandwidth vs JSON baseline
+// ============================================================
+console.log('\n=== Test 5: Bytes per Entity per Second ===');
+{
+    const ENTITIES = 200, HZ = 30, SECONDS = 5;
+    const enc = new Map();
+    const ents = [];
+    for (let i = 0; i < ENTITIES; i++) {
+        ents.push({ kind: MOVE_KIND_ENEMY, id: 2000000 + i, x: rand() * 20000, y: rand() * 20000, z: 300, isMoving: true,
+            heading: rand() * Math.PI * 2 });
+    }
+    let binaryBytes = 0, jsonBytes = 0;
+    for (let f = 0; f < HZ * SECONDS; f++) {
+        for (const e of ents) {
+            // ~200 units/s walk speed
+            e.x += Math.cos(e.heading) * 200 / HZ;
+            e.y += Math.sin(e.heading) * 200 / HZ;
+        }
+        // Socket.io frame: 451-["move:batch",{"_placeholder":true,"num":0}] + binary attachment
+        binaryBytes += encodeMoveBatch(ents, enc, f).length + 45;
+        for (const e of ents) {
+            // Socket.io text frame: 42["enemy:move",{...}]
+            jsonBytes += Buffer.byteLength('42' + JSON.stringify(['enemy:move',
+                { enemyId: e.id, x: e.x, y: e.y, z: e.z, targetX: e.x, targetY: e.y, isMoving: true }]));
+        }
+    }
+    const perEntBinary = binaryBytes / ENTITIES / SECONDS;
+    const perEntJson = jsonBytes / ENTITIES / SECONDS;
+    console.log(`  JSON   enemy:move: ${perEntJson.toFixed(0)} bytes/entity/s`);
+    console.log(`  Binary move:batch: ${perEntBinary.toFixed(0)} bytes/entity/s (${(perEntJson / perEntBinary).toFixed(1)}x smaller)`);
+    assert(perEntBinary * 4 < perEntJson, 'Binary channel at least 4x smaller than JSON');
+}
+
+// ============================================================
+// Results Summary
+// ============================================================
+console.log('\n========================================');
+console.log(`RESULTS: ${passed} passed, ${failed} failed`);
+console.log('========================================');
+
+if (failures.length > 0) {
+    console.log('\nFailed tests:');
+    failures.forEach((f, i) => console.log(`  ${i + 1}. ${f}`));
+}
+
+process.exit(failed > 0 ? 1 : 0);